@@ -55,7 +55,7 @@ AudioManagerAirplay::~AudioManagerAirplay()
 EGEResult AudioManagerAirplay::construct()
 {
   // subscribe for event notifications
-  if ( ! app()->eventManager()->addListener(this))
+  if ( ! app()->eventManager()->addListener(this, EGE_EVENT_ID_CORE_QUIT_REQUEST))
   {
     // error!
     return EGE_ERROR;
@@ -134,9 +134,9 @@ IAudioManager::EState AudioManagerAirplay::state() const
   return m_state;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void AudioManagerAirplay::onEventRecieved(PEvent event)
+void AudioManagerAirplay::onEventRecieved(const Event& event)
 {
-  switch (event->id())
+  switch (event.id())
   {
     case EGE_EVENT_ID_CORE_QUIT_REQUEST:
 
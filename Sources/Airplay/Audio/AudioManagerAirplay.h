@@ -49,7 +49,7 @@ class AudioManagerAirplay : public Object, public IAudioManagerBase, public IAud
   private:
 
     /*! @ see IEventListener::onEventRecieved. */
-    void onEventRecieved(PEvent event) override;
+    void onEventRecieved(const Event& event) override;
     /*! Shuts down. */
     void shutDown();
 
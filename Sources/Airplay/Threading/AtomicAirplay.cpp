@@ -3,14 +3,35 @@
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void egeAtomicIncrement(volatile u32& value)
+u32 egeAtomicIncrement(volatile u32& value)
 {
-  ++value;
+  return ++value;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void egeAtomicDecrement(volatile u32& value)
+u32 egeAtomicDecrement(volatile u32& value)
 {
-  --value;
+  return --value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 egeAtomicAdd(volatile u32& value, s32 delta)
+{
+  return value += delta;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 egeAtomicLoad(volatile u32& value)
+{
+  return value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool egeAtomicCompareAndSet(volatile u32& value, u32 compareValue, u32 newValue)
+{
+  if (value == compareValue)
+  {
+    value = newValue;
+    return true;
+  }
+
+  return false;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
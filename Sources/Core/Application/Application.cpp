@@ -16,6 +16,8 @@
 #include "Core/Audio/Interface/AudioManager.h"
 #include "Core/Audio/Interface/Null/AudioManagerNull.h"
 #include "Core/Graphics/Image/ImageLoader.h"
+#include "Core/Threading/JobSystem.h"
+#include "Core/Application/UpdateGraph.h"
 #include "EGEDebug.h"
 #include "EGEDeviceServices.h"
 #include "EGEPurchaseServices.h"
@@ -33,6 +35,8 @@
 #elif EGE_PLATFORM_IOS
   #include "iOS/Application/ApplicationIOS_p.h"
   #include "iOS/Audio/Interface/OpenAL/AudioManagerOpenALIOS.h"
+#elif EGE_PLATFORM_POSIX
+  #include "Posix/Application/ApplicationPosix_p.h"
 #endif // EGE_PLATFORM_WIN32
 
 EGE_NAMESPACE_BEGIN
@@ -56,6 +60,8 @@ Application::Application() : IEventListener(),
                              m_purchaseServices(NULL),
                              m_socialServices(NULL),
                              m_imageLoader(NULL),
+                             m_jobSystem(NULL),
+                             m_updateGraph(NULL),
                              m_landscapeMode(false),
                              m_language("en"),
                              m_updateInterval(0LL),
@@ -66,6 +72,9 @@ Application::Application() : IEventListener(),
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Application::~Application()
 {
+  // NOTE: job system goes first so no job can access any subsystem being destroyed
+  EGE_DELETE(m_jobSystem);
+  EGE_DELETE(m_updateGraph);
   EGE_DELETE(m_imageLoader);
   EGE_DELETE(m_sceneManager);
   EGE_DELETE(m_imageLoader);
@@ -92,6 +101,8 @@ EGEResult Application::construct(const Dictionary& params)
   Dictionary::const_iterator iterLandscape  = params.find(EGE_ENGINE_PARAM_LANDSCAPE_MODE);
   Dictionary::const_iterator iterUPS        = params.find(EGE_ENGINE_PARAM_UPDATES_PER_SECOND);
   Dictionary::const_iterator iterFPS        = params.find(EGE_ENGINE_PARAM_RENDERS_PER_SECOND);
+  Dictionary::const_iterator iterWorkers    = params.find(EGE_ENGINE_PARAM_JOB_WORKERS);
+  Dictionary::const_iterator iterParallel   = params.find(EGE_ENGINE_PARAM_PARALLEL_UPDATE);
 
   // check if update rate is given
   if (iterUPS != params.end())
@@ -160,6 +171,20 @@ EGEResult Application::construct(const Dictionary& params)
     return result;
   }
 
+  // create job system
+  m_jobSystem = ege_new JobSystem(this);
+  if (NULL == m_jobSystem)
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  if (EGE_SUCCESS != (result = m_jobSystem->construct((iterWorkers != params.end()) ? iterWorkers->second.toInt() : -1)))
+  {
+    // error!
+    return result;
+  }
+
   // create image loader
   m_imageLoader = ege_new ImageLoader(this);
   if (NULL == m_imageLoader)
@@ -293,8 +318,48 @@ EGEResult Application::construct(const Dictionary& params)
     return result;
   }
 
+  // create update graph
+  m_updateGraph = ege_new UpdateGraph(this, m_jobSystem);
+  if (NULL == m_updateGraph)
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  // declare frame update stages
+  // NOTE: stages interacting with rendering context or delivering resource notifications stay on main thread
+  // NOTE: physics interpolation is synchronization point for threaded simulation, steps requested by physics stage are processed while frame is rendered
+  // NOTE: screens populate scene and overlays and send events so scene and overlays are updated once screens are done
+  // NOTE: application stage accesses everything so it is executed once all other stages are done
+  m_updateGraph->addStage("physics", ege_make_slot(this, Application::onUpdatePhysics), UpdateGraph::DOMAIN_NONE, UpdateGraph::DOMAIN_PHYSICS, 
+                          UpdateGraph::STAGE_FLAG_MAIN_THREAD);
+  m_updateGraph->addStage("graphics", ege_make_slot(this, Application::onUpdateGraphics), UpdateGraph::DOMAIN_NONE, UpdateGraph::DOMAIN_GRAPHICS, 
+                          UpdateGraph::STAGE_FLAG_MAIN_THREAD);
+  m_updateGraph->addStage("image-loader", ege_make_slot(this, Application::onUpdateImageLoader), UpdateGraph::DOMAIN_NONE, UpdateGraph::DOMAIN_IMAGES,
+                          UpdateGraph::STAGE_FLAG_MAIN_THREAD);
+  m_updateGraph->addStage("resources", ege_make_slot(this, Application::onUpdateResources), UpdateGraph::DOMAIN_IMAGES, 
+                          UpdateGraph::DOMAIN_RESOURCES | UpdateGraph::DOMAIN_GRAPHICS, UpdateGraph::STAGE_FLAG_MAIN_THREAD);
+  m_updateGraph->addStage("audio", ege_make_slot(this, Application::onUpdateAudio), UpdateGraph::DOMAIN_RESOURCES, UpdateGraph::DOMAIN_AUDIO);
+  m_updateGraph->addStage("sequencers", ege_make_slot(this, Application::onUpdateSequencers), UpdateGraph::DOMAIN_NONE, UpdateGraph::DOMAIN_SEQUENCERS);
+  m_updateGraph->addStage("screens", ege_make_slot(this, Application::onUpdateScreens), UpdateGraph::DOMAIN_RESOURCES, 
+                          UpdateGraph::DOMAIN_SCREENS | UpdateGraph::DOMAIN_SCENE | UpdateGraph::DOMAIN_OVERLAYS | UpdateGraph::DOMAIN_EVENTS);
+  m_updateGraph->addStage("physics-interpolation", ege_make_slot(this, Application::onInterpolatePhysics), UpdateGraph::DOMAIN_NONE, 
+                          UpdateGraph::DOMAIN_PHYSICS, UpdateGraph::STAGE_FLAG_MAIN_THREAD);
+  m_updateGraph->addStage("scene", ege_make_slot(this, Application::onUpdateScene), UpdateGraph::DOMAIN_RESOURCES | UpdateGraph::DOMAIN_PHYSICS, 
+                          UpdateGraph::DOMAIN_SCENE);
+  m_updateGraph->addStage("overlays", ege_make_slot(this, Application::onUpdateOverlays), UpdateGraph::DOMAIN_RESOURCES, UpdateGraph::DOMAIN_OVERLAYS);
+  m_updateGraph->addStage("application", ege_make_slot(this, Application::onUpdateApplication), UpdateGraph::DOMAIN_ALL, UpdateGraph::DOMAIN_ALL,
+                          UpdateGraph::STAGE_FLAG_MAIN_THREAD);
+
+  // check if stages are to be executed serially
+  if (iterParallel != params.end())
+  {
+    m_updateGraph->setParallel(iterParallel->second.toBool());
+  }
+
   // subscribe for event notifications
-  if ( ! eventManager()->addListener(this))
+  if ( ! eventManager()->addListener(this, EGE_EVENT_ID_CORE_QUIT_REQUEST) || ! eventManager()->addListener(this, EGE_EVENT_ID_CORE_APP_PAUSE) ||
+       ! eventManager()->addListener(this, EGE_EVENT_ID_CORE_APP_RESUME))
   {
     // error!
     return EGE_ERROR;
@@ -348,29 +413,9 @@ void Application::update()
   }
   else if (STATE_RUNNING == m_state)
   {
-    // update accumulator for updates
-    m_updateAccumulator += timeInterval;
-
-    // update as much as requested
-    while (m_updateAccumulator > m_updateInterval)
-    {
-      m_updateAccumulator -= m_updateInterval;
-      physicsManager()->update(m_updateInterval);
-    }
-
-    graphics()->update();
-    imageLoader()->update(m_updateInterval);
-    resourceManager()->update(timeInterval);
-
-    audioManager()->update(timeInterval);
-    screenManager()->update(timeInterval);
-    sceneManager()->update(timeInterval);
-    overlayManager()->update(timeInterval);
-
-    update(timeInterval);
-
-    // interpolate physics by remaining value
-    // ..
+    // update all stages
+    // NOTE: this returns once all stages are done so nothing is being updated while rendering
+    m_updateGraph->update(timeInterval);
   }
 
   // store update duration
@@ -382,6 +427,85 @@ void Application::update(const Time& time)
   EGE_UNUSED(time);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onUpdatePhysics(const Time& time)
+{
+  // update accumulator for updates
+  m_updateAccumulator += time;
+
+  // update as much as requested
+  while (m_updateAccumulator > m_updateInterval)
+  {
+    m_updateAccumulator -= m_updateInterval;
+    physicsManager()->update(m_updateInterval);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onInterpolatePhysics(const Time& time)
+{
+  EGE_UNUSED(time);
+
+  // interpolate physics by remaining value
+  // NOTE: this blends rendered transformations between two last simulation steps so physics can run at lower rate than rendering
+  if (0 < m_updateInterval.microseconds())
+  {
+    physicsManager()->interpolate(m_updateAccumulator.seconds() / m_updateInterval.seconds());
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onUpdateGraphics(const Time& time)
+{
+  EGE_UNUSED(time);
+
+  graphics()->update();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onUpdateImageLoader(const Time& time)
+{
+  EGE_UNUSED(time);
+
+  imageLoader()->update(m_updateInterval);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onUpdateResources(const Time& time)
+{
+  resourceManager()->update(time);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onUpdateAudio(const Time& time)
+{
+  audioManager()->update(time);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onUpdateSequencers(const Time& time)
+{
+  // NOTE: iterate over copy as sequencers can be added or removed from within signal handlers
+  const SequencerArray sequencers = m_sequencers;
+  for (SequencerArray::const_iterator it = sequencers.begin(); it != sequencers.end(); ++it)
+  {
+    (*it)->update(time);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onUpdateScreens(const Time& time)
+{
+  screenManager()->update(time);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onUpdateScene(const Time& time)
+{
+  sceneManager()->update(time);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onUpdateOverlays(const Time& time)
+{
+  overlayManager()->update(time);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::onUpdateApplication(const Time& time)
+{
+  update(time);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Application::render()
 {
   if (STATE_RUNNING == m_state)
@@ -416,6 +540,19 @@ void Application::setLanguage(const String& language)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::addSequencer(const PSequencer& sequencer)
+{
+  if ((NULL != sequencer) && ! m_sequencers.contains(sequencer))
+  {
+    m_sequencers.push_back(sequencer);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Application::removeSequencer(const PSequencer& sequencer)
+{
+  m_sequencers.remove(sequencer);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Application::quit()
 {
   eventManager()->send(EGE_EVENT_ID_CORE_QUIT_REQUEST);
@@ -426,9 +563,9 @@ bool Application::isQuitting() const
   return (STATE_QUIT == state()) || (STATE_QUITTING == state());
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void Application::onEventRecieved(PEvent event)
+void Application::onEventRecieved(const Event& event)
 {
-  switch (event->id())
+  switch (event.id())
   {
     case EGE_EVENT_ID_CORE_QUIT_REQUEST:
 
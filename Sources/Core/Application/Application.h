@@ -6,6 +6,8 @@
 #include "EGESignal.h"
 #include "EGEDictionary.h"
 #include "EGEVersion.h"
+#include "EGEDynamicArray.h"
+#include "EGESequencer.h"
 #include "Core/Event/EventListener.h"
 
 EGE_NAMESPACE_BEGIN
@@ -25,6 +27,8 @@ class ImageLoader;
 class IAudioManager;
 class SocialServices;
 class PurchaseServices;
+class JobSystem;
+class UpdateGraph;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class Application : public IEventListener
 {
@@ -114,6 +118,12 @@ class Application : public IEventListener
     SocialServices* socialServices() const;
     /*! Returns image loader object. */
     ImageLoader* imageLoader() const;
+    /*! Returns job system. */
+    JobSystem* jobSystem() const;
+    /*! Returns frame update graph. 
+     *  @note Graph can be used to inspect per-stage timings or to add application specific stages.
+     */
+    UpdateGraph* updateGraph() const;
 
     /*! Returns TRUE if landscape mode is enabled. */
     bool isLandscape() const;
@@ -127,6 +137,14 @@ class Application : public IEventListener
     /*! Returns last frame update duration. */
     const Time& lastFrameUpdateDuration() const;
 
+    /*! Adds sequencer to be updated every frame while application is running. 
+     *  @note Sequencer signals are emitted from sequencers update stage. If parallel update is enabled, they may be emitted from worker thread while 
+     *        audio, scene and overlays are being updated.
+     */
+    void addSequencer(const PSequencer& sequencer);
+    /*! Removes sequencer from the list of updated ones. */
+    void removeSequencer(const PSequencer& sequencer);
+
   protected:
 
     /*! Application updater. */
@@ -134,7 +152,11 @@ class Application : public IEventListener
     /*! Application renderer. */
     virtual void render();
     /*! @see IEventListener::onEventRecieved. */
-    void onEventRecieved(PEvent pEvent) override;
+    void onEventRecieved(const Event& event) override;
+
+  private:
+
+    typedef DynamicArray<PSequencer> SequencerArray;
 
   private:
 
@@ -149,6 +171,28 @@ class Application : public IEventListener
     void onGroupLoadComplete(const String& name);
     /*! Slot called when resource group could not be loaded. */
     void onGroupLoadError(const String& name);
+    /*! Update stage updating physics. */
+    void onUpdatePhysics(const Time& time);
+    /*! Update stage interpolating physics results for the rest of the frame. */
+    void onInterpolatePhysics(const Time& time);
+    /*! Update stage updating graphics. */
+    void onUpdateGraphics(const Time& time);
+    /*! Update stage updating image loader. */
+    void onUpdateImageLoader(const Time& time);
+    /*! Update stage updating resources. */
+    void onUpdateResources(const Time& time);
+    /*! Update stage updating audio. */
+    void onUpdateAudio(const Time& time);
+    /*! Update stage updating registered sequencers. */
+    void onUpdateSequencers(const Time& time);
+    /*! Update stage updating screens. */
+    void onUpdateScreens(const Time& time);
+    /*! Update stage updating scene. */
+    void onUpdateScene(const Time& time);
+    /*! Update stage updating overlays. */
+    void onUpdateOverlays(const Time& time);
+    /*! Update stage updating application. */
+    void onUpdateApplication(const Time& time);
 
   private:
 
@@ -174,6 +218,10 @@ class Application : public IEventListener
     IAudioManager* m_audioManager;
     /*! Image loader. */
     ImageLoader* m_imageLoader;
+    /*! Job system. */
+    JobSystem* m_jobSystem;
+    /*! Frame update graph. */
+    UpdateGraph* m_updateGraph;
     /*! Debug object. */
     Debug* m_debug;
     /*! Device services object. */
@@ -198,6 +246,8 @@ class Application : public IEventListener
     Time m_updateAccumulator;
     /*! Current state. */
     State m_state;
+    /*! Sequencers updated every frame. */
+    SequencerArray m_sequencers;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 inline Graphics* Application::graphics() const 
@@ -270,6 +320,16 @@ inline ImageLoader* Application::imageLoader() const
   return m_imageLoader; 
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline JobSystem* Application::jobSystem() const 
+{ 
+  return m_jobSystem; 
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline UpdateGraph* Application::updateGraph() const 
+{ 
+  return m_updateGraph; 
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 inline bool Application::isLandscape() const
 {
   return m_landscapeMode; 
@@ -0,0 +1,264 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGEApplication.h>
+#include <EGEJobSystem.h>
+#include <EGEMath.h>
+#include <EGEMemory.h>
+#include <EGEThread.h>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of worker threads used by tests. */
+#define WORKERS_COUNT 3
+/*! Number of independent stages. */
+#define STAGES_COUNT  4
+/*! Number of updates performed by tests. */
+#define UPDATES_COUNT 100
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class UpdateGraphTest : public TestBase
+{
+  public:
+
+    /*! Stages incrementing their counters. */
+    void onStage0(const Time& time);
+    void onStage1(const Time& time);
+    void onStage2(const Time& time);
+    void onStage3(const Time& time);
+    /*! Stage validating all counters. */
+    void onValidate(const Time& time);
+    /*! Stage doing nothing. */
+    void onNothing(const Time& time);
+
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void SetUp();
+    virtual void TearDown();
+
+  protected:
+
+    /*! Adds independent stages followed by validation stage into graph. */
+    void addStages(u32 validationFlags);
+    /*! Increments counter of a given stage. */
+    void increment(u32 index);
+
+  protected:
+
+    /*! Job system. */
+    PJobSystem m_jobSystem;
+    /*! Tested graph. */
+    PUpdateGraph m_graph;
+    /*! Stage counters. */
+    u32 m_counters[STAGES_COUNT];
+    /*! Identifiers of threads which executed stages. */
+    void* m_threadIds[STAGES_COUNT + 1];
+    /*! Number of validations done. */
+    u32 m_validations;
+    /*! Number of validations failed. */
+    u32 m_failures;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::SetUp()
+{
+  m_jobSystem = ege_new JobSystem(NULL);
+  ASSERT_TRUE(NULL != m_jobSystem);
+  ASSERT_EQ(EGE_SUCCESS, m_jobSystem->construct(WORKERS_COUNT));
+
+  m_graph = ege_new UpdateGraph(NULL, m_jobSystem);
+  ASSERT_TRUE(NULL != m_graph);
+
+  for (u32 i = 0; i < STAGES_COUNT; ++i)
+  {
+    m_counters[i] = 0;
+  }
+
+  for (u32 i = 0; i < STAGES_COUNT + 1; ++i)
+  {
+    m_threadIds[i] = NULL;
+  }
+
+  m_validations = 0;
+  m_failures    = 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::TearDown()
+{
+  m_graph     = NULL;
+  m_jobSystem = NULL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::onStage0(const Time& time)
+{
+  EGE_UNUSED(time);
+  increment(0);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::onStage1(const Time& time)
+{
+  EGE_UNUSED(time);
+  increment(1);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::onStage2(const Time& time)
+{
+  EGE_UNUSED(time);
+  increment(2);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::onStage3(const Time& time)
+{
+  EGE_UNUSED(time);
+  increment(3);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::onValidate(const Time& time)
+{
+  EGE_UNUSED(time);
+
+  m_validations++;
+
+  // all stages should be done exactly once for each validation
+  for (u32 i = 0; i < STAGES_COUNT; ++i)
+  {
+    if (m_validations != m_counters[i])
+    {
+      m_failures++;
+    }
+  }
+
+  m_threadIds[STAGES_COUNT] = Thread::CurrentId();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::onNothing(const Time& time)
+{
+  EGE_UNUSED(time);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::addStages(u32 validationFlags)
+{
+  m_graph->addStage("stage-0", ege_make_slot(this, UpdateGraphTest::onStage0), UpdateGraph::DOMAIN_NONE, UpdateGraph::DOMAIN_USER << 0);
+  m_graph->addStage("stage-1", ege_make_slot(this, UpdateGraphTest::onStage1), UpdateGraph::DOMAIN_NONE, UpdateGraph::DOMAIN_USER << 1);
+  m_graph->addStage("stage-2", ege_make_slot(this, UpdateGraphTest::onStage2), UpdateGraph::DOMAIN_NONE, UpdateGraph::DOMAIN_USER << 2);
+  m_graph->addStage("stage-3", ege_make_slot(this, UpdateGraphTest::onStage3), UpdateGraph::DOMAIN_NONE, UpdateGraph::DOMAIN_USER << 3);
+  m_graph->addStage("validate", ege_make_slot(this, UpdateGraphTest::onValidate), UpdateGraph::DOMAIN_ALL, UpdateGraph::DOMAIN_NONE, validationFlags);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraphTest::increment(u32 index)
+{
+  m_counters[index]++;
+  m_threadIds[index] = Thread::CurrentId();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(UpdateGraphTest, Levels)
+{
+  const u32 domainA = UpdateGraph::DOMAIN_USER << 0;
+  const u32 domainB = UpdateGraph::DOMAIN_USER << 1;
+  const u32 domainC = UpdateGraph::DOMAIN_USER << 2;
+
+  EXPECT_EQ(0U, m_graph->addStage("write-a", ege_make_slot(this, UpdateGraphTest::onNothing), UpdateGraph::DOMAIN_NONE, domainA));
+  EXPECT_EQ(1U, m_graph->addStage("write-b", ege_make_slot(this, UpdateGraphTest::onNothing), UpdateGraph::DOMAIN_NONE, domainB));
+  EXPECT_EQ(2U, m_graph->addStage("read-a-write-c", ege_make_slot(this, UpdateGraphTest::onNothing), domainA, domainC));
+  EXPECT_EQ(3U, m_graph->addStage("read-b", ege_make_slot(this, UpdateGraphTest::onNothing), domainB, UpdateGraph::DOMAIN_NONE));
+  EXPECT_EQ(4U, m_graph->addStage("read-b-again", ege_make_slot(this, UpdateGraphTest::onNothing), domainB, UpdateGraph::DOMAIN_NONE));
+  EXPECT_EQ(5U, m_graph->addStage("write-b-again", ege_make_slot(this, UpdateGraphTest::onNothing), UpdateGraph::DOMAIN_NONE, domainB));
+
+  EXPECT_EQ(6U, m_graph->stageCount());
+  EXPECT_EQ(3U, m_graph->levelCount());
+
+  // writers of different domains are independent
+  EXPECT_EQ(0U, m_graph->stageLevel(0));
+  EXPECT_EQ(0U, m_graph->stageLevel(1));
+
+  // readers follow writers
+  EXPECT_EQ(1U, m_graph->stageLevel(2));
+  EXPECT_EQ(1U, m_graph->stageLevel(3));
+
+  // readers are independent of each other
+  EXPECT_EQ(1U, m_graph->stageLevel(4));
+
+  // writer follows all previous readers
+  EXPECT_EQ(2U, m_graph->stageLevel(5));
+
+  EXPECT_TRUE("read-a-write-c" == m_graph->stageName(2));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(UpdateGraphTest, ParallelUpdate)
+{
+  addStages(UpdateGraph::STAGE_FLAG_MAIN_THREAD);
+  EXPECT_EQ(2U, m_graph->levelCount());
+
+  // concurrent execution is opt-in
+  EXPECT_FALSE(m_graph->isParallel());
+  m_graph->setParallel(true);
+  EXPECT_TRUE(m_graph->isParallel());
+
+  for (u32 i = 0; i < UPDATES_COUNT; ++i)
+  {
+    m_graph->update(Time(0.016f));
+  }
+
+  EXPECT_EQ(static_cast<u32>(UPDATES_COUNT), m_validations);
+  EXPECT_EQ(0U, m_failures);
+
+  // main thread stage should be executed by calling thread only
+  EXPECT_EQ(Thread::CurrentId(), m_threadIds[STAGES_COUNT]);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(UpdateGraphTest, SerialUpdate)
+{
+  addStages(UpdateGraph::STAGE_FLAG_NONE);
+
+  m_graph->setParallel(false);
+  EXPECT_FALSE(m_graph->isParallel());
+
+  for (u32 i = 0; i < UPDATES_COUNT; ++i)
+  {
+    m_graph->update(Time(0.016f));
+  }
+
+  EXPECT_EQ(static_cast<u32>(UPDATES_COUNT), m_validations);
+  EXPECT_EQ(0U, m_failures);
+
+  // all stages should be executed by calling thread
+  for (u32 i = 0; i < STAGES_COUNT + 1; ++i)
+  {
+    EXPECT_EQ(Thread::CurrentId(), m_threadIds[i]);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(UpdateGraphTest, Timings)
+{
+  addStages(UpdateGraph::STAGE_FLAG_NONE);
+
+  m_graph->update(Time(0.016f));
+
+  s64 longest = 0;
+  s64 total   = 0;
+  for (u32 i = 0; i < m_graph->stageCount(); ++i)
+  {
+    const s64 duration = m_graph->stageDuration(i).microseconds();
+    EXPECT_LE(0, duration);
+
+    longest = Math::Max(longest, duration);
+    total  += duration;
+  }
+
+  // critical path is never shorter than the longest stage nor longer than all stages executed serially
+  EXPECT_LE(longest, m_graph->criticalPathDuration().microseconds());
+  EXPECT_GE(total, m_graph->criticalPathDuration().microseconds());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
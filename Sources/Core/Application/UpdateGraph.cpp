@@ -0,0 +1,173 @@
+#include "Core/Application/UpdateGraph.h"
+#include "EGEMath.h"
+#include "EGETimer.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(UpdateGraph)
+EGE_DEFINE_DELETE_OPERATORS(UpdateGraph)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+UpdateGraph::UpdateGraph(Application* app, JobSystem* jobSystem) : Object(app, EGE_OBJECT_UID_UPDATE_GRAPH),
+                                                                   m_jobSystem(jobSystem),
+                                                                   m_levelCount(0),
+                                                                   m_parallel(false)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+UpdateGraph::~UpdateGraph()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 UpdateGraph::addStage(const String& name, const UpdateStageFunction& function, u32 reads, u32 writes, u32 flags)
+{
+  Stage stage;
+  stage.name      = name;
+  stage.function  = function;
+  stage.reads     = reads;
+  stage.writes    = writes;
+  stage.flags     = flags;
+  stage.level     = 0;
+  stage.duration  = 0LL;
+
+  // determine level
+  // NOTE: stage needs to be placed after every stage it conflicts with
+  for (DynamicArray<Stage>::const_iterator it = m_stages.begin(); it != m_stages.end(); ++it)
+  {
+    const Stage& other = *it;
+
+    if ((0 != (other.writes & (reads | writes))) || (0 != (other.reads & writes)))
+    {
+      stage.level = Math::Max(stage.level, other.level + 1);
+    }
+  }
+
+  m_levelCount = Math::Max(m_levelCount, stage.level + 1);
+
+  m_stages.push_back(stage);
+  return static_cast<u32>(m_stages.size() - 1);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraph::setParallel(bool enable)
+{
+  m_parallel = enable;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool UpdateGraph::isParallel() const
+{
+  return m_parallel;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraph::update(const Time& time)
+{
+  m_time = time;
+
+  // check if stages are to be executed serially
+  if ( ! m_parallel || (NULL == m_jobSystem) || (0 == m_jobSystem->workerCount()))
+  {
+    for (DynamicArray<Stage>::iterator it = m_stages.begin(); it != m_stages.end(); ++it)
+    {
+      execute(*it);
+    }
+
+    return;
+  }
+
+  // go thru all levels
+  for (u32 level = 0; level < m_levelCount; ++level)
+  {
+    JobCounter counter;
+
+    // submit all stages which can be executed by workers first
+    for (DynamicArray<Stage>::iterator it = m_stages.begin(); it != m_stages.end(); ++it)
+    {
+      Stage& stage = *it;
+
+      if ((level == stage.level) && ! (stage.flags & STAGE_FLAG_MAIN_THREAD))
+      {
+        m_jobSystem->run(ege_make_slot(this, UpdateGraph::executeStage), &stage, &counter);
+      }
+    }
+
+    // execute main thread stages meanwhile
+    for (DynamicArray<Stage>::iterator it = m_stages.begin(); it != m_stages.end(); ++it)
+    {
+      Stage& stage = *it;
+
+      if ((level == stage.level) && (stage.flags & STAGE_FLAG_MAIN_THREAD))
+      {
+        execute(stage);
+      }
+    }
+
+    // join level
+    m_jobSystem->wait(counter);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 UpdateGraph::stageCount() const
+{
+  return static_cast<u32>(m_stages.size());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const String& UpdateGraph::stageName(u32 index) const
+{
+  EGE_ASSERT(index < m_stages.size());
+  return m_stages[index].name;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 UpdateGraph::stageLevel(u32 index) const
+{
+  EGE_ASSERT(index < m_stages.size());
+  return m_stages[index].level;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const Time& UpdateGraph::stageDuration(u32 index) const
+{
+  EGE_ASSERT(index < m_stages.size());
+  return m_stages[index].duration;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 UpdateGraph::levelCount() const
+{
+  return m_levelCount;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Time UpdateGraph::criticalPathDuration() const
+{
+  s64 duration = 0;
+
+  for (u32 level = 0; level < m_levelCount; ++level)
+  {
+    // find longest stage of the level
+    s64 longest = 0;
+    for (DynamicArray<Stage>::const_iterator it = m_stages.begin(); it != m_stages.end(); ++it)
+    {
+      if (level == it->level)
+      {
+        longest = Math::Max(longest, it->duration.microseconds());
+      }
+    }
+
+    duration += longest;
+  }
+
+  return Time(duration);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraph::execute(Stage& stage)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+
+  stage.function(m_time);
+
+  stage.duration = Timer::GetMicroseconds() - startTime;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UpdateGraph::executeStage(void* data)
+{
+  execute(*reinterpret_cast<Stage*>(data));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
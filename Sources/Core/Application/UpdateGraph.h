@@ -0,0 +1,136 @@
+#ifndef EGE_CORE_APPLICATION_UPDATEGRAPH_H
+#define EGE_CORE_APPLICATION_UPDATEGRAPH_H
+
+/** Update graph describes single frame update as a set of stages. Each stage declares domains it reads from and writes to. Stage depends on every stage 
+ *  added before it which writes to domain it accesses or reads from domain it writes to. Stages are grouped into levels so that every stage within a level
+ *  depends on stages from previous levels only. Stages of a single level are executed concurrently on job system workers and the graph waits for a level
+ *  to complete before next level is started.
+ *  Duration of every stage is measured for each update so the critical path of the frame can be inspected.
+ */
+
+#include "EGE.h"
+#include "EGEDynamicArray.h"
+#include "EGESignal.h"
+#include "EGEString.h"
+#include "EGETime.h"
+#include "Core/Threading/JobSystem.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DECLARE_SMART_CLASS(UpdateGraph, PUpdateGraph)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Update stage function. Called with time interval passed since last update. */
+typedef Delegate1<const Time&> UpdateStageFunction;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class UpdateGraph : public Object
+{
+  public:
+
+    UpdateGraph(Application* app, JobSystem* jobSystem);
+   ~UpdateGraph();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+  public:
+
+    /*! Available update domains. */
+    enum Domain
+    {
+      DOMAIN_NONE       = 0x00000000,
+      DOMAIN_EVENTS     = 0x00000001,
+      DOMAIN_PHYSICS    = 0x00000002,
+      DOMAIN_GRAPHICS   = 0x00000004,
+      DOMAIN_IMAGES     = 0x00000008,
+      DOMAIN_RESOURCES  = 0x00000010,
+      DOMAIN_AUDIO      = 0x00000020,
+      DOMAIN_SCREENS    = 0x00000040,
+      DOMAIN_SCENE      = 0x00000080,
+      DOMAIN_OVERLAYS   = 0x00000100,
+      DOMAIN_SEQUENCERS = 0x00000200,
+      DOMAIN_USER       = 0x00010000,     /*!< First domain available for application use. */
+      DOMAIN_ALL        = 0xffffffff
+    };
+
+    /*! Available stage flags. */
+    enum StageFlags
+    {
+      STAGE_FLAG_NONE         = 0x00,
+      STAGE_FLAG_MAIN_THREAD  = 0x01      /*!< Stage is always executed by the thread calling update. */
+    };
+
+  public:
+
+    /*! Adds stage to the graph.
+     *  @param  name      Stage name.
+     *  @param  function  Function to call on update.
+     *  @param  reads     Mask of domains stage reads from.
+     *  @param  writes    Mask of domains stage writes to.
+     *  @param  flags     Stage flags.
+     *  @return Index of the added stage.
+     *  @note Order in which stages are added determines order of execution of stages which depend on each other.
+     */
+    u32 addStage(const String& name, const UpdateStageFunction& function, u32 reads, u32 writes, u32 flags = STAGE_FLAG_NONE);
+    /*! Enables/disables concurrent execution of stages. If disabled, all stages are executed by the thread calling update in the order they were added. 
+     *  @note Concurrent execution is disabled by default.
+     */
+    void setParallel(bool enable);
+    /*! Returns TRUE if stages are executed concurrently. */
+    bool isParallel() const;
+
+    /*! Executes all stages. Returns once all stages are done. */
+    void update(const Time& time);
+
+    /*! Returns number of stages. */
+    u32 stageCount() const;
+    /*! Returns name of a given stage. */
+    const String& stageName(u32 index) const;
+    /*! Returns level of a given stage. Stages of the same level are executed concurrently. */
+    u32 stageLevel(u32 index) const;
+    /*! Returns duration of a given stage during last update. */
+    const Time& stageDuration(u32 index) const;
+    /*! Returns number of levels. */
+    u32 levelCount() const;
+    /*! Returns duration of critical path during last update. This is a sum of durations of the longest stage of every level. */
+    Time criticalPathDuration() const;
+
+  private:
+
+    /*! Stage descriptor. */
+    struct Stage
+    {
+      String name;                    /*!< Name. */
+      UpdateStageFunction function;   /*!< Function to call. */
+      u32 reads;                      /*!< Mask of domains read from. */
+      u32 writes;                     /*!< Mask of domains written to. */
+      u32 flags;                      /*!< Flags. */
+      u32 level;                      /*!< Level. */
+      Time duration;                  /*!< Duration during last update. */
+    };
+
+  private:
+
+    /*! Executes given stage. */
+    void execute(Stage& stage);
+    /*! Job function executing stage. */
+    void executeStage(void* data);
+
+  private:
+
+    /*! Job system executing stages. Can be NULL. */
+    JobSystem* m_jobSystem;
+    /*! Stages. */
+    DynamicArray<Stage> m_stages;
+    /*! Number of levels. */
+    u32 m_levelCount;
+    /*! Concurrent execution flag. */
+    bool m_parallel;
+    /*! Time interval of the update in progress. */
+    Time m_time;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_APPLICATION_UPDATEGRAPH_H
\ No newline at end of file
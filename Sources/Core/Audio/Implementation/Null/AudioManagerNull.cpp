@@ -75,7 +75,7 @@ IAudioManager::EState AudioManagerNull::state() const
   return m_state;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void AudioManagerNull::onEventRecieved(PEvent event)
+void AudioManagerNull::onEventRecieved(const Event& event)
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -95,7 +95,7 @@ EGEResult AudioManagerOpenAL::construct()
   }
 
   // subscribe for event notifications
-  if ( ! app()->eventManager()->addListener(this))
+  if ( ! app()->eventManager()->addListener(this, EGE_EVENT_ID_CORE_QUIT_REQUEST))
   {
     // error!
     return EGE_ERROR;
@@ -351,9 +351,9 @@ ALuint AudioManagerOpenAL::findAvailableChannel() const
   return 0;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void AudioManagerOpenAL::onEventRecieved(PEvent event)
+void AudioManagerOpenAL::onEventRecieved(const Event& event)
 {
-  switch (event->id())
+  switch (event.id())
   {
     case EGE_EVENT_ID_CORE_QUIT_REQUEST:
 
@@ -51,7 +51,7 @@ class AudioManagerNull : public Object,
   private:
 
     /*! @ see IEventListener::onEventRecieved. */
-    void onEventRecieved(PEvent event) override;
+    void onEventRecieved(const Event& event) override;
 
   private:
 
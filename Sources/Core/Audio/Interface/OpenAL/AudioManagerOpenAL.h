@@ -96,7 +96,7 @@ class AudioManagerOpenAL : public Object, public IAudioManagerBase, public IAudi
     ALuint findAvailableChannel() const;
 
     /*! @ see IEventListener::onEventRecieved. */
-    void onEventRecieved(PEvent event) override;
+    void onEventRecieved(const Event& event) override;
     /*! Shuts down. */
     void shutDown();
 
@@ -8,6 +8,7 @@ EGE_DEFINE_DELETE_OPERATORS(Component)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Component::Component(Application* app, u32 uid, const String& name) : Object(app, uid)
                                                                     , m_name(name)
+                                                                    , m_nameHash(Name::Hash(name))
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -50,6 +50,11 @@ List<PComponent> ComponentHost::components(u32 type) const
   return list;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+ComponentHost::ComponentRange ComponentHost::componentRange(u32 type) const
+{
+  return m_pool.equal_range(type);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PComponent ComponentHost::component(u32 type) const
 {
   List<PComponent> list;
@@ -58,7 +63,7 @@ PComponent ComponentHost::component(u32 type) const
   return list.first(NULL);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-PComponent ComponentHost::component(const String& name) const
+PComponent ComponentHost::component(const Name& name) const
 {
   PComponent component;
 
@@ -66,7 +71,9 @@ PComponent ComponentHost::component(const String& name) const
   for (MultiMap<u32, PComponent>::const_iterator it = m_pool.begin(); (it != m_pool.end()) && (NULL == component); ++it)
   {
     const PComponent& current = it->second;
-    if (current->name() == name)
+
+    // NOTE: component names are not interned, hashes are compared first to avoid string comparisons
+    if ((current->nameHash() == name.hash()) && (current->name() == name.toString()))
     {
       // found
       component = current;
@@ -27,11 +27,17 @@ class Component : public Object
 
     /*! Gets component name. */
     const String& name() const;
+    /*! Returns hash of the component name. 
+     *  @see Name::Hash.
+     */
+    u32 nameHash() const { return m_nameHash; }
 
   private:
 
     /*! Component name. */
     String m_name;
+    /*! Hash of the component name. */
+    u32 m_nameHash;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
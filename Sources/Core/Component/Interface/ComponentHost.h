@@ -7,6 +7,7 @@
 
 #include "EGE.h"
 #include "EGEString.h"
+#include "EGEName.h"
 #include "EGEMap.h"
 #include "EGEList.h"
 
@@ -17,6 +18,15 @@ EGE_DECLARE_SMART_CLASS(Component, PComponent)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class ComponentHost
 {
+  protected:
+
+    typedef MultiMap<u32, PComponent> ComponentPool;
+
+  public:
+
+    /*! Range of components of the same type. First element points to first component, second element points past the last one. */
+    typedef std::pair<ComponentPool::const_iterator, ComponentPool::const_iterator> ComponentRange;
+
   public:
 
     ComponentHost();
@@ -35,6 +45,12 @@ class ComponentHost
      *  @return List of all attached components of the given type.
      */
     List<PComponent> components(u32 type) const;
+    /*! Returns the range of components of a given type. 
+     *  @param  type  Component type to return.
+     *  @return Range of all attached components of the given type.
+     *  @note Unlike components, this does not copy anything. Returned range is valid until the pool gets modified.
+     */
+    ComponentRange componentRange(u32 type) const;
     /*! Returns first component of the given type. 
      *  @param  type  Component type to return.
      *  @return First component of given type found.
@@ -46,17 +62,13 @@ class ComponentHost
      *  @return First component of with a given name found.
      *  @note This is convinience method.
      */
-    PComponent component(const String& name) const;
+    PComponent component(const Name& name) const;
 
     /*! Removes given component. 
      *  @param  component Component to remove.
      */
     void removeComponent(const PComponent& component);
 
-  protected:
-
-    typedef MultiMap<u32, PComponent> ComponentPool;
-
   protected:
 
     /*! Pool of attached components, refernced by unique object id. */
@@ -1,11 +1,12 @@
 #ifdef EGE_PHYSICS_BOX2D
 
 #include "Core/Application/Application.h"
-#include "Core/Components/Physics/Box2D/PhysicsComponentBox2D_p.h"
+#include "Core/Component/Physics/Box2D/PhysicsComponentBox2D_p.h"
 #include "Core/Physics/Box2D/PhysicsManagerBox2D_p.h"
 #include <EGEPhysics.h>
 #include <Box2D/Box2D.h>
 #include <EGEDebug.h>
+#include <EGEMath.h>
 
 EGE_NAMESPACE_BEGIN
 
@@ -20,14 +21,27 @@ enum b2BodyType mapType(EGEPhysics::ComponentType type)
   {
     case EGEPhysics::COMPONENT_STATIC:    return b2_staticBody;
     case EGEPhysics::COMPONENT_KINEMATIC: return b2_kinematicBody;
+
+    default:
+      break;
   }
 
   return b2_dynamicBody;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PhysicsComponentPrivate::PhysicsComponentPrivate(PhysicsComponent* parent, PhysicsManagerPrivate* managerPrivate) : m_d(parent), m_body(NULL), 
-                                                                                                                    m_managerPrivate(managerPrivate)
+                                                                                                                    m_managerPrivate(managerPrivate),
+                                                                                                                    m_previousPosition(0, 0),
+                                                                                                                    m_previousAngle(0),
+                                                                                                                    m_renderPreviousPosition(0, 0),
+                                                                                                                    m_renderPreviousAngle(0),
+                                                                                                                    m_renderPosition(0, 0),
+                                                                                                                    m_renderAngle(0),
+                                                                                                                    m_movedInLastStep(false),
+                                                                                                                    m_transformationPending(false)
 {
+  PhysicsWorldLocker locker(manager());
+
   b2BodyDef def;
 	def.position.x  = 0;
 	def.position.y  = 0;
@@ -42,6 +56,11 @@ PhysicsComponentPrivate::PhysicsComponentPrivate(PhysicsComponent* parent, Physi
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PhysicsComponentPrivate::~PhysicsComponentPrivate()
 {
+  PhysicsWorldLocker locker(manager());
+
+  // make sure no transformation change is propagated for this one anymore
+  manager()->removePendingComponent(this);
+
   manager()->world()->DestroyBody(body());
   m_body = NULL;
 }
@@ -50,9 +69,15 @@ void PhysicsComponentPrivate::setPosition(const Vector4f& position)
 {
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     EGE::float32 scale = manager()->worldToSimulationScaleFactor();
 
     body()->SetTransform(b2Vec2(position.x * scale, position.y * scale), body()->GetAngle());
+
+    // NOTE: explicit change, no interpolation from previous state should take place
+    storePreviousTransformation();
+    updateRenderTransformation();
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -64,7 +89,8 @@ Vector4f PhysicsComponentPrivate::position() const
   {
     EGE::float32 scale = manager()->simulationToWorldScaleFactor();
 
-    const b2Vec2& pos = body()->GetPosition();
+    // NOTE: when simulation runs on work thread Box2D body cannot be accessed outside of synchronization point
+    const b2Vec2& pos = manager()->isThreaded() ? m_renderPosition : body()->GetPosition();
 
     vec.x = pos.x * scale;
     vec.y = pos.y * scale;
@@ -79,7 +105,18 @@ void PhysicsComponentPrivate::setOrientation(const Quaternionf& orientation)
 {
   if (isValid())
   {
-    body()->SetTransform(body()->GetPosition(), orientation.angle().radians());
+    PhysicsWorldLocker locker(manager());
+
+    Vector3f axis;
+    Angle angle;
+    Math::Convert(axis, angle, orientation);
+
+    // NOTE: rotation around negative Z axis is the opposite one
+    body()->SetTransform(body()->GetPosition(), (0 <= axis.z) ? angle.radians() : -angle.radians());
+
+    // NOTE: explicit change, no interpolation from previous state should take place
+    storePreviousTransformation();
+    updateRenderTransformation();
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -91,16 +128,74 @@ Quaternionf PhysicsComponentPrivate::orientation() const
   {
     // NOTE: we take base orientation Z value into account here as each rotation in 3D space can be represented by 2 opposit quaternions and we want to pick up
     //       right one
-    orient.create((0 <= d_func()->m_orientation.z) ? Vector3f::UNIT_Z : Vector3f::NEGATIVE_UNIT_Z, Angle::FromRadians(body()->GetAngle()));
+    orient = Math::CreateQuaternion((0 <= d_func()->m_orientation.z) ? Vector3f::UNIT_Z : Vector3f::NEGATIVE_UNIT_Z, 
+                                    Angle::FromRadians(manager()->isThreaded() ? m_renderAngle : body()->GetAngle()));
   }
 
   return orient;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Vector4f PhysicsComponentPrivate::interpolatedPosition() const
+{
+  Vector4f vec;
+
+  if (isValid())
+  {
+    EGE::float32 scale = manager()->simulationToWorldScaleFactor();
+    EGE::float32 alpha = manager()->interpolationAlpha();
+
+    vec.x = (m_renderPreviousPosition.x + (m_renderPosition.x - m_renderPreviousPosition.x) * alpha) * scale;
+    vec.y = (m_renderPreviousPosition.y + (m_renderPosition.y - m_renderPreviousPosition.y) * alpha) * scale;
+    vec.z = 0;
+    vec.w = 1;
+  }
+
+  return vec;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Quaternionf PhysicsComponentPrivate::interpolatedOrientation() const
+{
+  Quaternionf orient;
+
+  if (isValid())
+  {
+    EGE::float32 alpha = manager()->interpolationAlpha();
+    EGE::float32 angle = m_renderPreviousAngle + (m_renderAngle - m_renderPreviousAngle) * alpha;
+
+    // NOTE: see orientation()
+    orient = Math::CreateQuaternion((0 <= d_func()->m_orientation.z) ? Vector3f::UNIT_Z : Vector3f::NEGATIVE_UNIT_Z, Angle::FromRadians(angle));
+  }
+
+  return orient;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsComponentPrivate::storePreviousTransformation()
+{
+  m_previousPosition = body()->GetPosition();
+  m_previousAngle    = body()->GetAngle();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool PhysicsComponentPrivate::isTransformationChanged() const
+{
+  const b2Vec2& pos = body()->GetPosition();
+
+  return (pos.x != m_previousPosition.x) || (pos.y != m_previousPosition.y) || (body()->GetAngle() != m_previousAngle);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsComponentPrivate::updateRenderTransformation()
+{
+  m_renderPreviousPosition  = m_previousPosition;
+  m_renderPreviousAngle     = m_previousAngle;
+  m_renderPosition          = body()->GetPosition();
+  m_renderAngle             = body()->GetAngle();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsComponentPrivate::applyForce(const Vector4f& force, const Vector4f& worldPos)
 {
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     EGE::float32 scale = manager()->worldToSimulationScaleFactor();
 
     body()->ApplyForce(b2Vec2(force.x * scale, force.y * scale), b2Vec2(worldPos.x * scale, worldPos.y * scale));
@@ -111,6 +206,8 @@ void PhysicsComponentPrivate::applyLinearImpulse(const Vector4f& impulse, const
 {
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     EGE::float32 scale = manager()->worldToSimulationScaleFactor();
 
     body()->ApplyLinearImpulse(b2Vec2(impulse.x * scale, impulse.y * scale), b2Vec2(worldPos.x * scale, worldPos.y * scale));
@@ -132,6 +229,8 @@ void PhysicsComponentPrivate::setMass(EGE::float32 mass)
 {
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     b2MassData massData;
     body()->GetMassData(&massData);
 
@@ -147,6 +246,8 @@ EGE::float32 PhysicsComponentPrivate::mass() const
 
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     mass = body()->GetMass();
   }
 
@@ -157,6 +258,8 @@ void PhysicsComponentPrivate::setLinearVelocity(const Vector4f& velocity)
 {
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     EGE::float32 scale = manager()->worldToSimulationScaleFactor();
 
     body()->SetLinearVelocity(b2Vec2(velocity.x * scale, velocity.y * scale));
@@ -169,6 +272,8 @@ Vector4f PhysicsComponentPrivate::linearVelocity() const
 
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     EGE::float32 scale = manager()->simulationToWorldScaleFactor();
 
     b2Vec2 velocity = body()->GetLinearVelocity();
@@ -191,6 +296,8 @@ bool PhysicsComponentPrivate::addCircleShape(EGE::float32 radius, EGE::float32 d
 {
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     EGE::float32 scale = manager()->worldToSimulationScaleFactor();
 
     b2CircleShape shape;
@@ -217,6 +324,8 @@ bool PhysicsComponentPrivate::addPolygonShape(const DynamicArray<Vector4f>& poin
 {
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     EGE_ASSERT(b2_maxPolygonVertices >= points.size());
 
     EGE::float32 scale = manager()->worldToSimulationScaleFactor();
@@ -265,6 +374,8 @@ bool PhysicsComponentPrivate::isAwake() const
 {
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     return body()->IsAwake();
   }
 
@@ -275,6 +386,8 @@ void PhysicsComponentPrivate::setAwake(bool set)
 {
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     body()->SetAwake(set);
   }
 }
@@ -283,6 +396,8 @@ void PhysicsComponentPrivate::setAllowSleep(bool set)
 {
   if (isValid())
   {
+    PhysicsWorldLocker locker(manager());
+
     body()->SetSleepingAllowed(set);
   }
 }
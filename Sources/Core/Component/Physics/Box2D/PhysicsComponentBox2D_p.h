@@ -4,9 +4,10 @@
 #ifdef EGE_PHYSICS_BOX2D
 
 #include <EGE.h>
-#include <EGEVector.h>
+#include <EGEVector4.h>
 #include <EGEDynamicArray.h>
 #include <EGEPhysics.h>
+#include <Box2D/Common/b2Math.h>
 
 class b2Body;
 
@@ -55,6 +56,10 @@ class PhysicsComponentPrivate
     void setOrientation(const Quaternionf& orientation);
     /*! Returns orientation quaternion. */
     Quaternionf orientation() const;
+    /*! Returns position vector interpolated between two last simulation steps. */
+    Vector4f interpolatedPosition() const;
+    /*! Returns orientation quaternion interpolated between two last simulation steps. */
+    Quaternionf interpolatedOrientation() const;
     /*! Sets mass. */
     void setMass(float32 mass);
     /*! Returns mass. */
@@ -73,6 +78,15 @@ class PhysicsComponentPrivate
     /*! Returns Box2D representation. */
     b2Body* body() const { return m_body; }
 
+    /*! Stores current Box2D transformation as the one prior to simulation step. */
+    void storePreviousTransformation();
+    /*! Returns TRUE if Box2D transformation differs from the one stored prior to last simulation step. */
+    bool isTransformationChanged() const;
+    /*! Updates transformations visible to the rest of the engine from Box2D one. 
+     *  @note When simulation runs on work thread this is to be called at synchronization point only.
+     */
+    void updateRenderTransformation();
+
     /*! Adds circular shape. */
     bool addCircleShape(float32 radius, float32 density, EGEPhysics::CollisionData colissionData);
     /*! Adds polygonal shape. 
@@ -92,6 +106,25 @@ class PhysicsComponentPrivate
     b2Body* m_body;
     /*! Pointer to Box2D physics manager. */
     PhysicsManagerPrivate* m_managerPrivate;
+    /*! Box2D position prior to last simulation step. */
+    b2Vec2 m_previousPosition;
+    /*! Box2D angle (in radians) prior to last simulation step. */
+    float32 m_previousAngle;
+    /*! Box2D position prior to last simulation step, as visible to the rest of the engine. */
+    b2Vec2 m_renderPreviousPosition;
+    /*! Box2D angle (in radians) prior to last simulation step, as visible to the rest of the engine. */
+    float32 m_renderPreviousAngle;
+    /*! Box2D position after last simulation step, as visible to the rest of the engine. */
+    b2Vec2 m_renderPosition;
+    /*! Box2D angle (in radians) after last simulation step, as visible to the rest of the engine. */
+    float32 m_renderAngle;
+    /*! TRUE if transformation changed during last simulation step. */
+    bool m_movedInLastStep;
+    /*! TRUE if component is queued for transformation change propagation. */
+    bool m_transformationPending;
+
+    /* For access to transformation change propagation data. */
+    friend class PhysicsManagerPrivate;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -38,6 +38,16 @@ Quaternionf PhysicsComponentPrivate::orientation() const
   return d_func()->m_orientation;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Vector4f PhysicsComponentPrivate::interpolatedPosition() const
+{
+  return position();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Quaternionf PhysicsComponentPrivate::interpolatedOrientation() const
+{
+  return orientation();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsComponentPrivate::applyForce(const Vector4f& force, const Vector4f& worldPos)
 {
   EGE_UNUSED(force);
@@ -53,6 +53,10 @@ class PhysicsComponentPrivate
     void setOrientation(const Quaternionf& orientation);
     /*! Returns orientation quaternion. */
     Quaternionf orientation() const;
+    /*! Returns position vector interpolated between two last simulation steps. */
+    Vector4f interpolatedPosition() const;
+    /*! Returns orientation quaternion interpolated between two last simulation steps. */
+    Quaternionf interpolatedOrientation() const;
     /*! Sets mass. */
     void setMass(float32 mass);
     /*! Returns mass. */
@@ -112,6 +112,28 @@ Quaternionf PhysicsComponent::orientation() const
   return m_orientation;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Vector4f PhysicsComponent::interpolatedPosition() const
+{
+  EGE_ASSERT(isValid());
+  if (m_p)
+  {
+    return m_p->interpolatedPosition();
+  }
+
+  return m_position;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Quaternionf PhysicsComponent::interpolatedOrientation() const
+{
+  EGE_ASSERT(isValid());
+  if (m_p)
+  {
+    return m_p->interpolatedOrientation();
+  }
+
+  return m_orientation;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsComponent::applyForce(const Vector4f& force, const Vector4f& worldPos)
 {
   EGE_ASSERT(isValid());
@@ -78,6 +78,14 @@ class PhysicsComponent : public Component
     void setOrientation(const Quaternionf& orientation);
     /*! Returns orientation quaternion. */
     Quaternionf orientation() const;
+    /*! Returns position vector to be used for rendering. 
+     *  @note If physics interpolation is enabled, this is the position interpolated between two last simulation steps.
+     */
+    Vector4f interpolatedPosition() const;
+    /*! Returns orientation quaternion to be used for rendering. 
+     *  @note If physics interpolation is enabled, this is the orientation interpolated between two last simulation steps.
+     */
+    Quaternionf interpolatedOrientation() const;
     /*! Sets mass. */
     void setMass(float32 mass);
     /*! Returns mass. */
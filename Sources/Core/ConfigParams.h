@@ -26,11 +26,21 @@ EGE_NAMESPACE_BEGIN
 #define EGE_ENGINE_PARAM_UPDATES_PER_SECOND "updates-per-second"
 #define EGE_ENGINE_PARAM_LANDSCAPE_MODE     "landscape"
 #define EGE_ENGINE_PARAM_RENDERS_PER_SECOND "renders-per-second"
+/*! Headless rendering flag. If set, no native window is created and recording render system is used instead of hardware one. */
+#define EGE_ENGINE_PARAM_HEADLESS           "headless"
+/*! Number of job system worker threads. If not set, one worker per each hardware thread but the main one is created. */
+#define EGE_ENGINE_PARAM_JOB_WORKERS        "job-workers"
+/*! Concurrent execution of independent frame update stages. If set to FALSE, all stages are updated serially on main thread. Default is FALSE. */
+#define EGE_ENGINE_PARAM_PARALLEL_UPDATE    "parallel-update"
 
 // physics specifc
 
 /*! Real world to physics world scale factor. */
 #define EGE_PHYSICS_PARAM_SCALE_FACTOR "physics:scale-factor"
+/*! Physics rendering interpolation flag. If set, rendered transformations are blended between two last simulation steps. */
+#define EGE_PHYSICS_PARAM_INTERPOLATION "physics:interpolation"
+/*! Physics threading flag. If set, simulation steps requested in a frame are run on dedicated thread in parallel with rendering of that frame. */
+#define EGE_PHYSICS_PARAM_THREADED "physics:threaded"
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
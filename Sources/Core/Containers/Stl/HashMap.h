@@ -0,0 +1,48 @@
+#ifndef EGE_CORE_CONTAINER_HASHMAP_H
+#define EGE_CORE_CONTAINER_HASHMAP_H
+
+#include "Core/Platform.h"
+#include <unordered_map>
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Unordered map with constant average look-up time. Iteration order is not defined. */
+template <typename T, typename U>
+class HashMap : public std::unordered_map<T, U>
+{
+  public:
+
+    /* Returns TRUE if given key is present. */
+    bool contains(const T& key) const;
+    /*! Returns value associated with given key. If key is not found, default value is returned. */
+    U value(const T& key, const U defaultValue) const;
+    /*! Inserts value with given key to map. 
+     *  @note Value already associated with given key is not overwritten.
+     */
+    void insert(const T& key, const U& value);
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <typename T, typename U>
+bool HashMap<T, U>::contains(const T& key) const
+{
+  return this->find(key) != this->end();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <typename T, typename U>
+U HashMap<T, U>::value(const T& key, const U defaultValue) const
+{
+  typename HashMap<T, U>::const_iterator it = this->find(key);
+  return (it != this->end()) ? it->second : defaultValue;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <typename T, typename U>
+void HashMap<T, U>::insert(const T& key, const U& value)
+{
+  std::unordered_map<T, U>::insert(std::pair<T, U>(key, value));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_CONTAINER_HASHMAP_H
@@ -1,18 +1,44 @@
 #include "Core/Crypto/Interface/Cipher/CipherAES.h"
 #include "Core/Crypto/Interface/Cipher/CipherKey.h"
+#include "Core/Crypto/Interface/Cipher/CipherStream.h"
+#include "Core/Threading/JobSystem.h"
+#include "Core/Tools/ByteOrder.h"
 #include "EGEDebug.h"
+#include "EGEMath.h"
 #include "EGERandom.h"
 #include <openssl/aes.h>
 
 EGE_NAMESPACE
 
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+static const char* KCipherAESDebugName = "CipherAES";
+/*! Size of the data block length preceeding every data block (in bytes). */
+static const s32 KDataBlockLengthSize = 4;
+/*! Minimal number of cipher blocks decrypted in parallel. Smaller amounts are decrypted serially as it is faster. 
+ *  @note Data is usually added in chunks, such as by CipherStream, so every full chunk needs to reach it.
+ */
+static const s32 KParallelDecryptionMinBlocks = 2048;
+/*! Number of cipher blocks decrypted by single parallel job. */
+static const u32 KParallelDecryptionBatchBlocks = 1024;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// NOTE: chunk boundaries do not align with data blocks and first chunk carries initialization vector as well so leave plenty of margin
+static_assert(2 * KParallelDecryptionMinBlocks * AES_BLOCK_SIZE <= EGE_CIPHER_STREAM_DEFAULT_CHUNK_SIZE, 
+              "Default cipher stream chunk is too small to be decrypted in parallel");
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGE_DEFINE_NEW_OPERATORS(CipherAES)
 EGE_DEFINE_DELETE_OPERATORS(CipherAES)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-CipherAES::CipherAES(CipherDirection direction, const PCipherKey& key) : Cipher(direction, key)
+CipherAES::CipherAES(CipherDirection direction, const PCipherKey& key, JobSystem* jobSystem) : Cipher(direction, key)
+                                                                                              , m_jobSystem(jobSystem)
+                                                                                              , m_pendingDataLength(0)
+                                                                                              , m_initializationVectorRead(false)
+                                                                                              , m_blockBytesLeft(0)
+                                                                                              , m_blockCipherBlocksLeft(0)
+                                                                                              , m_parallelInput(NULL)
+                                                                                              , m_parallelOutput(NULL)
 {
   EGE_ASSERT(AES_BLOCK_SIZE == sizeof (m_initializationVector));
+  EGE_ASSERT(AES_BLOCK_SIZE == sizeof (m_pendingData));
  
   resetInitializationVectors(); 
 }
@@ -25,103 +51,240 @@ EGEResult CipherAES::addData(const char* data, s32 length)
 {
   EGE_ASSERT(128 == (m_key->length() << 3));
 
-  const s32 KDataBlockLengthSize = 4;
-
-  EGEResult result = EGE_SUCCESS;
-
-  AES_KEY key;
+  return (EEncrypt == m_direction) ? encrypt(data, length) : decrypt(data, length);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult CipherAES::encrypt(const char* data, s32 length)
+{
+  // get cached key schedule
+  const AES_KEY* key = m_key->aesEncryptKey();
+  if (NULL == key)
+  {
+    // error!
+    return EGE_ERROR;
+  }
 
   // determine if this is first operation
   bool firstOperation = (0 == m_result.size());
 
-  // check if encryping
-  if (EEncrypt == m_direction)
-  {
-    // prepare encryption key
-    AES_set_encrypt_key(m_key->data(), static_cast<int>(m_key->length() << 3), &key);
-
-    // calculate size of encoded output
-    const s32 encodedSize = ((length + AES_BLOCK_SIZE) / AES_BLOCK_SIZE) * AES_BLOCK_SIZE;
+  // calculate size of encoded output
+  // NOTE: there is always one extra cipher block containing remaining bytes
+  const s32 fullBlocksSize = (length / AES_BLOCK_SIZE) * AES_BLOCK_SIZE;
+  const s32 encodedSize    = fullBlocksSize + AES_BLOCK_SIZE;
 
-    // make sure buffer is big enough
-    const s64 requiredSize = m_result.size() + encodedSize + KDataBlockLengthSize + (firstOperation ? AES_BLOCK_SIZE : 0);
-    result = m_result.setSize(requiredSize);
+  // make sure buffer is big enough
+  const s64 requiredSize = m_result.size() + encodedSize + KDataBlockLengthSize + (firstOperation ? AES_BLOCK_SIZE : 0);
+  EGEResult result = m_result.setSize(requiredSize);
 
-    // check if first operation
-    if (firstOperation && (EGE_SUCCESS == result))
-    {
-      // write initialization vector first
-      result = (AES_BLOCK_SIZE == m_result.write(m_initializationVector, AES_BLOCK_SIZE)) ? EGE_SUCCESS : EGE_ERROR_IO;
-    }
+  // check if first operation
+  if (firstOperation && (EGE_SUCCESS == result))
+  {
+    // write initialization vector first
+    result = (AES_BLOCK_SIZE == m_result.write(m_initializationVector, AES_BLOCK_SIZE)) ? EGE_SUCCESS : EGE_ERROR_IO;
+  }
 
+  if (EGE_SUCCESS == result)
+  {
     // next, write length of data
     m_result << length;
 
-    if (EGE_SUCCESS == result)
-    {
-      // encrypt data
-      AES_cbc_encrypt(reinterpret_cast<const unsigned char*>(data), reinterpret_cast<unsigned char*>(m_result.data(m_result.writeOffset())), encodedSize, &key, 
-                      m_initializationVector, AES_ENCRYPT);
+    u8* output = reinterpret_cast<u8*>(m_result.data(m_result.writeOffset()));
 
-      // move write offset
-      m_result.setWriteOffset(m_result.writeOffset() + encodedSize);
-    }
+    // encrypt full cipher blocks
+    AES_cbc_encrypt(reinterpret_cast<const unsigned char*>(data), output, fullBlocksSize, key, m_initializationVector, AES_ENCRYPT);
+
+    // encrypt remaining bytes padded with zeroes
+    // NOTE: this way no data beyond input is accessed
+    u8 lastBlock[AES_BLOCK_SIZE];
+    memset(lastBlock, 0, AES_BLOCK_SIZE);
+    memcpy(lastBlock, data + fullBlocksSize, length - fullBlocksSize);
+
+    AES_cbc_encrypt(lastBlock, output + fullBlocksSize, AES_BLOCK_SIZE, key, m_initializationVector, AES_ENCRYPT);
+
+    // move write offset
+    m_result.setWriteOffset(m_result.writeOffset() + encodedSize);
   }
-  else
+
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult CipherAES::decrypt(const char* data, s32 length)
+{
+  // check if no valid key
+  if (NULL == m_key->aesDecryptKey())
   {
-    EGE_ASSERT_X(KDataBlockLengthSize <= length, "Too little data! Not even data block size could fit in!!!");
+    // error!
+    return EGE_ERROR;
+  }
 
-    // prepare encryption key
-    AES_set_decrypt_key(m_key->data(), static_cast<int>(m_key->length() << 3), &key);
+  const u8* input = reinterpret_cast<const u8*>(data);
 
-    // check if first operation
-    if (firstOperation)
+  while (0 < length)
+  {
+    // check if initialization vector is expected
+    if ( ! m_initializationVectorRead)
     {
-      // read data length of next block
-      DataBuffer buffer(reinterpret_cast<const void*>(data), AES_BLOCK_SIZE);
+      if (gatherPendingData(input, length, AES_BLOCK_SIZE))
+      {
+        memcpy(m_initializationVector, m_pendingData, AES_BLOCK_SIZE);
 
-      // read initialization vector first
-      result = (AES_BLOCK_SIZE == buffer.read(m_initializationVector, AES_BLOCK_SIZE)) ? EGE_SUCCESS : EGE_ERROR_IO;
-      if (EGE_SUCCESS == result)
+        m_pendingDataLength         = 0;
+        m_initializationVectorRead  = true;
+      }
+    }
+    // check if length of the next data block is expected
+    else if (0 == m_blockCipherBlocksLeft)
+    {
+      if (gatherPendingData(input, length, KDataBlockLengthSize))
       {
-        // move the data pointer
-        data += AES_BLOCK_SIZE;
-        length -= AES_BLOCK_SIZE;
+        s32 dataBlockLength;
+        ByteOrder::Convert(dataBlockLength, m_pendingData, m_result.byteOrdering());
+
+        m_pendingDataLength = 0;
+
+        if (0 > dataBlockLength)
+        {
+          // error!
+          egeWarning(KCipherAESDebugName) << "Invalid data block length:" << dataBlockLength;
+          return EGE_ERROR_BAD_PARAM;
+        }
+
+        // make sure buffer is big enough for entire data block
+        EGEResult result = m_result.setCapacity(m_result.size() + dataBlockLength);
+        if (EGE_SUCCESS != result)
+        {
+          // error!
+          return result;
+        }
+
+        m_blockBytesLeft        = dataBlockLength;
+        m_blockCipherBlocksLeft = (dataBlockLength / AES_BLOCK_SIZE) + 1;
       }
     }
+    // check if incomplete cipher block is pending
+    else if (0 < m_pendingDataLength)
+    {
+      if (gatherPendingData(input, length, AES_BLOCK_SIZE))
+      {
+        decryptBlocks(m_pendingData, 1);
 
-    // read all data blocks
-    while ((EGE_SUCCESS == result) && (0 < length))
+        m_pendingDataLength = 0;
+      }
+    }
+    else
     {
-      // read data length of next block
-      DataBuffer buffer(reinterpret_cast<const void*>(data), KDataBlockLengthSize);
+      // decrypt all complete cipher blocks of current data block directly from input
+      const s32 count = Math::Min(length / AES_BLOCK_SIZE, m_blockCipherBlocksLeft);
+      if (0 < count)
+      {
+        decryptBlocks(input, count);
 
-      s32 dataBlockLength;
-      buffer >> dataBlockLength;
+        input  += count * AES_BLOCK_SIZE;
+        length -= count * AES_BLOCK_SIZE;
+      }
+      else
+      {
+        // store incomplete cipher block until the rest of it is available
+        gatherPendingData(input, length, AES_BLOCK_SIZE);
+      }
+    }
+  }
 
-      // make sure buffer is big enough
-      result = m_result.setSize(m_result.size() + dataBlockLength);
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool CipherAES::gatherPendingData(const u8*& data, s32& length, s32 requiredLength)
+{
+  const s32 count = Math::Min(requiredLength - m_pendingDataLength, length);
 
-      if (EGE_SUCCESS == result)
-      {
-        // calculate size of encoded output
-        const s32 encodedSize = ((dataBlockLength + AES_BLOCK_SIZE) / AES_BLOCK_SIZE) * AES_BLOCK_SIZE;
+  memcpy(m_pendingData + m_pendingDataLength, data, count);
 
-        // encrypt data
-        AES_cbc_encrypt(reinterpret_cast<const unsigned char*>(data + KDataBlockLengthSize), 
-                        reinterpret_cast<unsigned char*>(m_result.data(m_result.writeOffset())), dataBlockLength, &key, m_initializationVector, AES_DECRYPT);
+  m_pendingDataLength += count;
+  data                += count;
+  length              -= count;
 
-        // move write offset
-        m_result.setWriteOffset(m_result.writeOffset() + dataBlockLength);
+  return (requiredLength == m_pendingDataLength);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CipherAES::decryptBlocks(const u8* data, s32 count)
+{
+  EGE_ASSERT((0 < count) && (count <= m_blockCipherBlocksLeft));
 
-        // advance over process data
-        data += KDataBlockLengthSize + encodedSize;
-        length -= KDataBlockLengthSize + encodedSize;
-      }
+  const AES_KEY* key = m_key->aesDecryptKey();
+
+  // determine number of cipher blocks decrypted in full
+  // NOTE: last cipher block of data block contains remaining bytes only
+  const bool lastIncluded = (count == m_blockCipherBlocksLeft);
+  const s32 fullCount     = lastIncluded ? (count - 1) : count;
+  const s32 outputLength  = lastIncluded ? m_blockBytesLeft : (count * AES_BLOCK_SIZE);
+
+  // grow result buffer
+  // NOTE: capacity for entire data block has been reserved already so this cannot fail
+  const s64 writeOffset = m_result.writeOffset();
+  EGEResult result = m_result.setSize(writeOffset + outputLength);
+  EGE_ASSERT(EGE_SUCCESS == result);
+  EGE_UNUSED(result);
+
+  u8* output = reinterpret_cast<u8*>(m_result.data(writeOffset));
+
+  if (0 < fullCount)
+  {
+    // check if worth decrypting in parallel
+    if ((NULL != m_jobSystem) && (0 < m_jobSystem->workerCount()) && (KParallelDecryptionMinBlocks <= fullCount))
+    {
+      m_parallelInput  = data;
+      m_parallelOutput = output;
+
+      m_jobSystem->parallelFor(static_cast<u32>(fullCount), KParallelDecryptionBatchBlocks, ege_make_slot(this, CipherAES::onDecryptRange));
+
+      // last cipher block becomes new initialization vector
+      memcpy(m_initializationVector, data + (fullCount - 1) * AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+    }
+    else
+    {
+      AES_cbc_encrypt(data, output, fullCount * AES_BLOCK_SIZE, key, m_initializationVector, AES_DECRYPT);
     }
   }
 
-  return result;
+  // check if last cipher block is to be decrypted
+  if (lastIncluded)
+  {
+    u8 lastBlock[AES_BLOCK_SIZE];
+    AES_cbc_encrypt(data + fullCount * AES_BLOCK_SIZE, lastBlock, AES_BLOCK_SIZE, key, m_initializationVector, AES_DECRYPT);
+
+    // copy remaining bytes only
+    const s32 remainingLength = outputLength - fullCount * AES_BLOCK_SIZE;
+    if (0 < remainingLength)
+    {
+      memcpy(output + fullCount * AES_BLOCK_SIZE, lastBlock, remainingLength);
+    }
+  }
+
+  // move write offset
+  m_result.setWriteOffset(writeOffset + outputLength);
+
+  m_blockBytesLeft        -= outputLength;
+  m_blockCipherBlocksLeft -= count;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CipherAES::onDecryptRange(u32 begin, u32 end)
+{
+  const AES_KEY* key = m_key->aesDecryptKey();
+
+  // NOTE: in CBC mode every plain block is decrypted cipher block XORed with previous cipher block, so blocks do not depend on each other
+  for (u32 i = begin; i < end; ++i)
+  {
+    const u8* input     = m_parallelInput + i * AES_BLOCK_SIZE;
+    const u8* previous  = (0 == i) ? m_initializationVector : (input - AES_BLOCK_SIZE);
+    u8* output          = m_parallelOutput + i * AES_BLOCK_SIZE;
+
+    AES_decrypt(input, output, key);
+
+    for (s32 j = 0; j < AES_BLOCK_SIZE; ++j)
+    {
+      output[j] ^= previous[j];
+    }
+  }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void CipherAES::reset()
@@ -129,6 +292,12 @@ void CipherAES::reset()
   // reset initialization vectors
   resetInitializationVectors();
 
+  // reset decryption state
+  m_pendingDataLength         = 0;
+  m_initializationVectorRead  = false;
+  m_blockBytesLeft            = 0;
+  m_blockCipherBlocksLeft     = 0;
+
   // call base class
   Cipher::reset();
 }
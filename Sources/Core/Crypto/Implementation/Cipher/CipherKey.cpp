@@ -1,4 +1,5 @@
 #include "Core/Crypto/Interface/Cipher/CipherKey.h"
+#include <openssl/aes.h>
 
 EGE_NAMESPACE
 
@@ -7,24 +8,34 @@ EGE_DEFINE_NEW_OPERATORS(CipherKey)
 EGE_DEFINE_DELETE_OPERATORS(CipherKey)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 CipherKey::CipherKey(const String& key) : Object(NULL)
+                                        , m_aesEncryptKey(NULL)
+                                        , m_aesDecryptKey(NULL)
 {
   s64 length = static_cast<s64>(key.size());
   if (m_key.write(reinterpret_cast<const void*>(key.toAscii()), length) != length)
   {
     m_key.clear();
   }
+
+  expandAESKeys();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 CipherKey::CipherKey(const PDataBuffer& key) : Object(NULL)
+                                              , m_aesEncryptKey(NULL)
+                                              , m_aesDecryptKey(NULL)
 {
   if (key->size() != m_key.write(key))
   {
     m_key.clear();
   }
+
+  expandAESKeys();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 CipherKey::~CipherKey()
 {
+  EGE_FREE(m_aesEncryptKey);
+  EGE_FREE(m_aesDecryptKey);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 u8* CipherKey::data() const
@@ -36,4 +47,37 @@ s64 CipherKey::length() const
 {
   return m_key.size();
 }
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const aes_key_st* CipherKey::aesEncryptKey() const
+{
+  return m_aesEncryptKey;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const aes_key_st* CipherKey::aesDecryptKey() const
+{
+  return m_aesDecryptKey;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CipherKey::expandAESKeys()
+{
+  const int bits = static_cast<int>(length() << 3);
+
+  // check if valid AES key
+  if ((128 == bits) || (192 == bits) || (256 == bits))
+  {
+    AES_KEY* encryptKey = reinterpret_cast<AES_KEY*>(EGE_MALLOC(sizeof (AES_KEY)));
+    AES_KEY* decryptKey = reinterpret_cast<AES_KEY*>(EGE_MALLOC(sizeof (AES_KEY)));
+    if ((NULL == encryptKey) || (NULL == decryptKey) || (0 != AES_set_encrypt_key(data(), bits, encryptKey)) || 
+        (0 != AES_set_decrypt_key(data(), bits, decryptKey)))
+    {
+      // error!
+      EGE_FREE(encryptKey);
+      EGE_FREE(decryptKey);
+      return;
+    }
+
+    m_aesEncryptKey = encryptKey;
+    m_aesDecryptKey = decryptKey;
+  }
+}
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
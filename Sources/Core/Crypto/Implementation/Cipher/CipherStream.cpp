@@ -0,0 +1,82 @@
+#include "Core/Crypto/Interface/Cipher/CipherStream.h"
+#include "EGEFile.h"
+#include "EGEMath.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(CipherStream)
+EGE_DEFINE_DELETE_OPERATORS(CipherStream)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+CipherStream::CipherStream(const PCipher& cipher, s32 chunkSize) : Object(NULL)
+                                                                 , m_cipher(cipher)
+                                                                 , m_chunkSize(chunkSize)
+{
+  EGE_ASSERT(0 < chunkSize);
+
+  m_chunk = ege_new DataBuffer();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+CipherStream::~CipherStream()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s64 CipherStream::read(File& file, s64 size)
+{
+  if ((NULL == m_cipher) || (NULL == m_chunk) || (EGE_SUCCESS != m_chunk->setCapacity(m_chunkSize)))
+  {
+    // error!
+    return -1;
+  }
+
+  // check if all remaining data is to be read
+  if (0 > size)
+  {
+    const s64 position = file.tell();
+    const s64 fileSize = file.size();
+    if ((0 > position) || (0 > fileSize))
+    {
+      // error!
+      return -1;
+    }
+
+    size = fileSize - position;
+  }
+
+  // reserve space for result
+  // NOTE: ciphered data is never shorter than deciphered one
+  PDataBuffer result = m_cipher->result();
+  if (EGE_SUCCESS != result->setCapacity(result->size() + size))
+  {
+    // error!
+    return -1;
+  }
+
+  // process chunk by chunk
+  s64 totalRead = 0;
+  while (totalRead < size)
+  {
+    m_chunk->clear();
+
+    // read next chunk
+    const s64 chunkSize = Math::Min(static_cast<s64>(m_chunkSize), size - totalRead);
+    const s64 readCount = file.read(m_chunk, chunkSize);
+    if (0 >= readCount)
+    {
+      // done
+      break;
+    }
+
+    // pass it thru cipher
+    if (EGE_SUCCESS != m_cipher->addData(reinterpret_cast<const char*>(m_chunk->data()), static_cast<s32>(readCount)))
+    {
+      // error!
+      return -1;
+    }
+
+    totalRead += readCount;
+  }
+
+  return totalRead;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1,15 +1,21 @@
 #include "Core/Crypto/Interface/Cipher/CipherXOR.h"
 #include "Core/Crypto/Interface/Cipher/CipherKey.h"
+#include <string.h>
 
 EGE_NAMESPACE
 
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Size of the machine word data is processed with (in bytes). */
+static const s32 KWordSize = sizeof (u64);
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGE_DEFINE_NEW_OPERATORS(CipherXOR)
 EGE_DEFINE_DELETE_OPERATORS(CipherXOR)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 CipherXOR::CipherXOR(CipherDirection direction, const PCipherKey& key) : Cipher(direction, key)
                                                                        , m_keyIndex(0)
+                                                                       , m_expandedKeyPeriod(0)
 {
+  expandKey();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 CipherXOR::~CipherXOR()
@@ -18,6 +24,13 @@ CipherXOR::~CipherXOR()
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGEResult CipherXOR::addData(const char* data, s32 length)
 {
+  // check if no valid key
+  if (0 == m_expandedKeyPeriod)
+  {
+    // error!
+    return EGE_ERROR;
+  }
+
   // make sure there is space in result buffer
   EGEResult result = m_result.setSize(m_result.writeOffset() + length);
   if (EGE_SUCCESS == result)
@@ -28,16 +41,47 @@ EGEResult CipherXOR::addData(const char* data, s32 length)
     // update write offset already
     m_result.setWriteOffset(m_result.writeOffset() + length);
 
+    const u8* key = reinterpret_cast<const u8*>(m_expandedKey.data());
+
+    // process full words
+    // NOTE: period is multiple of word size so key index never exceeds period by more than one word
+    // NOTE: memcpy is used for unaligned access, it is compiled into single load/store
+    while (KWordSize <= length)
+    {
+      u64 dataWord;
+      u64 keyWord;
+      memcpy(&dataWord, data, KWordSize);
+      memcpy(&keyWord, key + m_keyIndex, KWordSize);
+
+      // encrypt/decrypt
+      dataWord ^= keyWord;
+      memcpy(outData, &dataWord, KWordSize);
+
+      // next
+      outData    += KWordSize;
+      data       += KWordSize;
+      length     -= KWordSize;
+      m_keyIndex += KWordSize;
+      if (m_keyIndex >= m_expandedKeyPeriod)
+      {
+        m_keyIndex -= m_expandedKeyPeriod;
+      }
+    }
+
+    // process remaining bytes
     while (0 < length)
     {
       // encrypt/decrypt
-      *outData = *data ^ m_key->data()[m_keyIndex];
+      *outData = *data ^ key[m_keyIndex];
 
       // next
       ++outData;
       ++data;
-      m_keyIndex = (m_keyIndex + 1) % m_key->length();
       --length;
+      if (++m_keyIndex == m_expandedKeyPeriod)
+      {
+        m_keyIndex = 0;
+      }
     }
   }
 
@@ -53,3 +97,30 @@ void CipherXOR::reset()
   Cipher::reset();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CipherXOR::expandKey()
+{
+  const s32 keyLength = static_cast<s32>(m_key->length());
+  if (0 < keyLength)
+  {
+    // calculate period being least common multiple of key length and word size
+    s32 period = keyLength;
+    while (0 != (period % KWordSize))
+    {
+      period += keyLength;
+    }
+
+    // repeat key over period and one extra word
+    const s32 expandedLength = period + KWordSize;
+    if (EGE_SUCCESS == m_expandedKey.setSize(expandedLength))
+    {
+      u8* expandedKey = reinterpret_cast<u8*>(m_expandedKey.data());
+      for (s32 i = 0; i < expandedLength; ++i)
+      {
+        expandedKey[i] = m_key->data()[i % keyLength];
+      }
+
+      m_expandedKeyPeriod = period;
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
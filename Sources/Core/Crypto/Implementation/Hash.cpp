@@ -1,7 +1,160 @@
 #include "Core/Crypto/Interface/Hash.h"
+#include <string.h>
 
 EGE_NAMESPACE
 
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! xxHash32 primes. */
+static const u32 KPrime32_1 = 0x9E3779B1U;
+static const u32 KPrime32_2 = 0x85EBCA77U;
+static const u32 KPrime32_3 = 0xC2B2AE3DU;
+static const u32 KPrime32_4 = 0x27D4EB2FU;
+static const u32 KPrime32_5 = 0x165667B1U;
+/*! xxHash64 primes. */
+static const u64 KPrime64_1 = 0x9E3779B185EBCA87ULL;
+static const u64 KPrime64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const u64 KPrime64_3 = 0x165667B19E3779F9ULL;
+static const u64 KPrime64_4 = 0x85EBCA77C2B2AE63ULL;
+static const u64 KPrime64_5 = 0x27D4EB2F165667C5ULL;
+/*! Size of xxHash32 stripe (in bytes). */
+static const s32 KStripeSize32 = 16;
+/*! Size of xxHash64 stripe (in bytes). */
+static const s32 KStripeSize64 = 32;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function reading unaligned 32-bit word.
+ *  @note  Native byte order is used. All supported platforms are little-endian.
+ */
+static inline u32 Read32(const u8* data)
+{
+  u32 value;
+  memcpy(&value, data, sizeof (value));
+  return value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function reading unaligned 64-bit word. 
+ *  @note  Native byte order is used. All supported platforms are little-endian.
+ */
+static inline u64 Read64(const u8* data)
+{
+  u64 value;
+  memcpy(&value, data, sizeof (value));
+  return value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function rotating 32-bit value left. */
+static inline u32 RotateLeft32(u32 value, u32 bits)
+{
+  return (value << bits) | (value >> (32 - bits));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function rotating 64-bit value left. */
+static inline u64 RotateLeft64(u64 value, u32 bits)
+{
+  return (value << bits) | (value >> (64 - bits));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function mixing 32-bit word into xxHash32 lane accumulator. */
+static inline u32 Round32(u32 accumulator, u32 input)
+{
+  accumulator += input * KPrime32_2;
+  accumulator = RotateLeft32(accumulator, 13);
+  return accumulator * KPrime32_1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function mixing 64-bit word into xxHash64 lane accumulator. */
+static inline u64 Round64(u64 accumulator, u64 input)
+{
+  accumulator += input * KPrime64_2;
+  accumulator = RotateLeft64(accumulator, 31);
+  return accumulator * KPrime64_1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function consuming all complete stripes of data into xxHash64 lane accumulators. 
+ *  @return Number of bytes consumed.
+ */
+static s32 ConsumeStripes64(u64 accumulators[4], const u8* data, s32 size)
+{
+  u64 v1 = accumulators[0];
+  u64 v2 = accumulators[1];
+  u64 v3 = accumulators[2];
+  u64 v4 = accumulators[3];
+
+  const u8* begin = data;
+  const u8* limit = data + size - KStripeSize64;
+  while (data <= limit)
+  {
+    v1 = Round64(v1, Read64(data));
+    v2 = Round64(v2, Read64(data + 8));
+    v3 = Round64(v3, Read64(data + 16));
+    v4 = Round64(v4, Read64(data + 24));
+    data += KStripeSize64;
+  }
+
+  accumulators[0] = v1;
+  accumulators[1] = v2;
+  accumulators[2] = v3;
+  accumulators[3] = v4;
+
+  return static_cast<s32>(data - begin);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function initializing xxHash64 lane accumulators for a given seed. */
+static void InitializeAccumulators64(u64 accumulators[4], u64 seed)
+{
+  accumulators[0] = seed + KPrime64_1 + KPrime64_2;
+  accumulators[1] = seed + KPrime64_2;
+  accumulators[2] = seed;
+  accumulators[3] = seed - KPrime64_1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function merging xxHash64 lane accumulators into single value. */
+static u64 MergeAccumulators64(const u64 accumulators[4])
+{
+  u64 hash = RotateLeft64(accumulators[0], 1) + RotateLeft64(accumulators[1], 7) + RotateLeft64(accumulators[2], 12) + 
+             RotateLeft64(accumulators[3], 18);
+
+  for (s32 i = 0; i < 4; ++i)
+  {
+    hash ^= Round64(0, accumulators[i]);
+    hash = hash * KPrime64_1 + KPrime64_4;
+  }
+
+  return hash;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function mixing remaining data (less than one stripe) into xxHash64 value and calculating final avalanche. */
+static u64 Finalize64(u64 hash, const u8* data, s32 size)
+{
+  while (8 <= size)
+  {
+    hash ^= Round64(0, Read64(data));
+    hash = RotateLeft64(hash, 27) * KPrime64_1 + KPrime64_4;
+    data += 8;
+    size -= 8;
+  }
+
+  if (4 <= size)
+  {
+    hash ^= static_cast<u64>(Read32(data)) * KPrime64_1;
+    hash = RotateLeft64(hash, 23) * KPrime64_2 + KPrime64_3;
+    data += 4;
+    size -= 4;
+  }
+
+  while (0 < size--)
+  {
+    hash ^= (*data++) * KPrime64_5;
+    hash = RotateLeft64(hash, 11) * KPrime64_1;
+  }
+
+  hash ^= hash >> 33;
+  hash *= KPrime64_2;
+  hash ^= hash >> 29;
+  hash *= KPrime64_3;
+  hash ^= hash >> 32;
+
+  return hash;
+}
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 u32 Hash::FromString(const String& string)
 {
@@ -24,3 +177,136 @@ u32 Hash::FromData(const u8* data, s32 size)
   return h;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 Hash::FromData32(const u8* data, s32 size, u32 seed)
+{
+  const u8* end = data + size;
+  u32 hash;
+
+  if (KStripeSize32 <= size)
+  {
+    u32 v1 = seed + KPrime32_1 + KPrime32_2;
+    u32 v2 = seed + KPrime32_2;
+    u32 v3 = seed;
+    u32 v4 = seed - KPrime32_1;
+
+    const u8* limit = end - KStripeSize32;
+    while (data <= limit)
+    {
+      v1 = Round32(v1, Read32(data));
+      v2 = Round32(v2, Read32(data + 4));
+      v3 = Round32(v3, Read32(data + 8));
+      v4 = Round32(v4, Read32(data + 12));
+      data += KStripeSize32;
+    }
+
+    hash = RotateLeft32(v1, 1) + RotateLeft32(v2, 7) + RotateLeft32(v3, 12) + RotateLeft32(v4, 18);
+  }
+  else
+  {
+    hash = seed + KPrime32_5;
+  }
+
+  hash += static_cast<u32>(size);
+
+  // process remaining words and bytes
+  while (data + 4 <= end)
+  {
+    hash += Read32(data) * KPrime32_3;
+    hash = RotateLeft32(hash, 17) * KPrime32_4;
+    data += 4;
+  }
+
+  while (data < end)
+  {
+    hash += (*data++) * KPrime32_5;
+    hash = RotateLeft32(hash, 11) * KPrime32_1;
+  }
+
+  // final avalanche
+  hash ^= hash >> 15;
+  hash *= KPrime32_2;
+  hash ^= hash >> 13;
+  hash *= KPrime32_3;
+  hash ^= hash >> 16;
+
+  return hash;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u64 Hash::FromData64(const u8* data, s32 size, u64 seed)
+{
+  u64 hash;
+
+  if (KStripeSize64 <= size)
+  {
+    u64 accumulators[4];
+    InitializeAccumulators64(accumulators, seed);
+
+    const s32 consumed = ConsumeStripes64(accumulators, data, size);
+    data += consumed;
+    size -= consumed;
+
+    hash = MergeAccumulators64(accumulators);
+    hash += static_cast<u64>(consumed + size);
+  }
+  else
+  {
+    hash = seed + KPrime64_5 + static_cast<u64>(size);
+  }
+
+  return Finalize64(hash, data, size);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+HashStream::HashStream(u64 seed)
+{
+  reset(seed);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void HashStream::reset(u64 seed)
+{
+  InitializeAccumulators64(m_accumulators, seed);
+
+  m_pendingDataSize = 0;
+  m_totalSize       = 0;
+  m_seed            = seed;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void HashStream::update(const u8* data, s32 size)
+{
+  m_totalSize += static_cast<u64>(size);
+
+  // check if stripe cannot be completed yet
+  if (KStripeSize64 > m_pendingDataSize + size)
+  {
+    memcpy(m_pendingData + m_pendingDataSize, data, size);
+    m_pendingDataSize += size;
+    return;
+  }
+
+  // complete pending stripe first
+  if (0 < m_pendingDataSize)
+  {
+    const s32 count = KStripeSize64 - m_pendingDataSize;
+    memcpy(m_pendingData + m_pendingDataSize, data, count);
+    ConsumeStripes64(m_accumulators, m_pendingData, KStripeSize64);
+
+    data += count;
+    size -= count;
+    m_pendingDataSize = 0;
+  }
+
+  // consume whole stripes directly from input
+  const s32 consumed = ConsumeStripes64(m_accumulators, data, size);
+
+  // store remaining data
+  m_pendingDataSize = size - consumed;
+  memcpy(m_pendingData, data + consumed, m_pendingDataSize);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u64 HashStream::digest() const
+{
+  u64 hash = (static_cast<u64>(KStripeSize64) <= m_totalSize) ? MergeAccumulators64(m_accumulators) : (m_seed + KPrime64_5);
+  hash += m_totalSize;
+
+  return Finalize64(hash, m_pendingData, m_pendingDataSize);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
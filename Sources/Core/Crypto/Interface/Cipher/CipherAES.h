@@ -1,7 +1,11 @@
 #ifndef EGE_CORE_CRYPTO_CIPHER_CIPHERAES_H
 #define EGE_CORE_CRYPTO_CIPHER_CIPHERAES_H
 
-/** Class providing the way to encrypt/decrypt data using Advanced Encryption Standard specification. */
+/** Class providing the way to encrypt/decrypt data using Advanced Encryption Standard specification. 
+ *  Encrypted data consists of initialization vector followed by blocks of data, one per each call to addData. Every block is preceeded by its length.
+ *  Decryption is streamed, ie. encrypted data can be added in any portions. Every complete cipher block is decrypted as soon as it is available.
+ *  As CBC decryption of a cipher block depends on the previous cipher block only, blocks are decrypted in parallel if job system is given.
+ */
 
 #include "Core/Crypto/Interface/Cipher/Cipher.h"
 
@@ -9,12 +13,18 @@ EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGE_DECLARE_SMART_CLASS(CipherKey, PCipherKey)
+class JobSystem;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class CipherAES : public Cipher
 {
   public:
 
-    CipherAES(CipherDirection direction, const PCipherKey& key);
+    /*! Constructor.
+     *  @param  direction Ciphering direction.
+     *  @param  key       Key to use. Must be valid AES key.
+     *  @param  jobSystem Job system used to decrypt large amounts of data in parallel. If NULL, data is decrypted serially.
+     */
+    CipherAES(CipherDirection direction, const PCipherKey& key, JobSystem* jobSystem = NULL);
    ~CipherAES();
 
     EGE_DECLARE_NEW_OPERATORS
@@ -43,6 +53,40 @@ class CipherAES : public Cipher
 
     /*! Resets initialization vectors. */
     void resetInitializationVectors();
+    /*! Encrypts given data as a new block. */
+    EGEResult encrypt(const char* data, s32 length);
+    /*! Decrypts given portion of data. */
+    EGEResult decrypt(const char* data, s32 length);
+    /*! Moves data from input into pending data until required number of bytes is gathered.
+     *  @param  data            Input data. Advanced by number of bytes moved.
+     *  @param  length          Input data length. Decreased by number of bytes moved.
+     *  @param  requiredLength  Number of bytes required in pending data.
+     *  @return TRUE if pending data contains required number of bytes.
+     */
+    bool gatherPendingData(const u8*& data, s32& length, s32 requiredLength);
+    /*! Decrypts given number of cipher blocks of current data block and appends result to output. */
+    void decryptBlocks(const u8* data, s32 count);
+    /*! Job function decrypting range of cipher blocks. */
+    void onDecryptRange(u32 begin, u32 end);
+
+  private:
+
+    /*! Job system used for parallel decryption. Can be NULL. */
+    JobSystem* m_jobSystem;
+    /*! Incomplete input data (initialization vector, block length or cipher block) gathered so far. */
+    u8 m_pendingData[16];
+    /*! Number of bytes in pending data. */
+    s32 m_pendingDataLength;
+    /*! TRUE if initialization vector has been read. */
+    bool m_initializationVectorRead;
+    /*! Number of bytes of current data block yet to be decrypted. */
+    s32 m_blockBytesLeft;
+    /*! Number of cipher blocks of current data block yet to be decrypted. Zero if length of the next data block is expected. */
+    s32 m_blockCipherBlocksLeft;
+    /*! Input cipher blocks being decrypted in parallel. */
+    const u8* m_parallelInput;
+    /*! Output buffer for cipher blocks being decrypted in parallel. */
+    u8* m_parallelOutput;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -1,12 +1,18 @@
 #ifndef EGE_CORE_CRYPTO_CIPHER_CIPHERKEY_H
 #define EGE_CORE_CRYPTO_CIPHER_CIPHERKEY_H
 
-/** Class representing key used to cipher data. */
+/** Class representing key used to cipher data. 
+ *  If key length is valid AES key length, AES encryption and decryption key schedules are expanded once upon creation so they are not recalculated by 
+ *  every cipher using the key.
+ */
 
 #include "EGEString.h"
 #include "EGEDataBuffer.h"
 #include "EGEDebug.h"
 
+/*! Forward declaration of OpenSSL AES key schedule. */
+struct aes_key_st;
+
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -27,11 +33,24 @@ class CipherKey : public Object
     u8* data() const;
     /*! Returns length of the key (in bytes). */
     s64 length() const;
+    /*! Returns AES encryption key schedule. NULL if key is not valid AES key. */
+    const aes_key_st* aesEncryptKey() const;
+    /*! Returns AES decryption key schedule. NULL if key is not valid AES key. */
+    const aes_key_st* aesDecryptKey() const;
+
+  private:
+
+    /*! Expands AES key schedules if key length allows. */
+    void expandAESKeys();
 
   private:
 
     /*! Key data. */
     DataBuffer m_key;
+    /*! AES encryption key schedule. NULL if not available. */
+    aes_key_st* m_aesEncryptKey;
+    /*! AES decryption key schedule. NULL if not available. */
+    aes_key_st* m_aesDecryptKey;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
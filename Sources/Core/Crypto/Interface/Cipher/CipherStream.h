@@ -0,0 +1,62 @@
+#ifndef EGE_CORE_CRYPTO_CIPHER_CIPHERSTREAM_H
+#define EGE_CORE_CRYPTO_CIPHER_CIPHERSTREAM_H
+
+/** Adapter passing data thru cipher while it is being read from file. 
+ *  Data is read in chunks of fixed size into reusable buffer and every chunk is given to cipher as soon as it is read. This way whole ciphered data is 
+ *  never held in memory and deciphering of every chunk happens while it is still in cache.
+ */
+
+#include "EGE.h"
+#include "EGEDataBuffer.h"
+#include "Core/Crypto/Interface/Cipher/Cipher.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Default size of the chunk data is read in (in bytes). */
+#define EGE_CIPHER_STREAM_DEFAULT_CHUNK_SIZE (64 * 1024)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class File;
+
+EGE_DECLARE_SMART_CLASS(CipherStream, PCipherStream)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class CipherStream : public Object
+{
+  public:
+
+    /*! Constructor.
+     *  @param  cipher    Cipher data is passed thru.
+     *  @param  chunkSize Size of the chunk data is read in (in bytes).
+     */
+    CipherStream(const PCipher& cipher, s32 chunkSize = EGE_CIPHER_STREAM_DEFAULT_CHUNK_SIZE);
+   ~CipherStream();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+  public:
+
+    /*! Reads data from file and passes it thru cipher.
+     *  @param  file  File to read data from. Must be opened.
+     *  @param  size  Number of bytes to read. If negative, all data till the end of the file is read.
+     *  @return Returns number of bytes read from file. Negative value if error occured.
+     *  @note Result buffer capacity of the cipher is reserved upfront so it is not reallocated while streaming.
+     */
+    s64 read(File& file, s64 size = -1);
+    /*! Returns cipher. */
+    const PCipher& cipher() const { return m_cipher; }
+
+  private:
+
+    /*! Cipher data is passed thru. */
+    PCipher m_cipher;
+    /*! Chunk buffer. */
+    PDataBuffer m_chunk;
+    /*! Size of the chunk (in bytes). */
+    s32 m_chunkSize;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_CRYPTO_CIPHER_CIPHERSTREAM_H
@@ -1,7 +1,9 @@
 #ifndef EGE_CORE_CRYPTO_CIPHER_CIPHERXOR_H
 #define EGE_CORE_CRYPTO_CIPHER_CIPHERXOR_H
 
-/** Class providing the way to encrypt/decrypt data. */
+/** Class providing the way to encrypt/decrypt data. 
+ *  Key is expanded into repeating pattern upon creation so data can be processed one machine word at a time.
+ */
 
 #include "Core/Crypto/Interface/Cipher/Cipher.h"
 
@@ -32,10 +34,21 @@ class CipherXOR : public Cipher
     /*! @see Cipher::reset. */
     void reset() override;
 
+  private:
+
+    /*! Expands key into repeating pattern. */
+    void expandKey();
+
   private:
 
     /*! Current index within key. */
     s32 m_keyIndex;
+    /*! Key repeated over the period being multiple of machine word size, followed by one extra word of its beginning. This allows to read one full word
+     *  of key at any index within period.
+     */
+    DataBuffer m_expandedKey;
+    /*! Length of repeating pattern within expanded key (in bytes). */
+    s32 m_expandedKeyPeriod;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
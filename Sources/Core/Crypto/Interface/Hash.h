@@ -1,7 +1,7 @@
 #ifndef EGE_CORE_HASH_H
 #define EGE_CORE_HASH_H
 
-/** This class calculates 32-bit hash values from given input data. */
+/** This class calculates 32-bit and 64-bit hash values from given input data. */
 
 #include "EGETypes.h"
 #include "EGEString.h"
@@ -20,6 +20,64 @@ class Hash
      *         23 to produce fewer collisions on input such as "a", "aa", "aaa", "aaaa", ...
      */
     static u32 FromData(const u8* data, s32 size);
+    /*! Calculates 32-bit hash of data using fast word-at-a-time algorithm.
+     *  @param  data  Data from which hash is to be calculated.
+     *  @param  size  Size of data (in bytes).
+     *  @param  seed  Seed value. Different seeds yield unrelated hash values for the same data.
+     *  @return 32-bit hash.
+     *  @note  This is xxHash32 by Yann Collet. Data is consumed in 16-byte stripes by 4 independent lanes which gives good distribution even for short and 
+     *         similar keys. Resulting values are the same as of reference implementation on little-endian platforms.
+     */
+    static u32 FromData32(const u8* data, s32 size, u32 seed = 0);
+    /*! Calculates 64-bit hash of data using fast word-at-a-time algorithm.
+     *  @param  data  Data from which hash is to be calculated.
+     *  @param  size  Size of data (in bytes).
+     *  @param  seed  Seed value. Different seeds yield unrelated hash values for the same data.
+     *  @return 64-bit hash.
+     *  @note  This is xxHash64 by Yann Collet. Data is consumed in 32-byte stripes. Resulting values are the same as of reference implementation on 
+     *         little-endian platforms.
+     *  @see HashStream for calculating the same hash from data available in portions.
+     */
+    static u64 FromData64(const u8* data, s32 size, u64 seed = 0);
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** This class calculates 64-bit hash of data supplied in arbitrary portions. 
+ *  Resulting value is the same as of Hash::FromData64 called for all data at once.
+ */
+class HashStream
+{
+  public:
+
+    HashStream(u64 seed = 0);
+
+  public:
+
+    /*! Resets hashing state. 
+     *  @param  seed  Seed value to use.
+     */
+    void reset(u64 seed = 0);
+    /*! Appends data to hash.
+     *  @param  data  Data to append.
+     *  @param  size  Size of data (in bytes).
+     */
+    void update(const u8* data, s32 size);
+    /*! Returns 64-bit hash of all data appended so far. 
+     *  @note  State is not modified so more data can still be appended afterwards.
+     */
+    u64 digest() const;
+
+  private:
+
+    /*! Lane accumulators. */
+    u64 m_accumulators[4];
+    /*! Data not yet consumed by accumulators, less than one stripe. */
+    u8 m_pendingData[32];
+    /*! Number of bytes in pending data buffer. */
+    s32 m_pendingDataSize;
+    /*! Total number of bytes appended. */
+    u64 m_totalSize;
+    /*! Seed value. */
+    u64 m_seed;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -0,0 +1,169 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGEHash.h>
+#include <EGEMath.h>
+#include <EGEString.h>
+#include <EGETimer.h>
+#include <string>
+#include <vector>
+
+/** Micro-benchmarks of non-cryptographic hash functions.
+ *  Each benchmark hashes the same randomized data set a number of times and reports average duration of a single pass. Both large buffers and short keys 
+ *  are measured as the latter ones are dominated by setup and finalization costs.
+ */
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Size of large data buffer (in bytes). */
+#define BUFFER_SIZE     (1024 * 1024)
+/*! Number of short keys. */
+#define KEYS_COUNT      4096
+/*! Number of measured passes. */
+#define MEASURED_PASSES 50
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class HashBenchmark : public TestBase
+{
+  protected:
+
+    virtual void SetUp();
+
+  protected:
+
+    /*! Prints and records given total duration of all measured passes. */
+    void report(const char* name, s64 totalDuration, s32 elementsCount);
+
+  protected:
+
+    /*! Large data buffer. */
+    std::vector<u8> m_buffer;
+    /*! Short keys. */
+    std::vector<std::string> m_keys;
+    /*! Accumulated hash values. */
+    u64 m_result;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void HashBenchmark::SetUp()
+{
+  m_buffer.resize(BUFFER_SIZE);
+  for (s32 i = 0; i < BUFFER_SIZE; ++i)
+  {
+    m_buffer[i] = static_cast<u8>(rand() % 256);
+  }
+
+  for (s32 i = 0; i < KEYS_COUNT; ++i)
+  {
+    m_keys.push_back(String::Format("resource-%d", rand()).toAscii());
+  }
+
+  // NOTE: results are accumulated so no calculation can be optimized away
+  m_result = 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void HashBenchmark::report(const char* name, s64 totalDuration, s32 elementsCount)
+{
+  std::cout << "[ BENCH    ] " << name << ": passes " << MEASURED_PASSES << " x " << elementsCount << ", avg " << (totalDuration / MEASURED_PASSES) << "us"
+            << " (result " << m_result << ")" << std::endl;
+
+  RecordProperty("AveragePassDuration", static_cast<int>(totalDuration / MEASURED_PASSES));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashBenchmark, LargeBufferLegacy)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    m_result += Hash::FromData(&m_buffer[0], BUFFER_SIZE);
+  }
+
+  report("LargeBufferLegacy", Timer::GetMicroseconds() - startTime, BUFFER_SIZE);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashBenchmark, LargeBuffer32)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    m_result += Hash::FromData32(&m_buffer[0], BUFFER_SIZE);
+  }
+
+  report("LargeBuffer32", Timer::GetMicroseconds() - startTime, BUFFER_SIZE);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashBenchmark, LargeBuffer64)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    m_result += Hash::FromData64(&m_buffer[0], BUFFER_SIZE);
+  }
+
+  report("LargeBuffer64", Timer::GetMicroseconds() - startTime, BUFFER_SIZE);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashBenchmark, LargeBufferStream)
+{
+  // NOTE: odd portion size so most portions leave pending data behind
+  const s32 portionSize = 4093;
+
+  HashStream stream;
+
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    stream.reset();
+    for (s32 offset = 0; offset < BUFFER_SIZE; offset += portionSize)
+    {
+      stream.update(&m_buffer[offset], Math::Min(portionSize, BUFFER_SIZE - offset));
+    }
+
+    m_result += stream.digest();
+  }
+
+  report("LargeBufferStream", Timer::GetMicroseconds() - startTime, BUFFER_SIZE);
+
+  // verify against one-shot calculation
+  EXPECT_EQ(Hash::FromData64(&m_buffer[0], BUFFER_SIZE), stream.digest());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashBenchmark, ShortKeysLegacy)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    for (s32 i = 0; i < KEYS_COUNT; ++i)
+    {
+      m_result += Hash::FromData(reinterpret_cast<const u8*>(m_keys[i].c_str()), static_cast<s32>(m_keys[i].length()));
+    }
+  }
+
+  report("ShortKeysLegacy", Timer::GetMicroseconds() - startTime, KEYS_COUNT);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashBenchmark, ShortKeys32)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    for (s32 i = 0; i < KEYS_COUNT; ++i)
+    {
+      m_result += Hash::FromData32(reinterpret_cast<const u8*>(m_keys[i].c_str()), static_cast<s32>(m_keys[i].length()));
+    }
+  }
+
+  report("ShortKeys32", Timer::GetMicroseconds() - startTime, KEYS_COUNT);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashBenchmark, ShortKeys64)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    for (s32 i = 0; i < KEYS_COUNT; ++i)
+    {
+      m_result += Hash::FromData64(reinterpret_cast<const u8*>(m_keys[i].c_str()), static_cast<s32>(m_keys[i].length()));
+    }
+  }
+
+  report("ShortKeys64", Timer::GetMicroseconds() - startTime, KEYS_COUNT);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "TestFramework/Interface/TestBase.h"
 #include <EGECipher.h>
 #include <EGEDataBuffer.h>
+#include <EGEMath.h>
+#include <EGEJobSystem.h>
+#include <vector>
 
 EGE_NAMESPACE
 
@@ -10,6 +13,9 @@ static char* KPlainText = "This is a simple plain text to be encrypted and decry
 static char* KPlainText2 = "This is a another simple plain text to be encrypted and decrypted\n"
                            "Lets hope we can do it without loosing any data as well!!!!";
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Size of data used by streaming and parallel tests. Large enough to be decrypted in parallel. */
+static const s32 KLargeDataSize = 1024 * 1024 + 123;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class CipherAESTest : public TestBase
 {
   protected:
@@ -20,6 +26,11 @@ class CipherAESTest : public TestBase
   protected:
 
     CipherAESTest();
+
+    /*! Generates random data of given size. */
+    std::vector<char> generateData(s32 size) const;
+    /*! Encrypts given data in blocks of given lengths. Remaining data is encrypted as the last block. */
+    PDataBuffer encrypt(CipherAES& encryptor, const std::vector<char>& data, const s32* blockLengths, s32 blockLengthsCount) const;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 CipherAESTest::CipherAESTest() : TestBase(0.0001f)
@@ -36,6 +47,31 @@ void CipherAESTest::TearDownTestCase()
   MemoryManager::Deinitialize();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+std::vector<char> CipherAESTest::generateData(s32 size) const
+{
+  std::vector<char> data(size);
+  for (s32 i = 0; i < size; ++i)
+  {
+    data[i] = static_cast<char>(rand() & 0xff);
+  }
+
+  return data;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PDataBuffer CipherAESTest::encrypt(CipherAES& encryptor, const std::vector<char>& data, const s32* blockLengths, s32 blockLengthsCount) const
+{
+  s32 offset = 0;
+  for (s32 i = 0; i < blockLengthsCount; ++i)
+  {
+    EXPECT_EQ(EGE_SUCCESS, encryptor.addData(&data[offset], blockLengths[i]));
+    offset += blockLengths[i];
+  }
+
+  EXPECT_EQ(EGE_SUCCESS, encryptor.addData(&data[offset], static_cast<s32>(data.size()) - offset));
+
+  return encryptor.result();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 TEST_F(CipherAESTest, EncryptDecryptViaDataBuffers)
 {
   CipherKey key("ThisIsDummyAESKe");
@@ -147,3 +183,63 @@ TEST_F(CipherAESTest, EncryptMultipass)
   EXPECT_EQ(0, memcmp(decryptedData->data(), KPlainText, strlen(KPlainText)));
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(CipherAESTest, StreamedDecryption)
+{
+  CipherKey key("ThisIsDummyAESKe");
+  CipherAES encryptor(EEncrypt, key);
+  CipherAES decryptor(EDecrypt, key);
+
+  // encrypt data in blocks
+  // NOTE: empty blocks and blocks being multiples of cipher block size are included
+  const s32 blockLengths[] = { 1, 16, 0, 32, 1000, 4096, 4095, 15, 17 };
+  const std::vector<char> data = generateData(KLargeDataSize);
+  PDataBuffer encryptedData = encrypt(encryptor, data, blockLengths, sizeof (blockLengths) / sizeof (blockLengths[0]));
+
+  // decrypt in portions of varying size
+  const char* encrypted = reinterpret_cast<const char*>(encryptedData->data());
+  const s32 encryptedSize = static_cast<s32>(encryptedData->size());
+  s32 offset = 0;
+  s32 portion = 1;
+  while (offset < encryptedSize)
+  {
+    const s32 length = Math::Min(portion, encryptedSize - offset);
+    EXPECT_EQ(EGE_SUCCESS, decryptor.addData(encrypted + offset, length));
+
+    offset += length;
+    portion = ((portion * 7 + 3) % 5003) + 1;
+  }
+
+  // get decrypted data
+  PDataBuffer decryptedData = decryptor.result();
+
+  // compare results
+  ASSERT_EQ(static_cast<s64>(data.size()), decryptedData->size());
+  EXPECT_EQ(0, memcmp(decryptedData->data(), &data[0], data.size()));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(CipherAESTest, ParallelDecryption)
+{
+  PJobSystem jobSystem = ege_new JobSystem(NULL);
+  ASSERT_TRUE(NULL != jobSystem);
+  ASSERT_EQ(EGE_SUCCESS, jobSystem->construct(3));
+
+  CipherKey key("ThisIsDummyAESKe");
+  CipherAES encryptor(EEncrypt, key);
+  CipherAES decryptor(EDecrypt, key, jobSystem);
+
+  // encrypt data in two large blocks
+  const s32 blockLengths[] = { KLargeDataSize / 3 };
+  const std::vector<char> data = generateData(KLargeDataSize);
+  PDataBuffer encryptedData = encrypt(encryptor, data, blockLengths, sizeof (blockLengths) / sizeof (blockLengths[0]));
+
+  // decrypt
+  EXPECT_EQ(EGE_SUCCESS, decryptor.addData(reinterpret_cast<const char*>(encryptedData->data()), static_cast<s32>(encryptedData->size())));
+
+  // get decrypted data
+  PDataBuffer decryptedData = decryptor.result();
+
+  // compare results
+  ASSERT_EQ(static_cast<s64>(data.size()), decryptedData->size());
+  EXPECT_EQ(0, memcmp(decryptedData->data(), &data[0], data.size()));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,128 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGECipher.h>
+#include <EGEDataBuffer.h>
+#include <EGEFile.h>
+#include <EGEJobSystem.h>
+#include <vector>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+static const char* KFilePath  = "cipher-stream-test.bin";
+static const s32 KDataSize    = 100 * 1024 + 7;
+static const s32 KChunkSize   = 1000;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class CipherStreamTest : public TestBase
+{
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void SetUp();
+    virtual void TearDown();
+
+  protected:
+
+    /*! Writes data ciphered by given cipher into test file. */
+    void writeFile(Cipher& encryptor);
+    /*! Reads test file thru given cipher in chunks of given size and compares result with original data. */
+    void readFile(const PCipher& decryptor, s32 chunkSize = KChunkSize);
+
+  protected:
+
+    /*! Original data. */
+    std::vector<char> m_data;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CipherStreamTest::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CipherStreamTest::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CipherStreamTest::SetUp()
+{
+  m_data.resize(KDataSize);
+  for (s32 i = 0; i < KDataSize; ++i)
+  {
+    m_data[i] = static_cast<char>(rand() & 0xff);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CipherStreamTest::TearDown()
+{
+  // cleanup
+  File::Remove(KFilePath);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CipherStreamTest::writeFile(Cipher& encryptor)
+{
+  EXPECT_EQ(EGE_SUCCESS, encryptor.addData(&m_data[0], KDataSize));
+
+  File file(KFilePath);
+  ASSERT_EQ(EGE_SUCCESS, file.open(EGEFile::MODE_WRITE_ONLY));
+  EXPECT_EQ(encryptor.result()->size(), file.write(encryptor.result()));
+  file.close();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CipherStreamTest::readFile(const PCipher& decryptor, s32 chunkSize)
+{
+  File file(KFilePath);
+  ASSERT_EQ(EGE_SUCCESS, file.open(EGEFile::MODE_READ_ONLY));
+
+  const s64 size = file.size();
+
+  // read all data in chunks
+  CipherStream stream(decryptor, chunkSize);
+  EXPECT_EQ(size, stream.read(file));
+
+  // compare results
+  PDataBuffer decryptedData = decryptor->result();
+  ASSERT_EQ(KDataSize, decryptedData->size());
+  EXPECT_EQ(0, memcmp(decryptedData->data(), &m_data[0], KDataSize));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(CipherStreamTest, ReadXOR)
+{
+  CipherKey key("Dummy key");
+  CipherXOR encryptor(EEncrypt, key);
+  CipherXOR decryptor(EDecrypt, key);
+
+  writeFile(encryptor);
+  readFile(decryptor);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(CipherStreamTest, ReadAES)
+{
+  CipherKey key("ThisIsDummyAESKe");
+  CipherAES encryptor(EEncrypt, key);
+  CipherAES decryptor(EDecrypt, key);
+
+  writeFile(encryptor);
+  readFile(decryptor);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(CipherStreamTest, ReadAESParallel)
+{
+  PJobSystem jobSystem = ege_new JobSystem(NULL);
+  ASSERT_TRUE(NULL != jobSystem);
+  ASSERT_EQ(EGE_SUCCESS, jobSystem->construct(3));
+
+  CipherKey key("ThisIsDummyAESKe");
+  CipherAES encryptor(EEncrypt, key);
+  CipherAES decryptor(EDecrypt, key, jobSystem);
+
+  // NOTE: data is ciphered as single data block so every full chunk of default size is large enough to be decrypted in parallel
+  ASSERT_LT(EGE_CIPHER_STREAM_DEFAULT_CHUNK_SIZE, KDataSize);
+
+  writeFile(encryptor);
+  readFile(decryptor, EGE_CIPHER_STREAM_DEFAULT_CHUNK_SIZE);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
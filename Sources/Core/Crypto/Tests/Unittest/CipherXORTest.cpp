@@ -1,6 +1,7 @@
 #include "TestFramework/Interface/TestBase.h"
 #include <EGECipher.h>
 #include <EGEDataBuffer.h>
+#include <EGEMath.h>
 
 EGE_NAMESPACE
 
@@ -147,3 +148,48 @@ TEST_F(CipherXORTest, EncryptMultipass)
   EXPECT_EQ(0, memcmp(decryptedData->data(), KPlainText, strlen(KPlainText)));
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(CipherXORTest, KeyLengths)
+{
+  const s32 KDataLength = 1000;
+
+  // generate data
+  char data[KDataLength];
+  for (s32 i = 0; i < KDataLength; ++i)
+  {
+    data[i] = static_cast<char>(rand() & 0xff);
+  }
+
+  // test keys of different lengths
+  // NOTE: some are shorter than machine word, some are not multiples of it
+  const char* keys[] = { "k", "key", "Dummy key", "DummyKey", "This is much longer dummy key" };
+  for (size_t i = 0; i < sizeof (keys) / sizeof (keys[0]); ++i)
+  {
+    CipherKey key(keys[i]);
+    CipherXOR encryptor(EEncrypt, key);
+
+    // encrypt in portions of varying size
+    s32 offset = 0;
+    s32 portion = 1;
+    while (offset < KDataLength)
+    {
+      const s32 length = Math::Min(portion, KDataLength - offset);
+      EXPECT_EQ(EGE_SUCCESS, encryptor.addData(data + offset, length));
+
+      offset += length;
+      portion = ((portion * 5 + 3) % 61) + 1;
+    }
+
+    // get encrypted data
+    PDataBuffer encryptedData = encryptor.result();
+    ASSERT_EQ(KDataLength, encryptedData->size());
+
+    // compare with reference
+    const s32 keyLength = static_cast<s32>(strlen(keys[i]));
+    const char* encrypted = reinterpret_cast<const char*>(encryptedData->data());
+    for (s32 j = 0; j < KDataLength; ++j)
+    {
+      EXPECT_EQ(static_cast<char>(data[j] ^ keys[i][j % keyLength]), encrypted[j]);
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1,12 +1,20 @@
 #include "TestFramework/Interface/TestBase.h"
 #include <EGEHash.h>
+#include <EGEMath.h>
 #include <EGEString.h>
 #include <string>
+#include <vector>
 
 EGE_NAMESPACE
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 static const int KRepetitionsCount = 20;
+// NOTE: RAND_MAX is platform dependent, data size is limited to keep test execution time reasonable
+static const int KMaxDataSize = 32767;
+/*! Number of keys used for distribution tests. */
+static const int KDistributionKeysCount = 65536;
+/*! Number of buckets used for distribution tests. Needs to be power of 2. */
+static const u32 KDistributionBucketsCount = 1024;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class HashTest : public TestBase
 {
@@ -25,6 +33,14 @@ class HashTest : public TestBase
      *  @return 32-bit hash.
      */
     u32 hash(const std::string& data) const;
+    /*! Calculates chi-squared statistic of given hash values distributed into buckets.
+     *  @param  hashes  Hash values.
+     *  @param  shift   Number of bits hash values are shifted right by before bucket index is taken from lowest bits.
+     *  @return Chi-squared statistic. For uniform distribution it is close to number of buckets.
+     */
+    float64 chiSquared(const std::vector<u64>& hashes, u32 shift) const;
+    /*! Generates set of short and similar keys. */
+    std::vector<std::string> generateKeys() const;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 HashTest::HashTest() : TestBase(0.0001f)
@@ -52,12 +68,45 @@ u32 HashTest::hash(const std::string& data) const
   return hash(reinterpret_cast<const u8*>(data.c_str()), static_cast<s32>(data.length()));
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+float64 HashTest::chiSquared(const std::vector<u64>& hashes, u32 shift) const
+{
+  std::vector<u32> buckets(KDistributionBucketsCount, 0);
+  for (size_t i = 0; i < hashes.size(); ++i)
+  {
+    buckets[(hashes[i] >> shift) & (KDistributionBucketsCount - 1)]++;
+  }
+
+  const float64 expected = static_cast<float64>(hashes.size()) / KDistributionBucketsCount;
+
+  float64 value = 0;
+  for (u32 i = 0; i < KDistributionBucketsCount; ++i)
+  {
+    const float64 delta = buckets[i] - expected;
+    value += (delta * delta) / expected;
+  }
+
+  return value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+std::vector<std::string> HashTest::generateKeys() const
+{
+  std::vector<std::string> keys;
+
+  // NOTE: keys such as identifiers and file names typically share prefixes and differ in few trailing characters only
+  for (int i = 0; i < KDistributionKeysCount; ++i)
+  {
+    keys.push_back(String::Format("key%d", i).toAscii());
+  }
+
+  return keys;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 TEST_F(HashTest, HashFromData)
 {
   // perform fixed number of tests
   for (int i = 0; i < KRepetitionsCount; ++i)
   {
-    const int dataSize = rand() + 1;
+    const int dataSize = (rand() % KMaxDataSize) + 1;
     u8* data = new u8[dataSize];
 
     EXPECT_TRUE(NULL!= data);
@@ -87,7 +136,7 @@ TEST_F(HashTest, HashFromString)
   // perform fixed number of tests
   for (int i = 0; i < KRepetitionsCount; ++i)
   {
-    const int dataSize = rand() + 1;
+    const int dataSize = (rand() % KMaxDataSize) + 1;
 
     std::string data;
 
@@ -108,3 +157,148 @@ TEST_F(HashTest, HashFromString)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashTest, HashFromData32KnownValues)
+{
+  const std::string text = "Nobody inspects the spammish repetition";
+
+  // reference xxHash32 values
+  EXPECT_EQ(0x02CC5D05U, Hash::FromData32(NULL, 0));
+  EXPECT_EQ(0x32D153FFU, Hash::FromData32(reinterpret_cast<const u8*>("abc"), 3));
+  EXPECT_EQ(0xE2293B2FU, Hash::FromData32(reinterpret_cast<const u8*>(text.c_str()), static_cast<s32>(text.length())));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashTest, HashFromData64KnownValues)
+{
+  const std::string text = "Nobody inspects the spammish repetition";
+
+  // reference xxHash64 values
+  EXPECT_EQ(0xEF46DB3751D8E999ULL, Hash::FromData64(NULL, 0));
+  EXPECT_EQ(0x44BC2CF5AD770999ULL, Hash::FromData64(reinterpret_cast<const u8*>("abc"), 3));
+  EXPECT_EQ(0xFBCEA83C8A378BF1ULL, Hash::FromData64(reinterpret_cast<const u8*>(text.c_str()), static_cast<s32>(text.length())));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashTest, HashFromDataSeed)
+{
+  const u8 data[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+  EXPECT_NE(Hash::FromData32(data, sizeof (data), 0), Hash::FromData32(data, sizeof (data), 1));
+  EXPECT_NE(Hash::FromData64(data, sizeof (data), 0), Hash::FromData64(data, sizeof (data), 1));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashTest, HashStream)
+{
+  // perform fixed number of tests
+  for (int i = 0; i < KRepetitionsCount; ++i)
+  {
+    const int dataSize = (rand() % KMaxDataSize) + 1;
+    const u64 seed = static_cast<u64>(rand());
+
+    std::vector<u8> data(dataSize);
+
+    // initialize data
+    for (s32 j = 0; j < dataSize; ++j)
+    {
+      data[j] = static_cast<u8>(rand() % 256);
+    }
+
+    // calculate reference hash
+    const u64 expectedHash = Hash::FromData64(&data[0], dataSize, seed);
+
+    // calculate hash from portions of random sizes
+    HashStream stream(seed);
+    for (s32 offset = 0; offset < dataSize;)
+    {
+      const s32 size = Math::Min(rand() % 100, dataSize - offset);
+      stream.update(&data[offset], size);
+      offset += size;
+    }
+
+    // test
+    EXPECT_EQ(expectedHash, stream.digest());
+
+    // test reset
+    stream.reset(seed);
+    stream.update(&data[0], dataSize);
+    EXPECT_EQ(expectedHash, stream.digest());
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashTest, Distribution)
+{
+  const std::vector<std::string> keys = generateKeys();
+
+  std::vector<u64> hashes32;
+  std::vector<u64> hashes64;
+  std::vector<u64> hashesLegacy;
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    const u8* data = reinterpret_cast<const u8*>(keys[i].c_str());
+    const s32 size = static_cast<s32>(keys[i].length());
+
+    hashes32.push_back(Hash::FromData32(data, size));
+    hashes64.push_back(Hash::FromData64(data, size));
+    hashesLegacy.push_back(Hash::FromData(data, size));
+  }
+
+  // NOTE: for uniform distribution statistic is around number of buckets with standard deviation of sqrt(2 * buckets), allow generous margin
+  const float64 limit = KDistributionBucketsCount * 1.25;
+
+  // test low and high bits of each hash
+  EXPECT_GT(limit, chiSquared(hashes32, 0));
+  EXPECT_GT(limit, chiSquared(hashes32, 22));
+  EXPECT_GT(limit, chiSquared(hashes64, 0));
+  EXPECT_GT(limit, chiSquared(hashes64, 54));
+
+  // legacy hash concentrates similar keys in few buckets
+  EXPECT_LT(limit, chiSquared(hashesLegacy, 0));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(HashTest, Avalanche)
+{
+  const std::vector<std::string> keys = generateKeys();
+
+  u64 flippedBits32 = 0;
+  u64 flippedBits64 = 0;
+  u64 flipsCount = 0;
+
+  // flip every bit of every key and count changed bits of hash
+  for (size_t i = 0; i < keys.size(); i += 64)
+  {
+    std::string key = keys[i];
+
+    const u8* data = reinterpret_cast<const u8*>(key.c_str());
+    const s32 size = static_cast<s32>(key.length());
+
+    const u32 hash32 = Hash::FromData32(data, size);
+    const u64 hash64 = Hash::FromData64(data, size);
+
+    for (s32 bit = 0; bit < size * 8; ++bit)
+    {
+      key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+
+      u32 diff32 = hash32 ^ Hash::FromData32(data, size);
+      u64 diff64 = hash64 ^ Hash::FromData64(data, size);
+
+      for (; 0 != diff32; diff32 &= diff32 - 1)
+      {
+        ++flippedBits32;
+      }
+
+      for (; 0 != diff64; diff64 &= diff64 - 1)
+      {
+        ++flippedBits64;
+      }
+
+      key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+      ++flipsCount;
+    }
+  }
+
+  // each input bit should flip about half of output bits
+  const float64 ratio32 = static_cast<float64>(flippedBits32) / (flipsCount * 32);
+  const float64 ratio64 = static_cast<float64>(flippedBits64) / (flipsCount * 64);
+
+  EXPECT_NEAR(0.5, ratio32, 0.01);
+  EXPECT_NEAR(0.5, ratio64, 0.01);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
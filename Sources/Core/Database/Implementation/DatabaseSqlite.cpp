@@ -1,6 +1,6 @@
 #include "Core/Database/Interface/DatabaseSqlite.h"
 #include "Core/Database/Implementation/SqlResultSqlite.h"
-#include "Core/ComplexTypes.h"
+#include "Core/Database/Implementation/SqlCursorSqlite.h"
 #include "EGEDebug.h"
 #include <sqlite3.h>
 
@@ -8,6 +8,7 @@ EGE_NAMESPACE
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 static const char* KDatabaseSqliteDebugName = "EGEDatabaseSqlite";
+static const u32 KDefaultStatementCacheSize  = 32;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGE_DEFINE_NEW_OPERATORS(DatabaseSqlite)
 EGE_DEFINE_DELETE_OPERATORS(DatabaseSqlite)
@@ -16,6 +17,8 @@ DatabaseSqlite::DatabaseSqlite() : Database()
                                  , m_handle(NULL)
                                  , m_inTransaction(false)
                                  , m_result(NULL)
+                                 , m_statementCacheSize(KDefaultStatementCacheSize)
+                                 , m_statementUseCounter(0)
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -80,6 +83,9 @@ EGEResult DatabaseSqlite::close()
   // check if any database open
   if (NULL != m_handle)
   {
+    // finalize all cached statements
+    clearStatementCache();
+
     int sqliteResult = ::sqlite3_close_v2(m_handle);
 
     // process return value
@@ -218,170 +224,405 @@ EGEResult DatabaseSqlite::execute(const SqlQuery& query)
     result = EGE_ERROR_NO_MEMORY;
   }
 
+  // acquire statement object
+  ::sqlite3_stmt* statementObject = NULL;
   if (EGE_SUCCESS == result)
   {
-    ::sqlite3_stmt* statementObject = NULL;
+    result = acquireStatement(query.value(), &statementObject);
+  }
 
-    // prepare statement object
-    int sqlResult = ::sqlite3_prepare_v2(m_handle, query.value().toAscii(), static_cast<int>(query.value().length()), &statementObject, NULL);
-    switch (sqlResult)
-    {
-      case SQLITE_OK: result = EGE_SUCCESS; break;
-      default:
+  // bind values
+  if (EGE_SUCCESS == result)
+  {
+    result = bindValues(statementObject, query.values(), 0, static_cast<u32>(query.values().size()), false);
+  }
 
-        // error!
-        result = EGE_ERROR;
-        egeWarning(KDatabaseSqliteDebugName) << "Could not prepare statement object! Sqlite error:" << sqlResult;
-        break;
-    }
+  // process statement object
+  if (EGE_SUCCESS == result)
+  {
+    result = step(statementObject, ege_cast<SqlResultSqlite*>(resultObject));
+  }
 
-    if (EGE_SUCCESS == result)
-    {
-      // bind values
-      const List<PObject>& objects = query.values();
-      s32 i = 1;
-      for (List<PObject>::const_iterator it = objects.begin(); (it != objects.end()) && (EGE_SUCCESS == result); ++it, ++i)
-      {
-        const PObject object = *it;
+  // release statement
+  if (NULL != statementObject)
+  {
+    releaseStatement(query.value(), statementObject);
+  }
 
-        // process accroding to object type
-        switch (object->uid())
-        {
-          case EGE_OBJECT_UID_STRING_BUFFER:
+  // set new result
+  m_result = (EGE_SUCCESS == result) ? resultObject : NULL;
 
-            sqlResult = ::sqlite3_bind_text(statementObject, i, ege_pcast<PStringBuffer>(object)->string().toAscii(), 
-                                            static_cast<int>(ege_pcast<PStringBuffer>(object)->string().length()), NULL);
-            break;
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult DatabaseSqlite::executeBatch(const SqlQuery& query)
+{
+  EGE_ASSERT(NULL != m_handle);
 
-          case EGE_OBJECT_UID_DATA_BUFFER:
+  const SqlQuery::BindValueArray& values = query.values();
 
-            sqlResult = ::sqlite3_bind_blob(statementObject, i, ege_pcast<PDataBuffer>(object)->data(ege_pcast<PDataBuffer>(object)->readOffset()), 
-                                            static_cast<int>(ege_pcast<PDataBuffer>(object)->size() - ege_pcast<PDataBuffer>(object)->readOffset()), NULL);
-            break;
+  // no result is produced
+  m_result = NULL;
 
-          case EGE_OBJECT_UID_INT:
+  // acquire statement object
+  ::sqlite3_stmt* statementObject = NULL;
+  EGEResult result = acquireStatement(query.value(), &statementObject);
+  if (EGE_SUCCESS != result)
+  {
+    // error!
+    return result;
+  }
 
-            sqlResult = ::sqlite3_bind_int(statementObject, i, ege_pcast<PInteger>(object)->value());
-            break;
+  // determine number of executions
+  const u32 parameterCount = static_cast<u32>(::sqlite3_bind_parameter_count(statementObject));
+  const u32 valueCount     = static_cast<u32>(values.size());
+  if ((0 == parameterCount) ? (0 != valueCount) : (0 != (valueCount % parameterCount)))
+  {
+    // error!
+    egeWarning(KDatabaseSqliteDebugName) << "Number of bound values" << valueCount << "does not match number of parameters" << parameterCount;
+    releaseStatement(query.value(), statementObject);
+    return EGE_ERROR_BAD_PARAM;
+  }
 
-          default:
+  const u32 executionCount = (0 == parameterCount) ? 1 : (valueCount / parameterCount);
 
-            // error!
-            egeWarning(KDatabaseSqliteDebugName) << "Unsupported bind value of type:" << object->uid();
-            result = EGE_ERROR_NOT_SUPPORTED;
-            break;
-        }
-      }
+  // start transaction if none in progress
+  // NOTE: this is essential for performance as otherwise every single execution is committed separately
+  const bool ownTransaction = ! m_inTransaction;
+  if (ownTransaction)
+  {
+    result = beginTransaction();
+  }
 
-      // process statement object
-      s32 row = 0;
-      while ((SQLITE_DONE != sqlResult) && (EGE_SUCCESS == result))
-      {
-        // perform process step
-        sqlResult = ::sqlite3_step(statementObject);
-        switch (sqlResult)
-        {
-          case SQLITE_ROW:
+  // execute for each set of values
+  for (u32 i = 0; (i < executionCount) && (EGE_SUCCESS == result); ++i)
+  {
+    result = bindValues(statementObject, values, i * parameterCount, parameterCount, false);
+    if (EGE_SUCCESS == result)
+    {
+      result = step(statementObject, NULL);
+    }
 
-            // check if columns are not set in resulting objects yet
-            if (0 == ege_cast<SqlResultSqlite*>(resultObject)->columnCount())
-            {
-              // add column names to resulting object
-              const int columnCount = sqlite3_column_count(statementObject);
-              for (int i = 0; (i < columnCount) && (EGE_SUCCESS == result); ++i)
-              {
-                result = ege_cast<SqlResultSqlite*>(resultObject)->addColumnName(sqlite3_column_name(statementObject, i));
-              }
-            }
+    // reset for next execution
+    ::sqlite3_reset(statementObject);
+  }
 
-            if (EGE_SUCCESS == result)
-            {
-              for (u32 i = 0; (i < ege_cast<SqlResultSqlite*>(resultObject)->columnCount()) && (EGE_SUCCESS == result); ++i)
-              {
-                int columnType = sqlite3_column_type(statementObject, i);
-                switch (columnType)
-                {
-                  case SQLITE_INTEGER:
+  // release statement
+  releaseStatement(query.value(), statementObject);
 
-                    result = ege_cast<SqlResultSqlite*>(resultObject)->addValue(row, ::sqlite3_column_int(statementObject, i));
-                    break;
+  // finish own transaction
+  if (ownTransaction && m_inTransaction)
+  {
+    if (EGE_SUCCESS == result)
+    {
+      result = endTransaction();
+    }
+    else
+    {
+      abortTransaction();
+    }
+  }
 
-                  case SQLITE_FLOAT:
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PSqlCursor DatabaseSqlite::cursor(const SqlQuery& query)
+{
+  EGE_ASSERT(NULL != m_handle);
 
-                    result = ege_cast<SqlResultSqlite*>(resultObject)->addValue(row, static_cast<float32>(::sqlite3_column_double(statementObject, i)));
-                    break;
+  // acquire statement object
+  ::sqlite3_stmt* statementObject = NULL;
+  EGEResult result = acquireStatement(query.value(), &statementObject);
 
-                  case SQLITE_TEXT:
+  // bind values
+  // NOTE: values are copied as query is not required to outlive cursor
+  if (EGE_SUCCESS == result)
+  {
+    result = bindValues(statementObject, query.values(), 0, static_cast<u32>(query.values().size()), true);
+  }
 
-                    result = ege_cast<SqlResultSqlite*>(resultObject)->addValue(row, reinterpret_cast<const char*>(::sqlite3_column_text(statementObject, i)));
-                    break;
+  // create cursor
+  PSqlCursor cursorObject;
+  if (EGE_SUCCESS == result)
+  {
+    cursorObject = ege_new SqlCursorSqlite(this, query.value(), statementObject);
+  }
 
-                  case SQLITE_BLOB:
+  // check if failed
+  // NOTE: on success, statement is owned by cursor now
+  if ((NULL == cursorObject) && (NULL != statementObject))
+  {
+    releaseStatement(query.value(), statementObject);
+  }
 
-                    result = ege_cast<SqlResultSqlite*>(resultObject)->addValue(row, ::sqlite3_column_blob(statementObject, i), 
-                                                                                ::sqlite3_column_bytes(statementObject,i));
-                    break;
+  return cursorObject;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const PSqlResult DatabaseSqlite::result() const
+{
+  return m_result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void DatabaseSqlite::setStatementCacheSize(u32 size)
+{
+  m_statementCacheSize = size;
 
-                  default:
+  // drop currently cached statements
+  clearStatementCache();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult DatabaseSqlite::acquireStatement(const String& sql, ::sqlite3_stmt** statement)
+{
+  *statement = NULL;
 
-                    // error!
-                    egeCritical(KDatabaseSqliteDebugName) << "Unknown column type:" << columnType;
-                    result = EGE_ERROR_NOT_SUPPORTED;
-                    break;
-                }
-              }
-            }
-            break;
+  // check if cached and available
+  CachedStatementMap::iterator it = m_statementCache.find(sql);
+  if ((it != m_statementCache.end()) && ! it->second.inUse)
+  {
+    CachedStatement& cached = it->second;
 
-          case SQLITE_DONE:
+    cached.inUse    = true;
+    cached.lastUsed = ++m_statementUseCounter;
 
-            // done
-            result = EGE_SUCCESS;
-            break;
+    *statement = cached.statement;
+    return EGE_SUCCESS;
+  }
 
-          default:
+  // prepare statement object
+  int sqlResult = ::sqlite3_prepare_v2(m_handle, sql.toAscii(), static_cast<int>(sql.length()), statement, NULL);
+  if ((SQLITE_OK != sqlResult) || (NULL == *statement))
+  {
+    // error!
+    egeWarning(KDatabaseSqliteDebugName) << "Could not prepare statement object! Sqlite error:" << sqlResult;
+    *statement = NULL;
+    return EGE_ERROR;
+  }
 
-            // error!
-            result = EGE_ERROR;
-            egeWarning(KDatabaseSqliteDebugName) << "Processing of statement object failed! Sqlite error:" << sqlResult;
-            break;
+  // check if statement for such query is not in cache yet and cache is enabled
+  if ((it == m_statementCache.end()) && (0 < m_statementCacheSize))
+  {
+    // check if cache is full
+    if (m_statementCache.size() >= m_statementCacheSize)
+    {
+      // find least recently used statement which is not in use
+      CachedStatementMap::iterator itEvict = m_statementCache.end();
+      for (CachedStatementMap::iterator itCached = m_statementCache.begin(); itCached != m_statementCache.end(); ++itCached)
+      {
+        if ( ! itCached->second.inUse && ((itEvict == m_statementCache.end()) || (itCached->second.lastUsed < itEvict->second.lastUsed)))
+        {
+          itEvict = itCached;
         }
+      }
 
-        // update row index
-        ++row;
+      // evict
+      if (itEvict != m_statementCache.end())
+      {
+        ::sqlite3_finalize(itEvict->second.statement);
+        m_statementCache.erase(itEvict);
       }
     }
 
-    // finalize statement
-    sqlResult = ::sqlite3_finalize(statementObject);
-    if (SQLITE_OK != sqlResult)
+    // add to cache if there is space
+    if (m_statementCache.size() < m_statementCacheSize)
     {
-      // error!
-      egeWarning(KDatabaseSqliteDebugName) << "Could not finalize statement object! Sqlite error:" << sqlResult;
+      CachedStatement cached;
+      cached.statement = *statement;
+      cached.lastUsed  = ++m_statementUseCounter;
+      cached.inUse     = true;
 
-      result = EGE_ERROR;
+      m_statementCache.insert(sql, cached);
     }
+  }
 
-    // check if success
-    if (EGE_SUCCESS == result)
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void DatabaseSqlite::releaseStatement(const String& sql, ::sqlite3_stmt* statement)
+{
+  // check if statement comes from cache
+  CachedStatementMap::iterator it = m_statementCache.find(sql);
+  if ((it != m_statementCache.end()) && (it->second.statement == statement))
+  {
+    // reset so it can be reused
+    ::sqlite3_reset(statement);
+    ::sqlite3_clear_bindings(statement);
+
+    it->second.inUse = false;
+    return;
+  }
+
+  // finalize statement
+  int sqlResult = ::sqlite3_finalize(statement);
+  if (SQLITE_OK != sqlResult)
+  {
+    // error!
+    egeWarning(KDatabaseSqliteDebugName) << "Could not finalize statement object! Sqlite error:" << sqlResult;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void DatabaseSqlite::clearStatementCache()
+{
+  for (CachedStatementMap::iterator it = m_statementCache.begin(); it != m_statementCache.end(); ++it)
+  {
+    // NOTE: statements in use are finalized once released by their users (cursors)
+    if ( ! it->second.inUse)
     {
-      // set new result
-      m_result = resultObject;
+      ::sqlite3_finalize(it->second.statement);
     }
   }
 
-  // check if success
-  if (EGE_SUCCESS != result)
+  m_statementCache.clear();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult DatabaseSqlite::bindValues(::sqlite3_stmt* statement, const SqlQuery::BindValueArray& values, u32 offset, u32 count, bool transient) const
+{
+  EGE_ASSERT(offset + count <= values.size());
+
+  ::sqlite3_destructor_type destructor = transient ? SQLITE_TRANSIENT : SQLITE_STATIC;
+
+  int sqlResult = SQLITE_OK;
+  for (u32 i = 0; (i < count) && (SQLITE_OK == sqlResult); ++i)
   {
-    // delete result object
-    m_result = NULL;
+    const SqlQuery::BindValue& value = values[offset + i];
+
+    // NOTE: parameters indicies are 1-based
+    const int index = static_cast<int>(i + 1);
+
+    // process accroding to value type
+    switch (value.type)
+    {
+      case SqlQuery::BindValue::TYPE_TEXT:
+
+        sqlResult = ::sqlite3_bind_text(statement, index, value.textValue.toAscii(), static_cast<int>(value.textValue.length()), destructor);
+        break;
+
+      case SqlQuery::BindValue::TYPE_BLOB:
+
+        sqlResult = ::sqlite3_bind_blob(statement, index, value.blobValue->data(value.blobValue->readOffset()), 
+                                        static_cast<int>(value.blobValue->size() - value.blobValue->readOffset()), destructor);
+        break;
+
+      case SqlQuery::BindValue::TYPE_INT:
+
+        sqlResult = ::sqlite3_bind_int(statement, index, static_cast<int>(value.intValue));
+        break;
+
+      case SqlQuery::BindValue::TYPE_INT64:
+
+        sqlResult = ::sqlite3_bind_int64(statement, index, value.intValue);
+        break;
+
+      case SqlQuery::BindValue::TYPE_FLOAT:
+
+        sqlResult = ::sqlite3_bind_double(statement, index, value.floatValue);
+        break;
+
+      default:
+
+        // error!
+        egeWarning(KDatabaseSqliteDebugName) << "Unsupported bind value of type:" << value.type;
+        return EGE_ERROR_NOT_SUPPORTED;
+    }
   }
 
-  return result;
+  if (SQLITE_OK != sqlResult)
+  {
+    // error!
+    egeWarning(KDatabaseSqliteDebugName) << "Could not bind value! Sqlite error:" << sqlResult;
+    return EGE_ERROR;
+  }
+
+  return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-const PSqlResult DatabaseSqlite::result() const
+EGEResult DatabaseSqlite::step(::sqlite3_stmt* statement, SqlResultSqlite* resultObject) const
 {
-  return m_result;
+  EGEResult result = EGE_SUCCESS;
+
+  // process statement object
+  s32 row = 0;
+  int sqlResult = SQLITE_OK;
+  while ((SQLITE_DONE != sqlResult) && (EGE_SUCCESS == result))
+  {
+    // perform process step
+    sqlResult = ::sqlite3_step(statement);
+    switch (sqlResult)
+    {
+      case SQLITE_ROW:
+
+        // check if no result is requested
+        if (NULL == resultObject)
+        {
+          break;
+        }
+
+        // check if columns are not set in resulting objects yet
+        if (0 == resultObject->columnCount())
+        {
+          // add column names to resulting object
+          const int columnCount = sqlite3_column_count(statement);
+          for (int i = 0; (i < columnCount) && (EGE_SUCCESS == result); ++i)
+          {
+            result = resultObject->addColumnName(sqlite3_column_name(statement, i));
+          }
+        }
+
+        if (EGE_SUCCESS == result)
+        {
+          for (u32 i = 0; (i < resultObject->columnCount()) && (EGE_SUCCESS == result); ++i)
+          {
+            int columnType = sqlite3_column_type(statement, i);
+            switch (columnType)
+            {
+              case SQLITE_INTEGER:
+
+                result = resultObject->addValue(row, ::sqlite3_column_int(statement, i));
+                break;
+
+              case SQLITE_FLOAT:
+
+                result = resultObject->addValue(row, static_cast<float32>(::sqlite3_column_double(statement, i)));
+                break;
+
+              case SQLITE_TEXT:
+
+                result = resultObject->addValue(row, reinterpret_cast<const char*>(::sqlite3_column_text(statement, i)));
+                break;
+
+              case SQLITE_BLOB:
+
+                result = resultObject->addValue(row, ::sqlite3_column_blob(statement, i), ::sqlite3_column_bytes(statement,i));
+                break;
+
+              default:
+
+                // error!
+                egeCritical(KDatabaseSqliteDebugName) << "Unknown column type:" << columnType;
+                result = EGE_ERROR_NOT_SUPPORTED;
+                break;
+            }
+          }
+        }
+        break;
+
+      case SQLITE_DONE:
+
+        // done
+        result = EGE_SUCCESS;
+        break;
+
+      default:
+
+        // error!
+        result = EGE_ERROR;
+        egeWarning(KDatabaseSqliteDebugName) << "Processing of statement object failed! Sqlite error:" << sqlResult;
+        break;
+    }
+
+    // update row index
+    ++row;
+  }
+
+  return result;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,13 @@
+#include "Core/Database/Interface/SqlCursor.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+SqlCursor::SqlCursor() : Object(NULL)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+SqlCursor::~SqlCursor()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
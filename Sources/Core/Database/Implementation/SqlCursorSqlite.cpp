@@ -0,0 +1,133 @@
+#include "Core/Database/Implementation/SqlCursorSqlite.h"
+#include "Core/Database/Interface/DatabaseSqlite.h"
+#include "EGEDebug.h"
+#include <sqlite3.h>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+static const char* KSqlCursorSqliteDebugName = "EGESqlCursorSqlite";
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(SqlCursorSqlite)
+EGE_DEFINE_DELETE_OPERATORS(SqlCursorSqlite)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+SqlCursorSqlite::SqlCursorSqlite(DatabaseSqlite* database, const String& sql, ::sqlite3_stmt* statement) : SqlCursor()
+                                                                                                        , m_database(database)
+                                                                                                        , m_sql(sql)
+                                                                                                        , m_statement(statement)
+                                                                                                        , m_result(EGE_SUCCESS)
+                                                                                                        , m_hasRow(false)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+SqlCursorSqlite::~SqlCursorSqlite()
+{
+  // give statement back to database
+  if (NULL != m_statement)
+  {
+    m_database->releaseStatement(m_sql, m_statement);
+    m_statement = NULL;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool SqlCursorSqlite::next()
+{
+  m_hasRow = false;
+
+  if ((NULL != m_statement) && (EGE_SUCCESS == m_result))
+  {
+    // perform process step
+    int sqlResult = ::sqlite3_step(m_statement);
+    switch (sqlResult)
+    {
+      case SQLITE_ROW:
+
+        m_hasRow = true;
+        break;
+
+      case SQLITE_DONE:
+
+        // done, statement can be given back to database right away
+        m_database->releaseStatement(m_sql, m_statement);
+        m_statement = NULL;
+        break;
+
+      default:
+
+        // error!
+        m_result = EGE_ERROR;
+        egeWarning(KSqlCursorSqliteDebugName) << "Processing of statement object failed! Sqlite error:" << sqlResult;
+        break;
+    }
+  }
+
+  return m_hasRow;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult SqlCursorSqlite::result() const
+{
+  return m_result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 SqlCursorSqlite::columnCount() const
+{
+  return (NULL != m_statement) ? static_cast<u32>(::sqlite3_column_count(m_statement)) : 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+String SqlCursorSqlite::columnName(u32 index) const
+{
+  const char* name = (index < columnCount()) ? ::sqlite3_column_name(m_statement, static_cast<int>(index)) : NULL;
+  return (NULL != name) ? String(name) : String();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 SqlCursorSqlite::columnIndex(const String& name) const
+{
+  const u32 count = columnCount();
+  for (u32 i = 0; i < count; ++i)
+  {
+    if (name == ::sqlite3_column_name(m_statement, static_cast<int>(i)))
+    {
+      // found
+      return static_cast<s32>(i);
+    }
+  }
+
+  return -1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool SqlCursorSqlite::isNull(u32 index) const
+{
+  return ! m_hasRow || (SQLITE_NULL == ::sqlite3_column_type(m_statement, static_cast<int>(index)));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 SqlCursorSqlite::intValue(u32 index) const
+{
+  return m_hasRow ? ::sqlite3_column_int(m_statement, static_cast<int>(index)) : 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s64 SqlCursorSqlite::int64Value(u32 index) const
+{
+  return m_hasRow ? ::sqlite3_column_int64(m_statement, static_cast<int>(index)) : 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+float32 SqlCursorSqlite::floatValue(u32 index) const
+{
+  return m_hasRow ? static_cast<float32>(::sqlite3_column_double(m_statement, static_cast<int>(index))) : 0.0f;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* SqlCursorSqlite::textValue(u32 index) const
+{
+  const unsigned char* text = m_hasRow ? ::sqlite3_column_text(m_statement, static_cast<int>(index)) : NULL;
+  return (NULL != text) ? reinterpret_cast<const char*>(text) : "";
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const void* SqlCursorSqlite::blobValue(u32 index) const
+{
+  return m_hasRow ? ::sqlite3_column_blob(m_statement, static_cast<int>(index)) : NULL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 SqlCursorSqlite::valueSize(u32 index) const
+{
+  return m_hasRow ? ::sqlite3_column_bytes(m_statement, static_cast<int>(index)) : 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,75 @@
+#ifndef EGE_CORE_DATABASE_SQLCURSORSQLITE_H
+#define EGE_CORE_DATABASE_SQLCURSORSQLITE_H
+
+/** SQL cursor object for SQLite database.
+  * Cursor owns prepared statement for the duration of its life time. Statement is given back to database when cursor is destroyed.
+  */
+
+#include "EGE.h"
+#include "EGEString.h"
+#include "Core/Database/Interface/SqlCursor.h"
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+struct sqlite3_stmt;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class DatabaseSqlite;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class SqlCursorSqlite : public SqlCursor
+{
+  public:
+
+    SqlCursorSqlite(DatabaseSqlite* database, const String& sql, ::sqlite3_stmt* statement);
+   ~SqlCursorSqlite();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+  public:
+
+    /*! @see SqlCursor::next. */
+    bool next() override;
+    /*! @see SqlCursor::result. */
+    EGEResult result() const override;
+    /*! @see SqlCursor::columnCount. */
+    u32 columnCount() const override;
+    /*! @see SqlCursor::columnName. */
+    String columnName(u32 index) const override;
+    /*! @see SqlCursor::columnIndex. */
+    s32 columnIndex(const String& name) const override;
+    /*! @see SqlCursor::isNull. */
+    bool isNull(u32 index) const override;
+    /*! @see SqlCursor::intValue. */
+    s32 intValue(u32 index) const override;
+    /*! @see SqlCursor::int64Value. */
+    s64 int64Value(u32 index) const override;
+    /*! @see SqlCursor::floatValue. */
+    float32 floatValue(u32 index) const override;
+    /*! @see SqlCursor::textValue. */
+    const char* textValue(u32 index) const override;
+    /*! @see SqlCursor::blobValue. */
+    const void* blobValue(u32 index) const override;
+    /*! @see SqlCursor::valueSize. */
+    s32 valueSize(u32 index) const override;
+
+  private:
+
+    /*! Database which statement belongs to. */
+    DatabaseSqlite* m_database;
+    /*! SQL text of the statement. */
+    String m_sql;
+    /*! Statement being processed. NULL if processing is done. */
+    ::sqlite3_stmt* m_statement;
+    /*! Result of the last operation. */
+    EGEResult m_result;
+    /*! TRUE if cursor points to valid row. */
+    bool m_hasRow;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_DATABASE_SQLCURSORSQLITE_H
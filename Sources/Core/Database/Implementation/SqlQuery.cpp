@@ -1,6 +1,4 @@
 #include "Core/Database/Interface/SqlQuery.h"
-#include "Core/ComplexTypes.h"
-#include "EGEStringBuffer.h"
 
 EGE_NAMESPACE
 
@@ -20,36 +18,76 @@ const String& SqlQuery::value() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool SqlQuery::addBindValue(const String& value)
 {
-  PStringBuffer buffer = ege_new StringBuffer();
-  if (NULL != buffer)
-  {
-    *buffer << value;
+  m_boundValues.push_back(BindValue());
 
-    m_boundValues << buffer;
-  }
+  BindValue& bindValue = m_boundValues.back();
+  bindValue.type      = BindValue::TYPE_TEXT;
+  bindValue.textValue = value;
 
-  return (NULL != buffer);
+  return true;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool SqlQuery::addBindValue(PDataBuffer value)
 {
-  m_boundValues << value;
+  if (NULL == value)
+  {
+    // error!
+    return false;
+  }
+
+  m_boundValues.push_back(BindValue());
+
+  BindValue& bindValue = m_boundValues.back();
+  bindValue.type      = BindValue::TYPE_BLOB;
+  bindValue.blobValue = value;
 
   return true;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool SqlQuery::addBindValue(s32 value)
 {
-  PInteger valueObject = ege_new Integer(value);
-  if (NULL != valueObject)
-  {
-    m_boundValues << valueObject;
-  }
+  m_boundValues.push_back(BindValue());
+
+  BindValue& bindValue = m_boundValues.back();
+  bindValue.type     = BindValue::TYPE_INT;
+  bindValue.intValue = value;
+
+  return true;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool SqlQuery::addBindValue(s64 value)
+{
+  m_boundValues.push_back(BindValue());
 
-  return (NULL != valueObject);
+  BindValue& bindValue = m_boundValues.back();
+  bindValue.type     = BindValue::TYPE_INT64;
+  bindValue.intValue = value;
+
+  return true;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool SqlQuery::addBindValue(float32 value)
+{
+  m_boundValues.push_back(BindValue());
+
+  BindValue& bindValue = m_boundValues.back();
+  bindValue.type       = BindValue::TYPE_FLOAT;
+  bindValue.floatValue = value;
+
+  return true;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void SqlQuery::reserveBindValues(u32 count)
+{
+  m_boundValues.reserve(count);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void SqlQuery::clearBindValues()
+{
+  m_boundValues.clear();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-const List<PObject>& SqlQuery::values() const
+const SqlQuery::BindValueArray& SqlQuery::values() const
 {
   return m_boundValues;
 }
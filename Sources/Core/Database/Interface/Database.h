@@ -8,6 +8,7 @@
 #include "EGEString.h"
 #include "Core/Database/Interface/SqlQuery.h"
 #include "Core/Database/Interface/SqlResult.h"
+#include "Core/Database/Interface/SqlCursor.h"
 
 EGE_NAMESPACE_BEGIN
 
@@ -53,6 +54,19 @@ class Database : public Object
      *  @note Statement is executed as a part of current transaction.
      */
     virtual EGEResult execute(const SqlQuery& query) = 0;
+    /*! Executes given statement for multiple sets of bound values.
+     *  @param  query Statement to execute. Bound values are consumed in groups of the size equal to the number of parameters in the statement.
+     *  @return EGE_SUCCESS on success. Otherwise, another error code.
+     *  @note If there is no transaction in progress, all executions are done within a single transaction which is rolled back on any failure.
+     *  @note No result object is produced.
+     */
+    virtual EGEResult executeBatch(const SqlQuery& query) = 0;
+    /*! Executes given statement and returns cursor to its result.
+     *  @param  query Statement to execute.
+     *  @return Cursor object allowing to traverse the result row by row. NULL if error occured.
+     *  @note Rows are fetched from database as cursor advances so entire result is never held in memory.
+     */
+    virtual PSqlCursor cursor(const SqlQuery& query) = 0;
     /*! Returns pointer to result object.
      *  @return Object containing result of last database operation. Can be NULL.
      */
@@ -5,16 +5,22 @@
   */
 
 #include "Core/Database/Interface/Database.h"
+#include "EGEMap.h"
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 struct sqlite3;
+struct sqlite3_stmt;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_BEGIN
 
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class SqlResultSqlite;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class DatabaseSqlite : public Database
 {
+  friend class SqlCursorSqlite;
+
   public:
 
     DatabaseSqlite();
@@ -37,9 +43,66 @@ class DatabaseSqlite : public Database
     EGEResult abortTransaction() override;
     /*! @see Database::execute. */
     EGEResult execute(const SqlQuery& query) override;
+    /*! @see Database::executeBatch. */
+    EGEResult executeBatch(const SqlQuery& query) override;
+    /*! @see Database::cursor. */
+    PSqlCursor cursor(const SqlQuery& query) override;
      /*! @see Database::result. */
     const PSqlResult result() const override;
 
+    /*! Sets maximal number of prepared statements kept in cache. 
+     *  @note Statements are cached by their SQL text. Setting size to zero disables caching.
+     */
+    void setStatementCacheSize(u32 size);
+
+  private:
+
+    /*! Acquires prepared statement for a given SQL text. 
+     *  @param  sql       SQL text for which statement is to be acquired.
+     *  @param  statement Acquired statement.
+     *  @return EGE_SUCCESS on success. Otherwise, another error code.
+     *  @note Statement is taken from cache if present there and not in use. Otherwise, it is prepared (and cached if possible).
+     */
+    EGEResult acquireStatement(const String& sql, ::sqlite3_stmt** statement);
+    /*! Releases statement acquired with acquireStatement. 
+     *  @param  sql       SQL text statement was acquired for.
+     *  @param  statement Statement to release.
+     *  @note Statement is reset and given back to cache if it comes from there. Otherwise, it is finalized.
+     */
+    void releaseStatement(const String& sql, ::sqlite3_stmt* statement);
+    /*! Finalizes all cached statements. */
+    void clearStatementCache();
+    /*! Binds values to statement.
+     *  @param  statement Statement to bind values to.
+     *  @param  values    Array of values to bind.
+     *  @param  offset    Index of the first value to bind.
+     *  @param  count     Number of values to bind.
+     *  @param  transient If set, values are copied. Otherwise, values need to be alive until statement is reset.
+     *  @return EGE_SUCCESS on success. Otherwise, another error code.
+     */
+    EGEResult bindValues(::sqlite3_stmt* statement, const SqlQuery::BindValueArray& values, u32 offset, u32 count, bool transient) const;
+    /*! Steps statement until completion. 
+     *  @param  statement     Statement to execute.
+     *  @param  resultObject  Result object to which resulting rows are to be added. Can be NULL.
+     *  @return EGE_SUCCESS on success. Otherwise, another error code.
+     */
+    EGEResult step(::sqlite3_stmt* statement, SqlResultSqlite* resultObject) const;
+
+  private:
+
+    /*! Cached statement data struct. */
+    struct CachedStatement
+    {
+      /*! Prepared statement. */
+      ::sqlite3_stmt* statement;
+      /*! Value of use counter at the time of the last use. */
+      u32 lastUsed;
+      /*! TRUE if statement is currently acquired. */
+      bool inUse;
+    };
+
+    typedef Map<String, CachedStatement> CachedStatementMap;
+
   private:
 
     /*! Database handler. */
@@ -48,6 +111,12 @@ class DatabaseSqlite : public Database
     bool m_inTransaction;
     /*! Result object. */
     PSqlResult m_result;
+    /*! Prepared statements cache. */
+    CachedStatementMap m_statementCache;
+    /*! Maximal number of cached statements. */
+    u32 m_statementCacheSize;
+    /*! Statement use counter. Used to determine least recently used statement. */
+    u32 m_statementUseCounter;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -0,0 +1,71 @@
+#ifndef EGE_CORE_DATABASE_SQLCURSOR_H
+#define EGE_CORE_DATABASE_SQLCURSOR_H
+
+/** Base class for SQL cursor object.
+  * Cursor provides forward-only, row by row access to the result of a query without materializing the entire result set. Values are returned as typed
+  * values rather than generic objects.
+  * Such object is usually obtainable through database. It must not outlive the database it was obtained from.
+  */
+
+#include "EGE.h"
+#include "EGEString.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DECLARE_SMART_CLASS(SqlCursor, PSqlCursor)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class SqlCursor : public Object
+{
+  public:
+
+    SqlCursor();
+    virtual ~SqlCursor();
+
+  public:
+
+    /*! Advances cursor to next row. 
+     *  @return TRUE if cursor points to valid row. FALSE if there are no more rows or error occured. 
+     *  @note Cursor initially points before the first row.
+     */
+    virtual bool next() = 0;
+    /*! Returns result of the last operation. 
+     *  @return EGE_SUCCESS if no error occured so far. Otherwise, another error code.
+     */
+    virtual EGEResult result() const = 0;
+    /*! Returns number of columns. */
+    virtual u32 columnCount() const = 0;
+    /*! Returns name of the column at given index. */
+    virtual String columnName(u32 index) const = 0;
+    /*! Returns index of the column with a given name. Negative if not found. */
+    virtual s32 columnIndex(const String& name) const = 0;
+
+    /*! Returns TRUE if value at given column of current row is NULL. */
+    virtual bool isNull(u32 index) const = 0;
+    /*! Returns integer value at given column of current row. */
+    virtual s32 intValue(u32 index) const = 0;
+    /*! Returns 64-bit integer value at given column of current row. */
+    virtual s64 int64Value(u32 index) const = 0;
+    /*! Returns floating point value at given column of current row. */
+    virtual float32 floatValue(u32 index) const = 0;
+    /*! Returns text value at given column of current row. 
+     *  @note Returned pointer is valid until cursor is advanced.
+     */
+    virtual const char* textValue(u32 index) const = 0;
+    /*! Returns data blob value at given column of current row. 
+     *  @note Returned pointer is valid until cursor is advanced.
+     */
+    virtual const void* blobValue(u32 index) const = 0;
+    /*! Returns size (in bytes) of text or data blob value at given column of current row. */
+    virtual s32 valueSize(u32 index) const = 0;
+
+  private:
+
+    SqlCursor(const SqlCursor& other);
+    SqlCursor& operator = (SqlCursor& other);
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_DATABASE_SQLCURSOR_H
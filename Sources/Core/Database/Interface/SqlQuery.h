@@ -7,7 +7,7 @@
 #include "EGE.h"
 #include "EGEString.h"
 #include "EGEDataBuffer.h"
-#include "EGEList.h"
+#include "EGEDynamicArray.h"
 
 EGE_NAMESPACE_BEGIN
 
@@ -19,6 +19,35 @@ class SqlQuery
     SqlQuery(const String& statement);
    ~SqlQuery();
 
+  public:
+
+    /*! Bound value data struct. */
+    struct BindValue
+    {
+      /*! Available value types. */
+      enum Type
+      {
+        TYPE_INT = 0,
+        TYPE_INT64,
+        TYPE_FLOAT,
+        TYPE_TEXT,
+        TYPE_BLOB
+      };
+
+      /*! Type of value. */
+      Type type;
+      /*! Integer value. Valid for TYPE_INT and TYPE_INT64. */
+      s64 intValue;
+      /*! Floating point value. Valid for TYPE_FLOAT. */
+      float64 floatValue;
+      /*! Text value. Valid for TYPE_TEXT. */
+      String textValue;
+      /*! Data value. Valid for TYPE_BLOB. */
+      PDataBuffer blobValue;
+    };
+
+    typedef DynamicArray<BindValue> BindValueArray;
+
   public:
 
     /*! Returns current query string. */
@@ -27,20 +56,28 @@ class SqlQuery
      *  @param  value Value to be bound.
      *  @return TRUE if action succeeded.
      *  @note Passed objects needs to be alive until exection of the query.
+     *  @note Values can be bound for multiple executions of the query at once. In such case, values are consumed in groups of the size equal to the
+     *        number of parameters in the statement. See Database::executeBatch.
      */
     bool addBindValue(const String& value);
     bool addBindValue(PDataBuffer value);
     bool addBindValue(s32 value);
+    bool addBindValue(s64 value);
+    bool addBindValue(float32 value);
+    /*! Reserves space for a given number of values to be bound. */
+    void reserveBindValues(u32 count);
+    /*! Removes all bound values. */
+    void clearBindValues();
 
-    /*! Returns the list of bound objects. */
-    const List<PObject>& values() const;
+    /*! Returns the list of bound values. */
+    const BindValueArray& values() const;
 
   private:
 
     /*! Query. */
     String m_query;
-    /*! List of bound values. */
-    List<PObject> m_boundValues;
+    /*! Array of bound values. */
+    BindValueArray m_boundValues;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -310,7 +310,7 @@ TEST_F(DatabaseSqliteTest, InsertBlob)
   }
 
   // store blob data
-  SqlQuery query = "INSERT INTO MyTable VALUES (?);";
+  SqlQuery query("INSERT INTO MyTable VALUES (?);");
   DataBuffer data(reinterpret_cast<const void*>(blobData), sizeof (blobData));
   EXPECT_TRUE(query.addBindValue(data));
   EXPECT_EQ(EGE_SUCCESS, database.execute(query));
@@ -347,7 +347,7 @@ TEST_F(DatabaseSqliteTest, InsertInteger)
   const s32 integerValue = rand();
 
   // store integer data
-  SqlQuery query = "INSERT INTO MyTable VALUES (?);";
+  SqlQuery query("INSERT INTO MyTable VALUES (?);");
   EXPECT_TRUE(query.addBindValue(integerValue));
   EXPECT_EQ(EGE_SUCCESS, database.execute(query));
 
@@ -462,4 +462,160 @@ TEST_F(DatabaseSqliteTest, Transaction)
   EXPECT_EQ(EGE_SUCCESS, database.close());
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(DatabaseSqliteTest, StatementCache)
+{
+  DatabaseSqlite database;
+
+  // open database
+  EXPECT_EQ(EGE_SUCCESS, database.open(KValidGeneratedDatabasePath, false, true));
+
+  // add table
+  EXPECT_EQ(EGE_SUCCESS, database.execute(SqlQuery("CREATE TABLE MyTable (Key INTEGER);")));
+
+  // insert data reusing the same statement
+  for (s32 i = 0; i < 100; ++i)
+  {
+    SqlQuery query("INSERT INTO MyTable VALUES (?);");
+    EXPECT_TRUE(query.addBindValue(i));
+    EXPECT_EQ(EGE_SUCCESS, database.execute(query));
+  }
+
+  // check data
+  EXPECT_EQ(EGE_SUCCESS, database.execute(SqlQuery("SELECT COUNT(*) FROM MyTable")));
+  PSqlResult result = database.result();
+  EXPECT_TRUE(NULL != result);
+  EXPECT_EQ(100, ege_pcast<PInteger>(result->value(0, 0))->value());
+
+  // disable cache and check again
+  database.setStatementCacheSize(0);
+  EXPECT_EQ(EGE_SUCCESS, database.execute(SqlQuery("SELECT COUNT(*) FROM MyTable")));
+  result = database.result();
+  EXPECT_TRUE(NULL != result);
+  EXPECT_EQ(100, ege_pcast<PInteger>(result->value(0, 0))->value());
+
+  // close database
+  EXPECT_EQ(EGE_SUCCESS, database.close());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(DatabaseSqliteTest, ExecuteBatch)
+{
+  DatabaseSqlite database;
+
+  // open database
+  EXPECT_EQ(EGE_SUCCESS, database.open(KValidGeneratedDatabasePath, false, true));
+
+  // add table
+  EXPECT_EQ(EGE_SUCCESS, database.execute(SqlQuery("CREATE TABLE MyTable (Id INTEGER, Name varchar(255), Score REAL);")));
+
+  // bind values for multiple executions
+  const s32 KRowCount = 1000;
+  SqlQuery query("INSERT INTO MyTable VALUES (?, ?, ?);");
+  query.reserveBindValues(KRowCount * 3);
+  for (s32 i = 0; i < KRowCount; ++i)
+  {
+    EXPECT_TRUE(query.addBindValue(i));
+    EXPECT_TRUE(query.addBindValue(String::Format("Name-%d", i)));
+    EXPECT_TRUE(query.addBindValue(i * 0.5f));
+  }
+
+  EXPECT_EQ(EGE_SUCCESS, database.executeBatch(query));
+
+  // check data
+  EXPECT_EQ(EGE_SUCCESS, database.execute(SqlQuery("SELECT COUNT(*) FROM MyTable")));
+  PSqlResult result = database.result();
+  EXPECT_TRUE(NULL != result);
+  EXPECT_EQ(KRowCount, ege_pcast<PInteger>(result->value(0, 0))->value());
+
+  // incomplete set of values
+  SqlQuery invalidQuery("INSERT INTO MyTable VALUES (?, ?, ?);");
+  EXPECT_TRUE(invalidQuery.addBindValue(1));
+  EXPECT_EQ(EGE_ERROR_BAD_PARAM, database.executeBatch(invalidQuery));
+
+  // close database
+  EXPECT_EQ(EGE_SUCCESS, database.close());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(DatabaseSqliteTest, Cursor)
+{
+  DatabaseSqlite database;
+
+  // open database
+  EXPECT_EQ(EGE_SUCCESS, database.open(KValidDatabasePath, true, false));
+
+  // execute query
+  PSqlCursor cursor = database.cursor(SqlQuery("SELECT * FROM Dictionary"));
+  EXPECT_TRUE(NULL != cursor);
+  EXPECT_EQ(2, cursor->columnCount());
+  EXPECT_EQ(0, cursor->columnIndex("key"));
+  EXPECT_EQ(1, cursor->columnIndex("value"));
+  EXPECT_EQ(-1, cursor->columnIndex("unexisting"));
+
+  // row 1...
+  EXPECT_TRUE(cursor->next());
+  EXPECT_STREQ("Key-1", cursor->textValue(0));
+  EXPECT_STREQ("This is key-1 value", cursor->textValue(1));
+
+  // row 2...
+  EXPECT_TRUE(cursor->next());
+  EXPECT_STREQ("Key-2", cursor->textValue(0));
+  EXPECT_STREQ("This is key-2 value", cursor->textValue(1));
+
+  // row 3...
+  EXPECT_TRUE(cursor->next());
+  EXPECT_STREQ("Key-3", cursor->textValue(0));
+  EXPECT_STREQ("This is key-3 value", cursor->textValue(1));
+
+  // no more rows
+  EXPECT_FALSE(cursor->next());
+  EXPECT_EQ(EGE_SUCCESS, cursor->result());
+
+  // release cursor
+  cursor = NULL;
+
+  // close database
+  EXPECT_EQ(EGE_SUCCESS, database.close());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(DatabaseSqliteTest, CursorTypedValues)
+{
+  DatabaseSqlite database;
+
+  // open database
+  EXPECT_EQ(EGE_SUCCESS, database.open(KValidGeneratedDatabasePath, false, true));
+
+  // add table
+  EXPECT_EQ(EGE_SUCCESS, database.execute(SqlQuery("CREATE TABLE MyTable (Id INTEGER, Big INTEGER, Score REAL, Data BLOB, Empty TEXT);")));
+
+  // insert data
+  const char blobData[] = { 1, 2, 3, 4 };
+  SqlQuery query("INSERT INTO MyTable VALUES (?, ?, ?, ?, NULL);");
+  EXPECT_TRUE(query.addBindValue(7));
+  EXPECT_TRUE(query.addBindValue(static_cast<s64>(0x100000000LL)));
+  EXPECT_TRUE(query.addBindValue(2.5f));
+  EXPECT_TRUE(query.addBindValue(ege_new DataBuffer(blobData, sizeof (blobData))));
+  EXPECT_EQ(EGE_SUCCESS, database.execute(query));
+
+  // retrieve data
+  SqlQuery selectQuery("SELECT * FROM MyTable WHERE Id = ?;");
+  EXPECT_TRUE(selectQuery.addBindValue(7));
+
+  PSqlCursor cursor = database.cursor(selectQuery);
+  EXPECT_TRUE(NULL != cursor);
+  EXPECT_TRUE(cursor->next());
+  EXPECT_EQ(7, cursor->intValue(0));
+  EXPECT_EQ(0x100000000LL, cursor->int64Value(1));
+  EXPECT_EQ(2.5f, cursor->floatValue(2));
+  EXPECT_EQ(sizeof (blobData), cursor->valueSize(3));
+  EXPECT_EQ(0, memcmp(blobData, cursor->blobValue(3), sizeof (blobData)));
+  EXPECT_FALSE(cursor->isNull(3));
+  EXPECT_TRUE(cursor->isNull(4));
+  EXPECT_FALSE(cursor->next());
+
+  // release cursor
+  cursor = NULL;
+
+  // close database
+  EXPECT_EQ(EGE_SUCCESS, database.close());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -7,11 +7,14 @@ EGE_NAMESPACE_BEGIN
 const char* Debug::KWarningPrefix = "WARNING: ";
 const char* Debug::KErrorPrefix   = "ERROR: ";
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-static StringList l_enabledName;
-//--------------------------------------------------------------------------------------------------------------------------------------------------------------
-Debug::Debug(DebugMessageType type, const String& name) : m_spaceSeperated(true)
-                                                        , m_type(type)
-                                                        , m_enabled(false)
+/*! Enabled debug names.
+ *  @note Names are interned so checking if debug is enabled involves no string comparisons.
+ */
+static List<Name> l_enabledName;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Debug::Debug(DebugMessageType type, const Name& name) : m_spaceSeperated(true)
+                                                      , m_type(type)
+                                                      , m_enabled(false)
 {
   // check if enabled
   if (l_enabledName.contains(name))
@@ -223,10 +226,12 @@ void Debug::EnableNames(const StringList& names)
 {
   for (StringList::const_iterator it = names.begin(); it != names.end(); ++it)
   {
-    if ( ! l_enabledName.contains(*it))
+    const Name name(*it);
+
+    if ( ! l_enabledName.contains(name))
     {
       // add to pool
-      l_enabledName.push_back(*it);
+      l_enabledName.push_back(name);
     }
   }
 }
@@ -7,6 +7,7 @@
 #include "EGEStringBuffer.h"
 #include "EGEString.h"
 #include "EGEStringList.h"
+#include "EGEName.h"
 
 EGE_NAMESPACE_BEGIN
 
@@ -23,7 +24,7 @@ class Debug
 {
   public:
 
-    Debug(DebugMessageType type, const String& name);
+    Debug(DebugMessageType type, const Name& name);
     Debug(const Debug& other);
    ~Debug();
   
@@ -109,9 +110,15 @@ class NoDebug
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 #if EGE_FEATURE_DEBUG
 
-  inline Debug egeDebug(const String& name) { return Debug(ENormal, name); }
-  inline Debug egeWarning(const String& name) { return Debug(EWarning, name); }
-  inline Debug egeCritical(const String& name) { return Debug(EError, name); }
+  /*! Returns debug name for a given string.
+   *  @note Name is created once per call site, so checking if debug is enabled involves no string hashing nor table look-ups, only id comparisons.
+   *  @note Given string is expected to be constant, ie. debug name constant of a module.
+   */
+  #define EGE_DEBUG_NAME(name) ([]() -> const Name& { static const Name KDebugName(name); return KDebugName; }())
+
+  #define egeDebug(name) Debug(ENormal, EGE_DEBUG_NAME(name))
+  #define egeWarning(name) Debug(EWarning, EGE_DEBUG_NAME(name))
+  #define egeCritical(name) Debug(EError, EGE_DEBUG_NAME(name))
 
 #else
 
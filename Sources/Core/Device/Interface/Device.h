@@ -19,7 +19,8 @@ enum DeviceOS
   EUnknown = 0,
   EIOS,
   EWindows,
-  EMacOS
+  EMacOS,
+  ELinux
 };
 
 /*! Devices available. */
@@ -3,21 +3,35 @@
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGE_DEFINE_NEW_OPERATORS(Event)
-EGE_DEFINE_DELETE_OPERATORS(Event)
+Event::Event() : m_id(0)
+               , m_payloadType(PAYLOAD_NONE)
+               , m_intValue(0)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Event::Event(s32 id) : m_id(id)
+                     , m_payloadType(PAYLOAD_NONE)
+                     , m_intValue(0)
+{
+}
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-Event::Event(Application* app, s32 id) : Object(app), 
-                                         m_id(id)
+Event::Event(s32 id, s32 data) : m_id(id)
+                               , m_payloadType(PAYLOAD_INTEGER)
+                               , m_intValue(data)
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-Event::~Event()
+Event::Event(s32 id, float32 data) : m_id(id)
+                                   , m_payloadType(PAYLOAD_FLOAT)
+                                   , m_floatValue(data)
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void Event::setData(PObject data)
+Event::Event(s32 id, const PObject& data) : m_id(id)
+                                          , m_payloadType(PAYLOAD_OBJECT)
+                                          , m_intValue(0)
+                                          , m_data(data)
 {
-  m_data = data;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -1,40 +1,98 @@
 #ifndef EGE_CORE_EVENT_H
 #define EGE_CORE_EVENT_H
 
+/** Event is a plain value record. It is copied into event manager's queue so no allocations are done per event. Small payloads (integral and floating
+ *  point values) are stored inline. Only generic payloads are held thru object reference.
+ */
+
 #include "EGE.h"
+#include "EGEDebug.h"
 #include "Core/Event/EventIDs.h"
 
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGE_DECLARE_SMART_CLASS(Event, PEvent)
 EGE_DECLARE_SMART_CLASS(Object, PObject)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-class Event : public Object
+class Event
 {
   public:
 
-    Event(Application* app, s32 id);
-    virtual ~Event();
+    /*! Available payload types. */
+    enum PayloadType
+    {
+      PAYLOAD_NONE = 0,
+      PAYLOAD_INTEGER,
+      PAYLOAD_FLOAT,
+      PAYLOAD_OBJECT
+    };
+
+  public:
 
-    EGE_DECLARE_NEW_OPERATORS
-    EGE_DECLARE_DELETE_OPERATORS
+    Event();
+    explicit Event(s32 id);
+    Event(s32 id, s32 data);
+    Event(s32 id, float32 data);
+    Event(s32 id, const PObject& data);
 
     /*! Returns event ID. */
-    s32 id() const { return m_id; }
-    /*1 Sets event data. */
-    void setData(PObject data);
-    /*! Returns event data. */
-    PObject data() const { return m_data; }
+    inline s32 id() const;
+    /*! Returns payload type. */
+    inline PayloadType payloadType() const;
+    /*! Returns integral payload. 
+     *  @note Only valid for PAYLOAD_INTEGER payload type.
+     */
+    inline s32 intValue() const;
+    /*! Returns floating point payload. 
+     *  @note Only valid for PAYLOAD_FLOAT payload type.
+     */
+    inline float32 floatValue() const;
+    /*! Returns generic payload. NULL if event carries no generic payload. */
+    inline const PObject& data() const;
 
   private:
 
     /*! Event ID. */
     s32 m_id;
-    /*! Event data. Can be NULL. */
+    /*! Payload type. */
+    PayloadType m_payloadType;
+    /*! Inline payload. */
+    union
+    {
+      s32 m_intValue;
+      float32 m_floatValue;
+    };
+    /*! Generic payload. Can be NULL. */
     PObject m_data;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline s32 Event::id() const
+{
+  return m_id;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline Event::PayloadType Event::payloadType() const
+{
+  return m_payloadType;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline s32 Event::intValue() const
+{
+  EGE_ASSERT(PAYLOAD_INTEGER == m_payloadType);
+  return m_intValue;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline float32 Event::floatValue() const
+{
+  EGE_ASSERT(PAYLOAD_FLOAT == m_payloadType);
+  return m_floatValue;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline const PObject& Event::data() const
+{
+  return m_data;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
 
@@ -6,14 +6,16 @@
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGE_DECLARE_SMART_CLASS(Event, PEvent)
+class Event;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class IEventListener
 {
   public:
 
-    /*! Event reciever. */
-    virtual void onEventRecieved(PEvent event) = 0;
+    /*! Event reciever. 
+     *  @param  event Received event. It is valid only for the duration of the call.
+     */
+    virtual void onEventRecieved(const Event& event) = 0;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
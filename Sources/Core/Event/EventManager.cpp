@@ -1,8 +1,8 @@
 #include "Core/Event/EventManager.h"
-#include "Core/Event/Event.h"
 #include "EGETypes.h"
-#include "Core/ComplexTypes.h"
 #include "EGEDebug.h"
+#include "EGEThread.h"
+#include <algorithm>
 
 EGE_NAMESPACE_BEGIN
 
@@ -13,6 +13,9 @@ EGE_DEFINE_NEW_OPERATORS(EventManager)
 EGE_DEFINE_DELETE_OPERATORS(EventManager)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EventManager::EventManager(Application* app) : Object(app)
+                                             , m_ownerThreadId(NULL)
+                                             , m_dispatchDepth(0)
+                                             , m_compactionNeeded(false)
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -20,6 +23,9 @@ EventManager::~EventManager()
 {
   m_mutex = NULL;
   m_pendingEvents.clear();
+  m_dispatchedEvents.clear();
+  m_listeners.clear();
+  m_listenersById.clear();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGEResult EventManager::construct()
@@ -31,6 +37,8 @@ EGEResult EventManager::construct()
     // error!
     return EGE_ERROR_NO_MEMORY;
   }
+
+  m_ownerThreadId = Thread::CurrentId();
  
   return EGE_SUCCESS;
 }
@@ -39,80 +47,101 @@ void EventManager::update(const Time& time)
 {
   EGE_UNUSED(time);
 
-  // check if any pending events
-  if ( ! m_pendingEvents.empty())
+  EGE_ASSERT_X(isOwnerThread(), "Events can be dispatched from main thread only!");
+
+  // swap queues
+  // NOTE: pending queue is filled in from any thread so it is not even inspected without lock. Dispatched queue is always empty at this point, so 
+  //       both buffers keep their capacity and nothing is copied
+  if ( ! m_mutex->lock())
   {
-    EventList localList;
+    // damn...
+    egeCritical(KEventManagerDebugName) << EGE_FUNC_INFO << "Could not lock mutex!!!";
+  }
 
-    // make copy of the list
-    if ( ! m_mutex->lock())
-    {
-      // damn...
-      egeCritical(KEventManagerDebugName) << EGE_FUNC_INFO << "Could not lock mutex!!!";
-    }
+  m_dispatchedEvents.swap(m_pendingEvents);
+  
+  if ( ! m_mutex->unlock())
+  {
+    // damn...
+    egeCritical(KEventManagerDebugName) << EGE_FUNC_INFO << "Could not unlock mutex!!!";
+  }
 
-    localList.copy(m_pendingEvents);
-    m_pendingEvents.clear();
-    
-    if ( ! m_mutex->unlock())
-    {
-      // damn...
-      egeCritical(KEventManagerDebugName) << EGE_FUNC_INFO << "Could not unlock mutex!!!";
-    }
-    
+  // check if any pending events
+  if ( ! m_dispatchedEvents.empty())
+  {
     // propagate
-    EventList::const_iterator itEnd = localList.end();
-    for (EventList::const_iterator it = localList.begin(); it != itEnd; ++it)
+    // NOTE: events sent during dispatch go to pending queue and are delivered next frame
+    for (EventQueue::const_iterator it = m_dispatchedEvents.begin(); it != m_dispatchedEvents.end(); ++it)
     {
       notify(*it);
     }
+
+    // clean up
+    m_dispatchedEvents.clear();
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGEResult EventManager::send(s32 id, bool immediate)
 {
-  PEvent event = ege_new Event(app(), id);
-  if (NULL == event)
-  {
-    // error!
-    return EGE_ERROR_NO_MEMORY;
-  }
-
-  // check if event is to be dispatched immediately
-  if (immediate)
-  {
-    notify(event);
-  }
-  else
-  {
-    // add to pending
-    MutexLocker locker(m_mutex);
-    m_pendingEvents.push_back(event);
-  }
-
+  post(Event(id), immediate);
   return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGEResult EventManager::send(s32 id, s32 data, bool immediate)
 {
-  PEvent event = ege_new Event(app(), id);
-  if (NULL == event)
-  {
-    // error!
-    return EGE_ERROR_NO_MEMORY;
-  }
+  post(Event(id, data), immediate);
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult EventManager::send(s32 id, float32 data, bool immediate)
+{
+  post(Event(id, data), immediate);
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult EventManager::send(s32 id, PObject data, bool immediate)
+{
+  post(Event(id, data), immediate);
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool EventManager::addListener(IEventListener* listener)
+{
+  EGE_ASSERT_X(isOwnerThread(), "Listeners can be added from main thread only!");
+
+  return addListener(m_listeners, listener);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool EventManager::addListener(IEventListener* listener, s32 id)
+{
+  EGE_ASSERT_X(isOwnerThread(), "Listeners can be added from main thread only!");
+
+  return addListener(m_listenersById[id], listener);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void EventManager::removeListener(const IEventListener* listener)
+{
+  EGE_ASSERT_X(isOwnerThread(), "Listeners can be removed from main thread only!");
 
-  PInteger eventData = ege_new Integer(data);
-  if (NULL == eventData)
+  if (NULL == listener)
   {
-    // error!
-    return EGE_ERROR_NO_MEMORY;
+    // do nothing
+    return;
   }
 
-  event->setData(eventData);
+  removeListener(m_listeners, listener);
 
+  for (ListenerArrayMap::iterator it = m_listenersById.begin(); it != m_listenersById.end(); ++it)
+  {
+    removeListener(it->second, listener);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void EventManager::post(const Event& event, bool immediate)
+{
   // check if event is to be dispatched immediately
-  if (immediate)
+  // NOTE: listeners are not synchronized, so events sent from other threads are always queued and dispatched on the next update
+  if (immediate && isOwnerThread())
   {
     notify(event);
   }
@@ -122,79 +151,103 @@ EGEResult EventManager::send(s32 id, s32 data, bool immediate)
     MutexLocker locker(m_mutex);
     m_pendingEvents.push_back(event);
   }
-
-  return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult EventManager::send(s32 id, float32 data, bool immediate)
+void EventManager::notify(const Event& event)
 {
-  PEvent event = ege_new Event(app(), id);
-  if (NULL == event)
-  {
-    // error!
-    return EGE_ERROR_NO_MEMORY;
-  }
+  ++m_dispatchDepth;
 
-  PFloat eventData = ege_new Float(data);
-  if (NULL == eventData)
+  // notify listeners subscribed for this particular event
+  ListenerArrayMap::const_iterator it = m_listenersById.find(event.id());
+  if (it != m_listenersById.end())
   {
-    // error!
-    return EGE_ERROR_NO_MEMORY;
+    notify(event, it->second);
   }
 
-  event->setData(eventData);
+  // notify listeners subscribed for all events
+  notify(event, m_listeners);
 
-  // check if event is to be dispatched immediately
-  if (immediate)
+  // check if outermost dispatch is done and some listeners were removed during it
+  if ((0 == --m_dispatchDepth) && m_compactionNeeded)
   {
-    notify(event);
+    compactListeners();
   }
-  else
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void EventManager::notify(const Event& event, const ListenerArray& listeners)
+{
+  // NOTE: listeners added during dispatch are not notified about current event
+  // NOTE: array is not reallocated during dispatch as removal only clears entries, however, addition may reallocate it so indexing is used
+  const u32 count = static_cast<u32>(listeners.size());
+  for (u32 i = 0; i < count; ++i)
   {
-    // add to pending
-    MutexLocker locker(m_mutex);
-    m_pendingEvents.push_back(event);
+    IEventListener* listener = listeners[i];
+    if (NULL != listener)
+    {
+      listener->onEventRecieved(event);
+    }
   }
-
-  return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult EventManager::send(s32 id, PObject data, bool immediate)
+bool EventManager::addListener(ListenerArray& listeners, IEventListener* listener)
 {
-  PEvent event = ege_new Event(app(), id);
-  if (NULL == event)
+  if (NULL == listener)
   {
     // error!
-    return EGE_ERROR_NO_MEMORY;
+    return false;
   }
 
-  event->setData(data);
-
-  // check if event is to be dispatched immediately
-  if (immediate)
+  // check if already subscribed
+  if (listeners.contains(listener))
   {
-    notify(event);
+    // done
+    return true;
   }
-  else
+
+  listeners.push_back(listener);
+  return true;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void EventManager::removeListener(ListenerArray& listeners, const IEventListener* listener)
+{
+  for (ListenerArray::iterator it = listeners.begin(); it != listeners.end(); ++it)
   {
-    // add to pending
-    MutexLocker locker(m_mutex);
-    m_pendingEvents.push_back(event);
+    if (*it == listener)
+    {
+      // check if dispatch is in progress
+      if (0 < m_dispatchDepth)
+      {
+        // only clear entry so array being iterated stays intact
+        *it = NULL;
+        m_compactionNeeded = true;
+      }
+      else
+      {
+        listeners.erase(it);
+      }
+      break;
+    }
   }
-
-  return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void EventManager::notify(PEvent event)
+void EventManager::compactListeners()
 {
-  const ListenersContainer& objects = listeners();
+  IEventListener* const cleared = NULL;
+
+  m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), cleared), m_listeners.end());
 
-  // go thru all listners
-  ListenersContainer::const_iterator iterEnd = objects.end();
-  for (ListenersContainer::const_iterator iter = objects.begin(); iter != iterEnd; ++iter)
+  for (ListenerArrayMap::iterator it = m_listenersById.begin(); it != m_listenersById.end(); ++it)
   {
-    (*iter)->onEventRecieved(event);
+    ListenerArray& listeners = it->second;
+    listeners.erase(std::remove(listeners.begin(), listeners.end(), cleared), listeners.end());
   }
+
+  m_compactionNeeded = false;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool EventManager::isOwnerThread() const
+{
+  return Thread::CurrentId() == m_ownerThreadId;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
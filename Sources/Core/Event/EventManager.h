@@ -4,15 +4,19 @@
 /** Event manager is responsible for delivery of events to any objects which subscribed for it.
  *  In normal circumstances, all events are deliver at the beging of the a frame.
  *  It is possible, however, to ask manager to dispatch event immediately.
- *  Event manager is tread safe.
+ *  Listeners can subscribe for events of particular IDs only, in which case they are not bothered with any other events. Pending events are kept by 
+ *  value in a pair of reusable buffers, one being filled in while the other one is being dispatched.
+ *  Event manager is tread safe with regard to sending events. Listeners are notified on the thread which constructed the manager (main thread) only, thus
+ *  events sent from other threads are always queued, even if immediate dispatch is requested. Subscriptions must be managed from the main thread too.
  */
 
 #include "EGE.h"
-#include "EGEList.h"
+#include "EGEDynamicArray.h"
+#include "EGEMap.h"
 #include "EGEMutex.h"
 #include "EGETime.h"
+#include "Core/Event/Event.h"
 #include "Core/Event/EventListener.h"
-#include "Core/ListenerContainer.h"
 
 EGE_NAMESPACE_BEGIN
 
@@ -20,7 +24,7 @@ EGE_NAMESPACE_BEGIN
 EGE_DECLARE_SMART_CLASS(EventManager, PEventManager)
 EGE_DECLARE_SMART_CLASS(Object, PObject)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-class EventManager : public Object, public ListenerContainer<IEventListener>
+class EventManager : public Object
 {
   public:
 
@@ -38,45 +42,98 @@ class EventManager : public Object, public ListenerContainer<IEventListener>
     void update(const Time& time);
     /*! Sends event with given ID without any data associated with it. 
      *  @param  id        Event id.
-     *  @param  immediate TRUE if even is supposed to be dispatched immediately.
+     *  @param  immediate TRUE if even is supposed to be dispatched immediately. Ignored if called from other than main thread.
      *  @return EGE_SUCCESS on success.
      */
     EGEResult send(s32 id, bool immediate = false);
     /*! Sends event with given ID and associates integral value. 
      *  @param  id        Event id.
      *  @param  data      Integer associated with event.
-     *  @param  immediate TRUE if even is supposed to be dispatched immediately.
+     *  @param  immediate TRUE if even is supposed to be dispatched immediately. Ignored if called from other than main thread.
      *  @return EGE_SUCCESS on success.
      */
     EGEResult send(s32 id, s32 data, bool immediate = false);
     /*! Sends event with given ID and associates floating value. 
      *  @param  id        Event id.
      *  @param  data      Floating point data associated with event.
-     *  @param  immediate TRUE if even is supposed to be dispatched immediately.
+     *  @param  immediate TRUE if even is supposed to be dispatched immediately. Ignored if called from other than main thread.
      *  @return EGE_SUCCESS on success.
      */
     EGEResult send(s32 id, float32 data, bool immediate = false);
     /*! Sends event with given ID and associates arbitrary data. 
      *  @param  id        Event id.
      *  @param  data      Generic data associated with event.
-     *  @param  immediate TRUE if even is supposed to be dispatched immediately.
+     *  @param  immediate TRUE if even is supposed to be dispatched immediately. Ignored if called from other than main thread.
      *  @return EGE_SUCCESS on success.
      */
     EGEResult send(s32 id, PObject data, bool immediate = false);
 
+    /*! Subscribes listener for all events. 
+     *  @param  listener  Listener to subscribe.
+     *  @return TRUE on success.
+     *  @note Prefer subscribing for particular event IDs.
+     */
+    bool addListener(IEventListener* listener);
+    /*! Subscribes listener for events of a given ID. 
+     *  @param  listener  Listener to subscribe.
+     *  @param  id        ID of events listener is interested in.
+     *  @return TRUE on success.
+     */
+    bool addListener(IEventListener* listener, s32 id);
+    /*! Unsubscribes listener from all events. 
+     *  @param  listener  Listener to unsubscribe.
+     *  @note It is safe to call it during dispatch. Removed listener will not be notified anymore.
+     */
+    void removeListener(const IEventListener* listener);
+
   private:
 
-    /*! Event list type. */
-    typedef List<PEvent> EventList;
+    /*! Event queue type. */
+    typedef DynamicArray<Event> EventQueue;
+    /*! Listener array type. */
+    typedef DynamicArray<IEventListener*> ListenerArray;
+    /*! Map of listener arrays sorted by event ID. */
+    typedef Map<s32, ListenerArray> ListenerArrayMap;
 
   private:
 
+    /*! Queues event or dispatches it immediately. */
+    void post(const Event& event, bool immediate);
     /*! Sends event. */
-    void notify(PEvent event);
-    /*! List of all pending events to send. */
-    EventList m_pendingEvents;
-    /*! List access mutex. */
+    void notify(const Event& event);
+    /*! Notifies all valid listeners from given array. */
+    void notify(const Event& event, const ListenerArray& listeners);
+    /*! Adds listener into given array. */
+    bool addListener(ListenerArray& listeners, IEventListener* listener);
+    /*! Removes listener from given array. 
+     *  @note During dispatch listener entry is only cleared and array is compacted once dispatch is done.
+     */
+    void removeListener(ListenerArray& listeners, const IEventListener* listener);
+    /*! Removes cleared entries from all listener arrays. */
+    void compactListeners();
+    /*! Returns TRUE if called from the thread which constructed the manager. */
+    bool isOwnerThread() const;
+
+  private:
+
+    /*! Queue of pending events to send. */
+    EventQueue m_pendingEvents;
+    /*! Queue of events being dispatched. 
+     *  @note Swapped with pending queue on update so both buffers are reused.
+     */
+    EventQueue m_dispatchedEvents;
+    /*! Queue access mutex. */
     PMutex m_mutex;
+    /*! Identifier of the thread which constructed the manager. Listeners are managed and notified from this thread only. */
+    void* m_ownerThreadId;
+    /*! Listeners subscribed for all events. */
+    ListenerArray m_listeners;
+    /*! Listeners subscribed for particular events, by event ID. */
+    ListenerArrayMap m_listenersById;
+    /*! Dispatch nesting depth. */
+    s32 m_dispatchDepth;
+    /*! TRUE if any listener entries were cleared during dispatch. */
+    bool m_compactionNeeded;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -0,0 +1,249 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGEEvent.h>
+#include <EGEMemory.h>
+#include <EGEThread.h>
+#include <vector>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Listener recording IDs of received events. */
+class RecordingListener : public IEventListener
+{
+  public:
+
+    RecordingListener() : m_manager(NULL), m_listenerToRemove(NULL) {}
+
+    /*! Makes listener unsubscribe given listener once it receives any event. */
+    void removeOnEvent(EventManager* manager, const IEventListener* listener) { m_manager = manager; m_listenerToRemove = listener; }
+    /*! Returns IDs of received events. */
+    const std::vector<s32>& ids() const { return m_ids; }
+
+  private:
+
+    /*! @see IEventListener::onEventRecieved. */
+    void onEventRecieved(const Event& event) override
+    {
+      m_ids.push_back(event.id());
+
+      if (NULL != m_manager)
+      {
+        m_manager->removeListener(m_listenerToRemove);
+      }
+    }
+
+  private:
+
+    /*! IDs of received events. */
+    std::vector<s32> m_ids;
+    /*! Manager to unsubscribe listener from. */
+    EventManager* m_manager;
+    /*! Listener to unsubscribe once any event is received. */
+    const IEventListener* m_listenerToRemove;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Thread sending immediate event. */
+class SendingThread : public Thread
+{
+  public:
+
+    SendingThread(EventManager* manager, s32 id) : Thread(NULL), m_manager(manager), m_id(id) {}
+
+  private:
+
+    /*! @see Thread::run. */
+    s32 run() override
+    {
+      m_manager->send(m_id, true);
+      return 0;
+    }
+
+  private:
+
+    /*! Manager to send event thru. */
+    EventManager* m_manager;
+    /*! ID of event to send. */
+    s32 m_id;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class EventManagerTest : public TestBase
+{
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void SetUp();
+    virtual void TearDown();
+
+  protected:
+
+    /*! Tested manager. */
+    PEventManager m_manager;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void EventManagerTest::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void EventManagerTest::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void EventManagerTest::SetUp()
+{
+  m_manager = ege_new EventManager(NULL);
+  ASSERT_TRUE(NULL != m_manager);
+  ASSERT_EQ(EGE_SUCCESS, m_manager->construct());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void EventManagerTest::TearDown()
+{
+  m_manager = NULL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(EventManagerTest, DispatchOnUpdate)
+{
+  RecordingListener listener;
+  EXPECT_TRUE(m_manager->addListener(&listener));
+
+  // send queued events
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(1));
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(2, 5));
+  EXPECT_TRUE(listener.ids().empty());
+
+  // dispatch
+  m_manager->update(Time(0.016f));
+  ASSERT_EQ(2U, listener.ids().size());
+  EXPECT_EQ(1, listener.ids()[0]);
+  EXPECT_EQ(2, listener.ids()[1]);
+
+  // nothing is sent twice
+  m_manager->update(Time(0.016f));
+  EXPECT_EQ(2U, listener.ids().size());
+
+  // send immediate event
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(3, true));
+  ASSERT_EQ(3U, listener.ids().size());
+  EXPECT_EQ(3, listener.ids()[2]);
+
+  m_manager->removeListener(&listener);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(EventManagerTest, DispatchById)
+{
+  RecordingListener first;
+  RecordingListener second;
+  RecordingListener all;
+  EXPECT_TRUE(m_manager->addListener(&first, 1));
+  EXPECT_TRUE(m_manager->addListener(&second, 2));
+  EXPECT_TRUE(m_manager->addListener(&all));
+
+  // subscribing again does nothing
+  EXPECT_TRUE(m_manager->addListener(&first, 1));
+
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(1));
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(2));
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(3));
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(1));
+  m_manager->update(Time(0.016f));
+
+  // listeners subscribed for particular ID receive those events only
+  ASSERT_EQ(2U, first.ids().size());
+  EXPECT_EQ(1, first.ids()[0]);
+  EXPECT_EQ(1, first.ids()[1]);
+
+  ASSERT_EQ(1U, second.ids().size());
+  EXPECT_EQ(2, second.ids()[0]);
+
+  // listener subscribed for all receives everything in order
+  ASSERT_EQ(4U, all.ids().size());
+  EXPECT_EQ(1, all.ids()[0]);
+  EXPECT_EQ(2, all.ids()[1]);
+  EXPECT_EQ(3, all.ids()[2]);
+  EXPECT_EQ(1, all.ids()[3]);
+
+  // unsubscribe from everything
+  m_manager->removeListener(&first);
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(1, true));
+  EXPECT_EQ(2U, first.ids().size());
+  EXPECT_EQ(5U, all.ids().size());
+
+  m_manager->removeListener(&second);
+  m_manager->removeListener(&all);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(EventManagerTest, RemoveListenerDuringDispatch)
+{
+  RecordingListener remover;
+  RecordingListener removed;
+  RecordingListener removedFromAll;
+  RecordingListener remaining;
+
+  // remover unsubscribes listeners following it in the same array as well as listeners subscribed for all events
+  EXPECT_TRUE(m_manager->addListener(&remover, 1));
+  EXPECT_TRUE(m_manager->addListener(&removed, 1));
+  EXPECT_TRUE(m_manager->addListener(&remaining, 1));
+  EXPECT_TRUE(m_manager->addListener(&removedFromAll));
+  remover.removeOnEvent(m_manager, &removed);
+
+  RecordingListener secondRemover;
+  EXPECT_TRUE(m_manager->addListener(&secondRemover, 1));
+  secondRemover.removeOnEvent(m_manager, &removedFromAll);
+
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(1));
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(1));
+  m_manager->update(Time(0.016f));
+
+  // removed listeners are not notified anymore, not even about events of current dispatch
+  EXPECT_EQ(2U, remover.ids().size());
+  EXPECT_EQ(0U, removed.ids().size());
+  EXPECT_EQ(2U, remaining.ids().size());
+  EXPECT_EQ(0U, removedFromAll.ids().size());
+
+  // listener removes itself
+  remaining.removeOnEvent(m_manager, &remaining);
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(1, true));
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(1, true));
+  EXPECT_EQ(4U, remover.ids().size());
+  EXPECT_EQ(3U, remaining.ids().size());
+
+  // subscribe removed listener again after arrays are compacted
+  EXPECT_TRUE(m_manager->addListener(&removed, 2));
+  EXPECT_EQ(EGE_SUCCESS, m_manager->send(2, true));
+  EXPECT_EQ(1U, removed.ids().size());
+  EXPECT_EQ(4U, remover.ids().size());
+
+  m_manager->removeListener(&remover);
+  m_manager->removeListener(&removed);
+  m_manager->removeListener(&secondRemover);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(EventManagerTest, ImmediateEventFromOtherThread)
+{
+  RecordingListener listener;
+  EXPECT_TRUE(m_manager->addListener(&listener));
+
+  // send immediate event from other thread
+  PThread thread = ege_new SendingThread(m_manager, 7);
+  ASSERT_TRUE(NULL != thread);
+  ASSERT_TRUE(thread->start());
+
+  // NOTE: wait fails if thread has already finished
+  thread->wait();
+  EXPECT_TRUE(thread->isFinished());
+
+  // listener is not notified on other thread, event is queued instead
+  EXPECT_TRUE(listener.ids().empty());
+
+  m_manager->update(Time(0.016f));
+  ASSERT_EQ(1U, listener.ids().size());
+  EXPECT_EQ(7, listener.ids()[0]);
+
+  m_manager->removeListener(&listener);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -8,6 +8,8 @@
   #include "Airplay/File/FileAirplay_p.h"
 #elif EGE_PLATFORM_IOS
   #include "iOS/File/FileIOS_p.h"
+#elif EGE_PLATFORM_POSIX
+  #include "Posix/File/FilePosix_p.h"
 #endif
 
 EGE_NAMESPACE_BEGIN
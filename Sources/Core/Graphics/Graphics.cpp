@@ -3,6 +3,8 @@
 #include "Core/Graphics/Render/RenderTarget.h"
 #include "Core/Graphics/Render/RenderSystem.h"
 #include "Core/Graphics/Render/RenderWindow.h"
+#include "Core/Graphics/Recording/RenderSystemRecording.h"
+#include "Core/Graphics/Recording/RenderWindowRecording.h"
 #include "Core/Physics/PhysicsManager.h"
 #include "Core/Graphics/Particle/ParticleFactory.h"
 #include "Core/UI/WidgetFactory.h"
@@ -16,6 +18,8 @@
   #include "Airplay/Graphics/GraphicsAirplay_p.h"
 #elif EGE_PLATFORM_IOS
   #include "iOS/Graphics/GraphicsIOS_p.h"
+#elif EGE_PLATFORM_POSIX
+  #include "Posix/Graphics/GraphicsPosix_p.h"
 #endif
 
 EGE_NAMESPACE_BEGIN
@@ -48,19 +52,33 @@ EGEResult Graphics::construct()
 {
   EGEResult result;
 
-  // create private implementation
-  m_p = ege_new GraphicsPrivate(this);
-  if (NULL == m_p)
+  Dictionary::const_iterator iterHeadless = m_params.find(EGE_ENGINE_PARAM_HEADLESS);
+
+  // check if headless rendering is requested
+  if ((iterHeadless != m_params.end()) && iterHeadless->second.toBool())
   {
-    // error!
-    return EGE_ERROR_NO_MEMORY;
+    if (EGE_SUCCESS != (result = constructHeadless()))
+    {
+      // error!
+      return result;
+    }
   }
-
-  // construct private implementation
-  if (EGE_SUCCESS != (result = m_p->construct()))
+  else
   {
-    // error!
-    return result;
+    // create private implementation
+    m_p = ege_new GraphicsPrivate(this);
+    if (NULL == m_p)
+    {
+      // error!
+      return EGE_ERROR_NO_MEMORY;
+    }
+
+    // construct private implementation
+    if (EGE_SUCCESS != (result = m_p->construct()))
+    {
+      // error!
+      return result;
+    }
   }
 
   // create particle factory
@@ -205,5 +223,45 @@ IHardwareResourceProvider* Graphics::hardwareResourceProvider()
   return m_renderSystem;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult Graphics::constructHeadless()
+{
+  EGEResult result = EGE_SUCCESS;
+
+  // allocate render window
+  RenderWindowRecording* renderWindow = ege_new RenderWindowRecording(app(), m_params);
+  if (NULL == renderWindow)
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  // NOTE: render window is owned by render targets pool
+  PRenderWindow window = renderWindow;
+  if (EGE_SUCCESS != (result = renderWindow->construct(m_params)))
+  {
+    // error!
+    return result;
+  }
+
+  // create render system
+  m_renderSystem = ege_new RenderSystemRecording(app());
+  if (NULL == m_renderSystem)
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  if (EGE_SUCCESS != (result = m_renderSystem->construct()))
+  {
+    // error!
+    return result;
+  }
+
+  // add to render targets pool
+  registerRenderTarget(window);
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
\ No newline at end of file
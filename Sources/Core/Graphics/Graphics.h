@@ -76,6 +76,8 @@ class Graphics : public Object
 
     /*! Unregisteres all render targets. */
     void unregisterAllRenderTargets();
+    /*! Creates off-screen render window and recording render system. */
+    EGEResult constructHeadless();
 
   private:
 
@@ -42,7 +42,7 @@ EGEResult ImageLoader::construct()
   }
 
   // subscribe for event notifications
-  if ( ! app()->eventManager()->addListener(this))
+  if ( ! app()->eventManager()->addListener(this, EGE_EVENT_ID_CORE_QUIT_REQUEST))
   {
     // error!
     egeCritical(KImageLoaderDebugName) << EGE_FUNC_INFO << "Could not register for notifications!";
@@ -74,9 +74,9 @@ ImageLoader::State ImageLoader::state() const
   return p_func()->state();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void ImageLoader::onEventRecieved(PEvent event)
+void ImageLoader::onEventRecieved(const Event& event)
 {
-  switch (event->id())
+  switch (event.id())
   {
     case EGE_EVENT_ID_CORE_QUIT_REQUEST:
 
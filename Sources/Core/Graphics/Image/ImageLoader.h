@@ -72,7 +72,7 @@ class ImageLoader : public Object, public IEventListener
   private:
 
     /*! @see IEventListener::onEventRecieved. */
-    void onEventRecieved(PEvent event) override;
+    void onEventRecieved(const Event& event) override;
     /*! Shuts down. */
     void shutDown();
 
@@ -1,4 +1,5 @@
 #include "Core/Graphics/ImagedAnimation/Interface/ImagedAnimation.h"
+#include "Core/Graphics/ImagedAnimation/Interface/ImagedAnimationGeometry.h"
 #include "EGESequencer.h"
 #include "EGEPhysics.h"
 #include "EGEGraphics.h"
@@ -21,8 +22,8 @@ ImagedAnimation::ImagedAnimation() : Object(NULL)
                                    , m_displaySize(50, 50)
                                    , m_baseAlignment(ALIGN_TOP_LEFT)
                                    , m_alpha(1.0f)
-                                   , m_renderDataNeedsUpdate(false)
                                    , m_transform(Matrix4f::IDENTITY)
+                                   , m_modelMatrix(Matrix4f::IDENTITY)
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -33,8 +34,8 @@ ImagedAnimation::ImagedAnimation(Application* app, const String& name) : Object(
                                                                        , m_displaySize(50, 50)
                                                                        , m_baseAlignment(ALIGN_TOP_LEFT)
                                                                        , m_alpha(1.0f)
-                                                                       , m_renderDataNeedsUpdate(false)
                                                                        , m_transform(Matrix4f::IDENTITY)
+                                                                       , m_modelMatrix(Matrix4f::IDENTITY)
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -68,7 +69,7 @@ EGEResult ImagedAnimation::play(const String& sequencerName)
     return EGE_ERROR_NOT_FOUND;
   }
 
-  if ( ! isPlaying() && ! m_objects.empty() && ! m_framesActionsList.empty() && (NULL != m_currentSequencer))
+  if ( ! isPlaying() && (NULL != m_geometry) && (0 < m_geometry->frameCount()) && (NULL != m_currentSequencer))
   {
     // setup sequencer
     m_currentSequencer->setFrameDuration(m_frameDuration);
@@ -169,31 +170,26 @@ EGEResult ImagedAnimation::addForRendering(IRenderer& renderer)
 {
   EGEResult result = EGE_SUCCESS;
 
-  // check if no sequencer
-  if (NULL != m_currentSequencer)
+  // check if no sequencer or geometry
+  if ((NULL != m_currentSequencer) && (NULL != m_geometry))
   {
-    // check if render data is invalid
-    if (m_renderDataNeedsUpdate)
-    {
-      // update render data
-      updateRenderData();
-
-      // reset flag
-      m_renderDataNeedsUpdate = false;
-    }
-
-    EGE_ASSERT(m_currentSequencer->frameId(m_currentSequencer->currentFrameIndex()) < static_cast<s32>(m_renderComponents.size()));
+    EGE_ASSERT(m_currentSequencer->frameId(m_currentSequencer->currentFrameIndex()) < static_cast<s32>(m_geometry->frameCount()));
 
     // get current frame render data
-    PRenderComponent& renderComponent = m_renderComponents[m_currentSequencer->frameId(m_currentSequencer->currentFrameIndex())];
+    // NOTE: render data is shared with other instances so it is never modified here
+    PRenderComponent renderComponent = m_geometry->frame(m_currentSequencer->frameId(m_currentSequencer->currentFrameIndex()), m_renderPriority);
+    if (NULL == renderComponent)
+    {
+      // error!
+      return EGE_ERROR;
+    }
 
     // update alpha
     //ColorTransform colorTransform(Color::NONE, Color(1.0f, 1.0f, 1.0f, m_alpha));
     //frameData.renderData->material()->setDiffuseColorTransformation(colorTransform);
 
     // render
-    renderComponent->setPriority(m_renderPriority);
-    result = renderer.addForRendering(renderComponent);
+    result = renderer.addForRendering(renderComponent, m_modelMatrix);
   }
 
   return result;
@@ -207,6 +203,9 @@ void ImagedAnimation::setRenderPriority(s32 priority)
 void ImagedAnimation::setDisplaySize(const Vector2f& size)
 {
   m_displaySize = size;
+
+  // alignment depends on display size
+  updateModelMatrix();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 const Vector2f& ImagedAnimation::displaySize() const
@@ -220,15 +219,14 @@ void ImagedAnimation::setBaseAlignment(Alignment alignment)
   {
     m_baseAlignment = alignment;
 
-    // make sure render data gets updated
-    m_renderDataNeedsUpdate = true;
+    // update model matrix
+    updateModelMatrix();
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void ImagedAnimation::clear()
 {
-  m_objects.clear();
-  m_renderComponents.clear();
+  m_geometry = NULL;
   m_sequencers.clear();
 
   // disconnect from sequencer
@@ -298,180 +296,21 @@ void ImagedAnimation::setAlpha(float32 alpha)
   m_alpha = alpha;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void ImagedAnimation::updateRenderData()
+void ImagedAnimation::addData(const EGEImagedAnimation::ObjectMap& objects, const List<EGEImagedAnimation::ActionDataList>& frameActions)
 {
-  // TAGE - possibly we can reuse existing data (if any) in case of ie transformation changes
-  m_renderComponents.clear();
-
-  VertexDeclaration declaration;
-  declaration.addElement(NVertexBuffer::VES_POSITION_XY);
-  declaration.addElement(NVertexBuffer::VES_TEXTURE_UV);
-  declaration.addElement(NVertexBuffer::VES_COLOR_RGBA);
-
-  // go thru all frames
-  for (List<EGEImagedAnimation::ActionDataList>::const_iterator itFrame = m_framesActionsList.begin(); itFrame != m_framesActionsList.end(); ++itFrame)
-  {
-    const List<EGEImagedAnimation::ActionData>& actions = *itFrame;
-
-    // calculate number of vertices required for current frame
-    const u32 vertexCount = calculateFrameVertexCount(m_objects, actions);
-    
-    // create render component for current frame
-    PRenderComponent frameRenderData = ege_new RenderComponent(app(), name(), declaration);
-    EGE_ASSERT(NULL != frameRenderData);
-
-    PVertexBuffer vertexBuffer = frameRenderData->vertexBuffer();
-    vertexBuffer->setSize(vertexCount);
-    float32* data = reinterpret_cast<float32*>(vertexBuffer->lock(0, vertexCount));
-    EGE_ASSERT(NULL != data);
-
-    // go thru all frame actions
-    for (List<EGEImagedAnimation::ActionData>::const_iterator itAction = actions.begin(); itAction != actions.end(); ++itAction)
-    {
-      const EGEImagedAnimation::ActionData& action = *itAction;
-      
-      // go thru all action children
-      const EGEImagedAnimation::Object& object = m_objects.at(action.objectId);
-      for (EGEImagedAnimation::ChildObjectList::const_iterator itObject = object.children.begin(); itObject != object.children.end(); ++itObject)
-      {
-        const EGEImagedAnimation::ChildObject& child = *itObject;
-
-        Matrix4f finalMatrix = m_transform * (action.matrix * child.matrix);
-        
-        // check if no material assigned yet
-        if (frameRenderData->material() == NULL)
-        {
-          // create material
-          PMaterial material = ege_new Material(app());
-
-          // add pass
-          RenderPass* pass = material->addPass(NULL);
-
-          // setup material
-          pass->setSrcBlendFactor(EGEGraphics::BF_SRC_ALPHA);
-          pass->setDstBlendFactor(EGEGraphics::BF_ONE_MINUS_SRC_ALPHA);
-
-          PTextureImage ti = ege_new TextureImage(child.material->pass(0)->texture(0)->texture());
-          pass->addTexture(ti);
-
-          frameRenderData->setMaterial(material);
-        }
-
-        // apply alignment
-        Vector2f translation = Vector2f(finalMatrix.translationX(), finalMatrix.translationY());
-        translation = Math::Align(translation, m_displaySize, ALIGN_TOP_LEFT, m_baseAlignment);
-        finalMatrix.setTranslation(translation.x, translation.y, finalMatrix.translationZ());
-
-        // calculate quad vertices
-        Vector4f vertexTL(0, 0, 0, 1);
-        Vector4f vertexBL(0, child.size.y, 0, 1);
-        Vector4f vertexBR(child.size.x, child.size.y, 0, 1);
-        Vector4f vertexTR(child.size.x, 0, 0, 1);
-
-        vertexTL = finalMatrix * vertexTL;
-        vertexBL = finalMatrix * vertexBL;
-        vertexBR = finalMatrix * vertexBR;
-        vertexTR = finalMatrix * vertexTR;
-
-        // update render data
-
-        // vertex 1
-        *data++ = vertexTL.x;
-        *data++ = vertexTL.y;
-        *data++ = child.rect.x;
-        *data++ = child.rect.y;
-        *data++ = action.color.red;
-        *data++ = action.color.green;
-        *data++ = action.color.blue;
-        *data++ = action.color.alpha;
-
-        // vertex 2
-        *data++ = vertexBL.x;
-        *data++ = vertexBL.y;
-        *data++ = child.rect.x;
-        *data++ = child.rect.y + child.rect.height;
-        *data++ = action.color.red;
-        *data++ = action.color.green;
-        *data++ = action.color.blue;
-        *data++ = action.color.alpha;
-
-        // vertex 3
-        *data++ = vertexBR.x;
-        *data++ = vertexBR.y;
-        *data++ = child.rect.x + child.rect.width;
-        *data++ = child.rect.y + child.rect.height;
-        *data++ = action.color.red;
-        *data++ = action.color.green;
-        *data++ = action.color.blue;
-        *data++ = action.color.alpha;
-
-        // vertex 4
-        *data++ = vertexTL.x;
-        *data++ = vertexTL.y;
-        *data++ = child.rect.x;
-        *data++ = child.rect.y;
-        *data++ = action.color.red;
-        *data++ = action.color.green;
-        *data++ = action.color.blue;
-        *data++ = action.color.alpha;
-
-        // vertex 5
-        *data++ = vertexBR.x;
-        *data++ = vertexBR.y;
-        *data++ = child.rect.x + child.rect.width;
-        *data++ = child.rect.y + child.rect.height;
-        *data++ = action.color.red;
-        *data++ = action.color.green;
-        *data++ = action.color.blue;
-        *data++ = action.color.alpha;
-
-        // vertex 6
-        *data++ = vertexTR.x;
-        *data++ = vertexTR.y;
-        *data++ = child.rect.x + child.rect.width;
-        *data++ = child.rect.y;
-        *data++ = action.color.red;
-        *data++ = action.color.green;
-        *data++ = action.color.blue;
-        *data++ = action.color.alpha;
-      }
-    }
-
-    vertexBuffer->unlock(data - 1);
-
-    // add to pool
-    m_renderComponents.push_back(frameRenderData);
-  }
+  // create private geometry
+  m_geometry = ege_new ImagedAnimationGeometry(app(), name(), objects, frameActions);
+  EGE_ASSERT(NULL != m_geometry);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void ImagedAnimation::addData(const EGEImagedAnimation::ObjectMap& objects, const List<EGEImagedAnimation::ActionDataList>& frameActions)
+void ImagedAnimation::setGeometry(const PImagedAnimationGeometry& geometry)
 {
-  // store data
-  m_objects           = objects;
-  m_framesActionsList = frameActions;
-
-  // make sure render data gets rebuilt
-  m_renderDataNeedsUpdate = true;
+  m_geometry = geometry;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-u32 ImagedAnimation::calculateFrameVertexCount(const EGEImagedAnimation::ObjectMap& objects, const EGEImagedAnimation::ActionDataList& frameActionList) const
+PImagedAnimationGeometry ImagedAnimation::geometry() const
 {
-  u32 vertexCount = 0;
-
-  // go thru all frame actions
-  for (EGEImagedAnimation::ActionDataList::const_iterator itAction = frameActionList.begin(); itAction != frameActionList.end(); ++itAction)
-  {
-    const EGEImagedAnimation::ActionData& action = *itAction;
-      
-    // go thru all action children
-    const EGEImagedAnimation::Object& object = objects.at(action.objectId);
-
-    // update vertex count (number of objects)
-    vertexCount += object.children.size();
-  }
-
-  // (6 vertices per object/quad)
-  return vertexCount * 6;
+  return m_geometry;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 const String& ImagedAnimation::name() const
@@ -486,8 +325,20 @@ void ImagedAnimation::setTransformationMatrix(const Matrix4f& transform)
     // store new value
     m_transform = transform;
 
-    // mark dirty to recalculate
-    m_renderDataNeedsUpdate = true;
+    // update model matrix
+    updateModelMatrix();
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ImagedAnimation::updateModelMatrix()
+{
+  // calculate alignment offset
+  // NOTE: alignment is applied on top of global transformation
+  const Vector2f offset = Math::Align(Vector2f::ZERO, m_displaySize, ALIGN_TOP_LEFT, m_baseAlignment);
+
+  Matrix4f alignment = Matrix4f::IDENTITY;
+  alignment.setTranslation(offset.x, offset.y, 0);
+
+  m_modelMatrix = alignment * m_transform;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
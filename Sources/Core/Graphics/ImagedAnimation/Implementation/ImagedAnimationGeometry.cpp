@@ -0,0 +1,217 @@
+#include "Core/Graphics/ImagedAnimation/Interface/ImagedAnimationGeometry.h"
+#include "EGEGraphics.h"
+#include "EGERenderComponent.h"
+#include "EGEDebug.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(ImagedAnimationGeometry)
+EGE_DEFINE_DELETE_OPERATORS(ImagedAnimationGeometry)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+ImagedAnimationGeometry::ImagedAnimationGeometry(Application* app, const String& name, const EGEImagedAnimation::ObjectMap& objects, 
+                                                 const List<EGEImagedAnimation::ActionDataList>& frameActions) : Object(app)
+                                                                                                                 , m_name(name)
+                                                                                                                 , m_objects(objects)
+                                                                                                                 , m_framesActionsList(frameActions)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+ImagedAnimationGeometry::~ImagedAnimationGeometry()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 ImagedAnimationGeometry::frameCount() const
+{
+  return static_cast<u32>(m_framesActionsList.size());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PRenderComponent ImagedAnimationGeometry::frame(u32 index, s32 priority)
+{
+  EGE_ASSERT(index < frameCount());
+
+  // check if render data for given priority is not built yet
+  Map<s32, RenderComponentArray>::iterator it = m_renderComponents.find(priority);
+  if (it == m_renderComponents.end())
+  {
+    RenderComponentArray components;
+    if (EGE_SUCCESS != build(priority, components))
+    {
+      // error!
+      return NULL;
+    }
+
+    m_renderComponents.insert(priority, components);
+    it = m_renderComponents.find(priority);
+  }
+
+  return it->second.at(index, NULL);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult ImagedAnimationGeometry::build(s32 priority, RenderComponentArray& components) const
+{
+  VertexDeclaration declaration;
+  declaration.addElement(NVertexBuffer::VES_POSITION_XY);
+  declaration.addElement(NVertexBuffer::VES_TEXTURE_UV);
+  declaration.addElement(NVertexBuffer::VES_COLOR_RGBA);
+
+  // go thru all frames
+  for (ActionDataList::const_iterator itFrame = m_framesActionsList.begin(); itFrame != m_framesActionsList.end(); ++itFrame)
+  {
+    const EGEImagedAnimation::ActionDataList& actions = *itFrame;
+
+    // calculate number of vertices required for current frame
+    const u32 vertexCount = calculateFrameVertexCount(actions);
+    
+    // create render component for current frame
+    // NOTE: frame data never changes once built
+    PRenderComponent frameRenderData = ege_new RenderComponent(app(), m_name, declaration, priority, EGEGraphics::RPT_TRIANGLES, 
+                                                               NVertexBuffer::UT_STATIC_WRITE);
+    if (NULL == frameRenderData)
+    {
+      // error!
+      return EGE_ERROR_NO_MEMORY;
+    }
+
+    PVertexBuffer vertexBuffer = frameRenderData->vertexBuffer();
+    vertexBuffer->setSize(vertexCount);
+    float32* data = reinterpret_cast<float32*>(vertexBuffer->lock(0, vertexCount));
+    EGE_ASSERT(NULL != data);
+
+    // go thru all frame actions
+    for (List<EGEImagedAnimation::ActionData>::const_iterator itAction = actions.begin(); itAction != actions.end(); ++itAction)
+    {
+      const EGEImagedAnimation::ActionData& action = *itAction;
+      
+      // go thru all action children
+      const EGEImagedAnimation::Object& object = m_objects.at(action.objectId);
+      for (EGEImagedAnimation::ChildObjectList::const_iterator itObject = object.children.begin(); itObject != object.children.end(); ++itObject)
+      {
+        const EGEImagedAnimation::ChildObject& child = *itObject;
+
+        // NOTE: instance transformation and alignment are not baked in, they are applied as model matrix at submission
+        const Matrix4f finalMatrix = action.matrix * child.matrix;
+        
+        // check if no material assigned yet
+        if (frameRenderData->material() == NULL)
+        {
+          // create material
+          PMaterial material = ege_new Material(app());
+
+          // add pass
+          RenderPass* pass = material->addPass(NULL);
+
+          // setup material
+          pass->setSrcBlendFactor(EGEGraphics::BF_SRC_ALPHA);
+          pass->setDstBlendFactor(EGEGraphics::BF_ONE_MINUS_SRC_ALPHA);
+
+          PTextureImage ti = ege_new TextureImage(child.material->pass(0)->texture(0)->texture());
+          pass->addTexture(ti);
+
+          frameRenderData->setMaterial(material);
+        }
+
+        // calculate quad vertices
+        Vector4f vertexTL(0, 0, 0, 1);
+        Vector4f vertexBL(0, child.size.y, 0, 1);
+        Vector4f vertexBR(child.size.x, child.size.y, 0, 1);
+        Vector4f vertexTR(child.size.x, 0, 0, 1);
+
+        vertexTL = finalMatrix * vertexTL;
+        vertexBL = finalMatrix * vertexBL;
+        vertexBR = finalMatrix * vertexBR;
+        vertexTR = finalMatrix * vertexTR;
+
+        // update render data
+
+        // vertex 1
+        *data++ = vertexTL.x;
+        *data++ = vertexTL.y;
+        *data++ = child.rect.x;
+        *data++ = child.rect.y;
+        *data++ = action.color.red;
+        *data++ = action.color.green;
+        *data++ = action.color.blue;
+        *data++ = action.color.alpha;
+
+        // vertex 2
+        *data++ = vertexBL.x;
+        *data++ = vertexBL.y;
+        *data++ = child.rect.x;
+        *data++ = child.rect.y + child.rect.height;
+        *data++ = action.color.red;
+        *data++ = action.color.green;
+        *data++ = action.color.blue;
+        *data++ = action.color.alpha;
+
+        // vertex 3
+        *data++ = vertexBR.x;
+        *data++ = vertexBR.y;
+        *data++ = child.rect.x + child.rect.width;
+        *data++ = child.rect.y + child.rect.height;
+        *data++ = action.color.red;
+        *data++ = action.color.green;
+        *data++ = action.color.blue;
+        *data++ = action.color.alpha;
+
+        // vertex 4
+        *data++ = vertexTL.x;
+        *data++ = vertexTL.y;
+        *data++ = child.rect.x;
+        *data++ = child.rect.y;
+        *data++ = action.color.red;
+        *data++ = action.color.green;
+        *data++ = action.color.blue;
+        *data++ = action.color.alpha;
+
+        // vertex 5
+        *data++ = vertexBR.x;
+        *data++ = vertexBR.y;
+        *data++ = child.rect.x + child.rect.width;
+        *data++ = child.rect.y + child.rect.height;
+        *data++ = action.color.red;
+        *data++ = action.color.green;
+        *data++ = action.color.blue;
+        *data++ = action.color.alpha;
+
+        // vertex 6
+        *data++ = vertexTR.x;
+        *data++ = vertexTR.y;
+        *data++ = child.rect.x + child.rect.width;
+        *data++ = child.rect.y;
+        *data++ = action.color.red;
+        *data++ = action.color.green;
+        *data++ = action.color.blue;
+        *data++ = action.color.alpha;
+      }
+    }
+
+    vertexBuffer->unlock(data - 1);
+
+    // add to pool
+    components.push_back(frameRenderData);
+  }
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 ImagedAnimationGeometry::calculateFrameVertexCount(const EGEImagedAnimation::ActionDataList& frameActionList) const
+{
+  u32 vertexCount = 0;
+
+  // go thru all frame actions
+  for (EGEImagedAnimation::ActionDataList::const_iterator itAction = frameActionList.begin(); itAction != frameActionList.end(); ++itAction)
+  {
+    const EGEImagedAnimation::ActionData& action = *itAction;
+      
+    // go thru all action children
+    const EGEImagedAnimation::Object& object = m_objects.at(action.objectId);
+
+    // update vertex count (number of objects)
+    vertexCount += object.children.size();
+  }
+
+  // (6 vertices per object/quad)
+  return vertexCount * 6;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -23,6 +23,7 @@ EGE_NAMESPACE_BEGIN
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class IRenderer;
 EGE_DECLARE_SMART_CLASS(ImagedAnimation, PImagedAnimation)
+EGE_DECLARE_SMART_CLASS(ImagedAnimationGeometry, PImagedAnimationGeometry)
 EGE_DECLARE_SMART_CLASS(Material, PMaterial)
 EGE_DECLARE_SMART_CLASS(RenderComponent, PRenderComponent)
 EGE_DECLARE_SMART_CLASS(PhysicsComponent, PPhysicsComponent)
@@ -77,6 +78,7 @@ class ImagedAnimation : public Object
 
     /*! Sets global transformation matrix. 
      *  @param  transform New global transformation matrix for animation.
+     *  @note Transformation is applied as model matrix at submission, render data is not affected.
      */
     void setTransformationMatrix(const Matrix4f& transform);
 
@@ -101,8 +103,15 @@ class ImagedAnimation : public Object
     /*! Adds animation data.
      *  @param  objects       Map of all unique objects animation is built from.
      *  @param  frameActions  List of actions for each each frame of animation.
+     *  @note Frame geometry is built for this instance only. Use setGeometry to share geometry between instances.
      */
     void addData(const EGEImagedAnimation::ObjectMap& objects, const List<EGEImagedAnimation::ActionDataList>& frameActions);
+    /*! Sets frame geometry. 
+     *  @param  geometry  Geometry of all animation frames. It can be shared between any number of instances.
+     */
+    void setGeometry(const PImagedAnimationGeometry& geometry);
+    /*! Returns frame geometry. */
+    PImagedAnimationGeometry geometry() const;
 
     /*! Adds sequencer. */
     void addSequencer(const PSequencer& sequencer);
@@ -120,8 +129,6 @@ class ImagedAnimation : public Object
   private:
 
     typedef DynamicArray<PSequencer> SequencerArray;
-    typedef DynamicArray<PRenderComponent> RenderComponentArray;
-    typedef List<EGEImagedAnimation::ActionDataList> ActionDataList;
 
   private:
 
@@ -129,10 +136,8 @@ class ImagedAnimation : public Object
     State state() const { return m_state; }
     /*! Returns sequencer of a given name. */
     PSequencer sequencer(const String& name) const;
-    /*! Calculates number of vertices required for a given render frame. */
-    u32 calculateFrameVertexCount(const EGEImagedAnimation::ObjectMap& objects, const EGEImagedAnimation::ActionDataList& frameActionList) const;
-    /*! Updates render data. */
-    void updateRenderData();
+    /*! Updates model matrix. */
+    void updateModelMatrix();
 
   private slots:
 
@@ -161,16 +166,12 @@ class ImagedAnimation : public Object
     PSequencer m_currentSequencer;
     /*! Global color alpha value. */
     float32 m_alpha;
-    /*! Render data validity flag. */
-    bool m_renderDataNeedsUpdate;
     /*! Global transformation matrix. */
     Matrix4f m_transform;
-    /*! Animation objects sorted by object ID. */
-    EGEImagedAnimation::ObjectMap m_objects;
-    /*! Animation frame action list. */
-    ActionDataList m_framesActionsList;
-    /*! Array of frame render components. */
-    RenderComponentArray m_renderComponents;
+    /*! Model matrix frames are submitted with. This is global transformation combined with alignment. */
+    Matrix4f m_modelMatrix;
+    /*! Frame geometry. */
+    PImagedAnimationGeometry m_geometry;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
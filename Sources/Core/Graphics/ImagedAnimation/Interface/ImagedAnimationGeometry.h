@@ -0,0 +1,72 @@
+#ifndef EGE_CORE_IMAGEDANIMATIONGEOMETRY_H
+#define EGE_CORE_IMAGEDANIMATIONGEOMETRY_H
+
+/** Imaged animation geometry holds render data of all frames of an imaged animation. Geometry is built in animation local space and is shared, read-only, by 
+ *  all imaged animation instances created from the same definition. Each instance applies its own transformation as a model matrix at the time of 
+ *  submission.
+ */
+
+#include "EGE.h"
+#include "EGEDynamicArray.h"
+#include "EGEImagedAnimation.h"
+#include "EGEList.h"
+#include "EGEMap.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DECLARE_SMART_CLASS(ImagedAnimationGeometry, PImagedAnimationGeometry)
+EGE_DECLARE_SMART_CLASS(RenderComponent, PRenderComponent)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class ImagedAnimationGeometry : public Object
+{
+  public:
+
+    ImagedAnimationGeometry(Application* app, const String& name, const EGEImagedAnimation::ObjectMap& objects, 
+                            const List<EGEImagedAnimation::ActionDataList>& frameActions);
+   ~ImagedAnimationGeometry();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+  public:
+
+    /*! Returns number of frames. */
+    u32 frameCount() const;
+    /*! Returns render component of a given frame.
+     *  @param  index     Frame index.
+     *  @param  priority  Render priority component is to be rendered with.
+     *  @return Render component of the frame. NULL if frame could not be built.
+     *  @note Render data of all frames is built on first request for a given priority and shared afterwards. Thus, instances rendered with the same 
+     *        priority share the same render components.
+     */
+    PRenderComponent frame(u32 index, s32 priority);
+
+  private:
+
+    typedef DynamicArray<PRenderComponent> RenderComponentArray;
+    typedef List<EGEImagedAnimation::ActionDataList> ActionDataList;
+
+  private:
+
+    /*! Builds render components of all frames for a given priority. */
+    EGEResult build(s32 priority, RenderComponentArray& components) const;
+    /*! Calculates number of vertices required for a given render frame. */
+    u32 calculateFrameVertexCount(const EGEImagedAnimation::ActionDataList& frameActionList) const;
+
+  private:
+
+    /*! Name. */
+    String m_name;
+    /*! Animation objects sorted by object ID. */
+    EGEImagedAnimation::ObjectMap m_objects;
+    /*! Animation frame action list. */
+    ActionDataList m_framesActionsList;
+    /*! Frame render components for each render priority in use. */
+    Map<s32, RenderComponentArray> m_renderComponents;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_IMAGEDANIMATIONGEOMETRY_H
\ No newline at end of file
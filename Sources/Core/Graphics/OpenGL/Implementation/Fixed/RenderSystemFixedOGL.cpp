@@ -83,8 +83,7 @@ void RenderSystemFixedOGL::applyPassParams(const PRenderPass& pass)
   {
     setBlendEnabled(true);
       
-    glBlendFunc(mapBlendFactor(pass->srcBlendFactor()), mapBlendFactor(pass->dstBlendFactor()));
-    OGL_CHECK()
+    setBlendFunc(mapBlendFactor(pass->srcBlendFactor()), mapBlendFactor(pass->dstBlendFactor()));
   }
   else
   {
@@ -211,8 +210,6 @@ PProgram RenderSystemFixedOGL::createProgram(const String& name, const List<PSha
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystemFixedOGL::renderComponent(const PRenderComponent& component, const Matrix4f& modelMatrix)
 {
-  RenderSystemFrameStatisticData& statisticsData = ege_cast<RenderSystemStatistics*>(this->component(EGE_OBJECT_UID_RENDER_SYSTEM_STATISTICS))->currentRecord();
-
   // set component being rendered
   setActiveRenderComponent(component);
 
@@ -267,7 +264,7 @@ void RenderSystemFixedOGL::renderComponent(const PRenderComponent& component, co
     else
     {
       // bind vao
-      vao->bind();
+      bindVertexArrayObject(vao);
     }
 
     // NOTE: change to modelview after material is applied as it may change current matrix mode
@@ -277,12 +274,7 @@ void RenderSystemFixedOGL::renderComponent(const PRenderComponent& component, co
     const u32 vertexCount = (0 < indexBuffer->indexCount()) ? indexBuffer->indexCount() : vertexBuffer->vertexCount();
 
     // update statistics
-    statisticsData.vertexCount += vertexCount;
-    statisticsData.batchCount++;
-    statisticsData.queues.rbegin()->indexedBatchCount += (0 < indexBuffer->indexCount()) ? 1 : 0;
-    statisticsData.queues.rbegin()->batchCount++;
-    statisticsData.queues.rbegin()->vertexCount += vertexCount;
-    statisticsData.queues.rbegin()->componentNames << component->name();
+    EGE_RENDER_STATISTICS(m_statistics->addBatch(component, vertexCount, 0 < indexBuffer->indexCount()));
 
     // set model-view matrix
     glLoadMatrixf(m_viewMatrix.multiply(modelMatrix).data);
@@ -294,24 +286,18 @@ void RenderSystemFixedOGL::renderComponent(const PRenderComponent& component, co
       // render only if there is anything to render
       glDrawElements(mapPrimitiveType(component->primitiveType()), indexBuffer->indexCount(), mapIndexSize(indexBuffer->size()), indexBuffer->offset());
       OGL_CHECK()
-
-      // update statistics
-      statisticsData.drawElementsCalls++;
     }
     else
     {
       // render only if there is anything to render
       glDrawArrays(mapPrimitiveType(component->primitiveType()), 0, vertexBuffer->vertexCount());
       OGL_CHECK()
-
-      // update statistics
-      statisticsData.drawArraysCalls++;
     }
 
     if (NULL != vao)
     {
       // unbind vao
-      vao->unbind();
+      bindVertexArrayObject(NULL);
     }
 
     // clean up
@@ -319,8 +305,7 @@ void RenderSystemFixedOGL::renderComponent(const PRenderComponent& component, co
     {
       // disable texturing on server side
       activateTextureUnit(i);
-      glDisable(GL_TEXTURE_2D);
-      OGL_CHECK()
+      disableTexture(GL_TEXTURE_2D);
 
       // disable texturing data on client side
       if (NULL == vao)
@@ -471,7 +456,7 @@ void RenderSystemFixedOGL::setupVAO(PVertexArrayObject& vertexArrayObject, const
 
   // bind VAO
   // NOTE: Currently, all vertex states are stored within VAO rather than in OpenGL state machine, so there is no need to unbind anything 
-  vertexArrayObject->bind();
+  bindVertexArrayObject(vertexArrayObject);
 
   // bind VBO
   vertexBuffer->bind();
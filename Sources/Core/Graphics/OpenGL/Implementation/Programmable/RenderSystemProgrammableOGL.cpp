@@ -9,15 +9,6 @@
 
 EGE_NAMESPACE
 
-//--------------------------------------------------------------------------------------------------------------------------------------------------------------
-static const String KUniformModelViewPerspectiveName = "u_mvpMatrix";
-static const String KUniformTexture2DXName           = "u_texture2D%1";
-static const String KUniformTextureMatrixXName       = "u_texMatrix%1";
-
-static const String KAttributeVertexName        = "a_vertex";
-static const String KAttributeNormalName        = "a_normal";
-static const String KAttributeColorName         = "a_color";
-static const String KAttributeTextureCoordXName = "a_texCoord%1";
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 RenderSystemProgrammableOGL::RenderSystemProgrammableOGL(Application* app) : RenderSystemOGL(app)
                                                                            , m_activeProgram(NULL)
@@ -34,7 +25,7 @@ void RenderSystemProgrammableOGL::flush()
   EGE_ASSERT(NULL != renderTarget);
 
   // prepare projection matrix
-  m_finalProjectionMatrix = m_projectionMatrix;
+  Matrix4f projectionMatrix = m_projectionMatrix;
 
   // check if not auto-rotated
   if ( ! renderTarget->isAutoRotated())
@@ -46,11 +37,33 @@ void RenderSystemProgrammableOGL::flush()
     Matrix4f matrix;
     Math::Convert(matrix, rotation);
 
-    m_finalProjectionMatrix *= matrix;
+    // NOTE: rotation is applied on top of projection, same as in fixed pipeline
+    projectionMatrix = matrix.multiply(m_projectionMatrix);
   }
 
+  // calculate view-projection matrix
+  // NOTE: it is the same for all components rendered during this flush
+  m_viewProjectionMatrix = projectionMatrix.multiply(m_viewMatrix);
+
+  // NOTE: program could have been changed outside ie during linking
+  m_activeProgram = NULL;
+
   // call base class
   RenderSystemOGL::flush();
+
+  // clean up
+  // NOTE: states are kept between components and passes to avoid redundant changes, reset them once everything is rendered
+  bindVertexArrayObject(NULL);
+  bindProgram(NULL);
+
+  for (s32 i = m_activeTextureUnitsCount - 1; 0 <= i; --i)
+  {
+    // disable texturing on server side
+    activateTextureUnit(i);
+    disableTexture(GL_TEXTURE_2D);
+  }
+
+  m_activeTextureUnitsCount = 0;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystemProgrammableOGL::applyPassParams(const PRenderPass& pass)
@@ -60,8 +73,22 @@ void RenderSystemProgrammableOGL::applyPassParams(const PRenderPass& pass)
   //glColor4f(color.red, color.green, color.blue, color.alpha);
   //OGL_CHECK()
 
+  // enable blending if necessary
+  if ((EGEGraphics::BF_ONE != pass->srcBlendFactor()) || (EGEGraphics::BF_ZERO != pass->dstBlendFactor()))
+  {
+    setBlendEnabled(true);
+    setBlendFunc(mapBlendFactor(pass->srcBlendFactor()), mapBlendFactor(pass->dstBlendFactor()));
+  }
+  else
+  {
+    setBlendEnabled(false);
+  }
+
+  const u32 textureCount = pass->textureCount();
+  EGE_ASSERT_X(EGE_OGL_PROGRAM_MAX_TEXTURE_UNITS >= textureCount, "Too many textures in pass!");
+
   // go thru all textures
-  for (u32 i = 0; i < pass->textureCount(); ++i)
+  for (u32 i = 0; i < textureCount; ++i)
   {
     PTextureImage textureImage = pass->texture(i);
     EGE_ASSERT(EGE_OBJECT_UID_TEXTURE_IMAGE == textureImage->uid());
@@ -79,15 +106,11 @@ void RenderSystemProgrammableOGL::applyPassParams(const PRenderPass& pass)
         bindTexture(GL_TEXTURE_2D, tex2d->id());
       }
 
-      // assign appropriate texture sampler to texture unit
-      GLint location = m_activeProgram->uniformLocation(KUniformTexture2DXName.arg(i));
-      EGE_ASSERT(0 <= location);
-
-      glUniform1i(location, i);
-      OGL_CHECK()
+      // NOTE: texture samplers are assigned to texture units when program is linked
+      EGE_ASSERT(0 <= m_activeProgram->uniformLocation(static_cast<ProgramOGL::BuiltInUniform>(ProgramOGL::UNIFORM_TEXTURE_2D_0 + i)));
 
       // supply texture matrix if needed
-      location = m_activeProgram->uniformLocation(KUniformTextureMatrixXName.arg(i));
+      GLint location = m_activeProgram->uniformLocation(static_cast<ProgramOGL::BuiltInUniform>(ProgramOGL::UNIFORM_TEXTURE_MATRIX_0 + i));
       EGE_ASSERT((0 <= location) || (0 > location) && (0 == textureImage->rotationAngle().degrees()) || (0 > location) && (Rectf::UNIT != textureImage->rect()));
 
       if (0 <= location)
@@ -132,7 +155,14 @@ void RenderSystemProgrammableOGL::applyPassParams(const PRenderPass& pass)
   }
   
   // disable rest texture units
-  m_activeTextureUnitsCount = pass->textureCount();
+  // NOTE: units in use are left enabled so consecutive passes using them do not cause redundant state changes
+  for (s32 i = m_activeTextureUnitsCount - 1; static_cast<s32>(textureCount) <= i; --i)
+  {
+    activateTextureUnit(i);
+    disableTexture(GL_TEXTURE_2D);
+  }
+
+  m_activeTextureUnitsCount = textureCount;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PShader RenderSystemProgrammableOGL::createShader(EGEGraphics::ShaderType type, const String& name, const PDataBuffer& data)
@@ -203,8 +233,6 @@ PProgram RenderSystemProgrammableOGL::createProgram(const String& name, const Li
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystemProgrammableOGL::renderComponent(const PRenderComponent& component, const Matrix4f& modelMatrix)
 {
-  RenderSystemFrameStatisticData& statisticsData = ege_cast<RenderSystemStatistics*>(this->component(EGE_OBJECT_UID_RENDER_SYSTEM_STATISTICS))->currentRecord();
-
   // set component being rendered
   setActiveRenderComponent(component);
 
@@ -218,13 +246,17 @@ void RenderSystemProgrammableOGL::renderComponent(const PRenderComponent& compon
   // make sure VAOs are created and set up
   createAndSetupVAOs();
 
-  // get list of vaos
-  // NOTE: each VAO in the list corresponds to single pass
-  List<PComponent> vaos = component->components(EGE_OBJECT_UID_VERTEX_ARRAY_OBJECT);
+  // get range of vaos
+  // NOTE: each VAO in the range corresponds to single pass
+  ComponentHost::ComponentRange vaos = component->componentRange(EGE_OBJECT_UID_VERTEX_ARRAY_OBJECT);
+  const bool vaosPresent = (vaos.first != vaos.second);
 
   // check if no VAOs present
-  if (vaos.empty())
+  if ( ! vaosPresent)
   {
+    // make sure no VAO is bound so its state is not altered
+    bindVertexArrayObject(NULL);
+
     // bind vertex and index buffers
     // NOTE: this is valid for all passes
     vertexBuffer->bind();
@@ -234,30 +266,32 @@ void RenderSystemProgrammableOGL::renderComponent(const PRenderComponent& compon
   // apply general params
   applyGeneralParams();
 
+  // calculate model-view-projection matrix
+  // NOTE: this is valid for all passes
+  const Matrix4f modelViewProjectionMatrix = m_viewProjectionMatrix.multiply(modelMatrix);
+
   // go thru all passes
   for (u32 pass = 0; pass < material->passCount(); ++pass)
   {
     const PRenderPass renderPass = material->pass(pass);
 
-    // TAGE - move it to apply pass params!
-    m_activeProgram = ege_cast<ProgramOGL*>(renderPass->program());
+    // bind program
+    bindProgram(ege_cast<ProgramOGL*>(renderPass->program()));
     EGE_ASSERT(NULL != m_activeProgram);
 
-    // get first vao from the list and shrink the list
-    PVertexArrayObject vao = vaos.first(NULL);
-    if ( ! vaos.empty())
+    // get vao for current pass
+    VertexArrayObject* vao = NULL;
+    if (vaos.first != vaos.second)
     {
-      vaos.pop_front();
+      vao = ege_cast<VertexArrayObject*>(vaos.first->second);
+      ++vaos.first;
     }
 
-    // bind
-    m_activeProgram->bind();
-
-    // set model-view matrix
-    GLint location = m_activeProgram->uniformLocation(KUniformModelViewPerspectiveName);
+    // set model-view-projection matrix
+    GLint location = m_activeProgram->uniformLocation(ProgramOGL::UNIFORM_MODEL_VIEW_PROJECTION_MATRIX);
     EGE_ASSERT(0 <= location);
 
-    glUniformMatrix4fv(location, 1, GL_FALSE, m_viewMatrix.multiply(modelMatrix).multiply(m_finalProjectionMatrix).data);
+    glUniformMatrix4fv(location, 1, GL_FALSE, modelViewProjectionMatrix.data);
     OGL_CHECK()
 
     // apply pass related params
@@ -271,19 +305,14 @@ void RenderSystemProgrammableOGL::renderComponent(const PRenderComponent& compon
     else
     {
       // bind vao
-      vao->bind();
+      bindVertexArrayObject(vao);
     }
 
     // determine number of vertices to render
     const u32 vertexCount = (0 < indexBuffer->indexCount()) ? indexBuffer->indexCount() : vertexBuffer->vertexCount();
 
     // update statistics
-    statisticsData.vertexCount += vertexCount;
-    statisticsData.batchCount++;
-    statisticsData.queues.rbegin()->indexedBatchCount += (0 < indexBuffer->indexCount()) ? 1 : 0;
-    statisticsData.queues.rbegin()->batchCount++;
-    statisticsData.queues.rbegin()->vertexCount += vertexCount;
-    statisticsData.queues.rbegin()->componentNames << component->name();
+    EGE_RENDER_STATISTICS(m_statistics->addBatch(component, vertexCount, 0 < indexBuffer->indexCount()));
 
     // check if INDICIES are to be used
     if (0 < indexBuffer->indexCount())
@@ -291,40 +320,18 @@ void RenderSystemProgrammableOGL::renderComponent(const PRenderComponent& compon
       // render only if there is anything to render
       glDrawElements(mapPrimitiveType(component->primitiveType()), indexBuffer->indexCount(), mapIndexSize(indexBuffer->size()), indexBuffer->offset());
       OGL_CHECK()
-
-      // update statistics
-      statisticsData.drawElementsCalls++;
     }
     else
     {
       // render only if there is anything to render
       glDrawArrays(mapPrimitiveType(component->primitiveType()), 0, vertexBuffer->vertexCount());
       OGL_CHECK()
-
-      // update statistics
-      statisticsData.drawArraysCalls++;
     }
 
-    if (NULL != vao)
-    {
-      // unbind vao
-      vao->unbind();
-    }
-
-    // unbind program
-    m_activeProgram->unbind();
-
-    // clean up
-    for (s32 i = m_activeTextureUnitsCount - 1; 0 <= i; --i)
-    {
-      // disable texturing on server side
-      activateTextureUnit(i);
-      glDisable(GL_TEXTURE_2D);
-      OGL_CHECK()
-    }
+    // NOTE: program, VAO and texture units are left bound so next components using them do not cause redundant state changes
   }
 
-  if (vaos.empty())
+  if ( ! vaosPresent)
   {
     // unbind vertex and index buffers
     vertexBuffer->unbind();
@@ -361,7 +368,7 @@ void RenderSystemProgrammableOGL::applyVertexArrays()
     {
       case NVertexBuffer::VES_POSITION_XYZ:
 
-        location = m_activeProgram->attributeLocation(KAttributeVertexName);
+        location = m_activeProgram->attributeLocation(ProgramOGL::ATTRIBUTE_VERTEX);
         EGE_ASSERT(0 <= location);
 
         glVertexAttribPointer(location, 3, GL_FLOAT, GL_FALSE, vertexDeclaration.vertexSize(), static_cast<s8*>(vertexData) + itElement->offset());
@@ -370,7 +377,7 @@ void RenderSystemProgrammableOGL::applyVertexArrays()
 
       case NVertexBuffer::VES_POSITION_XY:
 
-        location = m_activeProgram->attributeLocation(KAttributeVertexName);
+        location = m_activeProgram->attributeLocation(ProgramOGL::ATTRIBUTE_VERTEX);
         EGE_ASSERT(0 <= location);
 
         glVertexAttribPointer(location, 2, GL_FLOAT, GL_FALSE, vertexDeclaration.vertexSize(), static_cast<s8*>(vertexData) + itElement->offset());
@@ -379,7 +386,7 @@ void RenderSystemProgrammableOGL::applyVertexArrays()
 
       case NVertexBuffer::VES_NORMAL:
 
-        location = m_activeProgram->attributeLocation(KAttributeNormalName);
+        location = m_activeProgram->attributeLocation(ProgramOGL::ATTRIBUTE_NORMAL);
         EGE_ASSERT(0 <= location);
 
         glVertexAttribPointer(location, 3, GL_FLOAT, GL_FALSE, vertexDeclaration.vertexSize(), static_cast<s8*>(vertexData) + itElement->offset());
@@ -388,7 +395,7 @@ void RenderSystemProgrammableOGL::applyVertexArrays()
 
       case NVertexBuffer::VES_COLOR_RGBA:
 
-        location = m_activeProgram->attributeLocation(KAttributeColorName);
+        location = m_activeProgram->attributeLocation(ProgramOGL::ATTRIBUTE_COLOR);
         EGE_ASSERT(0 <= location);
 
         glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, vertexDeclaration.vertexSize(), static_cast<s8*>(vertexData) + itElement->offset());
@@ -397,7 +404,8 @@ void RenderSystemProgrammableOGL::applyVertexArrays()
 
       case NVertexBuffer::VES_TEXTURE_UV:
 
-        location = m_activeProgram->attributeLocation(KAttributeTextureCoordXName.arg(textureCoordIndex));
+        EGE_ASSERT(EGE_OGL_PROGRAM_MAX_TEXTURE_UNITS > textureCoordIndex);
+        location = m_activeProgram->attributeLocation(static_cast<ProgramOGL::BuiltInAttribute>(ProgramOGL::ATTRIBUTE_TEXTURE_COORD_0 + textureCoordIndex++));
         EGE_ASSERT(0 <= location);
 
         glVertexAttribPointer(location, 2, GL_FLOAT, GL_FALSE, vertexDeclaration.vertexSize(), static_cast<s8*>(vertexData) + itElement->offset());
@@ -414,12 +422,7 @@ void RenderSystemProgrammableOGL::applyVertexArrays()
     // check if any vertex attribute needs enabling
     if (0 <= location)
     {
-      // enable
-      glEnableVertexAttribArray(location);  
-      OGL_CHECK()
-
-      // store for further use
-      m_enabledVertexAttributeIndices << location;
+      enableVertexAttributeArray(location);
     }
   }
 }
@@ -427,9 +430,13 @@ void RenderSystemProgrammableOGL::applyVertexArrays()
 void RenderSystemProgrammableOGL::setupVAO(PVertexArrayObject& vertexArrayObject, const PVertexBuffer& vertexBuffer, const PIndexBuffer& indexBuffer,
                                            const PRenderPass& pass)
 {
+  // NOTE: attribute locations are to be taken from the program used by the pass, which is not bound yet
+  ProgramOGL* program = ege_cast<ProgramOGL*>(pass->program());
+  EGE_ASSERT(NULL != program);
+
   // bind VAO
   // NOTE: Currently, all vertex states are stored within VAO rather than in OpenGL state machine, so there is no need to unbind anything 
-  vertexArrayObject->bind();
+  bindVertexArrayObject(vertexArrayObject);
 
   // bind VBO
   vertexBuffer->bind();
@@ -448,7 +455,7 @@ void RenderSystemProgrammableOGL::setupVAO(PVertexArrayObject& vertexArrayObject
     {
       case NVertexBuffer::VES_POSITION_XYZ:
 
-        location = m_activeProgram->attributeLocation(KAttributeVertexName);
+        location = program->attributeLocation(ProgramOGL::ATTRIBUTE_VERTEX);
         EGE_ASSERT(0 <= location);
 
         glEnableVertexAttribArray(location);
@@ -460,7 +467,7 @@ void RenderSystemProgrammableOGL::setupVAO(PVertexArrayObject& vertexArrayObject
 
       case NVertexBuffer::VES_POSITION_XY:
 
-        location = m_activeProgram->attributeLocation(KAttributeVertexName);
+        location = program->attributeLocation(ProgramOGL::ATTRIBUTE_VERTEX);
         EGE_ASSERT(0 <= location);
 
         glEnableVertexAttribArray(location);
@@ -472,7 +479,7 @@ void RenderSystemProgrammableOGL::setupVAO(PVertexArrayObject& vertexArrayObject
 
       case NVertexBuffer::VES_NORMAL:
 
-        location = m_activeProgram->attributeLocation(KAttributeNormalName);
+        location = program->attributeLocation(ProgramOGL::ATTRIBUTE_NORMAL);
         EGE_ASSERT(0 <= location);
 
         glEnableVertexAttribArray(location);
@@ -484,7 +491,7 @@ void RenderSystemProgrammableOGL::setupVAO(PVertexArrayObject& vertexArrayObject
 
       case NVertexBuffer::VES_COLOR_RGBA:
 
-        location = m_activeProgram->attributeLocation(KAttributeColorName);
+        location = program->attributeLocation(ProgramOGL::ATTRIBUTE_COLOR);
         EGE_ASSERT(0 <= location);
 
         glEnableVertexAttribArray(location);
@@ -496,7 +503,8 @@ void RenderSystemProgrammableOGL::setupVAO(PVertexArrayObject& vertexArrayObject
 
       case NVertexBuffer::VES_TEXTURE_UV:
 
-        location = m_activeProgram->attributeLocation(KAttributeTextureCoordXName.arg(textureCoordIndex++));
+        EGE_ASSERT(EGE_OGL_PROGRAM_MAX_TEXTURE_UNITS > textureCoordIndex);
+        location = program->attributeLocation(static_cast<ProgramOGL::BuiltInAttribute>(ProgramOGL::ATTRIBUTE_TEXTURE_COORD_0 + textureCoordIndex++));
         EGE_ASSERT(0 <= location);
 
         glEnableVertexAttribArray(location);
@@ -515,3 +523,34 @@ void RenderSystemProgrammableOGL::setupVAO(PVertexArrayObject& vertexArrayObject
   indexBuffer->bind();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemProgrammableOGL::bindProgram(ProgramOGL* program)
+{
+  if (program != m_activeProgram)
+  {
+    if (NULL != program)
+    {
+      program->bind();
+    }
+    else
+    {
+      m_activeProgram->unbind();
+    }
+
+    m_activeProgram = program;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemProgrammableOGL::enableVertexAttributeArray(GLint location)
+{
+  // check if not enabled yet
+  if ( ! m_enabledVertexAttributeIndices.contains(location))
+  {
+    // enable
+    glEnableVertexAttribArray(location);
+    OGL_CHECK()
+
+    // store for further use
+    m_enabledVertexAttributeIndices << location;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
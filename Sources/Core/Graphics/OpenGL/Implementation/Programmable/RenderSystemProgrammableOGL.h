@@ -48,13 +48,26 @@ class RenderSystemProgrammableOGL : public RenderSystemOGL
     /*! @see RenderSystemOGL::applyVertexArrays. */
     void applyVertexArrays() override;
 
+    /*! Binds given program. 
+     *  @param  program Program to bind. If NULL, currently bound program is unbound.
+     *  @note Binding is skipped if program is already bound.
+     */
+    void bindProgram(ProgramOGL* program);
+    /*! Enables vertex attribute array at given location. 
+     *  @param  location  Vertex attribute location.
+     *  @note Enabling is skipped if array is already enabled.
+     */
+    void enableVertexAttributeArray(GLint location);
+
   private:
 
-    /*! Final projection matrix i.e. after rotations etc. */
-    Matrix4f m_finalProjectionMatrix;
+    /*! Final view-projection matrix i.e. after rotations etc. 
+     *  @note This is calculated once per flush so only model matrix needs to be applied for each component.
+     */
+    Matrix4f m_viewProjectionMatrix;
     /*! List of enabled vertex attribute arrays indices. */
     List<s32> m_enabledVertexAttributeIndices;
-    /*! Pointer to active shader program. */
+    /*! Pointer to active (bound) shader program. */
     ProgramOGL* m_activeProgram;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -22,6 +22,10 @@ EGE_NAMESPACE
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 RenderSystemOGL::RenderSystemOGL(Application* app) : RenderSystem(app)
                                                    , m_activeTextureUnit(0)
+                                                   , m_blendSrcFactor(GL_ONE)
+                                                   , m_blendDstFactor(GL_ZERO)
+                                                   , m_scissorRect(0, 0, -1, -1)
+                                                   , m_boundVertexArrayObjectId(0)
                                                    , m_activeTextureUnitsCount(0)
 {
   m_blendEnabled = (GL_TRUE == glIsEnabled(GL_BLEND));
@@ -29,6 +33,13 @@ RenderSystemOGL::RenderSystemOGL(Application* app) : RenderSystem(app)
   
   m_scissorTestEnabled = (GL_TRUE == glIsEnabled(GL_SCISSOR_TEST));
   OGL_CHECK()
+
+  // NOTE: all texture units are disabled by default
+  TextureBinding defaultBinding;
+  defaultBinding.target    = GL_TEXTURE_2D;
+  defaultBinding.textureId = -1;
+  defaultBinding.enabled   = false;
+  m_textureBindings.resize(Device::TextureUnitsCount(), defaultBinding);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 RenderSystemOGL::~RenderSystemOGL()
@@ -78,32 +89,25 @@ void RenderSystemOGL::setViewport(const PViewport& viewport)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystemOGL::flush()
 {
-  RenderSystemFrameStatisticData& statisticsData = ege_cast<RenderSystemStatistics*>(this->component(EGE_OBJECT_UID_RENDER_SYSTEM_STATISTICS))->currentRecord();
+  // make sure states changed outside are not assumed
+  invalidateStateCache();
 
   // go thru all render queues
-  for (Map<s32, List<PRenderQueue> >::const_iterator itQueue = m_renderQueues.begin(); itQueue != m_renderQueues.end(); ++itQueue)
+  for (u32 i = 0; i < m_renderQueues.count(); ++i)
   {
-    const List<PRenderQueue>& queueList = itQueue->second;
+    const RenderQueueBucket& bucket = m_renderQueues.at(i);
 
-    if (5 < queueList.size())
+    if (5 < bucket.queues.size())
     {
-      egeWarning(KOpenGLDebugName) << "Possible batch optimization. Hash:" << itQueue->first;
+      egeWarning(KOpenGLDebugName) << "Possible batch optimization. Hash:" << bucket.hash;
     }
 
     // update statistics
-    // NOTE: this appends new render queue data object to the pool. This object will be used while processing all render queues below to aggregate all 
-    //       individual information.
-    RenderSystemRenderQueueData queueData;
-    queueData.hash              = itQueue->first;
-    queueData.primitiveType     = queueData.hash & 0xff;
-    queueData.priority          = queueData.hash >> 8;
-    queueData.batchCount        = 0;
-    queueData.vertexCount       = 0;
-    queueData.indexedBatchCount = 0;
-    statisticsData.queues.push_back(queueData);
-
-    // render queue list
-    for (List<PRenderQueue>::const_iterator it = queueList.begin(); it != queueList.end(); ++it)
+    // NOTE: all render queues below are aggregated into single statistics entry as they share the same hash value
+    EGE_RENDER_STATISTICS(m_statistics->beginRenderQueue(bucket.hash));
+
+    // render bucket queues
+    for (DynamicArray<PRenderQueue>::const_iterator it = bucket.queues.begin(); it != bucket.queues.end(); ++it)
     {
       PRenderQueue queue = *it;
 
@@ -139,37 +143,91 @@ void RenderSystemOGL::activateTextureUnit(u32 unit)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystemOGL::bindTexture(GLenum target, GLuint textureId)
 {
-  // enable target first
-  glEnable(target);
-  OGL_CHECK()
+  EGE_ASSERT_X((GL_TEXTURE_1D == target) || (GL_TEXTURE_2D == target), "Incorrect texture binding!");
 
-  // map texture target into texture binding query value
-  GLenum textureBinding;
-  switch (target)
-  {
-    case GL_TEXTURE_1D: textureBinding = GL_TEXTURE_BINDING_1D; break;
-    case GL_TEXTURE_2D: textureBinding = GL_TEXTURE_BINDING_2D; break;
+  TextureBinding& binding = m_textureBindings[m_activeTextureUnit];
 
-    default:
+  // check if target changes
+  // NOTE: binding of previous target is not tracked, next time it needs to be rebound
+  if (binding.target != target)
+  {
+    if (binding.enabled)
+    {
+      glDisable(binding.target);
+      OGL_CHECK()
+    }
 
-      EGE_ASSERT_X(false, "Incorrect texture binding!");
-      return;
+    binding.target    = target;
+    binding.textureId = -1;
+    binding.enabled   = false;
   }
 
-  // query texture Id bound to given target
-  GLint boundTextureId;
-	glGetIntegerv(textureBinding, &boundTextureId);
-  OGL_CHECK()
+  // enable target first
+  if ( ! binding.enabled)
+  {
+    glEnable(target);
+    OGL_CHECK()
+
+    binding.enabled = true;
+  }
 
   // check if different texture bound currently
-  if (static_cast<GLuint>(boundTextureId) != textureId)
+  // NOTE: shadowed value is used instead of querying server side as querying stalls the pipeline
+  if (static_cast<GLint>(textureId) != binding.textureId)
   {
     // bind new texture to target
     glBindTexture(target, textureId);
     OGL_CHECK()
+
+    binding.textureId = static_cast<GLint>(textureId);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemOGL::disableTexture(GLenum target)
+{
+  TextureBinding& binding = m_textureBindings[m_activeTextureUnit];
+
+  if (binding.enabled && (binding.target == target))
+  {
+    glDisable(target);
+    OGL_CHECK()
+
+    binding.enabled = false;
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemOGL::bindVertexArrayObject(VertexArrayObject* vertexArrayObject)
+{
+  const GLuint id = (NULL != vertexArrayObject) ? vertexArrayObject->id() : 0;
+
+  if (id != m_boundVertexArrayObjectId)
+  {
+    if (NULL != vertexArrayObject)
+    {
+      vertexArrayObject->bind();
+    }
+    else
+    {
+      glBindVertexArray(0);
+      OGL_CHECK()
+    }
+
+    m_boundVertexArrayObjectId = id;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemOGL::invalidateStateCache()
+{
+  // NOTE: texture objects can be bound (ie during uploads or render texture copies) or deleted outside, in which case ids can be recycled
+  for (DynamicArray<TextureBinding>::iterator it = m_textureBindings.begin(); it != m_textureBindings.end(); ++it)
+  {
+    it->textureId = -1;
+  }
+
+  // NOTE: scissor rectangle is not changed anywhere else but viewport size might have been
+  m_scissorRect.width = -1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PVertexBuffer RenderSystemOGL::createVertexBuffer(const String& name, const VertexDeclaration& vertexDeclaration, NVertexBuffer::UsageType usage) const
 {
   PVertexBuffer buffer;
@@ -341,7 +399,9 @@ PTexture2D RenderSystemOGL::createEmptyTexture(const String& name)
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
     // bind it
+    // NOTE: texture ids are recycled so newly generated one may be equal to id of deleted texture which is still shadowed as bound
     activateTextureUnit(0);
+    m_textureBindings[0].textureId = -1;
     bindTexture(GL_TEXTURE_2D, texture->id());
 
     // set texture parameters
@@ -375,6 +435,18 @@ void RenderSystemOGL::setBlendEnabled(bool set)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemOGL::setBlendFunc(GLenum srcFactor, GLenum dstFactor)
+{
+  if ((srcFactor != m_blendSrcFactor) || (dstFactor != m_blendDstFactor))
+  {
+    glBlendFunc(srcFactor, dstFactor);
+    OGL_CHECK()
+
+    m_blendSrcFactor = srcFactor;
+    m_blendDstFactor = dstFactor;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystemOGL::setScissorTestEnabled(bool set)
 {
   if (set != m_scissorTestEnabled)
@@ -392,6 +464,17 @@ void RenderSystemOGL::setScissorTestEnabled(bool set)
   }  
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemOGL::setScissorRect(const Recti& rect)
+{
+  if ((rect.x != m_scissorRect.x) || (rect.y != m_scissorRect.y) || (rect.width != m_scissorRect.width) || (rect.height != m_scissorRect.height))
+  {
+    glScissor(rect.x, rect.y, rect.width, rect.height);
+    OGL_CHECK()
+
+    m_scissorRect = rect;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool RenderSystemOGL::registerComponent(PRenderComponent& component, NVertexBuffer::UsageType vertexUsage, const VertexDeclaration& vertexDeclaration, 
                                         EGEIndexBuffer::UsageType indexUsage)
 {
@@ -551,7 +634,7 @@ void RenderSystemOGL::applyGeneralParams()
     clipRect.width  *= zoom;
     clipRect.height *= zoom;
 
-    glScissor(static_cast<GLint>(clipRect.x), static_cast<GLint>(clipRect.y), static_cast<GLsizei>(clipRect.width), static_cast<GLsizei>(clipRect.height));
+    setScissorRect(Recti(static_cast<s32>(clipRect.x), static_cast<s32>(clipRect.y), static_cast<s32>(clipRect.width), static_cast<s32>(clipRect.height)));
   }
 
   // check if points are to be rendered
@@ -573,11 +656,15 @@ void RenderSystemOGL::createAndSetupVAOs()
 
   bool result = true;
 
-  PMaterial material    = component->material();
-  List<PComponent> vaos = component->components(EGE_OBJECT_UID_VERTEX_ARRAY_OBJECT);
+  PMaterial material = component->material();
+  List<PComponent> vaos;
+
+  // check if VAOs are already created
+  // NOTE: range is used so nothing is copied in most common case
+  ComponentHost::ComponentRange range = component->componentRange(EGE_OBJECT_UID_VERTEX_ARRAY_OBJECT);
 
   // check if VAO is supported and can be used (ie VBO is supported)
-  if (vaos.empty() && 
+  if ((range.first == range.second) && 
       Device::HasRenderCapability(ERenderCapabilityVertexArrayObjects) && 
       Device::HasRenderCapability(ERenderCapabilityVertexBufferObjects))
   {
@@ -6,6 +6,7 @@
 
 #include "EGE.h"
 #include "EGEOpenGL.h"
+#include "EGEDynamicArray.h"
 #include "Core/Graphics/Render/RenderSystem.h"
 
 EGE_NAMESPACE_BEGIN
@@ -47,8 +48,17 @@ class RenderSystemOGL : public RenderSystem
 
     /*! Enables/disables blending. */
     void setBlendEnabled(bool set);
+    /*! Sets blending factors. 
+     *  @param  srcFactor Source blending factor.
+     *  @param  dstFactor Destination blending factor.
+     */
+    void setBlendFunc(GLenum srcFactor, GLenum dstFactor);
     /*! Enables/disables scissor testing. */
     void setScissorTestEnabled(bool set);
+    /*! Sets scissor rectangle. 
+     *  @param  rect  Scissor rectangle in window coordinates.
+     */
+    void setScissorRect(const Recti& rect);
     /*! Activates given texture unit at server side. 
      *  @param  unit  Texture unit to activate.
      */
@@ -58,6 +68,16 @@ class RenderSystemOGL : public RenderSystem
      *  @param  textureId Texture object id which is to be bound to target.
      */
     void bindTexture(GLenum target, GLuint textureId);
+    /*! Disables texturing target on currently active texture unit. 
+     *  @param  target  Texture type.
+     */
+    void disableTexture(GLenum target);
+    /*! Binds vertex array object. 
+     *  @param  vertexArrayObject Vertex array object to bind. If NULL, currently bound object is unbound.
+     */
+    void bindVertexArrayObject(VertexArrayObject* vertexArrayObject);
+    /*! Invalidates shadowed server side states which could have been changed outside of render system. */
+    void invalidateStateCache();
     /*! Creates VAOs and sets them up if necessary. 
      *  @note This is done for currently rendered component.
      */
@@ -117,14 +137,37 @@ class RenderSystemOGL : public RenderSystem
     /*! Applies vertex arrays for currently rendered component. */
     virtual void applyVertexArrays() = 0;
 
+  protected:
+
+    /*! Server side texture unit state. */
+    struct TextureBinding
+    {
+      /*! Texture target texture is bound to. */
+      GLenum target;
+      /*! Id of texture bound to target. Negative if unknown. */
+      GLint textureId;
+      /*! Flag indicating if target is enabled. */
+      bool enabled;
+    };
+
   protected:
 
     /*! Server side, currenty active texture unit. */
     u32 m_activeTextureUnit;
+    /*! Texture bindings for each available texture unit. */
+    DynamicArray<TextureBinding> m_textureBindings;
     /*! Blend enabled flag. */
     bool m_blendEnabled;
+    /*! Current source blending factor. */
+    GLenum m_blendSrcFactor;
+    /*! Current destination blending factor. */
+    GLenum m_blendDstFactor;
     /*! Scissor test enabled flag. */
     bool m_scissorTestEnabled;
+    /*! Current scissor rectangle. Negative width if unknown. */
+    Recti m_scissorRect;
+    /*! Id of currently bound vertex array object. */
+    GLuint m_boundVertexArrayObjectId;
     /*! Number of active texture units in use (counted from zero). */
     u32 m_activeTextureUnitsCount;
 };
@@ -25,6 +25,8 @@ class VertexArrayObject : public Component
     void bind();
     /*! Unbinds object. */
     void unbind();
+    /*! Returns object ID. */
+    GLuint id() const { return m_id; }
 
   private:
 
@@ -7,6 +7,15 @@
 
 EGE_NAMESPACE_BEGIN
 
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+static const String KUniformModelViewPerspectiveName = "u_mvpMatrix";
+static const String KUniformTexture2DXName           = "u_texture2D%1";
+static const String KUniformTextureMatrixXName       = "u_texMatrix%1";
+
+static const String KAttributeVertexName        = "a_vertex";
+static const String KAttributeNormalName        = "a_normal";
+static const String KAttributeColorName         = "a_color";
+static const String KAttributeTextureCoordXName = "a_texCoord%1";
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGE_DEFINE_NEW_OPERATORS(ProgramOGL)
 EGE_DEFINE_DELETE_OPERATORS(ProgramOGL)
@@ -17,6 +26,17 @@ ProgramOGL::ProgramOGL(Application* app, const String& name, IHardwareResourcePr
 {
   m_id = glCreateProgram();
   OGL_CHECK();
+
+  // reset built-in locations
+  for (s32 i = 0; i < UNIFORM_COUNT; ++i)
+  {
+    m_builtInUniformLocations[i] = -1;
+  }
+
+  for (s32 i = 0; i < ATTRIBUTE_COUNT; ++i)
+  {
+    m_builtInAttributeLocations[i] = -1;
+  }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 ProgramOGL::~ProgramOGL()
@@ -104,6 +124,9 @@ bool ProgramOGL::link()
     return false;
   }
 
+  // resolve built-in uniforms and attributes so no look-ups are necessary while rendering
+  resolveBuiltInLocations();
+
   // set flag
   m_linked = true;
 
@@ -187,6 +210,31 @@ bool ProgramOGL::buildAttributesList()
   return true;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ProgramOGL::resolveBuiltInLocations()
+{
+  m_builtInUniformLocations[UNIFORM_MODEL_VIEW_PROJECTION_MATRIX] = uniformLocation(KUniformModelViewPerspectiveName);
+
+  m_builtInAttributeLocations[ATTRIBUTE_VERTEX] = attributeLocation(KAttributeVertexName);
+  m_builtInAttributeLocations[ATTRIBUTE_NORMAL] = attributeLocation(KAttributeNormalName);
+  m_builtInAttributeLocations[ATTRIBUTE_COLOR]  = attributeLocation(KAttributeColorName);
+
+  for (s32 i = 0; i < EGE_OGL_PROGRAM_MAX_TEXTURE_UNITS; ++i)
+  {
+    m_builtInUniformLocations[UNIFORM_TEXTURE_2D_0 + i]        = uniformLocation(KUniformTexture2DXName.arg(i));
+    m_builtInUniformLocations[UNIFORM_TEXTURE_MATRIX_0 + i]    = uniformLocation(KUniformTextureMatrixXName.arg(i));
+    m_builtInAttributeLocations[ATTRIBUTE_TEXTURE_COORD_0 + i] = attributeLocation(KAttributeTextureCoordXName.arg(i));
+
+    // assign texture sampler to corresponding texture unit
+    // NOTE: uniform values are part of program object state so this needs to be done once only
+    const GLint location = m_builtInUniformLocations[UNIFORM_TEXTURE_2D_0 + i];
+    if (0 <= location)
+    {
+      glUniform1i(location, i);
+      OGL_CHECK();
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void ProgramOGL::printInfoLog()
 {
   int logLength = 0;
@@ -224,12 +272,12 @@ void ProgramOGL::unbind()
   OGL_CHECK();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-GLint ProgramOGL::uniformLocation(const String& name) const
+GLint ProgramOGL::uniformLocation(const Name& name) const
 {
   return m_uniforms.value(name, -1);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-GLint ProgramOGL::attributeLocation(const String& name) const
+GLint ProgramOGL::attributeLocation(const Name& name) const
 {
   return m_attributes.value(name, -1);
 }
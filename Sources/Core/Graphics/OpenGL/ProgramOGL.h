@@ -4,10 +4,14 @@
 #include "EGE.h"
 #include "EGEOpenGL.h"
 #include "EGEMap.h"
+#include "EGEName.h"
 #include "EGEShader.h"
 
 EGE_NAMESPACE_BEGIN
 
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Maximal number of texture units for which built-in uniforms and attributes are resolved. */
+#define EGE_OGL_PROGRAM_MAX_TEXTURE_UNITS 8
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGE_DECLARE_SMART_CLASS(Shader, PShader)
 class Program;
@@ -22,6 +26,29 @@ class ProgramOGL : public Program
     EGE_DECLARE_NEW_OPERATORS
     EGE_DECLARE_DELETE_OPERATORS
 
+  public:
+
+    /*! Built-in uniforms which locations are resolved at link time. */
+    enum BuiltInUniform
+    {
+      UNIFORM_MODEL_VIEW_PROJECTION_MATRIX = 0,
+      UNIFORM_TEXTURE_2D_0,
+      UNIFORM_TEXTURE_MATRIX_0 = UNIFORM_TEXTURE_2D_0 + EGE_OGL_PROGRAM_MAX_TEXTURE_UNITS,
+      UNIFORM_COUNT            = UNIFORM_TEXTURE_MATRIX_0 + EGE_OGL_PROGRAM_MAX_TEXTURE_UNITS
+    };
+
+    /*! Built-in attributes which locations are resolved at link time. */
+    enum BuiltInAttribute
+    {
+      ATTRIBUTE_VERTEX = 0,
+      ATTRIBUTE_NORMAL,
+      ATTRIBUTE_COLOR,
+      ATTRIBUTE_TEXTURE_COORD_0,
+      ATTRIBUTE_COUNT = ATTRIBUTE_TEXTURE_COORD_0 + EGE_OGL_PROGRAM_MAX_TEXTURE_UNITS
+    };
+
+  public:
+
     /*! @see Program::isValid. */
     bool isValid() const override;
     /*! @see Program::attach. */
@@ -41,12 +68,24 @@ class ProgramOGL : public Program
      *  @param  name  Name of the uniform.
      *  @return Location index (0-based) of a given uniform within the program. Negative, if could not be found.
      */
-    GLint uniformLocation(const String& name) const;
+    GLint uniformLocation(const Name& name) const;
     /*! Returns location infex of a given attribute. 
      *  @param  name  Name of the attribute.
      *  @return Location index (0-based) of a given attribute within the program. Negative, if could not be found.
      */
-    GLint attributeLocation(const String& name) const;
+    GLint attributeLocation(const Name& name) const;
+    /*! Returns location of a given built-in uniform. 
+     *  @param  uniform Built-in uniform.
+     *  @return Location index (0-based) of a given uniform within the program. Negative, if not used by the program.
+     *  @note This does not involve any look-ups as locations are resolved at link time.
+     */
+    inline GLint uniformLocation(BuiltInUniform uniform) const;
+    /*! Returns location of a given built-in attribute. 
+     *  @param  attribute Built-in attribute.
+     *  @return Location index (0-based) of a given attribute within the program. Negative, if not used by the program.
+     *  @note This does not involve any look-ups as locations are resolved at link time.
+     */
+    inline GLint attributeLocation(BuiltInAttribute attribute) const;
 
   private:
 
@@ -56,6 +95,10 @@ class ProgramOGL : public Program
     bool buildUniformsList();
     /*! Builds attributes list. */
     bool buildAttributesList();
+    /*! Resolves locations of built-in uniforms and attributes. 
+     *  @note Program needs to be bound.
+     */
+    void resolveBuiltInLocations();
 
   private:
 
@@ -64,11 +107,27 @@ class ProgramOGL : public Program
     /*! Flag indicating if program has been linked. */
     bool m_linked;
     /*! Map of uniforms and locations within program. */
-    Map<String, GLint> m_uniforms;
+    Map<Name, GLint> m_uniforms;
     /*! Map of attributes and locations within program. */
-    Map<String, GLint> m_attributes;
+    Map<Name, GLint> m_attributes;
+    /*! Locations of built-in uniforms. */
+    GLint m_builtInUniformLocations[UNIFORM_COUNT];
+    /*! Locations of built-in attributes. */
+    GLint m_builtInAttributeLocations[ATTRIBUTE_COUNT];
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline GLint ProgramOGL::uniformLocation(BuiltInUniform uniform) const
+{
+  EGE_ASSERT((0 <= uniform) && (UNIFORM_COUNT > uniform));
+  return m_builtInUniformLocations[uniform];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline GLint ProgramOGL::attributeLocation(BuiltInAttribute attribute) const
+{
+  EGE_ASSERT((0 <= attribute) && (ATTRIBUTE_COUNT > attribute));
+  return m_builtInAttributeLocations[attribute];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
 
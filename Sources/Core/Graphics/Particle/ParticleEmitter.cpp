@@ -348,109 +348,63 @@ bool ParticleEmitter::addForRendering(IRenderer* renderer, const Matrix4f& trans
         Vector3f up(viewMatrix.data[4], viewMatrix.data[5], viewMatrix.data[6]);
         Vector3f look(viewMatrix.data[8], viewMatrix.data[9], viewMatrix.data[10]);
 
+        // Quad looks like follows:
+        //
+        //   (0,3)  (5)
+        //    *------*
+        //    |\     |
+        //    | \Tri2|
+        //    |  \   |
+        //    |   \  |
+        //    |    \ |
+        //    |Tri1 \|
+        //    |      |
+        //    *------*
+        //   (1)   (2,4)
+
+        // quad corners in billboard space and their texture coords, in order of vertices
+        static const Vector3f KCorners[6] = { Vector3f(-1, -1, 0), Vector3f(-1, 1, 0), Vector3f(1, 1, 0), Vector3f(-1, -1, 0), Vector3f(1, 1, 0), 
+                                              Vector3f(1, -1, 0) };
+        static const float32 KTextureCoords[12] = { 0, 1, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1 };
+
+        const u32 vertexSize = m_renderData->vertexBuffer()->vertexDeclaration().vertexSize();
+
         for (s32 i = 0; i < m_activeParticlesCount; ++i)
         {
           const EGEParticle::ParticleData& particleData = m_particles[i];
 
-          // Quad looks like follows:
-          //
-          //   (0,3)  (5)
-          //    *------*
-          //    |\     |
-          //    | \Tri2|
-          //    |  \   |
-          //    |   \  |
-          //    |    \ |
-          //    |Tri1 \|
-          //    |      |
-          //    *------*
-          //   (1)   (2,4)
-
-          Vector3f halfSize(particleData.size.x * 0.5f, particleData.size.y * 0.5f, 0);
-          Vector3f point0;
-          Vector3f point1;
-          Vector3f point2;
-          Vector3f point5;
-
-          // calculate positions
+          // calculate billboard axes
           // NOTE: we destinguish two cases here: with and without rotation
-          if (0.0f == particleData.spinDelta.radians())
-          {
-            point0 = particleData.position + ((-right - up) * halfSize);
-            point1 = particleData.position + ((-right + up) * halfSize);
-            point2 = particleData.position + (( right + up) * halfSize);
-            point5 = particleData.position + (( right - up) * halfSize);
-          }
-          else
+          const Vector3f halfSize(particleData.size.x * 0.5f, particleData.size.y * 0.5f, 0);
+
+          Vector3f axisX = right * halfSize;
+          Vector3f axisY = up * halfSize;
+          if (0.0f != particleData.spinDelta.radians())
           {
             const Quaternionf quat = Math::CreateQuaternion(look, particleData.spin);
           
             // take rotation into account
-            point0 = particleData.position + quat * ((-right - up) * halfSize);
-            point1 = particleData.position + quat * ((-right + up) * halfSize);
-            point2 = particleData.position + quat * (( right + up) * halfSize);
-            point5 = particleData.position + quat * (( right - up) * halfSize);
+            axisX = quat * axisX;
+            axisY = quat * axisY;
           }
 
-          *data++ = point0.x;
-          *data++ = point0.y;
-          *data++ = point0.z;
-          *data++ = 0;
-          *data++ = 1;
-          *data++ = particleData.color.red;
-          *data++ = particleData.color.green;
-          *data++ = particleData.color.blue;
-          *data++ = particleData.color.alpha;
+          const Matrix4f billboardMatrix(axisX.x, axisX.y, axisX.z, 0, axisY.x, axisY.y, axisY.z, 0, 0, 0, 0, 0, particleData.position.x, 
+                                         particleData.position.y, particleData.position.z, 1);
 
-          *data++ = point1.x;
-          *data++ = point1.y;
-          *data++ = point1.z;
-          *data++ = 0;
-          *data++ = 0;
-          *data++ = particleData.color.red;
-          *data++ = particleData.color.green;
-          *data++ = particleData.color.blue;
-          *data++ = particleData.color.alpha;
-
-          *data++ = point2.x;
-          *data++ = point2.y;
-          *data++ = point2.z;
-          *data++ = 1;
-          *data++ = 0;
-          *data++ = particleData.color.red;
-          *data++ = particleData.color.green;
-          *data++ = particleData.color.blue;
-          *data++ = particleData.color.alpha;
+          // calculate positions of all vertices at once
+          Math::Transform(reinterpret_cast<Vector3f*>(data), vertexSize, KCorners, sizeof (Vector3f), 6, billboardMatrix);
 
-          *data++ = point0.x;
-          *data++ = point0.y;
-          *data++ = point0.z;
-          *data++ = 0;
-          *data++ = 1;
-          *data++ = particleData.color.red;
-          *data++ = particleData.color.green;
-          *data++ = particleData.color.blue;
-          *data++ = particleData.color.alpha;
-
-          *data++ = point2.x;
-          *data++ = point2.y;
-          *data++ = point2.z;
-          *data++ = 1;
-          *data++ = 0;
-          *data++ = particleData.color.red;
-          *data++ = particleData.color.green;
-          *data++ = particleData.color.blue;
-          *data++ = particleData.color.alpha;
-
-          *data++ = point5.x;
-          *data++ = point5.y;
-          *data++ = point5.z;
-          *data++ = 1;
-          *data++ = 1;
-          *data++ = particleData.color.red;
-          *data++ = particleData.color.green;
-          *data++ = particleData.color.blue;
-          *data++ = particleData.color.alpha;
+          // fill in remaining vertex data
+          for (s32 j = 0; j < 6; ++j)
+          {
+            data += 3;
+            *data++ = KTextureCoords[j * 2];
+            *data++ = KTextureCoords[j * 2 + 1];
+            *data++ = particleData.color.red;
+            *data++ = particleData.color.green;
+            *data++ = particleData.color.blue;
+            *data++ = particleData.color.alpha;
+          }
         }
       }
     }
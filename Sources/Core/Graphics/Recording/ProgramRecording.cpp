@@ -0,0 +1,33 @@
+#include "Core/Graphics/Recording/ProgramRecording.h"
+#include "EGEDebug.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(ProgramRecording)
+EGE_DEFINE_DELETE_OPERATORS(ProgramRecording)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+ProgramRecording::ProgramRecording(Application* app, const String& name, IHardwareResourceProvider* provider, u32 id) : Program(app, name, provider)
+                                                                                                                      , m_id(id)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+ProgramRecording::~ProgramRecording()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool ProgramRecording::isValid() const
+{
+  return 0 != m_id;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ProgramRecording::bind()
+{
+  // do nothing, binding is recorded by render system
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ProgramRecording::unbind()
+{
+  // do nothing, binding is recorded by render system
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef EGE_CORE_GRAPHICS_RECORDING_PROGRAMRECORDING_H
+#define EGE_CORE_GRAPHICS_RECORDING_PROGRAMRECORDING_H
+
+/** Program specialization used by recording render system. Program is represented by its handle only. Binding is recorded by render system itself.
+ */
+
+#include "EGE.h"
+#include "EGEShader.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class ProgramRecording : public Program
+{
+  public:
+
+    ProgramRecording(Application* app, const String& name, IHardwareResourceProvider* provider, u32 id);
+    virtual ~ProgramRecording();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+    /*! @see Program::isValid. */
+    bool isValid() const override;
+    /*! @see Program::bind. */
+    void bind() override;
+    /*! @see Program::unbind. */
+    void unbind() override;
+    /*! Returns program handle. */
+    u32 id() const { return m_id; }
+
+  private:
+
+    /*! Program handle. */
+    u32 m_id;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_GRAPHICS_RECORDING_PROGRAMRECORDING_H
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "Core/Graphics/Recording/RenderCommandBuffer.h"
+#include "Core/Graphics/Render/Implementation/RenderSystemStatistics.h"
+#include "EGEHash.h"
+#include "EGEDebug.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderCommandBuffer::RenderCommandBuffer()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderCommandBuffer::~RenderCommandBuffer()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderCommandBuffer::append(RenderCommandType type, s32 arg0, s32 arg1, s32 arg2, s32 arg3)
+{
+  RenderCommand command;
+  command.type    = static_cast<u32>(type);
+  command.args[0] = arg0;
+  command.args[1] = arg1;
+  command.args[2] = arg2;
+  command.args[3] = arg3;
+
+  m_commands.push_back(command);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderCommandBuffer::clear()
+{
+  m_commands.clear();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 RenderCommandBuffer::hash() const
+{
+  if (m_commands.empty())
+  {
+    // nothing to hash
+    return 0;
+  }
+
+  // NOTE: command structure has no padding so whole pool can be hashed at once
+  return Hash::FromData32(reinterpret_cast<const u8*>(&m_commands[0]), static_cast<s32>(m_commands.size() * sizeof (RenderCommand)));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult RenderCommandBuffer::replay(RenderSystemFrameStatisticData& data) const
+{
+  // reset quantities derived from the stream
+  data.drawElementsCalls = 0;
+  data.drawArraysCalls   = 0;
+  data.batchCount        = 0;
+  data.vertexCount       = 0;
+  data.queueCount        = 0;
+  data.componentNames.clear();
+
+  // go thru all commands
+  for (DynamicArray<RenderCommand>::const_iterator it = m_commands.begin(); it != m_commands.end(); ++it)
+  {
+    const RenderCommand& command = *it;
+
+    switch (command.type)
+    {
+      case RCT_BEGIN_QUEUE:
+        {
+          // check if no space left
+          if (EGE_RENDER_SYSTEM_STATISTICS_MAX_QUEUES == data.queueCount)
+          {
+            // error!
+            return EGE_ERROR;
+          }
+
+          // NOTE: this mirrors the way render system aggregates statistics for render queues bound to the same hash value
+          RenderSystemRenderQueueData& queueData = data.queues[data.queueCount++];
+          queueData.hash               = static_cast<u32>(command.args[0]);
+          queueData.primitiveType      = queueData.hash & 0xff;
+          queueData.priority           = queueData.hash >> 8;
+          queueData.batchCount         = 0;
+          queueData.vertexCount        = 0;
+          queueData.indexedBatchCount  = 0;
+          queueData.firstComponentName = 0;
+          queueData.componentNameCount = 0;
+        }
+        break;
+
+      case RCT_DRAW_ARRAYS:
+      case RCT_DRAW_ELEMENTS:
+
+        // check if draw is outside of any render queue
+        if (0 == data.queueCount)
+        {
+          // error!
+          return EGE_ERROR;
+        }
+
+        data.vertexCount += static_cast<u32>(command.args[1]);
+        data.batchCount++;
+        data.queues[data.queueCount - 1].batchCount++;
+        data.queues[data.queueCount - 1].vertexCount += static_cast<u32>(command.args[1]);
+
+        if (RCT_DRAW_ELEMENTS == command.type)
+        {
+          data.queues[data.queueCount - 1].indexedBatchCount++;
+          data.drawElementsCalls++;
+        }
+        else
+        {
+          data.drawArraysCalls++;
+        }
+        break;
+
+      default:
+
+        // check if unknown command
+        if (RCT_COUNT <= command.type)
+        {
+          // error!
+          return EGE_ERROR;
+        }
+        break;
+    }
+  }
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
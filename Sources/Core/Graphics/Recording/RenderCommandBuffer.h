@@ -0,0 +1,94 @@
+#ifndef EGE_CORE_GRAPHICS_RECORDING_RENDERCOMMANDBUFFER_H
+#define EGE_CORE_GRAPHICS_RECORDING_RENDERCOMMANDBUFFER_H
+
+/** Compact, API agnostic stream of render commands issued by recording render system within single frame. 
+ *  Only state transitions which actually took place are stored together with draw calls. This makes streams of identically rendered frames equal which 
+ *  allows them to be compared between runs and replayed later on.
+ */
+
+#include "EGE.h"
+#include "EGEDynamicArray.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+struct RenderSystemFrameStatisticData;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Available render command types. */
+enum RenderCommandType
+{
+  RCT_SET_VIEWPORT = 0,       /*!< Viewport change. Arguments: x, y, width, height (physical window-coordinates). */
+  RCT_CLEAR,                  /*!< Viewport clear. Arguments: buffer types mask, packed RGBA clear color. */
+  RCT_BEGIN_QUEUE,            /*!< Start of render queues bound to given hash value. Arguments: hash. */
+  RCT_SET_BLEND_ENABLED,      /*!< Blending enable change. Arguments: enable flag. */
+  RCT_SET_BLEND_FUNC,         /*!< Blending factors change. Arguments: source factor, destination factor. */
+  RCT_SET_SCISSOR_ENABLED,    /*!< Scissor test enable change. Arguments: enable flag. */
+  RCT_SET_SCISSOR_RECT,       /*!< Scissor rectangle change. Arguments: x, y, width, height. */
+  RCT_BIND_PROGRAM,           /*!< Program binding change. Arguments: program handle (0 if none). */
+  RCT_BIND_TEXTURE,           /*!< Texture binding change. Arguments: texture unit, texture handle (0 if none). */
+  RCT_DRAW_ARRAYS,            /*!< Non-indexed draw. Arguments: primitive type, vertex count. */
+  RCT_DRAW_ELEMENTS,          /*!< Indexed draw. Arguments: primitive type, index count, index size. */
+  RCT_COUNT
+};
+
+/*! Single recorded render command. */
+struct RenderCommand
+{
+  u32 type;                   /*!< Command type. @see RenderCommandType. */
+  s32 args[4];                /*!< Command arguments. Unused ones are zeroed. */
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class RenderCommandBuffer
+{
+  public:
+
+    RenderCommandBuffer();
+   ~RenderCommandBuffer();
+
+  public:
+
+    /*! Appends command at the end of the stream. 
+     *  @param  type  Command type.
+     *  @param  arg0  First argument.
+     *  @param  arg1  Second argument.
+     *  @param  arg2  Third argument.
+     *  @param  arg3  Fourth argument.
+     */
+    void append(RenderCommandType type, s32 arg0 = 0, s32 arg1 = 0, s32 arg2 = 0, s32 arg3 = 0);
+    /*! Removes all commands. 
+     *  @note Allocated storage is retained so recording of consecutive frames does not allocate.
+     */
+    void clear();
+    /*! Returns number of commands. */
+    u32 count() const;
+    /*! Returns command at given index. */
+    const RenderCommand& command(u32 index) const;
+    /*! Returns hash value of the whole stream. */
+    u32 hash() const;
+    /*! Replays command stream and calculates rendering statistics from it.
+     *  @param  data  Statistics data structure to fill in. Draw calls, batch, vertex counts and render queues data are reset before replay.
+     *  @return EGE_SUCCESS if stream is well-formed. Otherwise, EGE_ERROR.
+     *  @note Render duration and component names cannot be derived from the stream and are left intact.
+     */
+    EGEResult replay(RenderSystemFrameStatisticData& data) const;
+
+  private:
+
+    /*! Commands pool. */
+    DynamicArray<RenderCommand> m_commands;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline u32 RenderCommandBuffer::count() const
+{
+  return static_cast<u32>(m_commands.size());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline const RenderCommand& RenderCommandBuffer::command(u32 index) const
+{
+  return m_commands[index];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_GRAPHICS_RECORDING_RENDERCOMMANDBUFFER_H
\ No newline at end of file
@@ -0,0 +1,493 @@
+#include "Core/Graphics/Recording/RenderSystemRecording.h"
+#include "Core/Graphics/Recording/Texture2DRecording.h"
+#include "Core/Graphics/Recording/ShaderRecording.h"
+#include "Core/Graphics/Recording/ProgramRecording.h"
+#include "Core/Graphics/Recording/RenderTextureRecording.h"
+#include "Core/Graphics/OpenGL/IndexBufferVAOGL.h"
+#include "Core/Graphics/OpenGL/VertexBufferVAOGL.h"
+#include "Core/Graphics/Render/Implementation/RenderSystemStatistics.h"
+#include "EGEApplication.h"
+#include "EGEGraphics.h"
+#include "EGERenderQueues.h"
+#include "EGEDebug.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+static const char* KRenderSystemRecordingDebugName = "EGERenderSystemRecording";
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderSystemRecording::RenderSystemRecording(Application* app, u32 retainedFramesCount) : RenderSystem(app)
+                                                                                         , m_currentFrameIndex(0)
+                                                                                         , m_recordedFramesCount(0)
+                                                                                         , m_lastResourceId(0)
+                                                                                         , m_activeTextureUnitsCount(0)
+{
+  EGE_ASSERT(0 < retainedFramesCount);
+
+  // create empty frames in front
+  // NOTE: at least one frame is required to record into
+  m_frames.resize(Math::Max(retainedFramesCount, 1U));
+
+  // connect
+  ege_connect(app->graphics(), renderStart, this, RenderSystemRecording::onRenderStart);
+  ege_connect(app->graphics(), renderEnd, this, RenderSystemRecording::onRenderEnd);
+
+  invalidateStateCache();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderSystemRecording::~RenderSystemRecording()
+{
+  ege_disconnect(app()->graphics(), renderStart, this, RenderSystemRecording::onRenderStart);
+  ege_disconnect(app()->graphics(), renderEnd, this, RenderSystemRecording::onRenderEnd);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 RenderSystemRecording::recordedFramesCount() const
+{
+  return m_recordedFramesCount;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 RenderSystemRecording::retainedFramesCount() const
+{
+  return static_cast<u32>(m_frames.size());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const RenderCommandBuffer& RenderSystemRecording::recordedFrame(u32 age) const
+{
+  EGE_ASSERT_X(age < Math::Min(m_recordedFramesCount, retainedFramesCount()), "Frame is not available!");
+
+  const s32 count = static_cast<s32>(m_frames.size());
+  const s32 index = (m_currentFrameIndex - 1 - static_cast<s32>(age) + count * 2) % count;
+
+  return m_frames[index];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult RenderSystemRecording::replay(u32 age, RenderSystemFrameStatisticData& data) const
+{
+  // check if frame is not available
+  if (age >= Math::Min(m_recordedFramesCount, retainedFramesCount()))
+  {
+    // error!
+    return EGE_ERROR_BAD_PARAM;
+  }
+
+  return recordedFrame(age).replay(data);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::onRenderStart()
+{
+  // start new frame from scratch
+  currentFrame().clear();
+
+  invalidateStateCache();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::onRenderEnd()
+{
+  ++m_recordedFramesCount;
+
+  // move to next frame
+  ++m_currentFrameIndex %= m_frames.size();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderCommandBuffer& RenderSystemRecording::currentFrame()
+{
+  return m_frames[m_currentFrameIndex];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::invalidateStateCache()
+{
+  m_viewportRect       = Recti(0, 0, -1, -1);
+  m_blendEnabled       = -1;
+  m_blendSrcFactor     = -1;
+  m_blendDstFactor     = -1;
+  m_scissorTestEnabled = -1;
+  m_scissorRect        = Recti(0, 0, -1, -1);
+  m_boundProgramId     = -1;
+
+  for (DynamicArray<s32>::iterator it = m_boundTextureIds.begin(); it != m_boundTextureIds.end(); ++it)
+  {
+    *it = -1;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::setViewport(const PViewport& viewport)
+{
+  // call base class
+  RenderSystem::setViewport(viewport);
+
+  const Rectf actualRect = viewport->physicalRect();
+  const Recti rect(static_cast<s32>(actualRect.x), static_cast<s32>(actualRect.y), static_cast<s32>(actualRect.width), 
+                   static_cast<s32>(actualRect.height));
+
+  if ((rect.x != m_viewportRect.x) || (rect.y != m_viewportRect.y) || (rect.width != m_viewportRect.width) || (rect.height != m_viewportRect.height))
+  {
+    currentFrame().append(RCT_SET_VIEWPORT, rect.x, rect.y, rect.width, rect.height);
+
+    m_viewportRect = rect;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::clearViewport(const PViewport& viewport)
+{
+  // determine which buffers to clear
+  const s32 bufferTypes = viewport->clearBufferTypes() & (Viewport::BUFFER_TYPE_COLOR | Viewport::BUFFER_TYPE_DEPTH);
+
+  // check if anything to clear
+  if (0 != bufferTypes)
+  {
+    const u32 clearColor = (bufferTypes & Viewport::BUFFER_TYPE_COLOR) ? viewport->clearColor().packed() : 0;
+
+    currentFrame().append(RCT_CLEAR, bufferTypes, static_cast<s32>(clearColor));
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::flush()
+{
+  // go thru all render queues
+  for (u32 i = 0; i < m_renderQueues.count(); ++i)
+  {
+    const RenderQueueBucket& bucket = m_renderQueues.at(i);
+
+    // update statistics
+    // NOTE: all render queues below are aggregated into single statistics entry as they share the same hash value
+    EGE_RENDER_STATISTICS(m_statistics->beginRenderQueue(bucket.hash));
+
+    currentFrame().append(RCT_BEGIN_QUEUE, bucket.hash);
+
+    // render bucket queues
+    for (DynamicArray<PRenderQueue>::const_iterator it = bucket.queues.begin(); it != bucket.queues.end(); ++it)
+    {
+      PRenderQueue queue = *it;
+
+      // render queue
+      queue->render(*this);
+
+      // clear queue
+      queue->clear();
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::renderComponent(const PRenderComponent& component, const Matrix4f& modelMatrix)
+{
+  EGE_UNUSED(modelMatrix);
+
+  // set component being rendered
+  setActiveRenderComponent(component);
+
+  PVertexBuffer vertexBuffer = component->vertexBuffer();
+  PIndexBuffer indexBuffer   = component->indexBuffer();
+  PMaterial material         = component->material();
+
+  EGE_ASSERT_X(NULL != material, "Component must have material attached.");
+  EGE_ASSERT_X(0 < vertexBuffer->vertexCount(), "No vertices to render!");
+
+  // apply general params
+  applyGeneralParams();
+
+  // go thru all passes
+  for (u32 pass = 0; pass < material->passCount(); ++pass)
+  {
+    // apply pass related params
+    applyPassParams(material->pass(pass));
+
+    // determine number of vertices to render
+    const u32 vertexCount = (0 < indexBuffer->indexCount()) ? indexBuffer->indexCount() : vertexBuffer->vertexCount();
+
+    // update statistics
+    EGE_RENDER_STATISTICS(m_statistics->addBatch(component, vertexCount, 0 < indexBuffer->indexCount()));
+
+    // check if INDICIES are to be used
+    if (0 < indexBuffer->indexCount())
+    {
+      currentFrame().append(RCT_DRAW_ELEMENTS, component->primitiveType(), indexBuffer->indexCount(), indexBuffer->size());
+    }
+    else
+    {
+      currentFrame().append(RCT_DRAW_ARRAYS, component->primitiveType(), vertexBuffer->vertexCount());
+    }
+  }
+
+  // reset component being rendered
+  setActiveRenderComponent(NULL);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::applyGeneralParams()
+{
+  const PRenderComponent& component = activeRenderComponent();
+  
+  PRenderTarget renderTarget = currentRenderTarget();
+  EGE_ASSERT(NULL != renderTarget);
+
+  // apply scissor test
+  if (component->clipRect().isNull())
+  {
+    setScissorTestEnabled(false);
+  }
+  else
+  {
+    setScissorTestEnabled(true);
+
+    Rectf clipRect = component->clipRect();
+    
+    // check if conversion from "upper-left" corner to "lower-left" for current orientation is necessary
+    if ( ! renderTarget->requiresTextureFlipping())
+    {
+      // convert "upper-left" corner to "lower-left"
+      clipRect.y = renderTarget->height() - clipRect.height - clipRect.y;
+    }
+
+    // check if not auto-rotated
+    if ( ! renderTarget->isAutoRotated())
+    {
+      // apply opposite rotation to rectangle to convert it into native (non-transformed) coordinate
+      clipRect = applyRotation(clipRect, renderTarget->orientationRotation());
+    }
+
+    // apply zoom
+    float32 zoom = renderTarget->zoom();
+
+    clipRect.x      *= zoom;
+    clipRect.y      *= zoom;
+    clipRect.width  *= zoom;
+    clipRect.height *= zoom;
+
+    setScissorRect(Recti(static_cast<s32>(clipRect.x), static_cast<s32>(clipRect.y), static_cast<s32>(clipRect.width), static_cast<s32>(clipRect.height)));
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::applyPassParams(const PRenderPass& pass)
+{
+  EGE_ASSERT(NULL != pass);
+
+  // enable blending if necessary
+  if ((EGEGraphics::BF_ONE != pass->srcBlendFactor()) || (EGEGraphics::BF_ZERO != pass->dstBlendFactor()))
+  {
+    setBlendEnabled(true);
+    setBlendFunc(pass->srcBlendFactor(), pass->dstBlendFactor());
+  }
+  else
+  {
+    setBlendEnabled(false);
+  }
+
+  // bind program
+  ProgramRecording* program = ege_cast<ProgramRecording*>(pass->program());
+  bindProgram((NULL != program) ? program->id() : 0);
+
+  // go thru all textures
+  for (u32 i = 0; i < pass->textureCount(); ++i)
+  {
+    PTextureImage textureImage = pass->texture(i);
+    EGE_ASSERT(EGE_OBJECT_UID_TEXTURE_IMAGE == textureImage->uid());
+
+    // NOTE: it is possible texure object might be not present ie when it is manual and hasnt been set yet
+    Texture2DRecording* texture = ege_cast<Texture2DRecording*>(textureImage->texture());
+    bindTexture(i, (NULL != texture) ? texture->id() : 0);
+  }
+
+  // unbind textures from units not used by this pass anymore
+  for (u32 i = pass->textureCount(); i < m_activeTextureUnitsCount; ++i)
+  {
+    bindTexture(i, 0);
+  }
+
+  m_activeTextureUnitsCount = pass->textureCount();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::setBlendEnabled(bool set)
+{
+  const s32 value = set ? 1 : 0;
+
+  if (value != m_blendEnabled)
+  {
+    currentFrame().append(RCT_SET_BLEND_ENABLED, value);
+
+    m_blendEnabled = value;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::setBlendFunc(EGEGraphics::BlendFactor srcFactor, EGEGraphics::BlendFactor dstFactor)
+{
+  if ((srcFactor != m_blendSrcFactor) || (dstFactor != m_blendDstFactor))
+  {
+    currentFrame().append(RCT_SET_BLEND_FUNC, srcFactor, dstFactor);
+
+    m_blendSrcFactor = srcFactor;
+    m_blendDstFactor = dstFactor;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::setScissorTestEnabled(bool set)
+{
+  const s32 value = set ? 1 : 0;
+
+  if (value != m_scissorTestEnabled)
+  {
+    currentFrame().append(RCT_SET_SCISSOR_ENABLED, value);
+
+    m_scissorTestEnabled = value;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::setScissorRect(const Recti& rect)
+{
+  if ((rect.x != m_scissorRect.x) || (rect.y != m_scissorRect.y) || (rect.width != m_scissorRect.width) || (rect.height != m_scissorRect.height))
+  {
+    currentFrame().append(RCT_SET_SCISSOR_RECT, rect.x, rect.y, rect.width, rect.height);
+
+    m_scissorRect = rect;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::bindProgram(u32 programId)
+{
+  if (static_cast<s32>(programId) != m_boundProgramId)
+  {
+    currentFrame().append(RCT_BIND_PROGRAM, static_cast<s32>(programId));
+
+    m_boundProgramId = static_cast<s32>(programId);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemRecording::bindTexture(u32 unit, u32 textureId)
+{
+  // make sure unit is tracked
+  if (unit >= m_boundTextureIds.size())
+  {
+    m_boundTextureIds.resize(unit + 1, -1);
+  }
+
+  if (static_cast<s32>(textureId) != m_boundTextureIds[unit])
+  {
+    currentFrame().append(RCT_BIND_TEXTURE, static_cast<s32>(unit), static_cast<s32>(textureId));
+
+    m_boundTextureIds[unit] = static_cast<s32>(textureId);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 RenderSystemRecording::nextResourceId()
+{
+  // NOTE: handles are given in creation order so they are the same between runs
+  return ++m_lastResourceId;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool RenderSystemRecording::registerComponent(PRenderComponent& component, NVertexBuffer::UsageType vertexUsage, const VertexDeclaration& vertexDeclaration, 
+                                              EGEIndexBuffer::UsageType indexUsage)
+{
+  EGE_UNUSED(vertexUsage);
+  EGE_UNUSED(indexUsage);
+
+  bool result = false;
+
+  // NOTE: client side buffers are used regardless of usage hints
+  // add index buffer component
+  if (EGE_SUCCESS == component->addComponent(ege_new IndexBufferVA(app(), component->name() + "-ib")))
+  {
+    // add vertex buffer component
+    if (EGE_SUCCESS == component->addComponent(ege_new VertexBufferVA(app(), component->name() + "-vb", vertexDeclaration)))
+    {
+      // done
+      result = true;
+    }
+  }
+
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PTexture2D RenderSystemRecording::createTexture2D(const String& name, const PImage& image)
+{
+  PTexture2D texture = ege_new Texture2DRecording(app(), name, this, nextResourceId());
+  if ((NULL == texture) || (EGE_SUCCESS != texture->create(image)))
+  {
+    // error!
+    return NULL;
+  }
+
+  return texture;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PTexture2D RenderSystemRecording::createTexture2D(const String& name, const PDataBuffer& data)
+{
+  PTexture2D texture = ege_new Texture2DRecording(app(), name, this, nextResourceId());
+  if ((NULL == texture) || (EGE_SUCCESS != texture->create(data)))
+  {
+    // error!
+    return NULL;
+  }
+
+  return texture;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PTexture2D RenderSystemRecording::createRenderTexture(const String& name, s32 width, s32 height, PixelFormat format)
+{
+  const u32 id = nextResourceId();
+
+  // create empty texture
+  Texture2DRecording* texture = ege_new Texture2DRecording(app(), name, this, id);
+  if ((NULL == texture) || (EGE_SUCCESS != texture->create(width, height, format)))
+  {
+    // error!
+    EGE_DELETE(texture);
+    return NULL;
+  }
+
+  PTexture2D result = texture;
+
+  Dictionary params;
+  params[EGE_RENDER_TARGET_PARAM_NAME]    = name;
+  params[EGE_RENDER_TARGET_PARAM_WIDTH]   = String::FromNumber(width);
+  params[EGE_RENDER_TARGET_PARAM_HEIGHT]  = String::FromNumber(height);
+
+  PRenderTarget target = ege_new RenderTextureRecording(app(), params, id);
+  if (NULL == target)
+  {
+    // error!
+    return NULL;
+  }
+
+  // set render target
+  result->setRenderTarget(target);
+
+  // add into render targets
+  app()->graphics()->registerRenderTarget(result->renderTarget());
+
+  egeDebug(KRenderSystemRecordingDebugName) << "Creating render target done" << name;
+
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PShader RenderSystemRecording::createShader(EGEGraphics::ShaderType type, const String& name, const PDataBuffer& data)
+{
+  // create shader
+  ShaderRecording* shader = ege_new ShaderRecording(app(), name, type, this);
+  if ((NULL == shader) || ! shader->isValid() || (EGE_SUCCESS != shader->create(data)))
+  {
+    // error!
+    EGE_DELETE(shader);
+  }
+
+  return shader;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PProgram RenderSystemRecording::createProgram(const String& name, const List<PShader>& shaders)
+{
+  // create shader program
+  ProgramRecording* program = ege_new ProgramRecording(app(), name, this, nextResourceId());
+  if (NULL != program)
+  {
+    // attach shaders
+    for (List<PShader>::const_iterator it = shaders.begin(); it != shaders.end(); ++it)
+    {
+      if ( ! program->attach(*it))
+      {
+        // error!
+        EGE_DELETE(program);
+        break;
+      }
+    }
+  }
+
+  return program;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,155 @@
+#ifndef EGE_CORE_GRAPHICS_RECORDING_RENDERSYSTEMRECORDING_H
+#define EGE_CORE_GRAPHICS_RECORDING_RENDERSYSTEMRECORDING_H
+
+/*! Headless render system. Geometry is kept in client side buffers and instead of issuing any 3D API calls, compact stream of draws, bindings and state 
+ *  changes is recorded for each frame. Statistics are gathered exactly the same way as by hardware render systems. 
+ *  Command streams of a number of last frames are retained and can be compared or replayed which makes this render system suitable for running and 
+ *  benchmarking rendering paths on machines without graphics hardware.
+ */
+
+#include "EGE.h"
+#include "EGEDynamicArray.h"
+#include "EGERect.h"
+#include "Core/Graphics/Render/RenderSystem.h"
+#include "Core/Graphics/Recording/RenderCommandBuffer.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+struct RenderSystemFrameStatisticData;
+
+EGE_DECLARE_SMART_CLASS(VertexBuffer, PVertexBuffer)
+EGE_DECLARE_SMART_CLASS(IndexBuffer, PIndexBuffer)
+EGE_DECLARE_SMART_CLASS(Texture2D, PTexture2D)
+EGE_DECLARE_SMART_CLASS(Shader, PShader)
+EGE_DECLARE_SMART_CLASS(Program, PProgram)
+EGE_DECLARE_SMART_CLASS(RenderPass, PRenderPass)
+EGE_DECLARE_SMART_CLASS(RenderComponent, PRenderComponent)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class RenderSystemRecording : public RenderSystem
+{
+  public:
+
+    RenderSystemRecording(Application* app, u32 retainedFramesCount = 4);
+    virtual ~RenderSystemRecording();
+
+  public:
+
+    /*! Returns number of frames recorded so far. */
+    u32 recordedFramesCount() const;
+    /*! Returns number of frames which command streams are retained. */
+    u32 retainedFramesCount() const;
+    /*! Returns command stream of recorded frame. 
+     *  @param  age Age of the frame. Zero refers to last recorded frame, one to the frame before it and so on.
+     *  @note Age must be smaller than number of frames recorded and number of frames retained.
+     */
+    const RenderCommandBuffer& recordedFrame(u32 age = 0) const;
+    /*! Replays recorded frame calculating rendering statistics from it. 
+     *  @param  age   Age of the frame. @see recordedFrame.
+     *  @param  data  Statistics data structure to fill in.
+     *  @return EGE_SUCCESS if frame could be replayed.
+     */
+    EGEResult replay(u32 age, RenderSystemFrameStatisticData& data) const;
+
+  private slots:
+
+    /*! Slot called when rendering of next frame starts. */
+    void onRenderStart();
+    /*! Slot called when rendering of current frame ends. */
+    void onRenderEnd();
+
+  private:
+
+    /*! @see RenderSystem::setViewport. */
+    void setViewport(const PViewport& viewport) override;
+    /*! @see RenderSystem::clearViewport. */
+    void clearViewport(const PViewport& viewport) override;
+    /*! @see RenderSystem::flush. */
+    void flush() override;
+    /*! @see RenderSystem::applyGeneralParams. */
+    void applyGeneralParams() override;
+    /*! @see RenderSystem::applyPassParams. */
+    void applyPassParams(const PRenderPass& pass) override;
+
+    /*! @see IComponentRenderer::renderComponent. */
+    void renderComponent(const PRenderComponent& component, const Matrix4f& modelMatrix) override;
+
+    /*! @see IHardwareResourceProvider::registerComponent. */
+    bool registerComponent(PRenderComponent& component, NVertexBuffer::UsageType vertexUsage, const VertexDeclaration& vertexDeclaration, 
+                           EGEIndexBuffer::UsageType indexUsage) override;
+    /*! @see IHardwareResourceProvider::createTexture2D. */
+    PTexture2D createTexture2D(const String& name, const PImage& image) override;
+    /*! @see IHardwareResourceProvider::createTexture2D. */
+    PTexture2D createTexture2D(const String& name, const PDataBuffer& data) override;
+    /*! @see IHardwareResourceProvider::createRenderTexture. */
+    PTexture2D createRenderTexture(const String& name, s32 width, s32 height, PixelFormat format) override;
+    /*! @see IHardwareResourceProvider::createShader. */
+    PShader createShader(EGEGraphics::ShaderType type, const String& name, const PDataBuffer& data) override;
+    /*! @see IHardwareResourceProvider::createProgram. */
+    PProgram createProgram(const String& name, const List<PShader>& shaders) override;
+
+    /*! Returns command stream of frame being currently recorded. */
+    RenderCommandBuffer& currentFrame();
+    /*! Invalidates all shadowed states. 
+     *  @note This is done at the beginning of each frame so every recorded frame is self-contained.
+     */
+    void invalidateStateCache();
+    /*! Enables/disables blending. */
+    void setBlendEnabled(bool set);
+    /*! Sets blending factors. 
+     *  @param  srcFactor Source blending factor.
+     *  @param  dstFactor Destination blending factor.
+     */
+    void setBlendFunc(EGEGraphics::BlendFactor srcFactor, EGEGraphics::BlendFactor dstFactor);
+    /*! Enables/disables scissor testing. */
+    void setScissorTestEnabled(bool set);
+    /*! Sets scissor rectangle. 
+     *  @param  rect  Scissor rectangle in window coordinates.
+     */
+    void setScissorRect(const Recti& rect);
+    /*! Binds program. 
+     *  @param  programId Handle of the program to bind. Zero unbinds current program.
+     */
+    void bindProgram(u32 programId);
+    /*! Binds texture to given texture unit. 
+     *  @param  unit      Texture unit.
+     *  @param  textureId Handle of the texture to bind. Zero unbinds current texture.
+     */
+    void bindTexture(u32 unit, u32 textureId);
+    /*! Returns next free resource handle. */
+    u32 nextResourceId();
+
+  private:
+
+    /*! Command streams of retained frames. */
+    DynamicArray<RenderCommandBuffer> m_frames;
+    /*! Index of frame being currently recorded. */
+    s32 m_currentFrameIndex;
+    /*! Number of frames recorded so far. */
+    u32 m_recordedFramesCount;
+    /*! Last handle given to resource. */
+    u32 m_lastResourceId;
+    /*! Current viewport rectangle. Negative width if unknown. */
+    Recti m_viewportRect;
+    /*! Blend enabled state. Negative if unknown. */
+    s32 m_blendEnabled;
+    /*! Current source blending factor. Negative if unknown. */
+    s32 m_blendSrcFactor;
+    /*! Current destination blending factor. Negative if unknown. */
+    s32 m_blendDstFactor;
+    /*! Scissor test enabled state. Negative if unknown. */
+    s32 m_scissorTestEnabled;
+    /*! Current scissor rectangle. Negative width if unknown. */
+    Recti m_scissorRect;
+    /*! Handle of currently bound program. Negative if unknown. */
+    s32 m_boundProgramId;
+    /*! Handles of textures bound to each texture unit used so far. Negative if unknown. */
+    DynamicArray<s32> m_boundTextureIds;
+    /*! Number of texture units used by last applied pass. */
+    u32 m_activeTextureUnitsCount;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_GRAPHICS_RECORDING_RENDERSYSTEMRECORDING_H
\ No newline at end of file
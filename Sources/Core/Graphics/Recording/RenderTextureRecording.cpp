@@ -0,0 +1,43 @@
+#include "Core/Graphics/Recording/RenderTextureRecording.h"
+#include "EGEDebug.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderTextureRecording::RenderTextureRecording(Application* app, const Dictionary& params, u32 textureId) : RenderTarget(app, params)
+                                                                                                          , m_textureId(textureId)
+{
+  // set physical size to logical one
+  m_physicalWidth  = m_width;
+  m_physicalHeight = m_height;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderTextureRecording::~RenderTextureRecording()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderTarget::Priority RenderTextureRecording::priority() const
+{
+  return PRIORITY_RENDER_TEXTURE;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderTextureRecording::bind()
+{
+  // do nothing, there is no frame buffer to bind
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderTextureRecording::unbind()
+{
+  // do nothing, there is no frame buffer to unbind
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool RenderTextureRecording::requiresTextureFlipping() const
+{
+  return true;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool RenderTextureRecording::isAutoRotated() const
+{
+  return false;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
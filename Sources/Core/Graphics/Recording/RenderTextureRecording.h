@@ -0,0 +1,46 @@
+#ifndef EGE_CORE_GRAPHICS_RECORDING_RENDERTEXTURERECORDING_H
+#define EGE_CORE_GRAPHICS_RECORDING_RENDERTEXTURERECORDING_H
+
+/** Render target bound to texture created by recording render system. 
+ */
+
+#include "EGE.h"
+#include "EGEDictionary.h"
+#include "Core/Graphics/Render/RenderTarget.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class RenderTextureRecording : public RenderTarget
+{
+  public:
+
+    RenderTextureRecording(Application* app, const Dictionary& params, u32 textureId);
+    virtual ~RenderTextureRecording();
+
+    /*! Returns associated texture handle. */
+    u32 textureId() const { return m_textureId; }
+
+  private:
+
+    /*! @see RenderTarget::priority. */
+    Priority priority() const override;
+    /*! @see RenderTarget::bind. */
+    void bind() override;
+    /*! @see RenderTarget::unbind. */
+    void unbind() override;
+    /*! @see RenderTarget::requiresTextureFlipping. */
+    bool requiresTextureFlipping() const override;
+    /*! @see RenderTarget::isAutoRotated. */
+    bool isAutoRotated() const override;
+
+  private:
+
+    /*! Texture handle associated with render target. */
+    u32 m_textureId;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_GRAPHICS_RECORDING_RENDERTEXTURERECORDING_H
\ No newline at end of file
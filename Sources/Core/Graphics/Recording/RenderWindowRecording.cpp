@@ -0,0 +1,80 @@
+#include "Core/Graphics/Recording/RenderWindowRecording.h"
+#include "EGEMath.h"
+#include "EGEDebug.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderWindowRecording::RenderWindowRecording(Application* app, const Dictionary& params) : RenderWindow(app, params)
+                                                                                          , m_shownFramesCount(0)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderWindowRecording::~RenderWindowRecording()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult RenderWindowRecording::construct(const Dictionary& params)
+{
+  bool error = false;
+
+  // decompose param list
+  Dictionary::const_iterator iterFullscreen = params.find(EGE_RENDER_WINDOW_PARAM_FULLSCREEN);
+  Dictionary::const_iterator iterLandscape  = params.find(EGE_ENGINE_PARAM_LANDSCAPE_MODE);
+
+  bool landscape  = (iterLandscape != params.end()) ? iterLandscape->second.toBool(&error) : false;
+  bool fullscreen = (iterFullscreen != params.end()) ? iterFullscreen->second.toBool(&error) : false;
+
+  if (error || ! isValid())
+  {
+    // error!
+    return EGE_ERROR_BAD_PARAM;
+  }
+
+  // apply dimensions according to landscape requirement
+  s32 width  = m_width;
+  s32 height = m_height;
+
+  if (landscape)
+  {
+    m_height = Math::Min(width, height);
+    m_width  = Math::Max(width, height);
+  }
+  else
+  {
+    m_height = Math::Max(width, height);
+    m_width  = Math::Min(width, height);
+  }
+
+  // apply zoom to physical size
+  m_physicalWidth  = static_cast<s32>(m_width * zoom());
+  m_physicalHeight = static_cast<s32>(m_height * zoom());
+
+  return enableFullScreen(m_width, m_height, fullscreen);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult RenderWindowRecording::enableFullScreen(s32 width, s32 height, bool enable)
+{
+  EGE_UNUSED(width);
+  EGE_UNUSED(height);
+
+  // NOTE: there is no display to switch mode of
+  m_fullScreen = enable;
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool RenderWindowRecording::requiresTextureFlipping() const
+{
+  return false;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderWindowRecording::showFrameBuffer()
+{
+  ++m_shownFramesCount;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool RenderWindowRecording::isAutoRotated() const
+{
+  return false;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
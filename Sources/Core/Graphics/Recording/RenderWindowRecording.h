@@ -0,0 +1,46 @@
+#ifndef EGE_CORE_GRAPHICS_RECORDING_RENDERWINDOWRECORDING_H
+#define EGE_CORE_GRAPHICS_RECORDING_RENDERWINDOWRECORDING_H
+
+/** Off-screen render window used together with recording render system. No native window is created and nothing is ever presented.
+ */
+
+#include "EGE.h"
+#include "EGEDictionary.h"
+#include "Core/Graphics/Render/RenderWindow.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class RenderWindowRecording : public RenderWindow
+{
+  public:
+
+    RenderWindowRecording(Application* app, const Dictionary& params);
+    virtual ~RenderWindowRecording();
+
+    /*! Creates object. */
+    EGEResult construct(const Dictionary& params);
+    /*! Returns number of frames shown so far. */
+    u32 shownFramesCount() const { return m_shownFramesCount; }
+
+  private:
+
+    /*! RenderWindow override. Enables/Disables fullscreen mode. */
+    EGEResult enableFullScreen(s32 width, s32 height, bool enable) override;
+    /*! RenderTarget override. Returns TRUE if texture flipping is required for this render target. */
+    bool requiresTextureFlipping() const override;
+    /*! RenderWindow override. Shows frame buffer. */
+    void showFrameBuffer() override;
+    /*! @see RenderWindow::isAutoRotated. */
+    bool isAutoRotated() const override;
+
+  private:
+
+    /*! Number of frames shown so far. */
+    u32 m_shownFramesCount;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_GRAPHICS_RECORDING_RENDERWINDOWRECORDING_H
\ No newline at end of file
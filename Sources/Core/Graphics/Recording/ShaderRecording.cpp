@@ -0,0 +1,37 @@
+#include "Core/Graphics/Recording/ShaderRecording.h"
+#include "EGEDataBuffer.h"
+#include "EGEDebug.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(ShaderRecording)
+EGE_DEFINE_DELETE_OPERATORS(ShaderRecording)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+ShaderRecording::ShaderRecording(Application* app, const String& name, EGEGraphics::ShaderType type, IHardwareResourceProvider* provider) 
+: Shader(app, name, type, provider)
+, m_sourceSize(-1)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+ShaderRecording::~ShaderRecording()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool ShaderRecording::isValid() const
+{
+  return EGEGraphics::UNKNOWN_SHADER != type();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult ShaderRecording::create(const PDataBuffer& buffer)
+{
+  if ((NULL == buffer) || (0 == buffer->size()))
+  {
+    // error!
+    return EGE_ERROR_BAD_PARAM;
+  }
+
+  m_sourceSize = buffer->size();
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef EGE_CORE_GRAPHICS_RECORDING_SHADERRECORDING_H
+#define EGE_CORE_GRAPHICS_RECORDING_SHADERRECORDING_H
+
+/** Shader specialization used by recording render system. Source code is not compiled, only its size is kept for reference.
+ */
+
+#include "EGE.h"
+#include "EGEShader.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DECLARE_SMART_CLASS(DataBuffer, PDataBuffer)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class ShaderRecording : public Shader
+{
+  public:
+
+    ShaderRecording(Application* app, const String& name, EGEGraphics::ShaderType type, IHardwareResourceProvider* provider);
+    virtual ~ShaderRecording();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+    /*! @see Shader::isValid. */
+    bool isValid() const override;
+    /*! Creates shader from given source buffer. */
+    EGEResult create(const PDataBuffer& buffer);
+    /*! Returns size of shader source (in bytes). */
+    s64 sourceSize() const { return m_sourceSize; }
+
+  private:
+
+    /*! Size of shader source (in bytes). Negative if not created yet. */
+    s64 m_sourceSize;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_GRAPHICS_RECORDING_SHADERRECORDING_H
\ No newline at end of file
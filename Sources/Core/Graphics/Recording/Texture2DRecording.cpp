@@ -0,0 +1,70 @@
+#include "Core/Graphics/Recording/Texture2DRecording.h"
+#include "Core/Graphics/Image/Image.h"
+#include "EGEDebug.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Texture2DRecording::Texture2DRecording(Application* app, const String& name, IHardwareResourceProvider* provider, u32 id) 
+: Texture2D(app, name, provider)
+, m_id(id)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Texture2DRecording::~Texture2DRecording()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult Texture2DRecording::create(const String& path)
+{
+  // load image
+  PImage image = Image::Load(path);
+  if (NULL == image)
+  {
+    // error!
+    return EGE_ERROR;
+  }
+
+  return create(image);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult Texture2DRecording::create(const PDataBuffer& buffer)
+{
+  // load image
+  PImage image = Image::Load(buffer);
+  if (NULL == image)
+  {
+    // error!
+    return EGE_ERROR;
+  }
+
+  return create(image);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult Texture2DRecording::create(const PImage& image)
+{
+  if (NULL == image)
+  {
+    // error!
+    return EGE_ERROR_BAD_PARAM;
+  }
+
+  // NOTE: pixel data is not needed, only properties are stored
+  return create(image->width(), image->height(), image->format());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult Texture2DRecording::create(s32 width, s32 height, PixelFormat format)
+{
+  if ((0 >= width) || (0 >= height))
+  {
+    // error!
+    return EGE_ERROR_BAD_PARAM;
+  }
+
+  m_width  = width;
+  m_height = height;
+  m_format = format;
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef EGE_CORE_GRAPHICS_RECORDING_TEXTURE2DRECORDING_H
+#define EGE_CORE_GRAPHICS_RECORDING_TEXTURE2DRECORDING_H
+
+/** Texture2D specialization used by recording render system. No pixel data is kept. Texture is represented by its handle and properties only.
+ */
+
+#include "EGE.h"
+#include "EGETexture.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class Texture2DRecording : public Texture2D
+{
+  public:
+
+    Texture2DRecording(Application* app, const String& name, IHardwareResourceProvider* provider, u32 id);
+   ~Texture2DRecording();
+
+    /*! @see Texture2D::create. */
+    EGEResult create(const String& path) override;
+    /*! @see Texture2D::create. */
+    EGEResult create(const PDataBuffer& buffer) override;
+    /*! @see Texture2D::create. */
+    EGEResult create(const PImage& image) override;
+    /*! Creates empty texture of given size and format. */
+    EGEResult create(s32 width, s32 height, PixelFormat format);
+    /*! Returns texture handle. */
+    u32 id() const { return m_id; }
+
+  private:
+
+    /*! Texture handle. */
+    u32 m_id;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_GRAPHICS_RECORDING_TEXTURE2DRECORDING_H
\ No newline at end of file
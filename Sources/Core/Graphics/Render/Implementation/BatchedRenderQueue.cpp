@@ -1,4 +1,5 @@
 #include "Core/Graphics/Render/Implementation/BatchedRenderQueue.h"
+#include "Core/Graphics/Render/Implementation/ComponentRenderer.h"
 #include "EGEDebug.h"
 
 EGE_NAMESPACE_BEGIN
@@ -47,8 +48,8 @@ bool BatchedRenderQueue::IsSuitable(const PRenderComponent& component)
     for (u32 textureIndex = 0; textureIndex < pass->textureCount() && result; ++textureIndex)
     {
       // check if same texture
-      // TAGE - check if possible to compare just texture objects instead of names
-      if (component->material()->pass(0)->texture(0)->name() != pass->texture(textureIndex)->name())
+      // NOTE: texture objects are compared rather than names to avoid string comparisons on submission
+      if (component->material()->pass(0)->texture(0)->texture() != pass->texture(textureIndex)->texture())
       {
         // batching not possible
         result = false;
@@ -161,15 +162,11 @@ void BatchedRenderQueue::clear()
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void BatchedRenderQueue::prepareRenderList(RenderDataList& list)
+void BatchedRenderQueue::render(IComponentRenderer& renderer)
 {
   if ((NULL != m_renderData) && (NULL != m_renderData->material()) && (0 < m_renderData->vertexBuffer()->vertexCount()))
   {
-    SRENDERDATA data;
-    data.component    = m_renderData;
-    data.modelMatrix  = Matrix4f::IDENTITY;
-
-    list.push_back(data);
+    renderer.renderComponent(m_renderData, Matrix4f::IDENTITY);
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -433,89 +430,35 @@ bool BatchedRenderQueue::appendBuffer(const PIndexBuffer& buffer)
 void BatchedRenderQueue::convertVertices(float32* outData, const float32* inData, u32 count, const List<const Rectf*>& textureRects, 
                                          const Matrix4f& modelMatrix) const
 {
-  Vector4f position;
+  // convert all non-positional data and copy positions
+  convertVertices(outData, inData, count, textureRects);
 
-  // get vertex elements
-  const VertexElementArray& vertexElements = m_renderData->vertexBuffer()->vertexDeclaration().vertexElements();
+  const VertexDeclaration& vertexDeclaration = m_renderData->vertexBuffer()->vertexDeclaration();
+  const u32 vertexSize = vertexDeclaration.vertexSize();
 
-  // go thru all vertices
-  for (u32 i = 0; i < count; ++i)
+  // transform positions in place
+  // NOTE: all vertices are processed at once, directly within interleaved data
+  const VertexElementArray& vertexElements = vertexDeclaration.vertexElements();
+  for (VertexElementArray::const_iterator it = vertexElements.begin(); it != vertexElements.end(); ++it)
   {
-    // point to first texture coords
-    List<const Rectf*>::const_iterator itTextureRect = textureRects.begin();
-  
-    VertexElementArray::const_iterator itLast = vertexElements.end();
-    for (VertexElementArray::const_iterator it = vertexElements.begin(); it != itLast; ++it)
-    {
-      switch (it->semantic())
-      {
-        case NVertexBuffer::VES_POSITION_XY:
-
-          position.x = *inData++;
-          position.y = *inData++;
-          position.z = 0.0f;
-          position.w = 1.0f;
-
-          position = modelMatrix * position;
-
-          *outData++ = position.x;
-          *outData++ = position.y;
-          break;
-
-        case NVertexBuffer::VES_POSITION_XYZ:
-
-          position.x = *inData++;
-          position.y = *inData++;
-          position.z = *inData++;
-          position.w = 1.0f;
-
-          position = modelMatrix * position;
-
-          *outData++ = position.x;
-          *outData++ = position.y;
-          *outData++ = position.z;
-          break;
-
-        case NVertexBuffer::VES_NORMAL:
-
-          *outData++ = *inData++;
-          *outData++ = *inData++;
-          *outData++ = *inData++;
-          break;
+    u8* position = reinterpret_cast<u8*>(outData) + it->offset();
 
-        case NVertexBuffer::VES_TEXTURE_UV:
-
-          *outData++ = (*itTextureRect)->x + (*inData++) * (*itTextureRect)->width;
-          *outData++ = (*itTextureRect)->y + (*inData++) * (*itTextureRect)->height;
-
-          // update number of processed coords
-          ++itTextureRect;
-          break;
-
-        case NVertexBuffer::VES_COLOR_RGBA:
-
-          *outData++ = *inData++;
-          *outData++ = *inData++;
-          *outData++ = *inData++;
-          *outData++ = *inData++;
-          break;
+    switch (it->semantic())
+    {
+      case NVertexBuffer::VES_POSITION_XY:
 
-        case NVertexBuffer::VES_TANGENT:
+        Math::Transform(reinterpret_cast<Vector2f*>(position), vertexSize, reinterpret_cast<const Vector2f*>(position), vertexSize, count, 
+                        modelMatrix);
+        break;
 
-          *outData++ = *inData++;
-          *outData++ = *inData++;
-          break;
+      case NVertexBuffer::VES_POSITION_XYZ:
 
-        case NVertexBuffer::VES_POINT_SPRITE_SIZE:
+        Math::Transform(reinterpret_cast<Vector3f*>(position), vertexSize, reinterpret_cast<const Vector3f*>(position), vertexSize, count, 
+                        modelMatrix);
+        break;
 
-          *outData++ = *inData++;
-          break;
-
-        default:
-
-          EGE_ASSERT_X(false, "Implement!!!");
-          break;
-      }
+      default:
+        break;
     }
   }
 }
@@ -39,8 +39,8 @@ class BatchedRenderQueue : public RenderQueue
     EGEResult addForRendering(const PRenderQueue& queue) override;
     /*! @see RenderQueue::clear. */
     void clear() override;
-    /*! @see RenderQueue::prepareRenderList. */
-    void prepareRenderList(RenderDataList& list) override;
+    /*! @see RenderQueue::render. */
+    void render(IComponentRenderer& renderer) override;
 
     /*! Allocates master render component for a given component. 
      *  @param  component Component for which master component should be used. It is used as a template.
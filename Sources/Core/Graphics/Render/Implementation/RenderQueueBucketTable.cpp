@@ -0,0 +1,216 @@
+#include "Core/Graphics/Render/Implementation/RenderQueueBucketTable.h"
+#include "Core/Graphics/Render/RenderPass.h"
+#include "Core/Graphics/Material.h"
+#include "Core/Graphics/TextureImage.h"
+#include "Core/Graphics/Texture2D.h"
+#include "Core/Graphics/VertexBuffer.h"
+#include "Core/Graphics/IndexBuffer.h"
+#include "Core/Crypto/Interface/Hash.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of primitive types. */
+#define PRIMITIVE_TYPES_COUNT (EGEGraphics::RPT_POINTS + 1)
+/*! Initial number of batch slots within bucket. Must be power of 2. */
+#define INITIAL_BATCH_SLOTS_COUNT 8
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Batch key data struct. */
+struct BatchKeyData
+{
+  const void* texture;
+  s32 srcBlendFactor;
+  s32 dstBlendFactor;
+  u32 vertexSize;
+  u32 indexSize;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderQueueBucketTable::RenderQueueBucketTable()
+{
+  m_denseIndicies.resize(EGE_RENDER_QUEUE_DENSE_PRIORITIES_COUNT * PRIMITIVE_TYPES_COUNT, 0);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderQueueBucketTable::~RenderQueueBucketTable()
+{
+  for (DynamicArray<RenderQueueBucket*>::iterator it = m_buckets.begin(); it != m_buckets.end(); ++it)
+  {
+    EGE_DELETE(*it);
+  }
+
+  m_buckets.clear();
+  m_order.clear();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 RenderQueueBucketTable::CalculateBatchKey(const PRenderComponent& component)
+{
+  BatchKeyData data;
+  EGE_MEMSET(&data, 0, sizeof (data));
+
+  // NOTE: only data which cannot differ within the batch is taken into account
+  const PMaterial& material = component->material();
+  if (0 < material->passCount())
+  {
+    const PRenderPass& pass = material->pass(0);
+
+    data.srcBlendFactor = pass->srcBlendFactor();
+    data.dstBlendFactor = pass->dstBlendFactor();
+
+    // NOTE: compare texture objects rather than texture images as the latter ones are different for each texture atlas region
+    if (0 < pass->textureCount())
+    {
+      PTextureImage textureImage = pass->texture(0);
+      if (NULL != textureImage)
+      {
+        data.texture = textureImage->texture().object();
+      }
+    }
+  }
+
+  data.vertexSize = component->vertexBuffer()->vertexDeclaration().vertexSize();
+  data.indexSize  = component->indexBuffer()->indexSize();
+
+  return Hash::FromData32(reinterpret_cast<const u8*>(&data), sizeof (data));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderQueueBucket& RenderQueueBucketTable::bucket(u32 priority, EGEGraphics::RenderPrimitiveType primitiveType)
+{
+  const u32 hash = CalculateHash(priority, primitiveType);
+
+  // check if dense priority
+  if (EGE_RENDER_QUEUE_DENSE_PRIORITIES_COUNT > priority)
+  {
+    u32& index = m_denseIndicies[priority * PRIMITIVE_TYPES_COUNT + primitiveType];
+    if (0 == index)
+    {
+      index = createBucket(hash) + 1;
+    }
+
+    return *m_buckets[index - 1];
+  }
+
+  // look up in sparse map
+  Map<u32, u32>::const_iterator it = m_sparseIndicies.find(hash);
+  if (it != m_sparseIndicies.end())
+  {
+    return *m_buckets[it->second];
+  }
+
+  const u32 index = createBucket(hash);
+  m_sparseIndicies.insert(hash, index);
+
+  return *m_buckets[index];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 RenderQueueBucketTable::addQueue(RenderQueueBucket& bucket, const PRenderQueue& queue)
+{
+  bucket.queues.push_back(queue);
+  bucket.nextQueueIndicies.push_back(-1);
+
+  return static_cast<s32>(bucket.queues.size() - 1);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 RenderQueueBucketTable::batchQueueIndex(const RenderQueueBucket& bucket, u32 key) const
+{
+  return bucket.batchQueueIndicies.empty() ? -1 : bucket.batchQueueIndicies[batchSlot(bucket, key)];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderQueueBucketTable::setBatchQueueIndex(RenderQueueBucket& bucket, u32 key, s32 queueIndex)
+{
+  EGE_ASSERT(0 <= queueIndex);
+
+  // check if table is to be grown
+  // NOTE: load factor is kept below 1/2 so probing sequences stay short
+  if ((bucket.batchCount + 1) * 2 > bucket.batchKeys.size())
+  {
+    DynamicArray<u32> oldKeys;
+    DynamicArray<s32> oldIndicies;
+    oldKeys.swap(bucket.batchKeys);
+    oldIndicies.swap(bucket.batchQueueIndicies);
+
+    const u32 slotsCount = oldKeys.empty() ? INITIAL_BATCH_SLOTS_COUNT : static_cast<u32>(oldKeys.size() * 2);
+    bucket.batchKeys.resize(slotsCount, 0);
+    bucket.batchQueueIndicies.resize(slotsCount, -1);
+
+    // rehash
+    for (u32 i = 0; i < oldKeys.size(); ++i)
+    {
+      if (0 <= oldIndicies[i])
+      {
+        const u32 slot = batchSlot(bucket, oldKeys[i]);
+
+        bucket.batchKeys[slot]          = oldKeys[i];
+        bucket.batchQueueIndicies[slot] = oldIndicies[i];
+      }
+    }
+  }
+
+  const u32 slot = batchSlot(bucket, key);
+  if (0 > bucket.batchQueueIndicies[slot])
+  {
+    bucket.batchCount++;
+
+    bucket.batchKeys[slot]          = key;
+    bucket.batchQueueIndicies[slot] = queueIndex;
+  }
+  else
+  {
+    // append to the end of the chain
+    s32 index = bucket.batchQueueIndicies[slot];
+    while (0 <= bucket.nextQueueIndicies[index])
+    {
+      index = bucket.nextQueueIndicies[index];
+    }
+
+    bucket.nextQueueIndicies[index] = queueIndex;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 RenderQueueBucketTable::count() const
+{
+  return static_cast<u32>(m_order.size());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const RenderQueueBucket& RenderQueueBucketTable::at(u32 index) const
+{
+  return *m_order[index];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 RenderQueueBucketTable::createBucket(u32 hash)
+{
+  RenderQueueBucket* bucket = ege_new RenderQueueBucket();
+  EGE_ASSERT(NULL != bucket);
+
+  bucket->hash             = hash;
+  bucket->simpleQueueIndex = -1;
+  bucket->batchCount       = 0;
+
+  m_buckets.push_back(bucket);
+
+  // insert into render order
+  // NOTE: new buckets appear rarely (usually during first frames only) so ordered insertion is cheap enough
+  DynamicArray<RenderQueueBucket*>::iterator it = m_order.begin();
+  while ((it != m_order.end()) && ((*it)->hash < hash))
+  {
+    ++it;
+  }
+
+  m_order.insert(it, bucket);
+
+  return static_cast<u32>(m_buckets.size() - 1);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 RenderQueueBucketTable::batchSlot(const RenderQueueBucket& bucket, u32 key) const
+{
+  const u32 mask = static_cast<u32>(bucket.batchKeys.size() - 1);
+
+  // linear probing
+  // NOTE: table is never full so there is always an empty slot to stop at
+  u32 slot = key & mask;
+  while ((0 <= bucket.batchQueueIndicies[slot]) && (bucket.batchKeys[slot] != key))
+  {
+    slot = (slot + 1) & mask;
+  }
+
+  return slot;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,110 @@
+#ifndef EGE_CORE_GRAPHICS_RENDER_RENDERQUEUEBUCKETTABLE_H
+#define EGE_CORE_GRAPHICS_RENDER_RENDERQUEUEBUCKETTABLE_H
+
+/*! Table of render queue buckets.
+ *  Each bucket groups all render queues sharing the same priority and primitive type. Buckets of priorities below EGE_RENDER_QUEUE_DENSE_PRIORITIES_COUNT
+ *  are located with single array lookup, remaining ones fall back to the map. Within a bucket, batched render queues are located by batch key thru small
+ *  open addressing hash table, so neither lookup requires any allocation once the table is warmed up. Batched render queues sharing the same key (ie due
+ *  to different clip regions) are chained.
+ *  Buckets are never removed, so bucket references remain valid thru the lifetime of the table.
+ */
+
+#include "EGE.h"
+#include "EGEGraphics.h"
+#include "EGEDynamicArray.h"
+#include "EGEMap.h"
+#include "EGERenderComponent.h"
+#include "Core/Graphics/Render/Interface/RenderQueue.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of lowest priorities which buckets are looked up directly. */
+#define EGE_RENDER_QUEUE_DENSE_PRIORITIES_COUNT 512
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Render queue bucket data struct. */
+struct RenderQueueBucket
+{
+  u32 hash;                             /*!< Render queue hash value (priority and primitive type). */
+  DynamicArray<PRenderQueue> queues;    /*!< Render queues in order of creation. */
+  DynamicArray<s32> nextQueueIndicies;  /*!< Indicies of next batched render queues of the same batch key. Negative if last in chain. */
+  s32 simpleQueueIndex;                 /*!< Index of simple render queue within queues array. Negative if not created yet. */
+  DynamicArray<u32> batchKeys;          /*!< Batch keys hash table. */
+  DynamicArray<s32> batchQueueIndicies; /*!< Indicies of batched render queues for corresponding batch keys. Negative for empty slots. */
+  u32 batchCount;                       /*!< Number of occupied batch slots. */
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class RenderQueueBucketTable
+{
+  public:
+
+    RenderQueueBucketTable();
+   ~RenderQueueBucketTable();
+
+  public:
+
+    /*! Calculates render queues hash.
+     *  @param  priority      Render priority.
+     *  @param  primitiveType Primitive type to be rendered.
+     *  @return Calculated hash value.
+     */
+    static u32 CalculateHash(u32 priority, EGEGraphics::RenderPrimitiveType primitiveType);
+    /*! Calculates batch key of a given component.
+     *  @param  component Component for which key is to be calculated.
+     *  @return Calculated key.
+     *  @note Components of different keys can never be batched together. Components of the same key are most likely to be batched together.
+     */
+    static u32 CalculateBatchKey(const PRenderComponent& component);
+
+  public:
+
+    /*! Returns bucket for a given priority and primitive type. Creates one if does not exist yet. */
+    RenderQueueBucket& bucket(u32 priority, EGEGraphics::RenderPrimitiveType primitiveType);
+    /*! Appends render queue to a given bucket. Returns index of the render queue within bucket. */
+    s32 addQueue(RenderQueueBucket& bucket, const PRenderQueue& queue);
+    /*! Returns index of first batched render queue bound to a given key within given bucket. Negative if none. */
+    s32 batchQueueIndex(const RenderQueueBucket& bucket, u32 key) const;
+    /*! Binds batched render queue to a given key within given bucket.
+     *  @param  bucket      Bucket to modify.
+     *  @param  key         Batch key.
+     *  @param  queueIndex  Index of render queue within bucket. If key is bound already, render queue is appended to the end of the chain.
+     */
+    void setBatchQueueIndex(RenderQueueBucket& bucket, u32 key, s32 queueIndex);
+
+    /*! Returns number of buckets. */
+    u32 count() const;
+    /*! Returns bucket at a given position.
+     *  @note Buckets are sorted by hash value in ascending order, which is the render order.
+     */
+    const RenderQueueBucket& at(u32 index) const;
+
+  private:
+
+    /*! Creates new bucket for a given hash value. Returns index of the bucket. */
+    u32 createBucket(u32 hash);
+    /*! Returns index of batch slot for a given key within given bucket. It is either slot occupied by key or the empty one. */
+    u32 batchSlot(const RenderQueueBucket& bucket, u32 key) const;
+
+  private:
+
+    /*! Buckets in order of creation. */
+    DynamicArray<RenderQueueBucket*> m_buckets;
+    /*! Buckets sorted by hash value. */
+    DynamicArray<RenderQueueBucket*> m_order;
+    /*! Bucket indicies (increased by 1) for dense priorities. 0 if no bucket. */
+    DynamicArray<u32> m_denseIndicies;
+    /*! Map of bucket indicies for remaining priorities [hash, index]. */
+    Map<u32, u32> m_sparseIndicies;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline u32 RenderQueueBucketTable::CalculateHash(u32 priority, EGEGraphics::RenderPrimitiveType primitiveType)
+{
+  // NOTE: priority is stored in upper 24 bits while primitive is stored in least significant 8 bits.
+  //       Due to such composition priority is always leading as rendering is supposed to following priority settings.
+  return (priority << 8) | primitiveType;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_GRAPHICS_RENDER_RENDERQUEUEBUCKETTABLE_H
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "EGEApplication.h"
 #include "EGEGraphics.h"
 #include "EGEFile.h"
+#include "EGEMath.h"
+#include "EGERenderComponent.h"
 #include "EGEStringBuffer.h"
 #include "EGETimer.h"
 #include "EGEGraphics.h"
@@ -20,7 +22,7 @@ const char* PrimitiveTypeName(s32 primitiveType)
     case EGEGraphics::RPT_LINES:            return "RPT_LINES";
     case EGEGraphics::RPT_LINE_LOOP:        return "RPT_LINE_LOOP";
     case EGEGraphics::RPT_POINTS:           return "RPT_POINTS";
-  
+
     default:
 
       EGE_ASSERT_X(false, "Unhandled primitive type!");
@@ -30,18 +32,52 @@ const char* PrimitiveTypeName(s32 primitiveType)
   return "UNKNOWN";
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-RenderSystemStatistics::RenderSystemStatistics(Application* app, const String& logFileName, u32 recordsCount) 
+/*! Local function returning given string with JSON special characters escaped. */
+static String EscapeJSON(const String& string)
+{
+  String out;
+
+  const char* data = string.toAscii();
+  const u32 length = static_cast<u32>(string.length());
+  for (u32 i = 0; i < length; ++i)
+  {
+    switch (data[i])
+    {
+      case '"':   out += "\\\""; break;
+      case '\\':  out += "\\\\"; break;
+      case '\n':  out += "\\n"; break;
+      case '\r':  out += "\\r"; break;
+      case '\t':  out += "\\t"; break;
+
+      default:
+
+        out += data[i];
+        break;
+    }
+  }
+
+  return out;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderSystemStatistics::RenderSystemStatistics(Application* app, const String& logFileName, u32 recordsCount)
 : Component(app, EGE_OBJECT_UID_RENDER_SYSTEM_STATISTICS, "rs-statistics")
 , m_currentIndex(0)
+, m_currentRecord(NULL)
+, m_currentQueue(NULL)
+, m_framesCount(0)
+, m_componentNamesSamplingInterval(0)
+, m_captureComponentNames(false)
 , m_logFileName(logFileName)
 , m_fpsRendersCount(0)
 , m_fpsStartTimeStamp(0LL)
 {
-  // create empty records in front
-  while (0 < recordsCount--)
-  {
-    m_records.push_back(RenderSystemFrameStatisticData());
-  }
+  // allocate all records in front
+  // NOTE: at least two records are required so there is a completed one while current one is being gathered
+  // NOTE: records are never reallocated afterwards so pointers to them remain valid
+  m_records.resize(Math::Max(recordsCount, 2U));
+
+  m_currentRecord = &m_records[m_currentIndex];
+  clearCurrentRecord();
 
   // connect
   ege_connect(app->graphics(), renderStart, this, RenderSystemStatistics::onRenderStart);
@@ -53,16 +89,32 @@ RenderSystemStatistics::RenderSystemStatistics(Application* app, const String& l
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 RenderSystemStatistics::~RenderSystemStatistics()
 {
+  ege_disconnect(app()->graphics(), renderStart, this, RenderSystemStatistics::onRenderStart);
+  ege_disconnect(app()->graphics(), renderEnd, this, RenderSystemStatistics::onRenderEnd);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 RenderSystemFrameStatisticData& RenderSystemStatistics::currentRecord()
 {
-  return m_records[m_currentIndex];
+  return *m_currentRecord;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 const RenderSystemFrameStatisticData& RenderSystemStatistics::lastRecord() const
 {
-  const s32 index = (0 == m_currentIndex) ? static_cast<s32>(m_records.size() - 1) : static_cast<s32>(m_currentIndex);
+  return record(0);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 RenderSystemStatistics::recordsCount() const
+{
+  return Math::Min(m_framesCount, static_cast<u32>(m_records.size() - 1));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const RenderSystemFrameStatisticData& RenderSystemStatistics::record(u32 age) const
+{
+  EGE_ASSERT(age < m_records.size());
+
+  const s32 count = static_cast<s32>(m_records.size());
+  const s32 index = (m_currentIndex - static_cast<s32>(age % m_records.size()) - 1 + count) % count;
+
   return m_records[index];
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -71,16 +123,24 @@ const RenderSystemContinuousStatisticData& RenderSystemStatistics::continuousDat
   return m_continuousData;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemStatistics::setComponentNamesSamplingInterval(u32 interval)
+{
+  m_componentNamesSamplingInterval = interval;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystemStatistics::onRenderStart()
 {
   // clean up data
   clearCurrentRecord();
 
+  // determine if component names are to be captured in this frame
+  m_captureComponentNames = (0 < m_componentNamesSamplingInterval) && (0 == (m_framesCount % m_componentNamesSamplingInterval));
+
   // store render start time
-  currentRecord().renderDuration = Timer::GetMicroseconds();
+  m_currentRecord->renderDuration = Timer::GetMicroseconds();
 
   // check if 1 second hasnt passed yet
-  if (1000000LL > (currentRecord().renderDuration - m_fpsStartTimeStamp))
+  if (1000000LL > (m_currentRecord->renderDuration - m_fpsStartTimeStamp))
   {
     // new render
     ++m_fpsRendersCount;
@@ -94,17 +154,20 @@ void RenderSystemStatistics::onRenderStart()
     m_fpsRendersCount = 0;
 
     // reset time stamp
-    m_fpsStartTimeStamp = currentRecord().renderDuration;
+    m_fpsStartTimeStamp = m_currentRecord->renderDuration;
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystemStatistics::onRenderEnd()
 {
   // calculate render time
-  currentRecord().renderDuration = Timer::GetMicroseconds() - currentRecord().renderDuration;
+  m_currentRecord->renderDuration = Timer::GetMicroseconds() - m_currentRecord->renderDuration;
 
-  // move to next index
+  // move to next record
+  ++m_framesCount;
   ++m_currentIndex %= m_records.size();
+
+  m_currentRecord = &m_records[m_currentIndex];
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystemStatistics::dumpDataToFile(bool dumpComponentNames)
@@ -112,31 +175,30 @@ void RenderSystemStatistics::dumpDataToFile(bool dumpComponentNames)
   StringBuffer buffer;
 
   // go thru all records backwards
-  for (s32 i = 0; i < static_cast<s32>(m_records.size()); ++i)
+  for (u32 age = 0; age < recordsCount(); ++age)
   {
-    const s32 index = (0 <= (m_currentIndex - i - 1)) ? (m_currentIndex - i - 1) : (static_cast<s32>(m_records.size()) + m_currentIndex - i - 1);
-
-    const RenderSystemFrameStatisticData& data = m_records[index];
+    const RenderSystemFrameStatisticData& data = record(age);
 
     buffer << "-- START RECORD\n";
+    buffer << "Frame            : " << data.frameIndex << "\n";
     buffer << "Render time      : " << data.renderDuration << " msec\n";
     buffer << "DrawElementsCalls: " << data.drawElementsCalls << "\n";
     buffer << "DrawArraysCalls  : " << data.drawArraysCalls << "\n";
     buffer << "Batch Count      : " << data.batchCount << "\n";
     buffer << "Vertex Count     : " << data.vertexCount << "\n";
 
-    buffer << "Render queues: " << static_cast<s32>(data.queues.size()) << "\n";
-    for (DynamicArray<RenderSystemRenderQueueData>::const_iterator it = data.queues.begin(); it != data.queues.end(); ++it)
+    buffer << "Render queues: " << data.queueCount << "\n";
+    for (u32 i = 0; i < data.queueCount; ++i)
     {
-      const RenderSystemRenderQueueData& queueData = *it;
+      const RenderSystemRenderQueueData& queueData = data.queues[i];
 
-      buffer << " Hash: "<< queueData.hash << " Priority: " << queueData.priority << " Primitive: " << PrimitiveTypeName(queueData.primitiveType) 
-             << " Batch Count: " << queueData.batchCount << " Indexed Batch Count: " << queueData.indexedBatchCount << " Vertex Count: " 
+      buffer << " Hash: "<< queueData.hash << " Priority: " << queueData.priority << " Primitive: " << PrimitiveTypeName(queueData.primitiveType)
+             << " Batch Count: " << queueData.batchCount << " Indexed Batch Count: " << queueData.indexedBatchCount << " Vertex Count: "
              << queueData.vertexCount << "\n";
-      
-      for (StringList::const_iterator itName = queueData.componentNames.begin(); dumpComponentNames && (itName != queueData.componentNames.end()); ++itName)
+
+      for (u32 j = 0; dumpComponentNames && (j < queueData.componentNameCount); ++j)
       {
-        buffer << "   " << *itName << "\n";
+        buffer << "   " << data.componentNames[queueData.firstComponentName + j] << "\n";
       }
     }
 
@@ -152,20 +214,123 @@ void RenderSystemStatistics::dumpDataToFile(bool dumpComponentNames)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+String RenderSystemStatistics::exportData(ExportFormat format) const
+{
+  StringBuffer buffer;
+
+  const u32 count = recordsCount();
+
+  switch (format)
+  {
+    case FORMAT_CSV:
+
+      buffer << "frame,renderDuration,drawElementsCalls,drawArraysCalls,batchCount,vertexCount,queueCount\n";
+
+      // go thru all records, oldest first
+      for (s32 age = static_cast<s32>(count) - 1; 0 <= age; --age)
+      {
+        const RenderSystemFrameStatisticData& data = record(static_cast<u32>(age));
+
+        buffer << data.frameIndex << "," << data.renderDuration << "," << data.drawElementsCalls << "," << data.drawArraysCalls << ","
+               << data.batchCount << "," << data.vertexCount << "," << data.queueCount << "\n";
+      }
+      break;
+
+    case FORMAT_JSON:
+
+      buffer << "[";
+
+      // go thru all records, oldest first
+      for (s32 age = static_cast<s32>(count) - 1; 0 <= age; --age)
+      {
+        const RenderSystemFrameStatisticData& data = record(static_cast<u32>(age));
+
+        buffer << ((static_cast<s32>(count) - 1 == age) ? "\n" : ",\n");
+        buffer << "  {\"frame\": " << data.frameIndex << ", \"renderDuration\": " << data.renderDuration << ", \"drawElementsCalls\": "
+               << data.drawElementsCalls << ", \"drawArraysCalls\": " << data.drawArraysCalls << ", \"batchCount\": " << data.batchCount
+               << ", \"vertexCount\": " << data.vertexCount << ", \"queues\": [";
+
+        for (u32 i = 0; i < data.queueCount; ++i)
+        {
+          const RenderSystemRenderQueueData& queueData = data.queues[i];
+
+          buffer << ((0 == i) ? "" : ", ");
+          buffer << "{\"hash\": " << queueData.hash << ", \"priority\": " << queueData.priority << ", \"primitive\": \""
+                 << PrimitiveTypeName(queueData.primitiveType) << "\", \"batchCount\": " << queueData.batchCount << ", \"indexedBatchCount\": "
+                 << queueData.indexedBatchCount << ", \"vertexCount\": " << queueData.vertexCount;
+
+          // check if any names captured
+          if (0 < queueData.componentNameCount)
+          {
+            buffer << ", \"components\": [";
+            for (u32 j = 0; j < queueData.componentNameCount; ++j)
+            {
+              buffer << ((0 == j) ? "\"" : ", \"") << EscapeJSON(data.componentNames[queueData.firstComponentName + j]) << "\"";
+            }
+            buffer << "]";
+          }
+
+          buffer << "}";
+        }
+
+        buffer << "]}";
+      }
+
+      buffer << "\n]\n";
+      break;
+
+    default:
+
+      EGE_ASSERT_X(false, "Unsupported export format!");
+      break;
+  }
+
+  return buffer.string();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult RenderSystemStatistics::exportData(const String& fileName, ExportFormat format) const
+{
+  const String data = exportData(format);
+  const s64 length = static_cast<s64>(data.length());
+
+  // write to file
+  File file(fileName);
+  EGEResult result = file.open(EGEFile::MODE_WRITE_ONLY);
+  if (EGE_SUCCESS == result)
+  {
+    DataBuffer dataBuffer(data.toAscii(), length);
+    if (length != file.write(dataBuffer))
+    {
+      // error!
+      result = EGE_ERROR_IO;
+    }
+  }
+
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystemStatistics::clearCurrentRecord()
 {
-  RenderSystemFrameStatisticData& record = currentRecord();
+  RenderSystemFrameStatisticData& record = *m_currentRecord;
 
+  record.frameIndex        = m_framesCount;
   record.drawElementsCalls = 0;
   record.drawArraysCalls   = 0;
   record.renderDuration    = 0;
   record.batchCount        = 0;
   record.vertexCount       = 0;
+  record.queueCount        = 0;
 
-  const s32 KRenderQueuesReservedItemCount = 200;
-  EGE_ASSERT_X(KRenderQueuesReservedItemCount >= record.queues.size(), "Increase reserve value!");
+  // NOTE: until first render queue begins, batches are accounted to first entry which is not reported
+  m_currentQueue = &record.queues[0];
+  EGE_MEMSET(m_currentQueue, 0, sizeof (RenderSystemRenderQueueData));
 
-  record.queues.clear();
-  record.queues.reserve(KRenderQueuesReservedItemCount);
+  record.componentNames.clear();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemStatistics::captureComponentName(const RenderComponent* component)
+{
+  m_currentRecord->componentNames.push_back(component->name());
+  m_currentQueue->componentNameCount++;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1,19 +1,33 @@
 #ifndef EGE_CORE_GRAPHICS_RENDER_RENDERSYSTEMSTATISTICS_H
 #define EGE_CORE_GRAPHICS_RENDER_RENDERSYSTEMSTATISTICS_H
 
-/*! Render system statistics component. 
+/*! Render system statistics component.
  *  This object is used for gathering debug and performance information about rendering subsystem.
+ *  All data is gathered into fixed-size per-frame records kept in a ring buffer. Render systems update the current record thru the pointer they obtain
+ *  once, during construction, and only via EGE_RENDER_STATISTICS macro. Thus, when EGE_FEATURE_RENDER_STATISTICS is not defined, statistics
+ *  are compiled out completely.
  */
 
 #include "EGE.h"
 #include "EGETime.h"
 #include "EGEComponent.h"
 #include "EGEDynamicArray.h"
-#include "EGEStringList.h"
+#include "EGEStringArray.h"
 #include "EGESignal.h"
 
 EGE_NAMESPACE_BEGIN
 
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+#ifdef EGE_FEATURE_RENDER_STATISTICS
+  #define EGE_RENDER_STATISTICS(statement) statement
+#else
+  #define EGE_RENDER_STATISTICS(statement)
+#endif // EGE_FEATURE_RENDER_STATISTICS
+
+/*! Maximal number of render queues tracked individually within single frame. */
+#define EGE_RENDER_SYSTEM_STATISTICS_MAX_QUEUES 256
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class RenderComponent;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 /*! Render queue data struct. */
 struct RenderSystemRenderQueueData
@@ -24,7 +38,8 @@ struct RenderSystemRenderQueueData
   u32 batchCount;             /*!< Number of seperate render queues bound to this hash value. */
   u32 vertexCount;            /*!< Number of vertices rendered by all rendered queues bound to this hash value. */
   u32 indexedBatchCount;      /*!< Number of indexed batches only. */
-  StringList componentNames;  /*!< Names of components which are the part of this render queue. */
+  u32 firstComponentName;     /*!< Index of the first component name (in frame record) belonging to this render queue. */
+  u32 componentNameCount;     /*!< Number of component names captured for this render queue. */
 };
 
 /*! Statistics data structure for a single frame. */
@@ -32,7 +47,9 @@ struct RenderSystemFrameStatisticData
 {
  // u32 m_VBOBufferDataCalls;     /*!< Number of glBufferData calls in current frame. */
  // u32 m_VBOBufferSubDataCalls;  /*!< Number of glBufferSubData calls in current frame. */
-  
+
+  u32 frameIndex;                                     /*!< Frame number (counted since statistics creation). */
+
   u32 drawElementsCalls;                              /*!< Number of glDrawElements calls in current frame. */
   u32 drawArraysCalls;                                /*!< Number of glDrawArrays calls in current frame. */
 
@@ -41,7 +58,10 @@ struct RenderSystemFrameStatisticData
   u32 batchCount;                                     /*!< Number of batches rendered. */
   u32 vertexCount;                                    /*!< Number of vertices rendered. */
 
-  DynamicArray<RenderSystemRenderQueueData> queues;   /*!< Render queues data. */
+  u32 queueCount;                                     /*!< Number of valid entries in render queues data array. */
+  RenderSystemRenderQueueData queues[EGE_RENDER_SYSTEM_STATISTICS_MAX_QUEUES];  /*!< Render queues data. */
+
+  StringArray componentNames;                         /*!< Names of rendered components. Only filled in for sampled frames. */
 };
 
 /*! Statistics data structure for time-continuous quantities. */
@@ -59,14 +79,54 @@ class RenderSystemStatistics : public Component
     RenderSystemStatistics(Application* app, const String& logFileName = "ege-rs-stats.log", u32 recordsCount = 10);
    ~RenderSystemStatistics();
 
+  public:
+
+    /*! Available export formats. */
+    enum ExportFormat
+    {
+      FORMAT_CSV = 0,       /*!< Comma separated values. One line per frame. Render queues and component names are not exported. */
+      FORMAT_JSON           /*!< JSON array of frame objects. */
+    };
+
+  public:
+
     /*! Returns current data record. */
     RenderSystemFrameStatisticData& currentRecord();
     /*! Returns last data record. */
     const RenderSystemFrameStatisticData& lastRecord() const;
+    /*! Returns number of completed records available. */
+    u32 recordsCount() const;
+    /*! Returns completed record of a given age.
+     *  @param  age Age of the record. 0 refers to last completed frame.
+     *  @note Age should be less than recordsCount().
+     */
+    const RenderSystemFrameStatisticData& record(u32 age) const;
     /*! Returns time-continuous statistics data structure. */
-    const RenderSystemContinuousStatisticData& continuousData() const; 
+    const RenderSystemContinuousStatisticData& continuousData() const;
     /*! Dumps records to file. */
     void dumpDataToFile(bool dumpComponentNames = true);
+    /*! Exports all completed records, oldest first, into string of a given format. */
+    String exportData(ExportFormat format) const;
+    /*! Exports all completed records, oldest first, into file of a given format.
+     *  @param  fileName  Name of the file to write to. Any existing file is overwritten.
+     *  @param  format    Export format.
+     */
+    EGEResult exportData(const String& fileName, ExportFormat format) const;
+
+    /*! Sets component names sampling interval.
+     *  @param  interval  Every interval-th frame will capture names of rendered components. 0 disables capturing.
+     *  @note Capturing names requires string copying for every rendered component and should be used sparingly.
+     */
+    void setComponentNamesSamplingInterval(u32 interval);
+
+    /*! Marks beginning of the render queue of a given hash. All subsequent batches will be accounted to it. */
+    inline void beginRenderQueue(u32 hash);
+    /*! Accounts rendered batch to current record and render queue.
+     *  @param  component   Component being rendered.
+     *  @param  vertexCount Number of vertices (or indicies) rendered.
+     *  @param  indexed     TRUE if batch is rendered with indicies.
+     */
+    inline void addBatch(const RenderComponent* component, u32 vertexCount, bool indexed);
 
   private slots:
 
@@ -79,6 +139,8 @@ class RenderSystemStatistics : public Component
 
     /*! Clears current record data. */
     void clearCurrentRecord();
+    /*! Captures name of a given component into current record. */
+    void captureComponentName(const RenderComponent* component);
 
   private:
 
@@ -86,20 +148,77 @@ class RenderSystemStatistics : public Component
     DynamicArray<RenderSystemFrameStatisticData> m_records;
     /*! Current record index. */
     s32 m_currentIndex;
+    /*! Current record. */
+    RenderSystemFrameStatisticData* m_currentRecord;
+    /*! Current render queue data within current record. */
+    RenderSystemRenderQueueData* m_currentQueue;
+    /*! Number of frames completed so far. */
+    u32 m_framesCount;
+    /*! Component names sampling interval. 0 if disabled. */
+    u32 m_componentNamesSamplingInterval;
+    /*! TRUE if current frame captures component names. */
+    bool m_captureComponentNames;
     /*! Log file name. */
     String m_logFileName;
     /*! Time-continuous statistic data structure. */
     RenderSystemContinuousStatisticData m_continuousData;
-    /*! Number of frames rendered so far within current FPS interval. 
+    /*! Number of frames rendered so far within current FPS interval.
      *  @note This helper variable to calculate FPS over 1-second intervals.
      */
     s32 m_fpsRendersCount;
-    /*! Current FPS interval start time-stamp. 
+    /*! Current FPS interval start time-stamp.
      *  @note This helper variable to calculate FPS over 1-second intervals.
      */
     s64 m_fpsStartTimeStamp;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline void RenderSystemStatistics::beginRenderQueue(u32 hash)
+{
+  RenderSystemFrameStatisticData& record = *m_currentRecord;
+
+  // check if there is no space left
+  // NOTE: in such case, remaining render queues are aggregated into the last one
+  EGE_ASSERT_X(EGE_RENDER_SYSTEM_STATISTICS_MAX_QUEUES > record.queueCount, "Increase EGE_RENDER_SYSTEM_STATISTICS_MAX_QUEUES value!");
+  if (EGE_RENDER_SYSTEM_STATISTICS_MAX_QUEUES > record.queueCount)
+  {
+    m_currentQueue = &record.queues[record.queueCount++];
+
+    m_currentQueue->hash               = hash;
+    m_currentQueue->primitiveType      = hash & 0xff;
+    m_currentQueue->priority           = hash >> 8;
+    m_currentQueue->batchCount         = 0;
+    m_currentQueue->vertexCount        = 0;
+    m_currentQueue->indexedBatchCount  = 0;
+    m_currentQueue->firstComponentName = static_cast<u32>(record.componentNames.size());
+    m_currentQueue->componentNameCount = 0;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline void RenderSystemStatistics::addBatch(const RenderComponent* component, u32 vertexCount, bool indexed)
+{
+  m_currentRecord->vertexCount += vertexCount;
+  m_currentRecord->batchCount++;
+
+  if (indexed)
+  {
+    m_currentRecord->drawElementsCalls++;
+    m_currentQueue->indexedBatchCount++;
+  }
+  else
+  {
+    m_currentRecord->drawArraysCalls++;
+  }
+
+  m_currentQueue->batchCount++;
+  m_currentQueue->vertexCount += vertexCount;
+
+  // check if names are to be captured
+  if (m_captureComponentNames)
+  {
+    captureComponentName(component);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
 
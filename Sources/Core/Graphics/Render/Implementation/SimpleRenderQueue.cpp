@@ -1,4 +1,5 @@
 #include "Core/Graphics/Render/Implementation/SimpleRenderQueue.h"
+#include "Core/Graphics/Render/Implementation/ComponentRenderer.h"
 
 EGE_NAMESPACE
 
@@ -17,12 +18,9 @@ SimpleRenderQueue::~SimpleRenderQueue()
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGEResult SimpleRenderQueue::addForRendering(const PRenderComponent& component, const Matrix4f& modelMatrix)
 {
-  SRENDERDATA data;
-
-  data.modelMatrix  = modelMatrix;
-  data.component    = component;
-
-  m_renderData.push_back(data);
+  // NOTE: no reference is taken, component must outlive the frame
+  m_components.push_back(component.object());
+  m_modelMatrices.push_back(modelMatrix);
 
   return EGE_SUCCESS;
 }
@@ -35,11 +33,20 @@ EGEResult SimpleRenderQueue::addForRendering(const PRenderQueue& queue)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void SimpleRenderQueue::clear()
 {
-  m_renderData.clear();
+  // NOTE: memory is retained for next frame
+  m_components.clear();
+  m_modelMatrices.clear();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void SimpleRenderQueue::prepareRenderList(RenderDataList& list)
+void SimpleRenderQueue::render(IComponentRenderer& renderer)
 {
-  list = m_renderData;
+  EGE_ASSERT(m_components.size() == m_modelMatrices.size());
+
+  const u32 count = static_cast<u32>(m_components.size());
+  for (u32 i = 0; i < count; ++i)
+  {
+    // NOTE: wrap without taking ownership so no reference counting takes place
+    renderer.renderComponent(PRenderComponent(*m_components[i]), m_modelMatrices[i]);
+  }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
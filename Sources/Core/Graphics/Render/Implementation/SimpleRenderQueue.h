@@ -4,6 +4,7 @@
 #include "EGE.h"
 #include "EGERenderComponent.h"
 #include "EGEMatrix.h"
+#include "EGEDynamicArray.h"
 #include "Core/Graphics/Render/Interface/RenderQueue.h"
 
 EGE_NAMESPACE_BEGIN
@@ -11,6 +12,10 @@ EGE_NAMESPACE_BEGIN
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class Application;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Render queue rendering components in order of submission.
+ *  Submitted data is stored in contiguous arrays which are reused from frame to frame. Components are held by raw pointers so no reference counting
+ *  takes place neither on submission nor during rendering. Thus, submitted components must stay valid until queue is cleared.
+ */
 class SimpleRenderQueue : public RenderQueue
 {
   public:
@@ -29,13 +34,17 @@ class SimpleRenderQueue : public RenderQueue
     EGEResult addForRendering(const PRenderQueue& queue) override;
     /*! @see RenderQueue::clear. */
     void clear() override;
-    /*! @see RenderQueue::prepareRenderList. */
-    void prepareRenderList(RenderDataList& list) override;
+    /*! @see RenderQueue::render. */
+    void render(IComponentRenderer& renderer) override;
 
   private:
 
-    /*! Render data. */
-    RenderDataList m_renderData;
+    /*! Components to render. */
+    DynamicArray<RenderComponent*> m_components;
+    /*! Model matrices of components to render. 
+     *  @note Kept in parallel to components array so matrices are tightly packed.
+     */
+    DynamicArray<Matrix4f> m_modelMatrices;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
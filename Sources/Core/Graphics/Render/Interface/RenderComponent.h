@@ -14,6 +14,7 @@ EGE_DECLARE_SMART_CLASS(RenderComponent, PRenderComponent)
 EGE_DECLARE_SMART_CLASS(Material, PMaterial)
 EGE_DECLARE_SMART_CLASS(VertexBuffer, PVertexBuffer)
 EGE_DECLARE_SMART_CLASS(IndexBuffer, PIndexBuffer)
+EGE_DECLARE_SMART_CLASS(RenderPass, PRenderPass)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class RenderComponent : public Component
 {
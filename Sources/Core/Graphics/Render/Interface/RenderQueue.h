@@ -46,30 +46,15 @@ class RenderQueue : public Object
      */
     void setPriority(u32 priority);
     
-    /*! Renders queue. */
-    void render(IComponentRenderer& renderer);
+    /*! Renders queue. 
+     *  @param  renderer  Renderer to render queue content with.
+     *  @note Content is rendered in place. Queue content remains unchanged until cleared.
+     */
+    virtual void render(IComponentRenderer& renderer) = 0;
 
     /*! Returns render primitve type. */
     EGEGraphics::RenderPrimitiveType primitiveType() const;
 
-  protected:
-
-    /*! Render data structure. */
-    struct SRENDERDATA
-    {
-      PRenderComponent component;   /*< Render component. */
-      Matrix4f modelMatrix;         /*< Model transformation matrix. */
-    };
-
-    typedef List<SRENDERDATA> RenderDataList;
-
-  private:
-
-    /*! Prepares render list for rendering. 
-     *  @param  list  List to fill in with render data.
-     */
-    virtual void prepareRenderList(RenderDataList& list) = 0;
-
   private:
 
     /*! Render priority. */
@@ -23,6 +23,7 @@ class IRenderer
      *  @param  component   Render component which is to be added for rendering.
      *  @param  worldMatrix Model view to world transformation matrix.
      *  @return EGE_SUCCESS on success. EGE_ERROR_NOT_SUPPORTED if component has not been accepted by renderer. Otherwise, EGE_ERROR.
+     *  @note Component is not retained by renderer. Caller is responsible for keeping it alive until frame is rendered.
      */
     virtual EGEResult addForRendering(const PRenderComponent& component, const Matrix4f& worldMatrix = Matrix4f::IDENTITY) = 0;
     /*! Adds given render queue for rendering. 
@@ -22,18 +22,6 @@ EGE_NAMESPACE
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 static const char* KRenderSystemDebugName = "EGERenderSystem";
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-/*! Function calculating render queues hash.
- *  @param  priority      Priority of render component.
- *  @param  primitiveType Primitive type to be rendered.
- *  @return Calculated hash value.
- */
-u32 CalculateRenderQueueHash(u32 priority, EGEGraphics::RenderPrimitiveType primitiveType)
-{
-  // NOTE: priority is stored in upper 24 bits while primitive is stored in least significant 8 bits.
-  //       Due to such composition priority is always leading as rendering is supposed to following priority settings.
-  return (priority << 8) | primitiveType;
-}
-//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGE_DEFINE_NEW_OPERATORS(RenderSystem)
 EGE_DEFINE_DELETE_OPERATORS(RenderSystem)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -44,6 +32,7 @@ RenderSystem::RenderSystem(Application* app) : Object(app)
                                              , m_textureAddressingModeS(AM_CLAMP)
                                              , m_textureAddressingModeT(AM_CLAMP)
                                              , m_textureMipMapping(false)
+                                             , m_statistics(NULL)
 {
 }
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -63,19 +52,23 @@ EGEResult RenderSystem::construct()
   }
 
   // subscribe for event notifications
-  if ( ! app()->eventManager()->addListener(this))
+  if ( ! app()->eventManager()->addListener(this, EGE_EVENT_ID_CORE_QUIT_REQUEST))
   {
     // error!
     egeCritical(KRenderSystemDebugName) << EGE_FUNC_INFO << "Could not register for notifications!";
     return EGE_ERROR;
   }
 
+#ifdef EGE_FEATURE_RENDER_STATISTICS
   // add render system statistics component
-  if (EGE_SUCCESS != addComponent(ege_new RenderSystemStatistics(app())))
+  m_statistics = ege_new RenderSystemStatistics(app());
+  if ((NULL == m_statistics) || (EGE_SUCCESS != addComponent(m_statistics)))
   {
     // error!
+    m_statistics = NULL;
     return EGE_ERROR_NO_MEMORY;
   }
+#endif // EGE_FEATURE_RENDER_STATISTICS
 
   // set state
   m_state = STATE_READY;
@@ -217,69 +210,58 @@ EGEResult RenderSystem::addForRendering(const PRenderComponent& component, const
   // check if component is meaningful
   if ((0 < component->vertexBuffer()->vertexCount()) && (NULL != component->material()))
   {
-    // calculate hash
+    // find bucket
     // NOTE: at this stage components are separated into unique priorities and primitive types
-    u32 hash = CalculateRenderQueueHash(component->priority(), component->primitiveType());
+    RenderQueueBucket& bucket = m_renderQueues.bucket(component->priority(), component->primitiveType());
 
-    // check if proper queue exists already
-    bool renderQueueForHashPresent = m_renderQueues.contains(hash);
-    if (renderQueueForHashPresent)
+    // batch only really small buffers
+    // NOTE: batching enabled only for non-VBO rendering due to issues with updating batch data ie no way to get vertex data from VBO in write-only mode
+    if ((10 > component->vertexBuffer()->vertexCount()) && 
+        ! Device::HasRenderCapability(ERenderCapabilityVertexBufferObjects) && 
+        RenderQueue::IsSuitable(EGE_OBJECT_UID_BACTHED_RENDER_QUEUE, component))
     {
-      List<PRenderQueue>& queueList = m_renderQueues.at(hash);
+      const u32 key = RenderQueueBucketTable::CalculateBatchKey(component);
+
+      // try to add to batched queues bound to the key
+      // NOTE: usually there is only one, more are chained only if components of the same key cannot be batched together ie due to clipping
+      for (s32 queueIndex = m_renderQueues.batchQueueIndex(bucket, key); (0 <= queueIndex) && (EGE_ERROR_NOT_SUPPORTED == result);
+           queueIndex = bucket.nextQueueIndicies[queueIndex])
+      {
+        result = bucket.queues[queueIndex]->addForRendering(component, worldMatrix);
+      }
 
-      // try to add to one of the existing render queues
-      for (List<PRenderQueue>::iterator it = queueList.begin(); it != queueList.end(); ++it)
+      // check if no suitable queue has been found (but no error occured)
+      if (EGE_ERROR_NOT_SUPPORTED == result)
       {
-        PRenderQueue& queue = *it;
+        PRenderQueue queue = RenderQueueFactory::Create(app(), EGE_OBJECT_UID_BACTHED_RENDER_QUEUE, component->priority(), component->primitiveType());
+        if (NULL != queue)
+        {
+          result = queue->addForRendering(component, worldMatrix);
+        }
 
-        // add data into queue
-        result = queue->addForRendering(component, worldMatrix);
-        if (EGE_ERROR_NOT_SUPPORTED != result)
+        // add it into pool if ok
+        if (EGE_SUCCESS == result)
         {
-          // done
-          break;
+          m_renderQueues.setBatchQueueIndex(bucket, key, m_renderQueues.addQueue(bucket, queue));
         }
       }
     }
-
-    // check if no suitable queue has been found (but no error occured)
-    if (EGE_ERROR_NOT_SUPPORTED == result)
+    else
     {
-      // create appriopriate queue
-      PRenderQueue queue;
-
-      // batch only really small buffers
-      // NOTE: batching enabled only for non-VBO rendering due to issues with updating batch data ie no way to get vertex data from VBO in write-only mode
-      if ((10 > component->vertexBuffer()->vertexCount()) && 
-          ! Device::HasRenderCapability(ERenderCapabilityVertexBufferObjects) && 
-          RenderQueue::IsSuitable(EGE_OBJECT_UID_BACTHED_RENDER_QUEUE, component))
+      // check if no simple queue yet
+      if (0 > bucket.simpleQueueIndex)
       {
-        queue = RenderQueueFactory::Create(app(), EGE_OBJECT_UID_BACTHED_RENDER_QUEUE, component->priority(), component->primitiveType());
-      }
-      else
-      {
-        queue = RenderQueueFactory::Create(app(), EGE_OBJECT_UID_SIMPLE_RENDER_QUEUE, component->priority(), component->primitiveType());
-      }
-
-      // check if properly allocated
-      if (NULL != queue)
-      {
-        // add to newly created queue
-        result = queue->addForRendering(component, worldMatrix);
-      }
-
-      // add it into pool if ok
-      if (EGE_SUCCESS == result)
-      {
-        if (renderQueueForHashPresent)
-        {
-          m_renderQueues.at(hash).push_back(queue);
-        }
-        else
+        PRenderQueue queue = RenderQueueFactory::Create(app(), EGE_OBJECT_UID_SIMPLE_RENDER_QUEUE, component->priority(), component->primitiveType());
+        if (NULL == queue)
         {
-          m_renderQueues.insert(hash, queue);
+          // error!
+          return EGE_ERROR_NO_MEMORY;
         }
+
+        bucket.simpleQueueIndex = m_renderQueues.addQueue(bucket, queue);
       }
+
+      result = bucket.queues[bucket.simpleQueueIndex]->addForRendering(component, worldMatrix);
     }
   }
 
@@ -288,55 +270,18 @@ EGEResult RenderSystem::addForRendering(const PRenderComponent& component, const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGEResult RenderSystem::addForRendering(const PRenderQueue& queue)
 {
-  EGEResult result = EGE_ERROR;
- 
-  // calculate hash
+  // find bucket
   // NOTE: at this stage components are separated into unique priorities and primitive types
-  u32 hash = CalculateRenderQueueHash(queue->priority(), queue->primitiveType());
+  RenderQueueBucket& bucket = m_renderQueues.bucket(queue->priority(), queue->primitiveType());
 
-  // check if some queues exist already
-  bool renderQueueForHashPresent = m_renderQueues.contains(hash);
-  if (renderQueueForHashPresent)
+  // check if not present yet
+  if ( ! bucket.queues.contains(queue))
   {
-    List<PRenderQueue>& queueList = m_renderQueues.at(hash);
-
-    // try to find the same queue
-    for (List<PRenderQueue>::iterator it = queueList.begin(); it != queueList.end(); ++it)
-    {
-      PRenderQueue& curQueue = *it;
-
-      // check if the same
-      if (curQueue == queue)
-      {
-        // substitute
-        curQueue = queue;
-
-        // done
-        result = EGE_SUCCESS;
-        break;
-      }
-    }
-
-    // check if not found yet
-    if (EGE_ERROR == result)
-    {
-      // add to list
-      queueList.push_back(queue);
-
-      // done
-      result = EGE_SUCCESS;
-    }
+    // add to bucket
+    m_renderQueues.addQueue(bucket, queue);
   }
-  else
-  {
-    // insert into pool
-    m_renderQueues.insert(hash, queue);
 
-    // done
-    result = EGE_SUCCESS;
-  }
-
-  return result;
+  return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void RenderSystem::setProjectionMatrix(const Matrix4f& matrix)
@@ -556,9 +501,9 @@ RenderSystem::State RenderSystem::state() const
   return m_state;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void RenderSystem::onEventRecieved(PEvent event)
+void RenderSystem::onEventRecieved(const Event& event)
 {
-  switch (event->id())
+  switch (event.id())
   {
     case EGE_EVENT_ID_CORE_QUIT_REQUEST:
 
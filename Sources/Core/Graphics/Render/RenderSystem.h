@@ -13,6 +13,7 @@
 #include "Core/Graphics/HardwareResourceProvider.h"
 #include "Core/Graphics/Render/Interface/Renderer.h"
 #include "Core/Graphics/Render/Implementation/ComponentRenderer.h"
+#include "Core/Graphics/Render/Implementation/RenderQueueBucketTable.h"
 #include "Core/Event/EventListener.h"
 
 EGE_NAMESPACE_BEGIN
@@ -20,6 +21,7 @@ EGE_NAMESPACE_BEGIN
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class SceneNode;
 class RenderPass;
+class RenderSystemStatistics;
 
 EGE_DECLARE_SMART_CLASS(RenderComponent, PRenderComponent)
 EGE_DECLARE_SMART_CLASS(Viewport, PViewport)
@@ -131,19 +133,14 @@ class RenderSystem : public Object
     /*! Applies generic parameters for component currently being rendered. */
     virtual void applyGeneralParams() = 0;
 
-  protected:
-
-    /*! Map of render queue lists sorted by render priority. */
-    typedef Map<s32, List<PRenderQueue> > RenderQueueMap;
-
   protected:
 
     /*! Projection matrix. */
     Matrix4f m_projectionMatrix;
     /*! View matrix. */
     Matrix4f m_viewMatrix;
-    /*! Map of list of rendering queues sorted by hash value. */
-    RenderQueueMap m_renderQueues;            
+    /*! Table of rendering queues sorted by hash value. */
+    RenderQueueBucketTable m_renderQueues;
     /*! Texture minifying function filter. */
     TextureFilter m_textureMinFilter;
     /*! Texture magnification function filter. */
@@ -154,6 +151,10 @@ class RenderSystem : public Object
     TextureAddressingMode m_textureAddressingModeT;
     /*! Texture mip mapping flag. */
     bool m_textureMipMapping;
+    /*! Render statistics. NULL if EGE_FEATURE_RENDER_STATISTICS is not defined. 
+     *  @note This is a shortcut to one of the components. Should only be accessed via EGE_RENDER_STATISTICS macro.
+     */
+    RenderSystemStatistics* m_statistics;
 
   private:
 
@@ -211,7 +212,7 @@ class RenderSystem : public Object
     bool requestDestroyProgram(PProgram program, const HardwareResourceProviderSlot& slot = HardwareResourceProviderSlot()) override;
 
     /*! @see IEventListener::onEventRecieved. */
-    void onEventRecieved(PEvent event) override;
+    void onEventRecieved(const Event& event) override;
  
   private:
 
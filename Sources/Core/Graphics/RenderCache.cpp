@@ -0,0 +1,196 @@
+#include "Core/Graphics/RenderCache.h"
+#include "Core/Graphics/Graphics.h"
+#include "Core/Graphics/Viewport.h"
+#include "Core/Graphics/Material.h"
+#include "Core/Graphics/Texture2D.h"
+#include "Core/Graphics/TextureImage.h"
+#include "Core/Graphics/RenderObjectFactory.h"
+#include "Core/Graphics/Render/RenderTarget.h"
+#include "Core/Graphics/Render/RenderSystem.h"
+#include "EGEApplication.h"
+#include "EGEMath.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(RenderCache)
+EGE_DEFINE_DELETE_OPERATORS(RenderCache)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of caches created so far. Used to make names of render targets unique. */
+static u32 l_cacheCount = 0;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderCache::RenderCache(Application* app, const String& name) : Object(app),
+                                                                 m_name(String::Format("%s-%u", name.toAscii(), l_cacheCount++)),
+                                                                 m_size(Vector2f::ZERO),
+                                                                 m_frustum(app, Matrix4f::IDENTITY),
+                                                                 m_renderPriority(EGEGraphics::RP_MAIN_OVERLAY),
+                                                                 m_dirty(true)
+{
+  // setup projection
+  // NOTE: this follows the settings commonly used for 2D content
+  m_frustum.setProjectionType(Frustum::ORTHOGRAPHIC);
+  m_frustum.setNearPlaneDistance(-1);
+  m_frustum.setFarPlaneDistance(1);
+
+  ege_connect(app->graphics(), preRender, this, RenderCache::onPreRender);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderCache::~RenderCache()
+{
+  ege_disconnect(app()->graphics(), preRender, this, RenderCache::onPreRender);
+
+  destroyTexture();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult RenderCache::setSize(const Vector2f& size)
+{
+  // determine texture size
+  const s32 width  = Math::Ceil(size.x);
+  const s32 height = Math::Ceil(size.y);
+
+  // check if nothing changes
+  if ((NULL != m_texture) && (width == m_texture->width()) && (height == m_texture->height()))
+  {
+    // done
+    return EGE_SUCCESS;
+  }
+
+  // clean up
+  destroyTexture();
+
+  m_size  = size;
+  m_dirty = true;
+
+  // check if there is nothing to cache
+  if ((0 >= width) || (0 >= height))
+  {
+    // done
+    return EGE_SUCCESS;
+  }
+
+  // create render texture
+  // NOTE: render target is registered with graphics under the same name
+  m_texture = app()->graphics()->hardwareResourceProvider()->createRenderTexture(m_name, width, height, PF_RGBA_8888);
+  if (NULL == m_texture)
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  // create viewport
+  // NOTE: viewport is not added to render target so render target itself renders nothing, all rendering is done in onPreRender
+  m_viewport = ege_new Viewport(app(), m_name, NULL, m_texture->renderTarget());
+  if (NULL == m_viewport)
+  {
+    // error!
+    destroyTexture();
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  m_viewport->setClearBufferTypes(Viewport::BUFFER_TYPE_COLOR);
+  m_viewport->setClearColor(Color(0, 0, 0, 0));
+
+  // create quad
+  m_quad = RenderObjectFactory::CreateQuadXY(app(), m_name, Vector4f::ZERO, Vector2f::ONE, ALIGN_TOP_LEFT, false, false, RenderObjectFactory::VS_V2_T2,
+                                             m_renderPriority, EGEGraphics::RPT_TRIANGLE_STRIPS, NVertexBuffer::UT_STATIC_WRITE);
+  if (NULL == m_quad)
+  {
+    // error!
+    destroyTexture();
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  // create material
+  PMaterial material = ege_new Material(app());
+  if ((NULL == material) || (NULL == material->addPass(NULL)))
+  {
+    // error!
+    destroyTexture();
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  // NOTE: content is rendered into transparent texture so its colors are already multiplied by alpha
+  material->setSrcBlendFactor(EGEGraphics::BF_ONE);
+  material->setDstBlendFactor(EGEGraphics::BF_ONE_MINUS_SRC_ALPHA);
+  material->pass(0)->addTexture(ege_new TextureImage(m_texture));
+
+  m_quad->setMaterial(material);
+
+  // setup projection to cover entire texture
+  m_frustum.setOrthoSettings(Rectf(0, 0, static_cast<float32>(width), static_cast<float32>(height)));
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderCache::setRenderPriority(s32 priority)
+{
+  m_renderPriority = priority;
+
+  if (NULL != m_quad)
+  {
+    m_quad->setPriority(priority);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderCache::invalidate()
+{
+  m_dirty = true;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool RenderCache::isUpToDate() const
+{
+  return !m_dirty && (NULL != m_quad);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderCache::addForRendering(IRenderer* renderer, const Matrix4f& transform)
+{
+  EGE_ASSERT(isUpToDate());
+
+  // NOTE: quad is drawn with 1:1 texel to pixel mapping
+  const Vector4f scale(static_cast<float32>(m_texture->width()), static_cast<float32>(m_texture->height()), 1);
+
+  renderer->addForRendering(m_quad, transform * Math::CreateMatrix(Vector4f::ZERO, scale, Quaternionf::IDENTITY));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderCache::onPreRender(PRenderTarget target)
+{
+  // check if not own target or nothing to render
+  if ((NULL == m_texture) || (target != m_texture->renderTarget()) || !m_dirty)
+  {
+    // do nothing
+    return;
+  }
+
+  RenderSystem* renderSystem = app()->graphics()->renderSystem();
+
+  // setup render system
+  // NOTE: viewport needs to be set first as projection depends on current render target
+  renderSystem->setViewport(m_viewport);
+  renderSystem->setProjectionMatrix(m_frustum.projectionMatrix());
+  renderSystem->setViewMatrix(Matrix4f::IDENTITY);
+
+  // request content
+  emit renderRequested(renderSystem);
+
+  // render
+  renderSystem->clearViewport(m_viewport);
+  renderSystem->flush();
+
+  // validate
+  m_dirty = false;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderCache::destroyTexture()
+{
+  if (NULL != m_texture)
+  {
+    app()->graphics()->removeRenderTarget(m_name);
+  }
+
+  m_quad      = NULL;
+  m_viewport  = NULL;
+  m_texture   = NULL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,109 @@
+#ifndef EGE_CORE_GRAPHICS_RENDERCACHE_H
+#define EGE_CORE_GRAPHICS_RENDERCACHE_H
+
+/** Render cache keeps content rendered once into a render texture so it can later be drawn as a single quad.
+ *  Content is (re)rendered, thru renderRequested signal, just before cache's render texture is processed by the graphics, but only if cache has been
+ *  invalidated since last time. As render textures are processed before any render window, cached content is always up to date by the time it is drawn.
+ *  Cache owner is expected to render content directly, without the cache, for as long as isUpToDate() returns FALSE.
+ *  @note Content is rendered in local space with top-left corner at the origin.
+ *  @note Cache is exact for opaque content only. Translucent content is blended twice so its edges may slightly differ.
+ */
+
+#include "EGE.h"
+#include "EGEString.h"
+#include "EGEVector2.h"
+#include "EGEMatrix.h"
+#include "EGESignal.h"
+#include "EGERenderComponent.h"
+#include "Core/Graphics/Frustum.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class IRenderer;
+EGE_DECLARE_SMART_CLASS(RenderCache, PRenderCache)
+EGE_DECLARE_SMART_CLASS(RenderTarget, PRenderTarget)
+EGE_DECLARE_SMART_CLASS(Viewport, PViewport)
+EGE_DECLARE_SMART_CLASS(Texture2D, PTexture2D)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class RenderCache : public Object
+{
+  public:
+
+    /*! Constructor.
+     *  @param  app   Pointer to application.
+     *  @param  name  Base name of the cache. Unique suffix is appended to it so render targets of different caches do not clash.
+     */
+    RenderCache(Application* app, const String& name);
+   ~RenderCache();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+  public signals:
+
+    /*! Signal emitted when content is to be rendered into cache.
+     *  @param  renderer  Renderer content should be added to.
+     *  @note Content should be added in local space with top-left corner at the origin.
+     */
+    Signal1<IRenderer*> renderRequested;
+
+  public:
+
+    /*! Returns name. */
+    const String& name() const { return m_name; }
+    /*! Sets size of the cached area (in pixels).
+     *  @note Render texture is recreated, and the cache invalidated, if size changes.
+     *  @note Calling thread must be able to issue underlying 3D API commands.
+     */
+    EGEResult setSize(const Vector2f& size);
+    /*! Returns size of the cached area (in pixels). */
+    const Vector2f& size() const { return m_size; }
+    /*! Sets render priority of the quad cached content is drawn with. */
+    void setRenderPriority(s32 priority);
+    /*! Invalidates cache. Content will be rerendered before next frame. */
+    void invalidate();
+    /*! Returns TRUE if cached content can be used. */
+    bool isUpToDate() const;
+    /*! Returns viewport content is rendered into. NULL if not created yet. */
+    PViewport viewport() const { return m_viewport; }
+    /*! Adds cached content for rendering.
+     *  @param  renderer  Renderer to add content to.
+     *  @param  transform Transformation of the top-left corner of the content.
+     */
+    void addForRendering(IRenderer* renderer, const Matrix4f& transform = Matrix4f::IDENTITY);
+
+  private slots:
+
+    /*! Slot called just before given render target is rendered. */
+    void onPreRender(PRenderTarget target);
+
+  private:
+
+    /*! Destroys render texture and associated objects. */
+    void destroyTexture();
+
+  private:
+
+    /*! Name. */
+    String m_name;
+    /*! Size of the cached area (in pixels). */
+    Vector2f m_size;
+    /*! Render texture holding cached content. */
+    PTexture2D m_texture;
+    /*! Viewport covering entire render texture. */
+    PViewport m_viewport;
+    /*! Quad cached content is drawn with. */
+    PRenderComponent m_quad;
+    /*! Orthographic projection used for rendering into texture. */
+    Frustum m_frustum;
+    /*! Render priority of the quad. */
+    s32 m_renderPriority;
+    /*! TRUE if content needs to be rerendered. */
+    bool m_dirty;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_GRAPHICS_RENDERCACHE_H
\ No newline at end of file
@@ -127,20 +127,17 @@ bool RenderObjectFactory::DoCreateQuadXY(PRenderComponent& component, Vector4f p
   //    |      |
   //    *------*
   //   (1)    (2)
-  struct VertexData
-  {
-    Vector3f pos;
-    Vector2f uv;
-  };
-  VertexData vertices[4];
-  vertices[0].pos = Vector3f(position.x, position.y, position.z);
-  vertices[0].uv  = Vector2f(flipU ? 1.0f : 0.0f, flipV ? 1.0f : 0.0f);
-  vertices[1].pos = Vector3f(position.x, position.y + size.y, position.z);
-  vertices[1].uv  = Vector2f(flipU ? 1.0f : 0.0f, flipV ? 0.0f : 1.0f);
-  vertices[2].pos = Vector3f(position.x + size.x, position.y + size.y, position.z);
-  vertices[2].uv  = Vector2f(flipU ? 0.0f : 1.0f, flipV ? 0.0f : 1.0f);
-  vertices[3].pos = Vector3f(position.x + size.x, position.y, position.z);
-  vertices[3].uv  = Vector2f(flipU ? 0.0f : 1.0f, flipV ? 1.0f : 0.0f);
+  // NOTE: positions are given within unit square and are transformed into final ones when written
+  Vector3f positions[4];
+  Vector2f textureCoords[4];
+  positions[0]     = Vector3f(0.0f, 0.0f, 0.0f);
+  textureCoords[0] = Vector2f(flipU ? 1.0f : 0.0f, flipV ? 1.0f : 0.0f);
+  positions[1]     = Vector3f(0.0f, 1.0f, 0.0f);
+  textureCoords[1] = Vector2f(flipU ? 1.0f : 0.0f, flipV ? 0.0f : 1.0f);
+  positions[2]     = Vector3f(1.0f, 1.0f, 0.0f);
+  textureCoords[2] = Vector2f(flipU ? 0.0f : 1.0f, flipV ? 0.0f : 1.0f);
+  positions[3]     = Vector3f(1.0f, 0.0f, 0.0f);
+  textureCoords[3] = Vector2f(flipU ? 0.0f : 1.0f, flipV ? 1.0f : 0.0f);
 
   // determine list of vertices
   IntArray vertexList;
@@ -170,71 +167,10 @@ bool RenderObjectFactory::DoCreateQuadXY(PRenderComponent& component, Vector4f p
       return NULL;
   }
 
-  // resize vertex buffer
-  if ( ! component->vertexBuffer()->setSize(static_cast<u32>(vertexList.size())))
-  {
-    // error!
-    return false;
-  }
-
-  // lock vertex buffer
-  float32* data = reinterpret_cast<float32*>(component->vertexBuffer()->lock(0, static_cast<u32>(vertexList.size())));
-  if (NULL == data)
-  {
-    // error!
-    return false;
-  }
-
-  // go thru all vertices
-  for (IntArray::const_iterator it = vertexList.begin(); it != vertexList.end(); ++it)
-  {
-    const VertexData& vertex = vertices[*it];
-
-    // go thru all vertex arrays one by one
-    const VertexElementArray& vertexElements = component->vertexBuffer()->vertexDeclaration().vertexElements();
-    for (VertexElementArray::const_iterator it = vertexElements.begin(); it != vertexElements.end(); ++it)
-    {
-      switch (it->semantic())
-      {
-        case NVertexBuffer::VES_POSITION_XYZ:
-
-          *data++ = vertex.pos.x;
-          *data++ = vertex.pos.y;
-          *data++ = vertex.pos.z;
-          break;
-
-        case NVertexBuffer::VES_POSITION_XY:
-
-          *data++ = vertex.pos.x;
-          *data++ = vertex.pos.y;
-          break;
-
-        case NVertexBuffer::VES_TEXTURE_UV:
-
-          *data++ = vertex.uv.x;
-          *data++ = vertex.uv.y;
-          break;
-
-        case NVertexBuffer::VES_COLOR_RGBA:
-
-          *data++ = 1.0f;
-          *data++ = 1.0f;
-          *data++ = 1.0f;
-          *data++ = 1.0f;
-          break;
+  // scale unit square into final size and place it at final position
+  const Matrix4f transform(size.x, 0, 0, 0, 0, size.y, 0, 0, 0, 0, 1, 0, position.x, position.y, position.z, 1);
 
-        default:
-
-          EGE_ASSERT_X(false, "Not supported!");
-          return NULL;
-      }
-    }
-  }
-
-  // unlock vertex buffer
-  component->vertexBuffer()->unlock(data - 1);
-
-  return true;
+  return WriteVertices(component, positions, textureCoords, vertexList, transform);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool RenderObjectFactory::DoCreateQuatroQuadXY(PRenderComponent& component, Vector4f position, Vector2f size, Alignment origin, 
@@ -281,31 +217,28 @@ bool RenderObjectFactory::DoCreateQuatroQuadXY(PRenderComponent& component, Vect
   //       *------*------*
   //      (6)    (7)    (8) 
 
-  struct VertexData
-  {
-    Vector3f pos;
-    Vector2f uv;
-  };
-  VertexData vertices[9];
-
-  vertices[0].pos = Vector3f(position.x, position.y, position.z);
-  vertices[0].uv  = Vector2f(flipU ? 1.0f : 0.0f, flipV ? 1.0f : 0.0f);
-  vertices[1].pos = Vector3f(position.x, position.y + size.y * 0.5f, position.z);
-  vertices[1].uv  = Vector2f(flipU ? 1.0f : 0.0f, flipV ? 0.0f : 1.0f);
-  vertices[2].pos = Vector3f(position.x + size.x * 0.5f, position.y + size.y * 0.5f, position.z);
-  vertices[2].uv  = Vector2f(flipU ? 0.0f : 1.0f, flipV ? 0.0f : 1.0f);
-  vertices[3].pos = Vector3f(position.x + size.x * 0.5f, position.y, position.z);
-  vertices[3].uv  = Vector2f(flipU ? 0.0f : 1.0f, flipV ? 1.0f : 0.0f);
-  vertices[4].pos = Vector3f(position.x + size.x, position.y + size.y * 0.5f, position.z);
-  vertices[4].uv  = vertices[1].uv;
-  vertices[5].pos = Vector3f(position.x + size.x, position.y, position.z);
-  vertices[5].uv  = vertices[0].uv;
-  vertices[6].pos = Vector3f(position.x, position.y + size.y, position.z);
-  vertices[6].uv  = vertices[0].uv;
-  vertices[7].pos = Vector3f(position.x + size.x * 0.5f, position.y + size.y, position.z);
-  vertices[7].uv  = vertices[3].uv;
-  vertices[8].pos = Vector3f(position.x + size.x, position.y + size.y, position.z);
-  vertices[8].uv  = vertices[0].uv;
+  // NOTE: positions are given within unit square and are transformed into final ones when written
+  Vector3f positions[9];
+  Vector2f textureCoords[9];
+
+  positions[0]     = Vector3f(0.0f, 0.0f, 0.0f);
+  textureCoords[0] = Vector2f(flipU ? 1.0f : 0.0f, flipV ? 1.0f : 0.0f);
+  positions[1]     = Vector3f(0.0f, 0.5f, 0.0f);
+  textureCoords[1] = Vector2f(flipU ? 1.0f : 0.0f, flipV ? 0.0f : 1.0f);
+  positions[2]     = Vector3f(0.5f, 0.5f, 0.0f);
+  textureCoords[2] = Vector2f(flipU ? 0.0f : 1.0f, flipV ? 0.0f : 1.0f);
+  positions[3]     = Vector3f(0.5f, 0.0f, 0.0f);
+  textureCoords[3] = Vector2f(flipU ? 0.0f : 1.0f, flipV ? 1.0f : 0.0f);
+  positions[4]     = Vector3f(1.0f, 0.5f, 0.0f);
+  textureCoords[4] = textureCoords[1];
+  positions[5]     = Vector3f(1.0f, 0.0f, 0.0f);
+  textureCoords[5] = textureCoords[0];
+  positions[6]     = Vector3f(0.0f, 1.0f, 0.0f);
+  textureCoords[6] = textureCoords[0];
+  positions[7]     = Vector3f(0.5f, 1.0f, 0.0f);
+  textureCoords[7] = textureCoords[3];
+  positions[8]     = Vector3f(1.0f, 1.0f, 0.0f);
+  textureCoords[8] = textureCoords[0];
 
   // determine list of vertices
   IntArray vertexList;
@@ -371,69 +304,92 @@ bool RenderObjectFactory::DoCreateQuatroQuadXY(PRenderComponent& component, Vect
       return NULL;
   }
 
+  // scale unit square into final size and place it at final position
+  const Matrix4f transform(size.x, 0, 0, 0, 0, size.y, 0, 0, 0, 0, 1, 0, position.x, position.y, position.z, 1);
+
+  return WriteVertices(component, positions, textureCoords, vertexList, transform);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool RenderObjectFactory::WriteVertices(PRenderComponent& component, const Vector3f* positions, const Vector2f* textureCoords, const IntArray& vertexList, 
+                                        const Matrix4f& transform)
+{
+  const u32 count = static_cast<u32>(vertexList.size());
+
   // resize vertex buffer
-  if ( ! component->vertexBuffer()->setSize(static_cast<u32>(vertexList.size())))
+  if ( ! component->vertexBuffer()->setSize(count))
   {
     // error!
     return false;
   }
 
   // lock vertex buffer
-  float32* data = reinterpret_cast<float32*>(component->vertexBuffer()->lock(0, static_cast<u32>(vertexList.size())));
+  u8* data = reinterpret_cast<u8*>(component->vertexBuffer()->lock(0, count));
   if (NULL == data)
   {
     // error!
     return false;
   }
 
-  // go thru all vertices
+  const VertexDeclaration& vertexDeclaration = component->vertexBuffer()->vertexDeclaration();
+  const u32 vertexSize = vertexDeclaration.vertexSize();
+
+  // gather positions in order of vertices
+  DynamicArray<Vector3f> points;
   for (IntArray::const_iterator it = vertexList.begin(); it != vertexList.end(); ++it)
   {
-    const VertexData& vertex = vertices[*it];
+    points.push_back(positions[*it]);
+  }
+
+  // go thru all vertex arrays one by one
+  const VertexElementArray& vertexElements = vertexDeclaration.vertexElements();
+  for (VertexElementArray::const_iterator it = vertexElements.begin(); it != vertexElements.end(); ++it)
+  {
+    u8* elementData = data + it->offset();
 
-    // go thru all vertex arrays one by one
-    const VertexElementArray& vertexElements = component->vertexBuffer()->vertexDeclaration().vertexElements();
-    for (VertexElementArray::const_iterator it = vertexElements.begin(); it != vertexElements.end(); ++it)
+    switch (it->semantic())
     {
-      switch (it->semantic())
-      {
-        case NVertexBuffer::VES_POSITION_XYZ:
+      case NVertexBuffer::VES_POSITION_XYZ:
 
-          *data++ = vertex.pos.x;
-          *data++ = vertex.pos.y;
-          *data++ = vertex.pos.z;
-          break;
+        // NOTE: all positions are transformed at once, directly into interleaved data
+        Math::Transform(reinterpret_cast<Vector3f*>(elementData), vertexSize, &points[0], sizeof (Vector3f), count, transform);
+        break;
 
-        case NVertexBuffer::VES_POSITION_XY:
+      case NVertexBuffer::VES_POSITION_XY:
 
-          *data++ = vertex.pos.x;
-          *data++ = vertex.pos.y;
-          break;
+        Math::Transform(reinterpret_cast<Vector2f*>(elementData), vertexSize, reinterpret_cast<const Vector2f*>(&points[0]), sizeof (Vector3f), count, 
+                        transform);
+        break;
 
-        case NVertexBuffer::VES_TEXTURE_UV:
+      case NVertexBuffer::VES_TEXTURE_UV:
 
-          *data++ = vertex.uv.x;
-          *data++ = vertex.uv.y;
-          break;
+        for (u32 i = 0; i < count; ++i, elementData += vertexSize)
+        {
+          *reinterpret_cast<Vector2f*>(elementData) = textureCoords[vertexList[i]];
+        }
+        break;
 
-        case NVertexBuffer::VES_COLOR_RGBA:
+      case NVertexBuffer::VES_COLOR_RGBA:
 
-          *data++ = 1.0f;
-          *data++ = 1.0f;
-          *data++ = 1.0f;
-          *data++ = 1.0f;
-          break;
+        for (u32 i = 0; i < count; ++i, elementData += vertexSize)
+        {
+          float32* color = reinterpret_cast<float32*>(elementData);
 
-        default:
+          color[0] = 1.0f;
+          color[1] = 1.0f;
+          color[2] = 1.0f;
+          color[3] = 1.0f;
+        }
+        break;
 
-          EGE_ASSERT_X(false, "Not supported!");
-          return NULL;
-      }
+      default:
+
+        EGE_ASSERT_X(false, "Not supported!");
+        return false;
     }
   }
 
   // unlock vertex buffer
-  component->vertexBuffer()->unlock(data - 1);
+  component->vertexBuffer()->unlock(reinterpret_cast<float32*>(data + count * vertexSize) - 1);
 
   return true;
 }
@@ -471,11 +427,23 @@ PRenderComponent RenderObjectFactory::Create(const CubicSpline* spline, Applicat
         return NULL;
       }
 
+      // calculate all points at once
+      // NOTE: points are evenly distributed along the curve
+      DynamicArray<float32> parameters;
+      for (s32 i = 0; i <= vertexCount; ++i)
+      {
+        parameters.push_back(i / (1.0f * vertexCount));
+      }
+
+      DynamicArray<Vector3f> points;
+      points.resize(parameters.size());
+      spline->uniformValues(&parameters[0], &points[0], static_cast<u32>(parameters.size()));
+
       Vector3f pos;
 
 	    for (s32 i = 0; i < vertexCount; ++i)
 	    {
-        pos = spline->value(i / (1.0f * vertexCount));
+        pos = points[i];
         pos += offset;
 
         *data++ = pos.x;
@@ -486,7 +454,7 @@ PRenderComponent RenderObjectFactory::Create(const CubicSpline* spline, Applicat
         *data++ = 1.0f;
         *data++ = 1.0f;
 
-        pos = spline->value((i + 1) / (1.0f * vertexCount));
+        pos = points[i + 1];
         pos += offset;
 
         *data++ = pos.x;
@@ -99,6 +99,16 @@ class RenderObjectFactory
                                bool flipU, bool flipV);
     static bool DoCreateQuatroQuadXY(PRenderComponent& component, Vector4f position, Vector2f size, Alignment origin, 
                                      EGEGraphics::RenderPrimitiveType primitive, bool flipU, bool flipV);
+    /*! Writes vertices into component's vertex buffer.
+     *  @param  component     Component which vertex buffer is to be filled in.
+     *  @param  positions     Array of vertex positions. Positions are transformed by a given matrix before being written.
+     *  @param  textureCoords Array of vertex texture coordinates.
+     *  @param  vertexList    List of indicies into arrays above, in order vertices are to be written.
+     *  @param  transform     Transformation matrix applied to positions.
+     *  @return TRUE on success.
+     */
+    static bool WriteVertices(PRenderComponent& component, const Vector3f* positions, const Vector2f* textureCoords, const IntArray& vertexList, 
+                              const Matrix4f& transform);
     static VertexDeclaration ConvertVertexDeclarationSymbol(VertexDeclarationSymbol vertexDeclaration);
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
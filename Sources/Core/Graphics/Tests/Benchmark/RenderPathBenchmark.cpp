@@ -0,0 +1,332 @@
+#include "TestFramework/Interface/TestBase.h"
+#include "Core/Graphics/Camera.h"
+#include "Core/Graphics/TextureImage.h"
+#include "Core/Graphics/Image/ImageUtils.h"
+#include "Core/Graphics/Render/Implementation/RenderSystemStatistics.h"
+#include "Core/Graphics/Recording/RenderSystemRecording.h"
+#include <EGEApplication.h>
+#include <EGEGraphics.h>
+#include <EGEImage.h>
+#include <EGEMemory.h>
+#include <EGEOverlay.h>
+#include <EGEScene.h>
+#include <EGEScreen.h>
+#include <EGETimer.h>
+
+/** Benchmarks of the whole rendering path (scene graph, overlays and screens) down to the render system.
+ *  Application is run headless so rendering is done by recording render system. This allows benchmarks to be run on machines without graphics hardware
+ *  and to verify that rendered frames stay deterministic.
+ */
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of objects rendered by each benchmark. */
+#define OBJECTS_COUNT   2000
+/*! Number of distinct materials used by objects. */
+#define MATERIALS_COUNT 8
+/*! Number of frames rendered before measurement starts. */
+#define WARMUP_FRAMES   5
+/*! Number of measured frames. */
+#define MEASURED_FRAMES 100
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Headless application instance. */
+class BenchmarkApplication : public Application
+{
+  public:
+
+    /*! @see Application::onInitialized. */
+    void onInitialized() override {}
+    /*! @see Application::version. */
+    Version version() const override { return Version(1, 0, 0); }
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Scene object rendering single render component. */
+class BenchmarkSceneObject : public SceneNodeObject
+{
+  public:
+
+    BenchmarkSceneObject(const String& name, const PRenderComponent& renderData) : SceneNodeObject(name), m_renderData(renderData) {}
+
+    /*! @see SceneNodeObject::addForRendering. */
+    bool addForRendering(IRenderer* renderer, const Matrix4f& transform = Matrix4f::IDENTITY) override
+    {
+      return EGE_SUCCESS == renderer->addForRendering(m_renderData, transform);
+    }
+
+  private:
+
+    /*! Render component. */
+    PRenderComponent m_renderData;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Opaque screen rendering a number of render components. */
+class BenchmarkScreen : public Screen
+{
+  public:
+
+    BenchmarkScreen(Application* app) : Screen(app, "benchmark") {}
+
+    /*! @see Screen::render. */
+    void render(const Viewport* viewport, IRenderer* renderer) override
+    {
+      EGE_UNUSED(viewport);
+
+      for (DynamicArray<PRenderComponent>::const_iterator it = m_renderData.begin(); it != m_renderData.end(); ++it)
+      {
+        renderer->addForRendering(*it);
+      }
+    }
+    /*! @see Screen::hasTransparency. */
+    bool hasTransparency() const override { return false; }
+    /*! Adds render component to be rendered. */
+    void add(const PRenderComponent& renderData) { m_renderData.push_back(renderData); }
+
+  private:
+
+    /*! Render components. */
+    DynamicArray<PRenderComponent> m_renderData;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class RenderPathBenchmark : public TestBase
+{
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void SetUp();
+    virtual void TearDown();
+
+  protected:
+
+    /*! Returns recording render system. */
+    RenderSystemRecording* renderSystem() const;
+    /*! Creates quad render component using one of the benchmark materials.
+     *  @param  name  Name of the component.
+     *  @param  index Index of the object. Used to position quad and select material.
+     */
+    PRenderComponent createQuad(const String& name, s32 index) const;
+    /*! Renders warm-up and measured frames, reports timings and validates recorded frames.
+     *  @param  name  Name of the benchmark used for reporting.
+     */
+    void run(const char* name);
+
+  protected:
+
+    /*! Application instance. */
+    BenchmarkApplication* m_app;
+    /*! Materials shared by objects. */
+    DynamicArray<PMaterial> m_materials;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderPathBenchmark::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderPathBenchmark::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderPathBenchmark::SetUp()
+{
+  Dictionary params;
+  params[EGE_RENDER_TARGET_PARAM_NAME]    = EGE_PRIMARY_RENDER_TARGET_NAME;
+  params[EGE_RENDER_TARGET_PARAM_WIDTH]   = "1024";
+  params[EGE_RENDER_TARGET_PARAM_HEIGHT]  = "768";
+  params[EGE_ENGINE_PARAM_LANDSCAPE_MODE] = "true";
+  params[EGE_ENGINE_PARAM_HEADLESS]       = "true";
+
+  m_app = ege_new BenchmarkApplication();
+  ASSERT_TRUE(NULL != m_app);
+  ASSERT_EQ(EGE_SUCCESS, m_app->construct(params));
+  ASSERT_TRUE(NULL != renderSystem());
+
+  // setup main viewport
+  PRenderTarget window = m_app->graphics()->renderTarget(EGE_PRIMARY_RENDER_TARGET_NAME);
+  ASSERT_TRUE(NULL != window);
+  ASSERT_TRUE(NULL != window->addViewport("main", ege_new Camera("main", m_app->sceneManager())));
+
+  // create materials
+  // NOTE: every other material is blended so state changes are recorded between batches
+  for (s32 i = 0; i < MATERIALS_COUNT; ++i)
+  {
+    PTexture2D texture = m_app->graphics()->hardwareResourceProvider()->createTexture2D(String::Format("texture-%d", i),
+                                                                                       ImageUtils::CreateImage(16, 16, PF_RGBA_8888, false, 0, NULL));
+    ASSERT_TRUE(NULL != texture);
+
+    PMaterial material = ege_new Material(m_app);
+    ASSERT_TRUE(NULL != material);
+
+    PRenderPass pass = material->addPass(NULL);
+    ASSERT_TRUE(NULL != pass);
+    ASSERT_EQ(EGE_SUCCESS, pass->addTexture(ege_new TextureImage(texture)));
+
+    if (i & 1)
+    {
+      material->setSrcBlendFactor(EGEGraphics::BF_SRC_ALPHA);
+      material->setDstBlendFactor(EGEGraphics::BF_ONE_MINUS_SRC_ALPHA);
+    }
+
+    m_materials.push_back(material);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderPathBenchmark::TearDown()
+{
+  m_materials.clear();
+
+  EGE_DELETE(m_app);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+RenderSystemRecording* RenderPathBenchmark::renderSystem() const
+{
+  return static_cast<RenderSystemRecording*>(m_app->graphics()->renderSystem());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PRenderComponent RenderPathBenchmark::createQuad(const String& name, s32 index) const
+{
+  const Vector4f position(static_cast<float32>(index % 64) * 16.0f, static_cast<float32>(index / 64) * 16.0f, 0);
+
+  PRenderComponent component = RenderObjectFactory::CreateQuadXY(m_app, name, position, Vector2f(16.0f, 16.0f), ALIGN_TOP_LEFT, false, false,
+                                                                 RenderObjectFactory::VS_V2_T2, EGEGraphics::RP_MAIN, EGEGraphics::RPT_TRIANGLE_STRIPS,
+                                                                 NVertexBuffer::UT_STATIC_WRITE);
+  if (NULL != component)
+  {
+    component->setMaterial(m_materials[index % MATERIALS_COUNT]);
+  }
+
+  return component;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderPathBenchmark::run(const char* name)
+{
+  // warm up
+  for (s32 i = 0; i < WARMUP_FRAMES; ++i)
+  {
+    m_app->graphics()->render();
+  }
+
+  // measure
+  s64 minDuration   = 0;
+  s64 maxDuration   = 0;
+  s64 totalDuration = 0;
+  for (s32 i = 0; i < MEASURED_FRAMES; ++i)
+  {
+    const s64 startTime = Timer::GetMicroseconds();
+
+    m_app->graphics()->render();
+
+    const s64 duration = Timer::GetMicroseconds() - startTime;
+
+    minDuration    = (0 == i) ? duration : Math::Min(minDuration, duration);
+    maxDuration    = (0 == i) ? duration : Math::Max(maxDuration, duration);
+    totalDuration += duration;
+  }
+
+  // calculate last frame statistics from its command stream
+  // NOTE: this is available even if render statistics are compiled out
+  RenderSystemFrameStatisticData replayed;
+  EXPECT_EQ(EGE_SUCCESS, renderSystem()->replay(0, replayed));
+
+  // report
+  std::cout << "[ BENCH    ] " << name << ": frames " << MEASURED_FRAMES << ", avg " << (totalDuration / MEASURED_FRAMES) << "us, min " << minDuration
+            << "us, max " << maxDuration << "us, batches " << replayed.batchCount << ", vertices " << replayed.vertexCount << ", commands "
+            << renderSystem()->recordedFrame().count() << std::endl;
+
+  RecordProperty("AverageFrameDuration", static_cast<int>(totalDuration / MEASURED_FRAMES));
+  RecordProperty("MinFrameDuration", static_cast<int>(minDuration));
+  RecordProperty("MaxFrameDuration", static_cast<int>(maxDuration));
+  RecordProperty("BatchCount", static_cast<int>(replayed.batchCount));
+  RecordProperty("CommandCount", static_cast<int>(renderSystem()->recordedFrame().count()));
+
+  // validate every batch has been drawn
+  // NOTE: objects sharing material may be merged into single batch, so there is at least one batch per material and at most one per object
+  EXPECT_LE(MATERIALS_COUNT, static_cast<s32>(replayed.batchCount));
+  EXPECT_GE(OBJECTS_COUNT, static_cast<s32>(replayed.batchCount));
+  EXPECT_EQ(replayed.batchCount, replayed.drawArraysCalls + replayed.drawElementsCalls);
+
+  // validate frames are deterministic
+  EXPECT_EQ(WARMUP_FRAMES + MEASURED_FRAMES, renderSystem()->recordedFramesCount());
+  EXPECT_EQ(renderSystem()->recordedFrame(0).hash(), renderSystem()->recordedFrame(1).hash());
+
+#ifdef EGE_FEATURE_RENDER_STATISTICS
+  RenderSystemStatistics* statistics = ege_cast<RenderSystemStatistics*>(renderSystem()->component(EGE_OBJECT_UID_RENDER_SYSTEM_STATISTICS));
+  ASSERT_TRUE(NULL != statistics);
+
+  const RenderSystemFrameStatisticData& lastRecord = statistics->lastRecord();
+
+  // validate replay reproduces statistics
+  EXPECT_EQ(lastRecord.batchCount, replayed.batchCount);
+  EXPECT_EQ(lastRecord.vertexCount, replayed.vertexCount);
+  EXPECT_EQ(lastRecord.drawArraysCalls, replayed.drawArraysCalls);
+  EXPECT_EQ(lastRecord.drawElementsCalls, replayed.drawElementsCalls);
+  ASSERT_EQ(lastRecord.queueCount, replayed.queueCount);
+  for (u32 i = 0; i < replayed.queueCount; ++i)
+  {
+    EXPECT_EQ(lastRecord.queues[i].hash, replayed.queues[i].hash);
+    EXPECT_EQ(lastRecord.queues[i].batchCount, replayed.queues[i].batchCount);
+    EXPECT_EQ(lastRecord.queues[i].vertexCount, replayed.queues[i].vertexCount);
+  }
+#endif // EGE_FEATURE_RENDER_STATISTICS
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(RenderPathBenchmark, SceneGraph)
+{
+  SceneNode* rootNode = m_app->sceneManager()->rootNode();
+
+  for (s32 i = 0; i < OBJECTS_COUNT; ++i)
+  {
+    PRenderComponent component = createQuad(String::Format("scene-%d", i), i);
+    ASSERT_TRUE(NULL != component);
+
+    SceneNode* node = rootNode->createChildSceneNode(String::Format("node-%d", i));
+    ASSERT_TRUE(NULL != node);
+    ASSERT_TRUE(node->attachObject(ege_new BenchmarkSceneObject(String::Format("object-%d", i), component)));
+  }
+
+  run("SceneGraph");
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(RenderPathBenchmark, Overlays)
+{
+  for (s32 i = 0; i < OBJECTS_COUNT; ++i)
+  {
+    PImageOverlay overlay = ege_new ImageOverlay(m_app, String::Format("overlay-%d", i));
+    ASSERT_TRUE(NULL != overlay);
+
+    overlay->setSize(Vector2f(16.0f, 16.0f));
+    overlay->physics()->setPosition(Vector4f(static_cast<float32>(i % 64) * 16.0f, static_cast<float32>(i / 64) * 16.0f, 0));
+    overlay->renderData()->setMaterial(m_materials[i % MATERIALS_COUNT]);
+
+    ASSERT_EQ(EGE_SUCCESS, m_app->overlayManager()->add(overlay));
+  }
+
+  run("Overlays");
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(RenderPathBenchmark, Screens)
+{
+  BenchmarkScreen* screen = ege_new BenchmarkScreen(m_app);
+  ASSERT_TRUE(NULL != screen);
+
+  PScreen screenRef = screen;
+  ASSERT_EQ(EGE_SUCCESS, screen->construct());
+
+  for (s32 i = 0; i < OBJECTS_COUNT; ++i)
+  {
+    PRenderComponent component = createQuad(String::Format("screen-%d", i), i);
+    ASSERT_TRUE(NULL != component);
+
+    screen->add(component);
+  }
+
+  m_app->screenManager()->show(screenRef);
+
+  run("Screens");
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "TestFramework/Interface/TestBase.h"
+#include "Core/Graphics/Render/Implementation/ComponentRenderer.h"
+#include "Core/Graphics/VertexDeclaration.h"
+#include "Core/ObjectUIDs.h"
+#include <EGEApplication.h>
+#include <EGEGraphics.h>
+#include <EGEMemory.h>
+#include <EGERenderQueues.h>
+#include <EGETimer.h>
+
+/** Micro-benchmark of render queue submission and rendering.
+ *  Render queue is fed directly and rendered with a renderer which only touches submitted data, so the cost of the queue itself is measured.
+ */
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of components submitted each frame. */
+#define COMPONENTS_COUNT  10000
+/*! Number of frames submitted before measurement starts. */
+#define WARMUP_FRAMES     5
+/*! Number of measured frames. */
+#define MEASURED_FRAMES   100
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Headless application instance. */
+class QueueBenchmarkApplication : public Application
+{
+  public:
+
+    /*! @see Application::onInitialized. */
+    void onInitialized() override {}
+    /*! @see Application::version. */
+    Version version() const override { return Version(1, 0, 0); }
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Renderer accumulating data of rendered components. */
+class CountingRenderer : public IComponentRenderer
+{
+  public:
+
+    CountingRenderer() : m_count(0), m_checksum(0) {}
+
+    /*! @see IComponentRenderer::renderComponent. */
+    void renderComponent(const PRenderComponent& component, const Matrix4f& modelMatrix) override
+    {
+      m_count++;
+      m_checksum += component->priority() + static_cast<u32>(modelMatrix.data[12]);
+    }
+
+    /*! Returns number of components rendered. */
+    u32 count() const { return m_count; }
+    /*! Returns checksum of rendered data. */
+    u32 checksum() const { return m_checksum; }
+    /*! Resets counters. */
+    void reset() { m_count = 0; m_checksum = 0; }
+
+  private:
+
+    /*! Number of components rendered. */
+    u32 m_count;
+    /*! Checksum of rendered data. */
+    u32 m_checksum;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class RenderQueueBenchmark : public TestBase
+{
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void SetUp();
+    virtual void TearDown();
+
+  protected:
+
+    /*! Submits all components into given queue, renders and clears it. */
+    void renderFrame(const PRenderQueue& queue, CountingRenderer& renderer);
+
+  protected:
+
+    /*! Application instance. */
+    QueueBenchmarkApplication* m_app;
+    /*! Submitted components. */
+    DynamicArray<PRenderComponent> m_components;
+    /*! Model matrices of submitted components. */
+    DynamicArray<Matrix4f> m_modelMatrices;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderQueueBenchmark::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderQueueBenchmark::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderQueueBenchmark::SetUp()
+{
+  Dictionary params;
+  params[EGE_RENDER_TARGET_PARAM_NAME]    = EGE_PRIMARY_RENDER_TARGET_NAME;
+  params[EGE_RENDER_TARGET_PARAM_WIDTH]   = "1024";
+  params[EGE_RENDER_TARGET_PARAM_HEIGHT]  = "768";
+  params[EGE_ENGINE_PARAM_HEADLESS]       = "true";
+
+  m_app = ege_new QueueBenchmarkApplication();
+  ASSERT_TRUE(NULL != m_app);
+  ASSERT_EQ(EGE_SUCCESS, m_app->construct(params));
+
+  VertexDeclaration vertexDeclaration;
+  ASSERT_TRUE(vertexDeclaration.addElement(NVertexBuffer::VES_POSITION_XY));
+
+  // create components
+  for (s32 i = 0; i < COMPONENTS_COUNT; ++i)
+  {
+    PRenderComponent component = ege_new RenderComponent(m_app, String::Format("component-%d", i), vertexDeclaration, EGEGraphics::RP_MAIN,
+                                                         EGEGraphics::RPT_TRIANGLE_STRIPS);
+    ASSERT_TRUE(NULL != component);
+
+    Matrix4f modelMatrix = Matrix4f::IDENTITY;
+    modelMatrix.data[12] = static_cast<float32>(i % 64);
+
+    m_components.push_back(component);
+    m_modelMatrices.push_back(modelMatrix);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderQueueBenchmark::TearDown()
+{
+  m_components.clear();
+  m_modelMatrices.clear();
+
+  EGE_DELETE(m_app);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderQueueBenchmark::renderFrame(const PRenderQueue& queue, CountingRenderer& renderer)
+{
+  for (s32 i = 0; i < COMPONENTS_COUNT; ++i)
+  {
+    queue->addForRendering(m_components[i], m_modelMatrices[i]);
+  }
+
+  queue->render(renderer);
+  queue->clear();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(RenderQueueBenchmark, SimpleQueue10k)
+{
+  PRenderQueue queue = RenderQueueFactory::Create(m_app, EGE_OBJECT_UID_SIMPLE_RENDER_QUEUE, EGEGraphics::RP_MAIN, EGEGraphics::RPT_TRIANGLE_STRIPS);
+  ASSERT_TRUE(NULL != queue);
+
+  CountingRenderer renderer;
+
+  // warm up
+  // NOTE: this also lets queue reach its final capacity
+  for (s32 i = 0; i < WARMUP_FRAMES; ++i)
+  {
+    renderFrame(queue, renderer);
+  }
+
+  // calculate expected checksum
+  u32 expectedChecksum = 0;
+  for (s32 i = 0; i < COMPONENTS_COUNT; ++i)
+  {
+    expectedChecksum += m_components[i]->priority() + static_cast<u32>(m_modelMatrices[i].data[12]);
+  }
+
+  // measure
+  s64 minDuration   = 0;
+  s64 maxDuration   = 0;
+  s64 totalDuration = 0;
+  for (s32 i = 0; i < MEASURED_FRAMES; ++i)
+  {
+    renderer.reset();
+
+    const s64 startTime = Timer::GetMicroseconds();
+
+    renderFrame(queue, renderer);
+
+    const s64 duration = Timer::GetMicroseconds() - startTime;
+
+    minDuration    = (0 == i) ? duration : Math::Min(minDuration, duration);
+    maxDuration    = (0 == i) ? duration : Math::Max(maxDuration, duration);
+    totalDuration += duration;
+
+    // validate every component has been rendered exactly once
+    EXPECT_EQ(static_cast<u32>(COMPONENTS_COUNT), renderer.count());
+    EXPECT_EQ(expectedChecksum, renderer.checksum());
+  }
+
+  // report
+  std::cout << "[ BENCH    ] SimpleQueue10k: frames " << MEASURED_FRAMES << ", avg " << (totalDuration / MEASURED_FRAMES) << "us, min " << minDuration
+            << "us, max " << maxDuration << "us" << std::endl;
+
+  RecordProperty("AverageFrameDuration", static_cast<int>(totalDuration / MEASURED_FRAMES));
+  RecordProperty("MinFrameDuration", static_cast<int>(minDuration));
+  RecordProperty("MaxFrameDuration", static_cast<int>(maxDuration));
+
+  // validate no references are held by queue
+  // NOTE: only array in fixture holds references
+  EXPECT_EQ(1U, m_components[0]->referenceCount());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include "TestFramework/Interface/TestBase.h"
+#include "Core/Graphics/Render/Implementation/RenderSystemStatistics.h"
+#include "Core/Graphics/VertexDeclaration.h"
+#include <EGEApplication.h>
+#include <EGEGraphics.h>
+#include <EGEMemory.h>
+#include <EGERenderComponent.h>
+#include <EGEStringBuffer.h>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Name of the rendered component. Contains all characters which need to be escaped in JSON. */
+static const char* KComponentName        = "quoted \"name\" in\\path\n\tand\r";
+/*! Rendered component name as expected in JSON export. */
+static const char* KEscapedComponentName = "quoted \\\"name\\\" in\\\\path\\n\\tand\\r";
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Headless application instance. */
+class RenderSystemStatisticsTestApplication : public Application
+{
+  public:
+
+    /*! @see Application::onInitialized. */
+    void onInitialized() override {}
+    /*! @see Application::version. */
+    Version version() const override { return Version(1, 0, 0); }
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class RenderSystemStatisticsTest : public TestBase
+{
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void SetUp();
+    virtual void TearDown();
+
+  protected:
+
+    /*! Begins new frame. */
+    void beginFrame();
+    /*! Ends current frame. */
+    void endFrame();
+
+  protected:
+
+    /*! Application instance. */
+    RenderSystemStatisticsTestApplication* m_app;
+    /*! Tested statistics. */
+    PRenderSystemStatistics m_statistics;
+    /*! Rendered component. */
+    PRenderComponent m_component;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemStatisticsTest::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemStatisticsTest::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemStatisticsTest::SetUp()
+{
+  Dictionary params;
+  params[EGE_RENDER_TARGET_PARAM_NAME]    = EGE_PRIMARY_RENDER_TARGET_NAME;
+  params[EGE_RENDER_TARGET_PARAM_WIDTH]   = "1024";
+  params[EGE_RENDER_TARGET_PARAM_HEIGHT]  = "768";
+  params[EGE_ENGINE_PARAM_HEADLESS]       = "true";
+
+  m_app = ege_new RenderSystemStatisticsTestApplication();
+  ASSERT_TRUE(NULL != m_app);
+  ASSERT_EQ(EGE_SUCCESS, m_app->construct(params));
+
+  m_statistics = ege_new RenderSystemStatistics(m_app, "render-system-statistics-test.log", 4);
+  ASSERT_TRUE(NULL != m_statistics);
+
+  VertexDeclaration vertexDeclaration;
+  ASSERT_TRUE(vertexDeclaration.addElement(NVertexBuffer::VES_POSITION_XY));
+
+  m_component = ege_new RenderComponent(m_app, KComponentName, vertexDeclaration);
+  ASSERT_TRUE(NULL != m_component);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemStatisticsTest::TearDown()
+{
+  m_component  = NULL;
+  m_statistics = NULL;
+
+  EGE_DELETE(m_app);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemStatisticsTest::beginFrame()
+{
+  m_app->graphics()->renderStart();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RenderSystemStatisticsTest::endFrame()
+{
+  m_app->graphics()->renderEnd();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(RenderSystemStatisticsTest, ExportJSONWithoutRecords)
+{
+  EXPECT_EQ(0U, m_statistics->recordsCount());
+  EXPECT_EQ("[\n]\n", m_statistics->exportData(RenderSystemStatistics::FORMAT_JSON));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(RenderSystemStatisticsTest, ExportJSON)
+{
+  const u32 hash = (static_cast<u32>(EGEGraphics::RP_MAIN) << 8) | EGEGraphics::RPT_TRIANGLES;
+
+  m_statistics->setComponentNamesSamplingInterval(1);
+
+  // frame with single render queue of two batches
+  beginFrame();
+  m_statistics->beginRenderQueue(hash);
+  m_statistics->addBatch(m_component, 6, true);
+  m_statistics->addBatch(m_component, 3, false);
+  endFrame();
+
+  // frame with nothing rendered
+  beginFrame();
+  endFrame();
+
+  ASSERT_EQ(2U, m_statistics->recordsCount());
+
+  StringBuffer expected;
+  expected << "[\n";
+  expected << "  {\"frame\": 0, \"renderDuration\": " << m_statistics->record(1).renderDuration << ", \"drawElementsCalls\": 1, \"drawArraysCalls\": 1, "
+           << "\"batchCount\": 2, \"vertexCount\": 9, \"queues\": [{\"hash\": " << hash << ", \"priority\": " << static_cast<s32>(EGEGraphics::RP_MAIN) << ", "
+           << "\"primitive\": \"RPT_TRIANGLES\", \"batchCount\": 2, \"indexedBatchCount\": 1, \"vertexCount\": 9, \"components\": [\""
+           << KEscapedComponentName << "\", \"" << KEscapedComponentName << "\"]}]},\n";
+  expected << "  {\"frame\": 1, \"renderDuration\": " << m_statistics->record(0).renderDuration << ", \"drawElementsCalls\": 0, \"drawArraysCalls\": 0, "
+           << "\"batchCount\": 0, \"vertexCount\": 0, \"queues\": []}\n";
+  expected << "]\n";
+
+  EXPECT_EQ(expected.string(), m_statistics->exportData(RenderSystemStatistics::FORMAT_JSON));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
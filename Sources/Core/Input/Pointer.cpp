@@ -6,6 +6,8 @@
   #include "Airplay/Input/PointerAirplay_p.h"
 #elif EGE_PLATFORM_IOS
   #include "iOS/Input/PointerIOS_p.h"
+#elif EGE_PLATFORM_POSIX
+  #include "Posix/Input/PointerPosix_p.h"
 #endif
 
 EGE_NAMESPACE_BEGIN
@@ -0,0 +1,233 @@
+#ifndef EGE_CORE_MATH_MATHSIMD_H
+#define EGE_CORE_MATH_MATHSIMD_H
+
+/*! SIMD backend for single precision math types.
+ *  Backend is selected automatically according to target instruction set:
+ *    EGE_MATH_SIMD_SSE   - SSE (x86, x64)
+ *    EGE_MATH_SIMD_NEON  - NEON (ARM)
+ *  If none is available or EGE_FEATURE_NO_SIMD is defined, EGE_MATH_SIMD is not defined and generic scalar code is used.
+ *  All loads and stores are unaligned ones, so data allocated thru the memory manager is always safe to process. On 64-bit targets, where heap memory
+ *  is 16-byte aligned anyway, math types are additionally declared 16-byte aligned so loads and stores never split cache lines.
+ *  @note Operations are evaluated in the same order as in scalar code and no fused multiply-add is used, so results match scalar ones.
+ */
+
+#include "EGETypes.h"
+
+#ifndef EGE_FEATURE_NO_SIMD
+  #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (1 <= _M_IX86_FP))
+    #define EGE_MATH_SIMD_SSE 1
+    #include <xmmintrin.h>
+  #elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    #define EGE_MATH_SIMD_NEON 1
+    #include <arm_neon.h>
+  #endif
+#endif // EGE_FEATURE_NO_SIMD
+
+#if EGE_MATH_SIMD_SSE || EGE_MATH_SIMD_NEON
+  #define EGE_MATH_SIMD 1
+#endif // EGE_MATH_SIMD_SSE || EGE_MATH_SIMD_NEON
+
+// NOTE: alignment is only declared when heap allocations are guaranteed to respect it. Also, 32-bit MSVC does not allow passing aligned types by value
+#if EGE_MATH_SIMD && (defined(_M_X64) || defined(__x86_64__) || defined(__aarch64__))
+  #ifdef _MSC_VER
+    #define EGE_MATH_ALIGN16 __declspec(align(16))
+  #else
+    #define EGE_MATH_ALIGN16 __attribute__((aligned(16)))
+  #endif // _MSC_VER
+#else
+  #define EGE_MATH_ALIGN16
+#endif // EGE_MATH_SIMD && (defined(_M_X64) || defined(__x86_64__) || defined(__aarch64__))
+
+#if EGE_MATH_SIMD
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class MathSIMD
+{
+  public:
+
+#if EGE_MATH_SIMD_SSE
+    typedef __m128 Vector;
+#elif EGE_MATH_SIMD_NEON
+    typedef float32x4_t Vector;
+#endif // EGE_MATH_SIMD_SSE
+
+  public:
+
+    /*! Loads 4 values from given (possibly unaligned) memory location. */
+    static inline Vector Load(const float32* data);
+    /*! Stores 4 values into given (possibly unaligned) memory location. */
+    static inline void Store(float32* data, Vector value);
+    /*! Stores first 2 values into given (possibly unaligned) memory location. Memory past them is not accessed. */
+    static inline void Store2(float32* data, Vector value);
+    /*! Stores first 3 values into given (possibly unaligned) memory location. Memory past them is not accessed. */
+    static inline void Store3(float32* data, Vector value);
+    /*! Returns vector of given components. */
+    static inline Vector Set(float32 x, float32 y, float32 z, float32 w);
+    /*! Returns vector with all components set to given value. */
+    static inline Vector Splat(float32 value);
+    /*! Returns vector composed of given components of a given vector. */
+    template <int X, int Y, int Z, int W>
+    static inline Vector Swizzle(Vector value);
+    /*! Returns component-wise sum of vectors. */
+    static inline Vector Add(Vector left, Vector right);
+    /*! Returns component-wise difference of vectors. */
+    static inline Vector Subtract(Vector left, Vector right);
+    /*! Returns component-wise product of vectors. */
+    static inline Vector Multiply(Vector left, Vector right);
+    /*! Returns component-wise sum of a given vector and product of remaining ones ie. value + left * right.
+     *  @note Product is rounded before addition.
+     */
+    static inline Vector MultiplyAdd(Vector value, Vector left, Vector right);
+    /*! Returns linear combination of 4 columns with weights given by components of a vector ie. column0 * weights.x + ... + column3 * weights.w. */
+    static inline Vector Combine(Vector column0, Vector column1, Vector column2, Vector column3, Vector weights);
+    /*! Returns linear combination of 3 columns with weights given by components of a vector ie. column0 * weights.x + ... + column2 * weights.z. */
+    static inline Vector Combine(Vector column0, Vector column1, Vector column2, Vector weights);
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+#if EGE_MATH_SIMD_SSE
+inline MathSIMD::Vector MathSIMD::Load(const float32* data)
+{
+  return _mm_loadu_ps(data);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline void MathSIMD::Store(float32* data, Vector value)
+{
+  _mm_storeu_ps(data, value);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline void MathSIMD::Store2(float32* data, Vector value)
+{
+  _mm_storel_pi(reinterpret_cast<__m64*>(data), value);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline void MathSIMD::Store3(float32* data, Vector value)
+{
+  _mm_storel_pi(reinterpret_cast<__m64*>(data), value);
+  _mm_store_ss(data + 2, _mm_movehl_ps(value, value));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Set(float32 x, float32 y, float32 z, float32 w)
+{
+  return _mm_set_ps(w, z, y, x);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Splat(float32 value)
+{
+  return _mm_set1_ps(value);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <int X, int Y, int Z, int W>
+inline MathSIMD::Vector MathSIMD::Swizzle(Vector value)
+{
+  return _mm_shuffle_ps(value, value, _MM_SHUFFLE(W, Z, Y, X));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Add(Vector left, Vector right)
+{
+  return _mm_add_ps(left, right);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Subtract(Vector left, Vector right)
+{
+  return _mm_sub_ps(left, right);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Multiply(Vector left, Vector right)
+{
+  return _mm_mul_ps(left, right);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::MultiplyAdd(Vector value, Vector left, Vector right)
+{
+  return _mm_add_ps(value, _mm_mul_ps(left, right));
+}
+#elif EGE_MATH_SIMD_NEON
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Load(const float32* data)
+{
+  return vld1q_f32(data);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline void MathSIMD::Store(float32* data, Vector value)
+{
+  vst1q_f32(data, value);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline void MathSIMD::Store2(float32* data, Vector value)
+{
+  vst1_f32(data, vget_low_f32(value));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline void MathSIMD::Store3(float32* data, Vector value)
+{
+  vst1_f32(data, vget_low_f32(value));
+  vst1q_lane_f32(data + 2, value, 2);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Set(float32 x, float32 y, float32 z, float32 w)
+{
+  const float32 data[4] = { x, y, z, w };
+  return vld1q_f32(data);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Splat(float32 value)
+{
+  return vdupq_n_f32(value);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <int X, int Y, int Z, int W>
+inline MathSIMD::Vector MathSIMD::Swizzle(Vector value)
+{
+#ifdef __clang__
+  return __builtin_shufflevector(value, value, X, Y, Z, W);
+#else
+  const float32 data[4] = { vgetq_lane_f32(value, X), vgetq_lane_f32(value, Y), vgetq_lane_f32(value, Z), vgetq_lane_f32(value, W) };
+  return vld1q_f32(data);
+#endif // __clang__
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Add(Vector left, Vector right)
+{
+  return vaddq_f32(left, right);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Subtract(Vector left, Vector right)
+{
+  return vsubq_f32(left, right);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Multiply(Vector left, Vector right)
+{
+  return vmulq_f32(left, right);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::MultiplyAdd(Vector value, Vector left, Vector right)
+{
+  // NOTE: vmlaq_f32 is not used as it may be fused on some targets
+  return vaddq_f32(value, vmulq_f32(left, right));
+}
+#endif // EGE_MATH_SIMD_SSE
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Combine(Vector column0, Vector column1, Vector column2, Vector column3, Vector weights)
+{
+  Vector result = Multiply(column0, Swizzle<0, 0, 0, 0>(weights));
+  result = MultiplyAdd(result, column1, Swizzle<1, 1, 1, 1>(weights));
+  result = MultiplyAdd(result, column2, Swizzle<2, 2, 2, 2>(weights));
+  return MultiplyAdd(result, column3, Swizzle<3, 3, 3, 3>(weights));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline MathSIMD::Vector MathSIMD::Combine(Vector column0, Vector column1, Vector column2, Vector weights)
+{
+  Vector result = Multiply(column0, Swizzle<0, 0, 0, 0>(weights));
+  result = MultiplyAdd(result, column1, Swizzle<1, 1, 1, 1>(weights));
+  return MultiplyAdd(result, column2, Swizzle<2, 2, 2, 2>(weights));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_MATH_SIMD
+
+#endif // EGE_CORE_MATH_MATHSIMD_H
\ No newline at end of file
@@ -23,6 +23,8 @@ static Matrix4f CatMullRomMatrix(-0.5f,  1.0f, -0.5f, 0.0f,             // colum
 CubicSpline::CubicSpline(CubicSplineType type) : Spline()
                                                , m_type(ENone)
 {
+  m_length = 0.0f;
+
   setType(type);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -34,9 +36,11 @@ CubicSpline& CubicSpline::operator = (const CubicSpline& other)
 {
   // clean up
   m_segments.clear();
+  m_arcLengthTable.clear();
 
   // copy
   m_segments.copy(other.m_segments);
+  m_arcLengthTable.copy(other.m_arcLengthTable);
   m_type   = other.m_type;
   m_matrix = other.m_matrix;
   m_length = other.m_length;
@@ -67,7 +71,8 @@ void CubicSpline::setType(CubicSplineType type)
         break;
     }
 
-    // TAGE - update length etc
+    // update lengths
+    updateArcLengthTable();
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -110,8 +115,8 @@ bool CubicSpline::addPoints(const List<Vector3f>& points)
       m_segments.push_back(segment);
     }
 
-    // invalidate length
-    m_length.invalidate();
+    // update lengths
+    updateArcLengthTable();
 
     // done
     result = true;
@@ -124,56 +129,283 @@ Vector3f CubicSpline::value(float32 parameter) const
 {
   Vector3f out = Vector3f::ZERO;
 
-  // make sure value is valid
-  parameter = Math::Clamp(parameter, 0.0f, 1.0f);
+  // check if any segments
+  if ( ! m_segments.empty())
+  {
+    float32 segmentParameter;
+    const SegmentData& segment = locate(parameter, segmentParameter);
 
-  // convert into [0-length] space
-  parameter *= length();
+    // get value within segment
+    out = value(segmentParameter, segment);
+  }
 
-  // go thru all segments and find the one which contains point at given location
-  for (DynamicArray<SegmentData>::const_iterator it = m_segments.begin(); (it != m_segments.end() && (0 <= parameter)); ++it)
+  return out;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CubicSpline::values(const float32* parameters, Vector3f* out, u32 count) const
+{
+  // check if no segments
+  if (m_segments.empty())
   {
-    const SegmentData& segment = *it;
+    for (u32 i = 0; i < count; ++i)
+    {
+      out[i] = Vector3f::ZERO;
+    }
+
+    return;
+  }
+
+  // NOTE: segment of previous position is the starting point for the next one
+  u32 segmentIndex = 0;
+  for (u32 i = 0; i < count; ++i)
+  {
+    float32 segmentParameter;
+    const SegmentData& segment = locate(parameters[i], segmentParameter, segmentIndex);
+
+    // get value within segment
+    out[i] = value(segmentParameter, segment);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Vector3f CubicSpline::uniformValue(float32 parameter) const
+{
+  Vector3f out = Vector3f::ZERO;
+
+  // check if any segments
+  if ( ! m_segments.empty())
+  {
+    float32 segmentParameter;
+    const SegmentData& segment = locateUniform(parameter, segmentParameter);
+
+    // get value within segment
+    out = value(segmentParameter, segment);
+  }
+
+  return out;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void CubicSpline::uniformValues(const float32* parameters, Vector3f* out, u32 count) const
+{
+  // check if no segments
+  if (m_segments.empty())
+  {
+    for (u32 i = 0; i < count; ++i)
+    {
+      out[i] = Vector3f::ZERO;
+    }
+
+    return;
+  }
 
-    // check if position within current segment or last element
-    // NOTE: since 'parameter' is enforced to be in [0-1] interval, it can be assumed that if last segment is reached but first
-    //       condition is not satisfied (ie due to round errors) it is still valid to process the last segment
-    if ((parameter <= segment.length) || (it == (m_segments.end() - 1)))
+  // NOTE: arc length sample of previous position is the starting point for the next one
+  u32 sampleIndex = 0;
+  for (u32 i = 0; i < count; ++i)
+  {
+    float32 segmentParameter;
+    const SegmentData& segment = locateUniform(parameters[i], segmentParameter, sampleIndex);
+
+    // get value within segment
+    out[i] = value(segmentParameter, segment);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Vector3f CubicSpline::tangent(float32 parameter) const
+{
+  Vector3f out = Vector3f::ZERO;
+
+  // check if any segments
+  if ( ! m_segments.empty())
+  {
+    float32 segmentParameter;
+    const SegmentData& segment = locate(parameter, segmentParameter);
+
+    // get tangent within segment
+    out = tangent(segmentParameter, segment);
+  }
+
+  return out;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Vector3f CubicSpline::uniformTangent(float32 parameter) const
+{
+  Vector3f out = Vector3f::ZERO;
+
+  // check if any segments
+  if ( ! m_segments.empty())
+  {
+    float32 segmentParameter;
+    const SegmentData& segment = locateUniform(parameter, segmentParameter);
+
+    // get tangent within segment
+    out = tangent(segmentParameter, segment);
+  }
+
+  return out;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const CubicSpline::SegmentData& CubicSpline::locate(float32 parameter, float32& segmentParameter) const
+{
+  // NOTE: starting from last segment makes whole spline to be searched unless position lies within last segment
+  u32 segmentIndex = static_cast<u32>(m_segments.size()) - 1;
+  return locate(parameter, segmentParameter, segmentIndex);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const CubicSpline::SegmentData& CubicSpline::locate(float32 parameter, float32& segmentParameter, u32& segmentIndex) const
+{
+  EGE_ASSERT( ! m_segments.empty());
+  EGE_ASSERT(segmentIndex < static_cast<u32>(m_segments.size()));
+
+  // make sure value is valid and convert it into [0-length] space
+  const float32 distance = Math::Clamp(parameter, 0.0f, 1.0f) * m_length;
+
+  // find last segment starting at or before given distance
+  // NOTE: since 'parameter' is enforced to be in [0-1] interval, it can be assumed that if distance is past the last segment (ie due to round errors) it 
+  //       is still valid to process the last segment
+  const u32 lastIndex = static_cast<u32>(m_segments.size()) - 1;
+  if ((0 == segmentIndex) || (m_segments[segmentIndex].offset < distance))
+  {
+    // walk forward from given segment
+    while ((segmentIndex < lastIndex) && (m_segments[segmentIndex + 1].offset < distance))
     {
-      // re-map to [0-1] interval of current segement
-      parameter = Math::Clamp(parameter / segment.length, 0.0f, 1.0f);
+      ++segmentIndex;
+    }
+  }
+  else
+  {
+    s32 low  = 0;
+    s32 high = static_cast<s32>(lastIndex);
+    while (low < high)
+    {
+      const s32 middle = (low + high + 1) / 2;
+      if (m_segments[middle].offset < distance)
+      {
+        low = middle;
+      }
+      else
+      {
+        high = middle - 1;
+      }
+    }
+
+    segmentIndex = static_cast<u32>(low);
+  }
+
+  const SegmentData& segment = m_segments[segmentIndex];
 
-      // get value within segment
-      out = value(parameter, segment);
+  // re-map to [0-1] interval of current segement
+  segmentParameter = (0.0f < segment.length) ? Math::Clamp((distance - segment.offset) / segment.length, 0.0f, 1.0f) : 0.0f;
+
+  return segment;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const CubicSpline::SegmentData& CubicSpline::locateUniform(float32 parameter, float32& segmentParameter) const
+{
+  EGE_ASSERT(2 <= m_arcLengthTable.size());
 
-      // done
-      parameter = -1.0f;
+  // NOTE: starting from last selectable sample makes whole table to be searched unless position lies past it
+  u32 sampleIndex = static_cast<u32>(m_arcLengthTable.size()) - 2;
+  return locateUniform(parameter, segmentParameter, sampleIndex);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const CubicSpline::SegmentData& CubicSpline::locateUniform(float32 parameter, float32& segmentParameter, u32& sampleIndex) const
+{
+  EGE_ASSERT(2 <= m_arcLengthTable.size());
+  EGE_ASSERT(sampleIndex + 1 < static_cast<u32>(m_arcLengthTable.size()));
+
+  // make sure value is valid and convert it into [0-length] space
+  const float32 distance = Math::Clamp(parameter, 0.0f, 1.0f) * m_length;
+
+  // find last sample at or before given distance
+  // NOTE: last sample is never selected so there is always a next one to interpolate towards
+  const u32 lastIndex = static_cast<u32>(m_arcLengthTable.size()) - 2;
+  if ((0 == sampleIndex) || (m_arcLengthTable[sampleIndex].distance <= distance))
+  {
+    // walk forward from given sample
+    while ((sampleIndex < lastIndex) && (m_arcLengthTable[sampleIndex + 1].distance <= distance))
+    {
+      ++sampleIndex;
     }
-    else
+  }
+  else
+  {
+    s32 low  = 0;
+    s32 high = static_cast<s32>(lastIndex);
+    while (low < high)
     {
-      // update remaining distance
-      parameter -= segment.length;
+      const s32 middle = (low + high + 1) / 2;
+      if (m_arcLengthTable[middle].distance <= distance)
+      {
+        low = middle;
+      }
+      else
+      {
+        high = middle - 1;
+      }
     }
+
+    sampleIndex = static_cast<u32>(low);
   }
 
-  return out;
+  const ArcLengthSample& sample     = m_arcLengthTable[sampleIndex];
+  const ArcLengthSample& nextSample = m_arcLengthTable[sampleIndex + 1];
+
+  // interpolate parameter between samples
+  // NOTE: samples of different segments meet at the same distance, in such case segment end is used
+  segmentParameter = sample.parameter;
+  if ((sample.segment == nextSample.segment) && (sample.distance < nextSample.distance))
+  {
+    const float32 factor = Math::Clamp((distance - sample.distance) / (nextSample.distance - sample.distance), 0.0f, 1.0f);
+    segmentParameter = sample.parameter + (nextSample.parameter - sample.parameter) * factor;
+  }
+
+  return m_segments[sample.segment];
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void CubicSpline::calculateSegmentLength(const SegmentData& segment) const
+void CubicSpline::updateArcLengthTable()
 {
   const float32 step = 0.01f;
 
-  float32 length = 0;
-  for (float32 t = 0; t < 1.0f; t += step)
+  m_arcLengthTable.clear();
+
+  // go thru all segments
+  float32 totalLength = 0;
+  for (u32 i = 0; i < static_cast<u32>(m_segments.size()); ++i)
   {
-    const Vector3f posA = value(t, segment);
-    const Vector3f posB = value(Math::Min(t + step, 1.0f), segment);
+    SegmentData& segment = m_segments[i];
+
+    segment.offset = totalLength;
+
+    // add segment start sample
+    ArcLengthSample sample;
+    sample.distance  = totalLength;
+    sample.parameter = 0;
+    sample.segment   = i;
+    m_arcLengthTable.push_back(sample);
+
+    // approximate segment with line pieces
+    float32 length = 0;
+    for (float32 t = 0; t < 1.0f; t += step)
+    {
+      const float32 nextT = Math::Min(t + step, 1.0f);
+
+      const Vector3f posA = value(t, segment);
+      const Vector3f posB = value(nextT, segment);
+
+      length += (posB - posA).length();
 
-    length += (posB - posA).length();
+      // add sample
+      sample.distance  = totalLength + length;
+      sample.parameter = nextT;
+      m_arcLengthTable.push_back(sample);
+    }
+
+    // update lengths
+    segment.length = length;
+    totalLength += length;
   }
 
-  // update length
-  segment.length = length;
+  // store new spline length
+  m_length = totalLength;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Vector3f CubicSpline::value(float32 parameter, const SegmentData& segment) const
@@ -187,33 +419,31 @@ Vector3f CubicSpline::value(float32 parameter, const SegmentData& segment) const
          (m_matrix.data[12] * t3 + m_matrix.data[13] * t2 + m_matrix.data[14] * parameter + m_matrix.data[15]) * segment.control2;  
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-float32 CubicSpline::length() const
+Vector3f CubicSpline::tangent(float32 parameter, const SegmentData& segment) const
 {
-  // check if invalid
-  if ( ! m_length.isValid())
-  {
-    float32 length = 0;
-
-    // go thru all segments and sum up their lengths
-    for (SegmentArray::const_iterator it = m_segments.begin(); it != m_segments.end(); ++it)
-    {
-      const SegmentData& segment = *it;
-
-      // check if segment data length needs update
-      if ( ! segment.length.isValid())
-      {
-        // recalculate segment length
-        calculateSegmentLength(segment);
-      }
+  const float32 t2 = parameter * parameter;
 
-      // update total spline length
-      length += segment.length.data();
-    }
+  // differentiate basis polynomials
+  Vector3f out = (3.0f * m_matrix.data[0]  * t2 + 2.0f * m_matrix.data[1]  * parameter + m_matrix.data[2])  * segment.begin +
+                 (3.0f * m_matrix.data[4]  * t2 + 2.0f * m_matrix.data[5]  * parameter + m_matrix.data[6])  * segment.end +
+                 (3.0f * m_matrix.data[8]  * t2 + 2.0f * m_matrix.data[9]  * parameter + m_matrix.data[10]) * segment.control1 +
+                 (3.0f * m_matrix.data[12] * t2 + 2.0f * m_matrix.data[13] * parameter + m_matrix.data[14]) * segment.control2;
 
-    // store new spline length
-    m_length = length;
+  // check if tangent is defined
+  if (Math::EPSILON_SQUARED < out.lengthSquared())
+  {
+    out.normalize();
+  }
+  else
+  {
+    out = Vector3f::ZERO;
   }
 
+  return out;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+float32 CubicSpline::length() const
+{
   return m_length;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
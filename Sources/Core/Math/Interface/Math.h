@@ -158,6 +158,41 @@ class Math
      */
     template <typename T>
     static TVector3<T> Transform(const TVector3<T>& vector, const TQuaternion<T>& quaternion);
+    /*! Transforms array of 2D points by matrix. 
+     *  @param  out       Pointer to first transformed point.
+     *  @param  outStride Distance (in bytes) between consecutive transformed points.
+     *  @param  in        Pointer to first point to be transformed.
+     *  @param  inStride  Distance (in bytes) between consecutive points to be transformed.
+     *  @param  count     Number of points to transform.
+     *  @param  matrix    Transformation matrix.
+     *  @note Points are treated as (x, y, 0, 1). Thus, only affine 2D part of the matrix is used.
+     *  @note Input and output arrays may be the same. Strides allow for operating directly on interleaved vertex data.
+     */
+    template <typename T>
+    static void Transform(TVector2<T>* out, u32 outStride, const TVector2<T>* in, u32 inStride, u32 count, const TMatrix4<T>& matrix);
+    /*! Transforms array of 3D points by matrix. 
+     *  @param  out       Pointer to first transformed point.
+     *  @param  outStride Distance (in bytes) between consecutive transformed points.
+     *  @param  in        Pointer to first point to be transformed.
+     *  @param  inStride  Distance (in bytes) between consecutive points to be transformed.
+     *  @param  count     Number of points to transform.
+     *  @param  matrix    Transformation matrix.
+     *  @note Points are treated as (x, y, z, 1). Resulting W component is discarded.
+     *  @note Input and output arrays may be the same. Strides allow for operating directly on interleaved vertex data.
+     */
+    template <typename T>
+    static void Transform(TVector3<T>* out, u32 outStride, const TVector3<T>* in, u32 inStride, u32 count, const TMatrix4<T>& matrix);
+    /*! Transforms array of vectors by matrix. 
+     *  @param  out       Pointer to first transformed vector.
+     *  @param  outStride Distance (in bytes) between consecutive transformed vectors.
+     *  @param  in        Pointer to first vector to be transformed.
+     *  @param  inStride  Distance (in bytes) between consecutive vectors to be transformed.
+     *  @param  count     Number of vectors to transform.
+     *  @param  matrix    Transformation matrix.
+     *  @note Input and output arrays may be the same. Strides allow for operating directly on interleaved vertex data.
+     */
+    template <typename T>
+    static void Transform(TVector4<T>* out, u32 outStride, const TVector4<T>* in, u32 inStride, u32 count, const TMatrix4<T>& matrix);
 
     /*! Creates matrix from translation, scale vectors and rotation quaternion. 
      *  @param  translation Translation vector.
@@ -442,6 +477,60 @@ TVector4<T> Math::Transform(const TVector4<T>& vector, const TMatrix4<T>& matrix
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 template <typename T>
+void Math::Transform(TVector2<T>* out, u32 outStride, const TVector2<T>* in, u32 inStride, u32 count, const TMatrix4<T>& matrix)
+{
+  const u8* inData = reinterpret_cast<const u8*>(in);
+  u8* outData      = reinterpret_cast<u8*>(out);
+
+  for (u32 i = 0; i < count; ++i, inData += inStride, outData += outStride)
+  {
+    const TVector2<T>* vector = reinterpret_cast<const TVector2<T>*>(inData);
+    TVector2<T>* result       = reinterpret_cast<TVector2<T>*>(outData);
+
+    // NOTE: input is read completely before writing as transformation can be done in place
+    const T x = vector->x;
+    const T y = vector->y;
+
+    result->x = matrix.data[0] * x + matrix.data[4] * y + matrix.data[12];
+    result->y = matrix.data[1] * x + matrix.data[5] * y + matrix.data[13];
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <typename T>
+void Math::Transform(TVector3<T>* out, u32 outStride, const TVector3<T>* in, u32 inStride, u32 count, const TMatrix4<T>& matrix)
+{
+  const u8* inData = reinterpret_cast<const u8*>(in);
+  u8* outData      = reinterpret_cast<u8*>(out);
+
+  for (u32 i = 0; i < count; ++i, inData += inStride, outData += outStride)
+  {
+    const TVector3<T>* vector = reinterpret_cast<const TVector3<T>*>(inData);
+    TVector3<T>* result       = reinterpret_cast<TVector3<T>*>(outData);
+
+    // NOTE: input is read completely before writing as transformation can be done in place
+    const T x = vector->x;
+    const T y = vector->y;
+    const T z = vector->z;
+
+    result->x = matrix.data[0] * x + matrix.data[4] * y + matrix.data[8]  * z + matrix.data[12];
+    result->y = matrix.data[1] * x + matrix.data[5] * y + matrix.data[9]  * z + matrix.data[13];
+    result->z = matrix.data[2] * x + matrix.data[6] * y + matrix.data[10] * z + matrix.data[14];
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <typename T>
+void Math::Transform(TVector4<T>* out, u32 outStride, const TVector4<T>* in, u32 inStride, u32 count, const TMatrix4<T>& matrix)
+{
+  const u8* inData = reinterpret_cast<const u8*>(in);
+  u8* outData      = reinterpret_cast<u8*>(out);
+
+  for (u32 i = 0; i < count; ++i, inData += inStride, outData += outStride)
+  {
+    *reinterpret_cast<TVector4<T>*>(outData) = Math::Transform(*reinterpret_cast<const TVector4<T>*>(inData), matrix);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <typename T>
 TVector3<T> Math::Transform(const TVector3<T>& vector, const TQuaternion<T>& quaternion)
 {
   // nVidia SDK implementation
@@ -464,21 +553,8 @@ TMatrix4<T> Math::CreateMatrix(const TVector4<T>& translation, const TVector4<T>
   //    1. Scale
   //    2. Rotate
   //    3. Translate
-
-  const TMatrix4<T> scaleMatrix(scale.x, 0, 0, 0, 0, scale.y, 0, 0, 0, 0, scale.z, 0, 0, 0, 0, scale.w);
-
-  // convert quaternion into rotation matrix
-  TMatrix4<T> rotationMatrix;
-  Math::Convert(rotationMatrix, orientation);
-
-  // combine 1. and 2.
-  TMatrix4<T> matrix = rotationMatrix.multiply(scaleMatrix);
-
-  // apply 3.
-  matrix.setTranslation(translation.x, translation.y, translation.z);
-  matrix.data[15] = 1;
-
-  return matrix;
+  // NOTE: composition is done directly without intermediate matrices
+  return TMatrix4<T>(translation, scale, orientation);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 template <typename T>
@@ -12,12 +12,18 @@
 
 #include "EGETypes.h"
 #include "EGEDebug.h"
+#include "Core/Math/Interface/Math.h"
+#include "Core/Math/Interface/Vector2.h"
+#include "Core/Math/Interface/Vector3.h"
+#include "Core/Math/Interface/Vector4.h"
+#include "Core/Math/Implementation/MathSIMD.h"
+#include "Core/Math/Implementation/QuaternionTypes.h"
 
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 template <typename T>
-class TMatrix4
+class EGE_MATH_ALIGN16 TMatrix4
 {
 	public:
 
@@ -26,6 +32,13 @@ class TMatrix4
 		TMatrix4(T m00, T m01, T m02, T m03, T m10, T m11, T m12, T m13, T m20, T m21, T m22, T m23, T m30, T m31, T m32, T m33);
 		TMatrix4(const T column0[4], const T column1[4], const T column2[4], const T column3[4]);
 		TMatrix4(const TMatrix4& matrix);
+    /*! Creates affine matrix from translation, scale vectors and rotation quaternion. 
+     *  @param  translation Translation vector.
+     *  @param  scale       Scale vector.
+     *  @param  orientation Rotation quaternion.
+     *  @note Result is equivalent to translation * rotation * scale composition, however, it is calculated directly.
+     */
+    TMatrix4(const TVector4<T>& translation, const TVector4<T>& scale, const TQuaternion<T>& orientation);
 
   operators:
 
@@ -44,6 +57,12 @@ class TMatrix4
      *  @return Resulting matrix.
      */
     TMatrix4<T> multiply(const TMatrix4<T>& matrix) const;
+    /*! Concatenates current and given affine matrix. 
+     *  @param  matrix  Matrix to concatenate with.
+     *  @return Resulting matrix.
+     *  @note Both matrices MUST be affine. Last row is not calculated.
+     */
+    TMatrix4<T> multiplyAffine(const TMatrix4<T>& matrix) const;
     /*! Returns transposed matrix. */
     TMatrix4<T> transposed() const;
     /*! Returns TRUE if matrix is affine. */
@@ -131,7 +150,7 @@ TMatrix4<T>::TMatrix4(const T column0[4], const T column1[4], const T column2[4]
 template <typename T>
 TMatrix4<T>::TMatrix4(const T data[16])
 {
-  EGE_MEMCPY(this->data, data, sizeof (data) * 16);
+  EGE_MEMCPY(this->data, data, sizeof (T) * 16);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 template <typename T>
@@ -141,6 +160,36 @@ TMatrix4<T>::TMatrix4(const TMatrix4<T>& matrix)
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 template <typename T>
+TMatrix4<T>::TMatrix4(const TVector4<T>& translation, const TVector4<T>& scale, const TQuaternion<T>& orientation)
+{
+  // NOTE: each column is a column of rotation matrix (see Math::Convert) scaled by corresponding scale component
+
+  // 1st column
+  data[0] = (1 - 2 * (orientation.y * orientation.y + orientation.z * orientation.z)) * scale.x;
+  data[1] = (2 * (orientation.x * orientation.y - orientation.z * orientation.w)) * scale.x;
+  data[2] = (2 * (orientation.x * orientation.z + orientation.y * orientation.w)) * scale.x;
+  data[3] = 0;
+
+  // 2nd column
+  data[4] = (2 * (orientation.x * orientation.y + orientation.z * orientation.w)) * scale.y;
+  data[5] = (1 - 2 * (orientation.x * orientation.x + orientation.z * orientation.z)) * scale.y;
+  data[6] = (2 * (orientation.z * orientation.y - orientation.x * orientation.w)) * scale.y;
+  data[7] = 0;
+
+  // 3rd column
+  data[8]  = (2 * (orientation.x * orientation.z - orientation.y * orientation.w)) * scale.z;
+  data[9]  = (2 * (orientation.y * orientation.z + orientation.x * orientation.w)) * scale.z;
+  data[10] = (1 - 2 * (orientation.x * orientation.x + orientation.y * orientation.y)) * scale.z;
+  data[11] = 0;
+
+  // 4th column
+  data[12] = translation.x;
+  data[13] = translation.y;
+  data[14] = translation.z;
+  data[15] = 1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <typename T>
 TMatrix4<T>& TMatrix4<T>::operator += (const TMatrix4<T>& matrix)
 {
   for (u32 entry = 0; entry < 16; ++entry)
@@ -243,6 +292,40 @@ TMatrix4<T> TMatrix4<T>::multiply(const TMatrix4<T>& matrix) const
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 template <typename T>
+TMatrix4<T> TMatrix4<T>::multiplyAffine(const TMatrix4<T>& matrix) const
+{
+  EGE_ASSERT(isAffine() && matrix.isAffine());
+
+  TMatrix4<T> newMatrix;
+
+  // 1st row
+  newMatrix.data[0]  = data[0] * matrix.data[0]  + data[4] * matrix.data[1]  + data[8] * matrix.data[2];
+  newMatrix.data[4]  = data[0] * matrix.data[4]  + data[4] * matrix.data[5]  + data[8] * matrix.data[6];
+  newMatrix.data[8]  = data[0] * matrix.data[8]  + data[4] * matrix.data[9]  + data[8] * matrix.data[10];
+  newMatrix.data[12] = data[0] * matrix.data[12] + data[4] * matrix.data[13] + data[8] * matrix.data[14] + data[12];
+  
+  // 2nd row
+  newMatrix.data[1]  = data[1] * matrix.data[0]  + data[5] * matrix.data[1]  + data[9] * matrix.data[2];
+  newMatrix.data[5]  = data[1] * matrix.data[4]  + data[5] * matrix.data[5]  + data[9] * matrix.data[6];
+  newMatrix.data[9]  = data[1] * matrix.data[8]  + data[5] * matrix.data[9]  + data[9] * matrix.data[10];
+  newMatrix.data[13] = data[1] * matrix.data[12] + data[5] * matrix.data[13] + data[9] * matrix.data[14] + data[13];
+
+  // 3rd row
+  newMatrix.data[2]  = data[2] * matrix.data[0]  + data[6] * matrix.data[1]  + data[10] * matrix.data[2];
+  newMatrix.data[6]  = data[2] * matrix.data[4]  + data[6] * matrix.data[5]  + data[10] * matrix.data[6];
+  newMatrix.data[10] = data[2] * matrix.data[8]  + data[6] * matrix.data[9]  + data[10] * matrix.data[10];
+  newMatrix.data[14] = data[2] * matrix.data[12] + data[6] * matrix.data[13] + data[10] * matrix.data[14] + data[14];
+
+  // 4th row
+  newMatrix.data[3]  = 0;
+  newMatrix.data[7]  = 0;
+  newMatrix.data[11] = 0;
+  newMatrix.data[15] = 1;
+
+  return newMatrix;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <typename T>
 TMatrix4<T> TMatrix4<T>::transposed() const
 {
   return TMatrix4<T>(data[0], data[4], data[8], data[12], data[1], data[5], data[9], data[13], data[2], data[6], data[10], data[14], data[3], data[7], data[11], 
@@ -325,6 +408,141 @@ TMatrix4<T> operator * (const TMatrix4<T>& left, const TMatrix4<T>& right)
   return left.multiply(right);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+#if EGE_MATH_SIMD
+template <>
+inline TMatrix4<float32> TMatrix4<float32>::multiply(const TMatrix4<float32>& matrix) const
+{
+  const MathSIMD::Vector column0 = MathSIMD::Load(data);
+  const MathSIMD::Vector column1 = MathSIMD::Load(data + 4);
+  const MathSIMD::Vector column2 = MathSIMD::Load(data + 8);
+  const MathSIMD::Vector column3 = MathSIMD::Load(data + 12);
+
+  TMatrix4<float32> newMatrix;
+
+  // NOTE: each resulting column is a combination of current columns weighted by corresponding column of given matrix
+  MathSIMD::Store(newMatrix.data,      MathSIMD::Combine(column0, column1, column2, column3, MathSIMD::Load(matrix.data)));
+  MathSIMD::Store(newMatrix.data + 4,  MathSIMD::Combine(column0, column1, column2, column3, MathSIMD::Load(matrix.data + 4)));
+  MathSIMD::Store(newMatrix.data + 8,  MathSIMD::Combine(column0, column1, column2, column3, MathSIMD::Load(matrix.data + 8)));
+  MathSIMD::Store(newMatrix.data + 12, MathSIMD::Combine(column0, column1, column2, column3, MathSIMD::Load(matrix.data + 12)));
+
+  return newMatrix;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <>
+inline TMatrix4<float32> TMatrix4<float32>::multiplyAffine(const TMatrix4<float32>& matrix) const
+{
+  EGE_ASSERT(isAffine() && matrix.isAffine());
+
+  const MathSIMD::Vector column0 = MathSIMD::Load(data);
+  const MathSIMD::Vector column1 = MathSIMD::Load(data + 4);
+  const MathSIMD::Vector column2 = MathSIMD::Load(data + 8);
+  const MathSIMD::Vector column3 = MathSIMD::Load(data + 12);
+
+  TMatrix4<float32> newMatrix;
+
+  // NOTE: as both matrices are affine, last row of each combination is already [0 0 0 1]
+  MathSIMD::Store(newMatrix.data,      MathSIMD::Combine(column0, column1, column2, MathSIMD::Load(matrix.data)));
+  MathSIMD::Store(newMatrix.data + 4,  MathSIMD::Combine(column0, column1, column2, MathSIMD::Load(matrix.data + 4)));
+  MathSIMD::Store(newMatrix.data + 8,  MathSIMD::Combine(column0, column1, column2, MathSIMD::Load(matrix.data + 8)));
+  MathSIMD::Store(newMatrix.data + 12, MathSIMD::Add(MathSIMD::Combine(column0, column1, column2, MathSIMD::Load(matrix.data + 12)), column3));
+
+  return newMatrix;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <>
+inline TVector4<float32> Math::Transform(const TVector4<float32>& vector, const TMatrix4<float32>& matrix)
+{
+  TVector4<float32> result;
+  MathSIMD::Store(&result.x, MathSIMD::Combine(MathSIMD::Load(matrix.data), MathSIMD::Load(matrix.data + 4), MathSIMD::Load(matrix.data + 8), 
+                                               MathSIMD::Load(matrix.data + 12), MathSIMD::Load(&vector.x)));
+
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <>
+inline void Math::Transform(TVector2<float32>* out, u32 outStride, const TVector2<float32>* in, u32 inStride, u32 count, 
+                            const TMatrix4<float32>& matrix)
+{
+  const u8* inData = reinterpret_cast<const u8*>(in);
+  u8* outData      = reinterpret_cast<u8*>(out);
+
+  // NOTE: two points are transformed at once, each occupying half of the register
+  const MathSIMD::Vector column0     = MathSIMD::Set(matrix.data[0], matrix.data[1], matrix.data[0], matrix.data[1]);
+  const MathSIMD::Vector column1     = MathSIMD::Set(matrix.data[4], matrix.data[5], matrix.data[4], matrix.data[5]);
+  const MathSIMD::Vector translation = MathSIMD::Set(matrix.data[12], matrix.data[13], matrix.data[12], matrix.data[13]);
+
+  u32 i = 0;
+  for (; i + 1 < count; i += 2, inData += 2 * inStride, outData += 2 * outStride)
+  {
+    const TVector2<float32>* vector0 = reinterpret_cast<const TVector2<float32>*>(inData);
+    const TVector2<float32>* vector1 = reinterpret_cast<const TVector2<float32>*>(inData + inStride);
+
+    MathSIMD::Vector value = MathSIMD::Multiply(column0, MathSIMD::Set(vector0->x, vector0->x, vector1->x, vector1->x));
+    value = MathSIMD::MultiplyAdd(value, column1, MathSIMD::Set(vector0->y, vector0->y, vector1->y, vector1->y));
+    value = MathSIMD::Add(value, translation);
+
+    MathSIMD::Store2(reinterpret_cast<float32*>(outData), value);
+    MathSIMD::Store2(reinterpret_cast<float32*>(outData + outStride), MathSIMD::Swizzle<2, 3, 2, 3>(value));
+  }
+
+  // process remaining point
+  if (i < count)
+  {
+    const TVector2<float32>* vector = reinterpret_cast<const TVector2<float32>*>(inData);
+    TVector2<float32>* result       = reinterpret_cast<TVector2<float32>*>(outData);
+
+    const float32 x = vector->x;
+    const float32 y = vector->y;
+
+    result->x = matrix.data[0] * x + matrix.data[4] * y + matrix.data[12];
+    result->y = matrix.data[1] * x + matrix.data[5] * y + matrix.data[13];
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <>
+inline void Math::Transform(TVector3<float32>* out, u32 outStride, const TVector3<float32>* in, u32 inStride, u32 count, 
+                            const TMatrix4<float32>& matrix)
+{
+  const u8* inData = reinterpret_cast<const u8*>(in);
+  u8* outData      = reinterpret_cast<u8*>(out);
+
+  const MathSIMD::Vector column0 = MathSIMD::Load(matrix.data);
+  const MathSIMD::Vector column1 = MathSIMD::Load(matrix.data + 4);
+  const MathSIMD::Vector column2 = MathSIMD::Load(matrix.data + 8);
+  const MathSIMD::Vector column3 = MathSIMD::Load(matrix.data + 12);
+
+  for (u32 i = 0; i < count; ++i, inData += inStride, outData += outStride)
+  {
+    const TVector3<float32>* vector = reinterpret_cast<const TVector3<float32>*>(inData);
+
+    // NOTE: points are neither loaded nor stored as whole registers as it could access memory past the last one
+    MathSIMD::Vector value = MathSIMD::Multiply(column0, MathSIMD::Splat(vector->x));
+    value = MathSIMD::MultiplyAdd(value, column1, MathSIMD::Splat(vector->y));
+    value = MathSIMD::MultiplyAdd(value, column2, MathSIMD::Splat(vector->z));
+    MathSIMD::Store3(reinterpret_cast<float32*>(outData), MathSIMD::Add(value, column3));
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <>
+inline void Math::Transform(TVector4<float32>* out, u32 outStride, const TVector4<float32>* in, u32 inStride, u32 count, 
+                            const TMatrix4<float32>& matrix)
+{
+  const u8* inData = reinterpret_cast<const u8*>(in);
+  u8* outData      = reinterpret_cast<u8*>(out);
+
+  const MathSIMD::Vector column0 = MathSIMD::Load(matrix.data);
+  const MathSIMD::Vector column1 = MathSIMD::Load(matrix.data + 4);
+  const MathSIMD::Vector column2 = MathSIMD::Load(matrix.data + 8);
+  const MathSIMD::Vector column3 = MathSIMD::Load(matrix.data + 12);
+
+  for (u32 i = 0; i < count; ++i, inData += inStride, outData += outStride)
+  {
+    MathSIMD::Store(reinterpret_cast<float32*>(outData), MathSIMD::Combine(column0, column1, column2, column3, 
+                                                                           MathSIMD::Load(reinterpret_cast<const float32*>(inData))));
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+#endif // EGE_MATH_SIMD
 template <typename T>
 Debug operator << (Debug debug, const TMatrix4<T>& obj)
 {
@@ -11,12 +11,13 @@
 
 #include "EGETypes.h"
 #include "Core/Math/Interface/Math.h"
+#include "Core/Math/Implementation/MathSIMD.h"
 
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 template <typename T>
-class TQuaternion
+class EGE_MATH_ALIGN16 TQuaternion
 {
   public:
 
@@ -266,6 +267,26 @@ TQuaternion<T> operator + (const TQuaternion<T>& left, const TQuaternion<T>& rig
   return TQuaternion<T>(left.x + right.x, left.y + right.y, left.z + right.z, left.w + right.w);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+#if EGE_MATH_SIMD
+template <>
+inline TQuaternion<float32> TQuaternion<float32>::multiply(const TQuaternion<float32>& quat) const
+{
+  const MathSIMD::Vector left  = MathSIMD::Load(&x);
+  const MathSIMD::Vector right = MathSIMD::Load(&quat.x);
+  const MathSIMD::Vector sign  = MathSIMD::Set(1, 1, 1, -1);
+
+  // NOTE: terms are arranged so each component is evaluated in the same order as in generic implementation
+  const MathSIMD::Vector a = MathSIMD::Multiply(MathSIMD::Swizzle<3, 3, 3, 3>(left), right);
+  const MathSIMD::Vector b = MathSIMD::Multiply(MathSIMD::Multiply(MathSIMD::Swizzle<0, 1, 2, 0>(left), MathSIMD::Swizzle<3, 3, 3, 0>(right)), sign);
+  const MathSIMD::Vector c = MathSIMD::Multiply(MathSIMD::Multiply(MathSIMD::Swizzle<1, 2, 0, 1>(left), MathSIMD::Swizzle<2, 0, 1, 1>(right)), sign);
+  const MathSIMD::Vector d = MathSIMD::Multiply(MathSIMD::Swizzle<2, 0, 1, 2>(left), MathSIMD::Swizzle<1, 2, 0, 2>(right));
+
+  TQuaternion<float32> out;
+  MathSIMD::Store(&out.x, MathSIMD::Subtract(MathSIMD::Add(MathSIMD::Add(a, b), c), d));
+  return out;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+#endif // EGE_MATH_SIMD
 
 EGE_NAMESPACE_END
 
@@ -74,6 +74,12 @@ class TRect
      *  @return Intersection rectangle. In case of no intersection, returned rectangle may be either NULL or EMPTY.
      */
     TRect<T> intersect(const TRect<T>& other) const;
+    /*! Returns TRUE if given rectangle overlaps current one. 
+     *  @param  other Rectangle to test.
+     *  @return Returns TRUE if rectangles share at least one point. EMPTY and NULL rectangles never overlap.
+     *  @note This is cheaper than checking the result of intersect().
+     */
+    bool intersects(const TRect<T>& other) const;
     /*! Calculates union rectangle between current and given rectangle. 
      *  @param  other Rectangle to unite with.
      *  @return United rectangle.
@@ -208,6 +214,18 @@ TRect<T> TRect<T>::intersect(const TRect<T>& other) const
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 template <typename T>
+bool TRect<T>::intersects(const TRect<T>& other) const
+{
+  // sanity checks
+  if (other.isNull() || other.isEmpty() || isNull() || isEmpty())
+  {
+    return false;
+  }
+
+  return (other.x <= right()) && (x <= other.right()) && (other.y <= bottom()) && (y <= other.bottom());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <typename T>
 TRect<T> TRect<T>::unite(const TRect<T>& other) const
 {
   TRect<T> out;
@@ -60,6 +60,41 @@ class CubicSpline : public Spline
     /*! @see Spline::length. */
     float32 length() const override;
 
+    /*! Calculates values on spline at given positions.
+     *  @param  parameters  Array of parametrized distances on a spline at which calculations are done. Typicially in [0-1] interval.
+     *  @param  out         Array of calculated positions. Must be capable of holding count elements.
+     *  @param  count       Number of positions to calculate.
+     *  @note Parameters are interpreted the same way as in value(float32).
+     *  @note Segments are walked forward between consecutive parameters, so sorting parameters in ascending order makes whole calculation linear.
+     */
+    void values(const float32* parameters, Vector3f* out, u32 count) const;
+    /*! Calculates value on spline at given fraction of its arc length.
+     *  @param  parameter Fraction of arc length of a spline at which calculations are done. Typicially in [0-1] interval.
+     *  @return Calculated position on spline at given position.
+     *  @note Contrary to value(float32), evenly distributed parameters result in evenly distributed positions along the curve (constant speed).
+     */
+    Vector3f uniformValue(float32 parameter) const;
+    /*! Calculates values on spline at given fractions of its arc length.
+     *  @param  parameters  Array of fractions of arc length at which calculations are done. Typicially in [0-1] interval.
+     *  @param  out         Array of calculated positions. Must be capable of holding count elements.
+     *  @param  count       Number of positions to calculate.
+     *  @note Parameters are interpreted the same way as in uniformValue(float32).
+     *  @note Arc length table is walked forward between consecutive parameters, so sorting parameters in ascending order makes whole calculation linear.
+     */
+    void uniformValues(const float32* parameters, Vector3f* out, u32 count) const;
+    /*! Calculates normalized tangent on spline at given position.
+     *  @param  parameter Parametrized distance on a spline at which calculations are done. Typicially in [0-1] interval.
+     *  @return Unit tangent vector at given position. Zero vector if tangent is undefined.
+     *  @note Parameter is interpreted the same way as in value(float32).
+     */
+    Vector3f tangent(float32 parameter) const;
+    /*! Calculates normalized tangent on spline at given fraction of its arc length.
+     *  @param  parameter Fraction of arc length of a spline at which calculations are done. Typicially in [0-1] interval.
+     *  @return Unit tangent vector at given position. Zero vector if tangent is undefined.
+     *  @note Parameter is interpreted the same way as in uniformValue(float32).
+     */
+    Vector3f uniformTangent(float32 parameter) const;
+
   private:
 
     /*! Segment data struct. */
@@ -70,23 +105,65 @@ class CubicSpline : public Spline
       Vector3f control2;              /*!< Segment second control point. */
       Vector3f end;                   /*!< Segment end point. */
 
-      mutable CachedFloat32 length;   /*! Segment length. */
+      float32 length;                 /*!< Segment length. */
+      float32 offset;                 /*!< Distance along spline from its start to segment start. */
+    };
+
+    /*! Arc length table entry struct. */
+    struct ArcLengthSample
+    {
+      float32 distance;               /*!< Distance along spline from its start. */
+      float32 parameter;              /*!< Parametrized distance within segment at which distance is reached. */
+      u32 segment;                    /*!< Index of the segment. */
     };
 
     typedef DynamicArray<SegmentData> SegmentArray;
+    typedef DynamicArray<ArcLengthSample> ArcLengthSampleArray;
 
   private:
 
-    /*! Updates segment length. 
-     *  @param  segment Segment for which length is to be updated (recalculated).
+    /*! Recalculates lengths of all segments and arc length table. */
+    void updateArcLengthTable();
+    /*! Maps given position on spline into segment and parametrized distance within it.
+     *  @param  parameter         Parametrized distance on a spline. Interpreted the same way as in value(float32).
+     *  @param  segmentParameter  Parametrized distance within returned segment.
+     *  @return Segment containing given position.
+     */
+    const SegmentData& locate(float32 parameter, float32& segmentParameter) const;
+    /*! Maps given position on spline into segment and parametrized distance within it, starting search from a given segment.
+     *  @param  parameter         Parametrized distance on a spline. Interpreted the same way as in value(float32).
+     *  @param  segmentParameter  Parametrized distance within returned segment.
+     *  @param  segmentIndex      Index of segment to start search from. Upon return, index of returned segment.
+     *  @return Segment containing given position.
+     *  @note If given position lies before segment to start from, whole spline is searched. Otherwise, segments are walked forward.
+     */
+    const SegmentData& locate(float32 parameter, float32& segmentParameter, u32& segmentIndex) const;
+    /*! Maps given fraction of arc length into segment and parametrized distance within it.
+     *  @param  parameter         Fraction of arc length of a spline. Interpreted the same way as in uniformValue(float32).
+     *  @param  segmentParameter  Parametrized distance within returned segment.
+     *  @return Segment containing given position.
+     */
+    const SegmentData& locateUniform(float32 parameter, float32& segmentParameter) const;
+    /*! Maps given fraction of arc length into segment and parametrized distance within it, starting search from a given arc length sample.
+     *  @param  parameter         Fraction of arc length of a spline. Interpreted the same way as in uniformValue(float32).
+     *  @param  segmentParameter  Parametrized distance within returned segment.
+     *  @param  sampleIndex       Index of arc length sample to start search from. Upon return, index of sample preceding given position.
+     *  @return Segment containing given position.
+     *  @note If given position lies before sample to start from, whole arc length table is searched. Otherwise, samples are walked forward.
      */
-    void calculateSegmentLength(const SegmentData& segment) const;
+    const SegmentData& locateUniform(float32 parameter, float32& segmentParameter, u32& sampleIndex) const;
     /*! Calculates value within a segment at given position.
      *  @param parameter  Parametrized distance on a segment at which calculations are done. Typicially in [0-1] interval.
      *  @param segment    Segment on which data is being calculated.
      *  @return Calculated position on segment at given position.
      */
     Vector3f value(float32 parameter, const SegmentData& segment) const;
+    /*! Calculates normalized tangent within a segment at given position.
+     *  @param parameter  Parametrized distance on a segment at which calculations are done. Typicially in [0-1] interval.
+     *  @param segment    Segment on which data is being calculated.
+     *  @return Unit tangent vector at given position on segment. Zero vector if tangent is undefined.
+     */
+    Vector3f tangent(float32 parameter, const SegmentData& segment) const;
 
   private:
 
@@ -96,6 +173,8 @@ class CubicSpline : public Spline
     Matrix4f m_matrix;
     /*! List of all spline segments. */
     SegmentArray m_segments;
+    /*! Arc length table. Samples are sorted by distance. */
+    ArcLengthSampleArray m_arcLengthTable;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -6,12 +6,13 @@
 
 #include "EGETypes.h"
 #include "EGEDebug.h"
+#include "Core/Math/Implementation/MathSIMD.h"
 
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 template <typename T>
-class TVector4 
+class EGE_MATH_ALIGN16 TVector4 
 {
 	public:
 
@@ -160,6 +161,50 @@ TVector4<T> operator - (const TVector4<T>& left, const TVector4<T>& right)
   return TVector4<T>(left.x - right.x, left.y - right.y, left.z - right.z, left.w - right.w);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+#if EGE_MATH_SIMD
+template <>
+inline void TVector4<float32>::operator += (const TVector4<float32>& other)
+{
+  MathSIMD::Store(&x, MathSIMD::Add(MathSIMD::Load(&x), MathSIMD::Load(&other.x)));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <>
+inline void TVector4<float32>::operator -= (const TVector4<float32>& other)
+{
+  MathSIMD::Store(&x, MathSIMD::Subtract(MathSIMD::Load(&x), MathSIMD::Load(&other.x)));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <>
+inline TVector4<float32> operator * (const TVector4<float32>& left, float32 scalar)
+{
+  TVector4<float32> out;
+  MathSIMD::Store(&out.x, MathSIMD::Multiply(MathSIMD::Load(&left.x), MathSIMD::Splat(scalar)));
+  return out;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <>
+inline TVector4<float32> operator * (float32 scalar, const TVector4<float32>& right)
+{
+  return right * scalar;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <>
+inline TVector4<float32> operator + (const TVector4<float32>& left, const TVector4<float32>& right)
+{
+  TVector4<float32> out;
+  MathSIMD::Store(&out.x, MathSIMD::Add(MathSIMD::Load(&left.x), MathSIMD::Load(&right.x)));
+  return out;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <>
+inline TVector4<float32> operator - (const TVector4<float32>& left, const TVector4<float32>& right)
+{
+  TVector4<float32> out;
+  MathSIMD::Store(&out.x, MathSIMD::Subtract(MathSIMD::Load(&left.x), MathSIMD::Load(&right.x)));
+  return out;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+#endif // EGE_MATH_SIMD
 template <typename T>
 Debug operator << (Debug debug, const TVector4<T>& obj)
 {
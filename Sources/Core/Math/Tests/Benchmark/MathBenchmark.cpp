@@ -0,0 +1,217 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGEMath.h>
+#include <EGEMatrix.h>
+#include <EGEQuaternion.h>
+#include <EGEVector2.h>
+#include <EGEVector3.h>
+#include <EGEVector4.h>
+#include <EGETimer.h>
+
+/** Micro-benchmarks of core math operations.
+ *  Each benchmark runs the operation over the same randomized data set a number of times and reports average duration of a single pass. Where applicable,
+ *  generic (scalar) composition is measured as well for reference.
+ */
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of elements processed in a single pass. */
+#define ELEMENTS_COUNT  4096
+/*! Number of measured passes. */
+#define MEASURED_PASSES 200
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class MathBenchmark : public TestBase
+{
+  protected:
+
+    virtual void SetUp();
+
+  protected:
+
+    /*! Prints and records given total duration of all measured passes. */
+    void report(const char* name, s64 totalDuration);
+
+  protected:
+
+    /*! Affine matrices. */
+    std::vector<Matrix4f> m_matrices;
+    /*! Vectors. */
+    std::vector<Vector4f> m_vectors;
+    /*! Unit quaternions. */
+    std::vector<Quaternionf> m_quaternions;
+    /*! Resulting matrices. */
+    std::vector<Matrix4f> m_matrixResults;
+    /*! Resulting vectors. */
+    std::vector<Vector4f> m_vectorResults;
+    /*! Resulting quaternions. */
+    std::vector<Quaternionf> m_quaternionResults;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void MathBenchmark::SetUp()
+{
+  for (s32 i = 0; i < ELEMENTS_COUNT; ++i)
+  {
+    Quaternionf orientation(random(), random(), random(), random());
+    orientation.normalize();
+
+    const Vector4f translation(random(100.0f), random(100.0f), random(100.0f));
+    const Vector4f scale(randomPositive(10.0f), randomPositive(10.0f), randomPositive(10.0f));
+
+    m_matrices.push_back(Matrix4f(translation, scale, orientation));
+    m_vectors.push_back(Vector4f(random(100.0f), random(100.0f), random(100.0f), 1.0f));
+    m_quaternions.push_back(orientation);
+  }
+
+  // NOTE: results are stored so no calculation can be optimized away
+  m_matrixResults.resize(ELEMENTS_COUNT, Matrix4f::IDENTITY);
+  m_vectorResults.resize(ELEMENTS_COUNT);
+  m_quaternionResults.resize(ELEMENTS_COUNT);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void MathBenchmark::report(const char* name, s64 totalDuration)
+{
+  std::cout << "[ BENCH    ] " << name << ": passes " << MEASURED_PASSES << " x " << ELEMENTS_COUNT << ", avg " << (totalDuration / MEASURED_PASSES) << "us"
+            << std::endl;
+
+  RecordProperty("AveragePassDuration", static_cast<int>(totalDuration / MEASURED_PASSES));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(MathBenchmark, MatrixMultiply)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    for (s32 i = 0; i < ELEMENTS_COUNT - 1; ++i)
+    {
+      m_matrixResults[i] = m_matrices[i].multiply(m_matrices[i + 1]);
+    }
+  }
+
+  report("MatrixMultiply", Timer::GetMicroseconds() - startTime);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(MathBenchmark, MatrixMultiplyAffine)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    for (s32 i = 0; i < ELEMENTS_COUNT - 1; ++i)
+    {
+      m_matrixResults[i] = m_matrices[i].multiplyAffine(m_matrices[i + 1]);
+    }
+  }
+
+  report("MatrixMultiplyAffine", Timer::GetMicroseconds() - startTime);
+
+  // verify against general multiplication
+  const Matrix4f expected = m_matrices[0].multiply(m_matrices[1]);
+  for (u32 i = 0; i < 16; ++i)
+  {
+    EXPECT_FLOAT_EQ(expected.data[i], m_matrixResults[0].data[i]);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(MathBenchmark, MatrixFromTranslationRotationScale)
+{
+  const Vector4f scale(2.0f, 3.0f, 4.0f);
+
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    for (s32 i = 0; i < ELEMENTS_COUNT; ++i)
+    {
+      m_matrixResults[i] = Matrix4f(m_vectors[i], scale, m_quaternions[i]);
+    }
+  }
+
+  report("MatrixFromTranslationRotationScale", Timer::GetMicroseconds() - startTime);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(MathBenchmark, MatrixFromTranslationRotationScaleComposed)
+{
+  const Vector4f scale(2.0f, 3.0f, 4.0f);
+
+  Matrix4f scaleMatrix = Matrix4f::IDENTITY;
+  scaleMatrix.setScale(scale.x, scale.y, scale.z);
+
+  // NOTE: this is composition via intermediate matrices for reference
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    for (s32 i = 0; i < ELEMENTS_COUNT; ++i)
+    {
+      Matrix4f rotationMatrix;
+      Math::Convert(rotationMatrix, m_quaternions[i]);
+
+      m_matrixResults[i] = rotationMatrix.multiply(scaleMatrix);
+      m_matrixResults[i].setTranslation(m_vectors[i].x, m_vectors[i].y, m_vectors[i].z);
+    }
+  }
+
+  report("MatrixFromTranslationRotationScaleComposed", Timer::GetMicroseconds() - startTime);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(MathBenchmark, VectorTransform)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    for (s32 i = 0; i < ELEMENTS_COUNT; ++i)
+    {
+      m_vectorResults[i] = m_matrices[pass] * m_vectors[i];
+    }
+  }
+
+  report("VectorTransform", Timer::GetMicroseconds() - startTime);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(MathBenchmark, VectorArrayTransform)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    Math::Transform(&m_vectorResults[0], sizeof (Vector4f), &m_vectors[0], sizeof (Vector4f), ELEMENTS_COUNT, m_matrices[pass]);
+  }
+
+  report("VectorArrayTransform", Timer::GetMicroseconds() - startTime);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(MathBenchmark, PointArrayTransform)
+{
+  // NOTE: points are read from and written into strided data, as in case of interleaved vertex buffers
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    Math::Transform(reinterpret_cast<Vector3f*>(&m_vectorResults[0]), sizeof (Vector4f), reinterpret_cast<const Vector3f*>(&m_vectors[0]), 
+                    sizeof (Vector4f), ELEMENTS_COUNT, m_matrices[pass]);
+  }
+
+  report("PointArrayTransform", Timer::GetMicroseconds() - startTime);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(MathBenchmark, PointArrayTransform2D)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    Math::Transform(reinterpret_cast<Vector2f*>(&m_vectorResults[0]), sizeof (Vector4f), reinterpret_cast<const Vector2f*>(&m_vectors[0]), 
+                    sizeof (Vector4f), ELEMENTS_COUNT, m_matrices[pass]);
+  }
+
+  report("PointArrayTransform2D", Timer::GetMicroseconds() - startTime);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(MathBenchmark, QuaternionMultiply)
+{
+  const s64 startTime = Timer::GetMicroseconds();
+  for (s32 pass = 0; pass < MEASURED_PASSES; ++pass)
+  {
+    for (s32 i = 0; i < ELEMENTS_COUNT - 1; ++i)
+    {
+      m_quaternionResults[i] = m_quaternions[i] * m_quaternions[i + 1];
+    }
+  }
+
+  report("QuaternionMultiply", Timer::GetMicroseconds() - startTime);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
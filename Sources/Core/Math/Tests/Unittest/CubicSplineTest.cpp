@@ -274,3 +274,192 @@ TEST_F(CubicSplineTest, Length)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(CubicSplineTest, Values)
+{
+  // perform fixed number of tests
+  for (int i = 0; i < KRepetitionsCount; ++i)
+  {
+    // create spline of two segments
+    const List<Vector3f> points = List<Vector3f>() << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random())
+                                                   << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random())
+                                                   << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random())
+                                                   << Vector3f(random(), random(), random());
+
+    CubicSpline spline(EBezier);
+    EXPECT_TRUE(spline.addPoints(points));
+
+    // generate parameters
+    float32 parameters[11];
+    for (int j = 0; j < 11; ++j)
+    {
+      parameters[j] = j / 10.0f;
+    }
+
+    Vector3f out[11];
+    spline.values(parameters, out, 11);
+
+    // compare against single value calculations
+    for (int j = 0; j < 11; ++j)
+    {
+      const Vector3f referenceValue = spline.value(parameters[j]);
+
+      EGE_EXPECT_FLOAT_EQ(referenceValue.x, out[j].x, epsilon());
+      EGE_EXPECT_FLOAT_EQ(referenceValue.y, out[j].y, epsilon());
+      EGE_EXPECT_FLOAT_EQ(referenceValue.z, out[j].z, epsilon());
+    }
+
+    // check ends
+    EGE_EXPECT_FLOAT_EQ(points.front().x, out[0].x, epsilon());
+    EGE_EXPECT_FLOAT_EQ(points.front().y, out[0].y, epsilon());
+    EGE_EXPECT_FLOAT_EQ(points.front().z, out[0].z, epsilon());
+    EGE_EXPECT_FLOAT_EQ(points.back().x, out[10].x, epsilon());
+    EGE_EXPECT_FLOAT_EQ(points.back().y, out[10].y, epsilon());
+    EGE_EXPECT_FLOAT_EQ(points.back().z, out[10].z, epsilon());
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(CubicSplineTest, UniformValues)
+{
+  const int KSamplesCount = 20;
+
+  // perform fixed number of tests
+  for (int i = 0; i < KRepetitionsCount; ++i)
+  {
+    // create spline of two segments
+    const List<Vector3f> points = List<Vector3f>() << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random())
+                                                   << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random())
+                                                   << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random())
+                                                   << Vector3f(random(), random(), random());
+
+    CubicSpline spline(EBezier);
+    EXPECT_TRUE(spline.addPoints(points));
+
+    // generate evenly distributed parameters
+    float32 parameters[KSamplesCount + 1];
+    for (int j = 0; j <= KSamplesCount; ++j)
+    {
+      parameters[j] = j / static_cast<float32>(KSamplesCount);
+    }
+
+    Vector3f out[KSamplesCount + 1];
+    spline.uniformValues(parameters, out, KSamplesCount + 1);
+
+    // check ends
+    EGE_EXPECT_FLOAT_EQ(points.front().x, out[0].x, epsilon());
+    EGE_EXPECT_FLOAT_EQ(points.front().y, out[0].y, epsilon());
+    EGE_EXPECT_FLOAT_EQ(points.back().x, out[KSamplesCount].x, epsilon());
+    EGE_EXPECT_FLOAT_EQ(points.back().y, out[KSamplesCount].y, epsilon());
+
+    // check if points are evenly distributed along the curve
+    // NOTE: arc length between neighbouring samples is approximated with dense sampling of the curve
+    const float32 expectedDistance = spline.length() / KSamplesCount;
+    for (int j = 0; j < KSamplesCount; ++j)
+    {
+      float32 distance = 0;
+      Vector3f previous = out[j];
+      for (int k = 1; k <= 20; ++k)
+      {
+        const Vector3f current = spline.uniformValue(parameters[j] + (parameters[j + 1] - parameters[j]) * k / 20.0f);
+        distance += previous.distanceTo(current);
+        previous = current;
+      }
+
+      EGE_EXPECT_FLOAT_EQ(expectedDistance, distance, expectedDistance * 0.05f);
+    }
+
+    // compare against single value calculations
+    for (int j = 0; j <= KSamplesCount; ++j)
+    {
+      const Vector3f referenceValue = spline.uniformValue(parameters[j]);
+
+      EGE_EXPECT_FLOAT_EQ(referenceValue.x, out[j].x, epsilon());
+      EGE_EXPECT_FLOAT_EQ(referenceValue.y, out[j].y, epsilon());
+      EGE_EXPECT_FLOAT_EQ(referenceValue.z, out[j].z, epsilon());
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(CubicSplineTest, UnsortedValues)
+{
+  const int KSamplesCount = 50;
+
+  // perform fixed number of tests
+  for (int i = 0; i < KRepetitionsCount; ++i)
+  {
+    // create spline of three segments
+    const List<Vector3f> points = List<Vector3f>() << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random())
+                                                   << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random())
+                                                   << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random())
+                                                   << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random())
+                                                   << Vector3f(random(), random(), random()) << Vector3f(random(), random(), random());
+
+    CubicSpline spline(ECardinal);
+    EXPECT_TRUE(spline.addPoints(points));
+
+    // generate parameters in random order, including ones out of [0-1] interval
+    float32 parameters[KSamplesCount];
+    for (int j = 0; j < KSamplesCount; ++j)
+    {
+      parameters[j] = 0.5f + random(0.75f);
+    }
+
+    Vector3f out[KSamplesCount];
+    Vector3f uniformOut[KSamplesCount];
+    spline.values(parameters, out, KSamplesCount);
+    spline.uniformValues(parameters, uniformOut, KSamplesCount);
+
+    // compare against single value calculations
+    for (int j = 0; j < KSamplesCount; ++j)
+    {
+      const Vector3f referenceValue        = spline.value(parameters[j]);
+      const Vector3f referenceUniformValue = spline.uniformValue(parameters[j]);
+
+      EGE_EXPECT_FLOAT_EQ(referenceValue.x, out[j].x, epsilon());
+      EGE_EXPECT_FLOAT_EQ(referenceValue.y, out[j].y, epsilon());
+      EGE_EXPECT_FLOAT_EQ(referenceValue.z, out[j].z, epsilon());
+      EGE_EXPECT_FLOAT_EQ(referenceUniformValue.x, uniformOut[j].x, epsilon());
+      EGE_EXPECT_FLOAT_EQ(referenceUniformValue.y, uniformOut[j].y, epsilon());
+      EGE_EXPECT_FLOAT_EQ(referenceUniformValue.z, uniformOut[j].z, epsilon());
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(CubicSplineTest, Tangent)
+{
+  const float32 dt = 0.001f;
+
+  // perform fixed number of tests
+  for (int i = 0; i < KRepetitionsCount; ++i)
+  {
+    const Vector3f point1(random(), random(), random());
+    const Vector3f point2(random(), random(), random());
+    const Vector3f point3(random(), random(), random());
+    const Vector3f point4(random(), random(), random());
+
+    const List<Vector3f> points = List<Vector3f>() << point1 << point2 << point3 << point4;
+
+    CubicSpline spline(EBezier);
+    spline.addPoints(points);
+
+    // simulate traversal along the curve
+    for (float32 t = 0.1f; t < 0.95f; t += 0.1f)
+    {
+      // calculate reference value using central difference
+      Vector3f referenceValue = bezierValue(t + dt, point1, point2, point3, point4) - bezierValue(t - dt, point1, point2, point3, point4);
+      referenceValue.normalize();
+
+      // get value
+      const Vector3f out = spline.tangent(t);
+
+      // compare
+      EGE_EXPECT_FLOAT_EQ(1.0f, out.length(), 0.0001f);
+      EGE_EXPECT_FLOAT_EQ(referenceValue.x, out.x, 0.001f);
+      EGE_EXPECT_FLOAT_EQ(referenceValue.y, out.y, 0.001f);
+      EGE_EXPECT_FLOAT_EQ(referenceValue.z, out.z, 0.001f);
+
+      // check uniform variant
+      EGE_EXPECT_FLOAT_EQ(1.0f, spline.uniformTangent(t).length(), 0.0001f);
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1,4 +1,5 @@
 #include "Core/Math/Tests/Unittest/Helpers/GeneratorHelper.h"
+#include <limits>
 
 EGE_NAMESPACE
 
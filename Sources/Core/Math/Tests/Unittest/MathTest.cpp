@@ -1,4 +1,5 @@
 #include "TestFramework/Interface/TestBase.h"
+#include "Core/Math/Tests/Unittest/Helpers/GeneratorHelper.h"
 #include "Core/Math/Tests/Unittest/Helpers/MatrixHelper.h"
 #include "Core/Math/Tests/Unittest/Helpers/VectorHelper.h"
 #include "Core/Math/Tests/Unittest/Helpers/QuaternionHelper.h"
@@ -683,6 +684,90 @@ TEST_F(MathTest, TransformVector)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(MathTest, TransformArray)
+{
+  // NOTE: vertex consists of 4 position components followed by 2 components which should remain intact
+  //       odd number of vertices is used so all code paths are exercised
+  const u32 KVertexSize   = 6;
+  const u32 KVertexCount  = 7;
+  const u32 KStride       = KVertexSize * sizeof (float32);
+
+  // perform fixed number of tests
+  for (int i = 0; i < KRepetitionsCount; ++i)
+  {
+    std::vector<float32> matrixData = MatrixHelper::RandomMatrix4();
+    const Matrix4f matrix(&matrixData[0]);
+
+    // randomize interleaved data
+    std::vector<float32> data;
+    for (u32 j = 0; j < KVertexCount * KVertexSize; ++j)
+    {
+      data.push_back(random(100.0f));
+    }
+
+    // test 2D points
+    std::vector<float32> out = data;
+    Math::Transform(reinterpret_cast<Vector2f*>(&out[0]), KStride, reinterpret_cast<const Vector2f*>(&data[0]), KStride, KVertexCount, matrix);
+    for (u32 j = 0; j < KVertexCount; ++j)
+    {
+      std::vector<float32> vectorData;
+      vectorData.push_back(data[j * KVertexSize + 0]);
+      vectorData.push_back(data[j * KVertexSize + 1]);
+      vectorData.push_back(0);
+      vectorData.push_back(1);
+
+      std::vector<float32> vectorDataOut = MathHelper::MultiplyVector(matrixData, vectorData);
+      vectorDataOut.resize(2);
+
+      EXPECT_TRUE(GeneratorHelper::AreEqual(vectorDataOut, std::vector<float32>(&out[j * KVertexSize], &out[j * KVertexSize + 2])));
+      EXPECT_TRUE(GeneratorHelper::AreEqual(std::vector<float32>(&data[j * KVertexSize + 2], &data[j * KVertexSize + KVertexSize]), 
+                                            std::vector<float32>(&out[j * KVertexSize + 2], &out[j * KVertexSize + KVertexSize])));
+    }
+
+    // test 3D points
+    out = data;
+    Math::Transform(reinterpret_cast<Vector3f*>(&out[0]), KStride, reinterpret_cast<const Vector3f*>(&data[0]), KStride, KVertexCount, matrix);
+    for (u32 j = 0; j < KVertexCount; ++j)
+    {
+      std::vector<float32> vectorData(&data[j * KVertexSize], &data[j * KVertexSize + 3]);
+      vectorData.push_back(1);
+
+      std::vector<float32> vectorDataOut = MathHelper::MultiplyVector(matrixData, vectorData);
+      vectorDataOut.resize(3);
+
+      EXPECT_TRUE(GeneratorHelper::AreEqual(vectorDataOut, std::vector<float32>(&out[j * KVertexSize], &out[j * KVertexSize + 3])));
+      EXPECT_TRUE(GeneratorHelper::AreEqual(std::vector<float32>(&data[j * KVertexSize + 3], &data[j * KVertexSize + KVertexSize]), 
+                                            std::vector<float32>(&out[j * KVertexSize + 3], &out[j * KVertexSize + KVertexSize])));
+    }
+
+    // test 4D vectors
+    out = data;
+    Math::Transform(reinterpret_cast<Vector4f*>(&out[0]), KStride, reinterpret_cast<const Vector4f*>(&data[0]), KStride, KVertexCount, matrix);
+    for (u32 j = 0; j < KVertexCount; ++j)
+    {
+      std::vector<float32> vectorData(&data[j * KVertexSize], &data[j * KVertexSize + 4]);
+
+      std::vector<float32> vectorDataOut = MathHelper::MultiplyVector(matrixData, vectorData);
+
+      EXPECT_TRUE(GeneratorHelper::AreEqual(vectorDataOut, std::vector<float32>(&out[j * KVertexSize], &out[j * KVertexSize + 4])));
+      EXPECT_TRUE(GeneratorHelper::AreEqual(std::vector<float32>(&data[j * KVertexSize + 4], &data[j * KVertexSize + KVertexSize]), 
+                                            std::vector<float32>(&out[j * KVertexSize + 4], &out[j * KVertexSize + KVertexSize])));
+    }
+
+    // test in place transformation
+    out = data;
+    Math::Transform(reinterpret_cast<Vector3f*>(&out[0]), KStride, reinterpret_cast<const Vector3f*>(&out[0]), KStride, KVertexCount, matrix);
+    for (u32 j = 0; j < KVertexCount; ++j)
+    {
+      const Vector4f vector = matrix * Vector4f(data[j * KVertexSize + 0], data[j * KVertexSize + 1], data[j * KVertexSize + 2], 1);
+
+      EXPECT_FLOAT_EQ(vector.x, out[j * KVertexSize + 0]);
+      EXPECT_FLOAT_EQ(vector.y, out[j * KVertexSize + 1]);
+      EXPECT_FLOAT_EQ(vector.z, out[j * KVertexSize + 2]);
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 TEST_F(MathTest, CreateMatrix)
 {
   // perform fixed number of tests
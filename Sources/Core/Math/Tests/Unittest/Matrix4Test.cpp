@@ -4,6 +4,7 @@
 #include "Core/Math/Tests/Unittest/Helpers/MathHelper.h"
 #include <EGEMatrix.h>
 #include <EGEVector4.h>
+#include <EGEQuaternion.h>
 #include <EGEMath.h>
 
 /** Tests are focusing TMatrix4<float32> instantiations. */
@@ -155,6 +156,72 @@ TEST_F(Matrix4Test, MultiplyMatrix)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(Matrix4Test, MultiplyAffineMatrix)
+{
+  // perform fixed number of tests
+  for (int i = 0; i < KRepetitionsCount; ++i)
+  {
+    std::vector<float32> data1;
+    std::vector<float32> data2;
+    std::vector<float32> dataOut;
+
+    // randomize data
+    data1 = MatrixHelper::RandomMatrix4();
+    data2 = MatrixHelper::RandomMatrix4();
+
+    // make them affine
+    data1[3] = data1[7] = data1[11] = 0;
+    data2[3] = data2[7] = data2[11] = 0;
+    data1[15] = data2[15] = 1;
+
+    const Matrix4f matrix1(&data1[0]);
+    const Matrix4f matrix2(&data2[0]);
+
+    // multiply...
+    dataOut = MatrixHelper::Multiply(data1, data2);
+
+    // ...and compare with affine multiplication
+    const Matrix4f matrixOut = matrix1.multiplyAffine(matrix2);
+    EXPECT_TRUE(MatrixHelper::AreEqual(dataOut, matrixOut.data));
+    EXPECT_TRUE(matrixOut.isAffine());
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(Matrix4Test, TranslationRotationScale)
+{
+  // perform fixed number of tests
+  for (int i = 0; i < KRepetitionsCount; ++i)
+  {
+    const Vector4f translation(random(100.0f), random(100.0f), random(100.0f));
+    const Vector4f scale(random(10.0f), random(10.0f), random(10.0f));
+
+    Quaternionf orientation(random(), random(), random(), random());
+    orientation.normalize();
+
+    // compose reference matrix
+    Matrix4f rotationMatrix;
+    Math::Convert(rotationMatrix, orientation);
+
+    Matrix4f scaleMatrix = Matrix4f::IDENTITY;
+    scaleMatrix.setScale(scale.x, scale.y, scale.z);
+
+    Matrix4f translationMatrix = Matrix4f::IDENTITY;
+    translationMatrix.setTranslation(translation.x, translation.y, translation.z);
+
+    const Matrix4f expected = translationMatrix * rotationMatrix * scaleMatrix;
+
+    // verify
+    const Matrix4f matrix(translation, scale, orientation);
+    for (u32 j = 0; j < 16; ++j)
+    {
+      EXPECT_FLOAT_EQ(expected.data[j], matrix.data[j]);
+    }
+
+    EXPECT_TRUE(matrix.isAffine());
+    EXPECT_TRUE(matrix == Math::CreateMatrix(translation, scale, orientation));
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 TEST_F(Matrix4Test, Transpose)
 {
   // perform fixed number of tests
@@ -286,7 +353,7 @@ TEST_F(Matrix4Test, Translation)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-TEST_F(Matrix4Test, rrayIndexing)
+TEST_F(Matrix4Test, ArrayIndexing)
 {
   // perform fixed number of tests
   for (int i = 0; i < KRepetitionsCount; ++i)
@@ -496,6 +496,44 @@ TEST_F(RectTest, Intersect)
   EXPECT_EQ(50, rect2.intersect(rect).height);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(RectTest, Intersects)
+{
+  const Recti rect(0, 0, 100, 100);
+
+  // same rectangles
+  EXPECT_TRUE(rect.intersects(rect));
+
+  // no intersection
+  EXPECT_FALSE(rect.intersects(Recti(-100, -100, 50, 50)));
+  EXPECT_FALSE(rect.intersects(Recti(-40, -40, 40, 40)));
+  EXPECT_FALSE(rect.intersects(Recti(100, 0, 10, 10)));
+  EXPECT_FALSE(rect.intersects(Recti(0, 100, 10, 10)));
+  EXPECT_FALSE(Recti(-40, -40, 40, 40).intersects(rect));
+
+  // single point intersection
+  EXPECT_TRUE(rect.intersects(Recti(-29, -29, 30, 30)));
+  EXPECT_TRUE(rect.intersects(Recti(99, 99, 30, 30)));
+  EXPECT_TRUE(Recti(99, 99, 30, 30).intersects(rect));
+
+  // inner rectangle
+  EXPECT_TRUE(rect.intersects(Recti(10, 10, 50, 50)));
+  EXPECT_TRUE(Recti(10, 10, 50, 50).intersects(rect));
+
+  // EMPTY and NULL rectangles
+  EXPECT_FALSE(rect.intersects(Recti(10, 10, 0, 50)));
+  EXPECT_FALSE(rect.intersects(Recti::INVALID));
+  EXPECT_FALSE(Recti::INVALID.intersects(rect));
+
+  // result matches intersect()
+  for (s32 i = -120; i <= 120; i += 10)
+  {
+    const Recti other(i, i / 2, 30, 30);
+    const Recti intersection = rect.intersect(other);
+
+    EXPECT_EQ((0 < intersection.width) && (0 < intersection.height), rect.intersects(other));
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 TEST_F(RectTest, Unite)
 {
   const s32 x       = 0;
@@ -57,8 +57,7 @@ inline void Object::addReference()
 inline void Object::release() 
 { 
   //--m_references;
-  egeAtomicDecrement(m_references);
-  if (0 == m_references) 
+  if (0 == egeAtomicDecrement(m_references)) 
   { 
     if (NULL != m_deleteFunc) 
     {
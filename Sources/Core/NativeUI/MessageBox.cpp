@@ -7,6 +7,8 @@
   #include "Airplay/NativeUI/MessageBoxAirplay_p.h"
 #elif EGE_PLATFORM_IOS
   #include "iOS/NativeUI/MessageBoxIOS_p.h"
+#elif EGE_PLATFORM_POSIX
+  #include "Posix/NativeUI/MessageBoxPosix_p.h"
 #endif
 
 EGE_NAMESPACE_BEGIN
@@ -25,6 +25,7 @@ EGE_NAMESPACE_BEGIN
 #define EGE_OBJECT_UID_DATA_BUFFER            ((EGE_CORE_OBJECT_UID_BASE) + 7)
 #define EGE_OBJECT_UID_POINTER_DATA           ((EGE_CORE_OBJECT_UID_BASE) + 8)
 #define EGE_OBJECT_UID_STRING_BUFFER          ((EGE_CORE_OBJECT_UID_BASE) + 9)
+#define EGE_OBJECT_UID_UPDATE_GRAPH           ((EGE_CORE_OBJECT_UID_BASE) + 10)
 
 // Graphics related object ids
 #define EGE_OBJECT_UID_GRAPHICS                 ((EGE_CORE_GRAPHICS_OBJECT_UID_BASE + 0))
@@ -75,6 +76,7 @@ EGE_NAMESPACE_BEGIN
 #define EGE_OBJECT_UID_THREAD                 ((EGE_CORE_THREADING_OBJECT_UID_BASE) + 0)
 #define EGE_OBJECT_UID_MUTEX                  ((EGE_CORE_THREADING_OBJECT_UID_BASE) + 1)
 #define EGE_OBJECT_UID_WAIT_CONDITION         ((EGE_CORE_THREADING_OBJECT_UID_BASE) + 2)
+#define EGE_OBJECT_UID_JOB_SYSTEM             ((EGE_CORE_THREADING_OBJECT_UID_BASE) + 3)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
@@ -3,7 +3,9 @@
 #include "Core/Application/Application.h"
 #include "Core/Physics/Box2D/DebugDrawBox2D.h"
 #include "Core/Physics/Box2D/PhysicsManagerBox2D_p.h"
+#include "Core/Graphics/Render/Interface/Renderer.h"
 #include <EGEGraphics.h>
+#include <EGERenderComponent.h>
 
 EGE_NAMESPACE_BEGIN
 
@@ -21,18 +23,50 @@ DebugDraw::~DebugDraw()
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void DebugDraw::clear()
+{
+  m_renderComponents.clear();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void DebugDraw::addForRendering(const PRenderComponent& component)
+{
+  // NOTE: components are created on the fly so they need to be kept alive until frame is rendered
+  m_renderComponents.push_back(component);
+
+  app()->graphics()->renderer()->addForRendering(component);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PRenderComponent DebugDraw::createRenderComponent(const char* name, EGEGraphics::RenderPrimitiveType primitiveType)
+{
+  // NOTE: vertices carry position and color only
+  VertexDeclaration vertexDeclaration;
+  vertexDeclaration.addElement(NVertexBuffer::VES_POSITION_XYZ);
+  vertexDeclaration.addElement(NVertexBuffer::VES_COLOR_RGBA);
+
+  return ege_new RenderComponent(app(), name, vertexDeclaration, EGEGraphics::RP_PHYSICS_DEBUG, primitiveType);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void* DebugDraw::lockVertices(const PRenderComponent& component, u32 count)
+{
+  // make sure all vertices fit
+  if ( ! component->vertexBuffer()->setSize(count))
+  {
+    // error!
+    return NULL;
+  }
+
+  return component->vertexBuffer()->lock(0, count);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void DebugDraw::DrawPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color)
 {
-  PRenderComponent component = ege_new RenderComponent(app(), "DebugDraw::DrawPolygon", EGEGraphics::RP_PHYSICS_DEBUG, 
-                                                       EGEGraphics::RPT_LINE_LOOP);
+  PRenderComponent component = createRenderComponent("DebugDraw::DrawPolygon", EGEGraphics::RPT_LINE_LOOP);
   if (component->isValid())
   {
     float32 scale = manager()->simulationToWorldScaleFactor();
  
-    component->vertexBuffer()->setSemantics(RenderObjectFactory::VS_V3_C4);
 
-    // TAGE - set buffer size
-    float32* data = (float32*) component->vertexBuffer()->lock(0, vertexCount);
+    float32* data = (float32*) lockVertices(component, vertexCount);
 
 	  for (int32 i = 0; i < vertexCount; ++i)
 	  {
@@ -47,16 +81,14 @@ void DebugDraw::DrawPolygon(const b2Vec2* vertices, int32 vertexCount, const b2C
 
     component->vertexBuffer()->unlock(data - 1);
 
-    app()->graphics()->renderer()->addForRendering(component);
+    addForRendering(component);
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void DebugDraw::DrawSolidPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color)
 {
-  PRenderComponent component_fill = ege_new RenderComponent(app(), "DebugDraw::DrawSolidPolygon-fill", EGEGraphics::RP_PHYSICS_DEBUG, 
-                                                            EGEGraphics::RPT_TRIANGLE_FAN);
-  PRenderComponent component_frame = ege_new RenderComponent(app(), "DebugDraw::DrawSolidPolygon-frame", EGEGraphics::RP_PHYSICS_DEBUG, 
-                                                            EGEGraphics::RPT_LINE_LOOP);
+  PRenderComponent component_fill = createRenderComponent("DebugDraw::DrawSolidPolygon-fill", EGEGraphics::RPT_TRIANGLE_FAN);
+  PRenderComponent component_frame = createRenderComponent("DebugDraw::DrawSolidPolygon-frame", EGEGraphics::RPT_LINE_LOOP);
 
   PMaterial material = ege_new Material(NULL);
   RenderPass* pass = material->addPass(NULL);
@@ -68,12 +100,9 @@ void DebugDraw::DrawSolidPolygon(const b2Vec2* vertices, int32 vertexCount, cons
   {
     float32 scale = manager()->simulationToWorldScaleFactor();
  
-    component_fill->vertexBuffer()->setSemantics(RenderObjectFactory::VS_V3_C4);
-    component_frame->vertexBuffer()->setSemantics(RenderObjectFactory::VS_V3_C4);
     
-    // TAGE - set buffer size
-    float32* data_fill  = (float32*) component_fill->vertexBuffer()->lock(0, vertexCount);
-    float32* data_frame = (float32*) component_frame->vertexBuffer()->lock(0, vertexCount);
+    float32* data_fill  = (float32*) lockVertices(component_fill, vertexCount);
+    float32* data_frame = (float32*) lockVertices(component_frame, vertexCount);
 
 	  for (int32 i = 0; i < vertexCount; ++i)
 	  {
@@ -97,15 +126,14 @@ void DebugDraw::DrawSolidPolygon(const b2Vec2* vertices, int32 vertexCount, cons
     component_fill->vertexBuffer()->unlock(data_fill - 1);
     component_frame->vertexBuffer()->unlock(data_frame - 1);
 
-    app()->graphics()->renderer()->addForRendering(component_fill);
-    app()->graphics()->renderer()->addForRendering(component_frame);
+    addForRendering(component_fill);
+    addForRendering(component_frame);
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void DebugDraw::DrawCircle(const b2Vec2& center, EGE::float32 radius, const b2Color& color)
 {
-  PRenderComponent component = ege_new RenderComponent(app(), "DebugDraw::DrawCircle", EGEGraphics::RP_PHYSICS_DEBUG, 
-                                                       EGEGraphics::RPT_LINE_LOOP);
+  PRenderComponent component = createRenderComponent("DebugDraw::DrawCircle", EGEGraphics::RPT_LINE_LOOP);
   if (component->isValid())
   {
 	  const float32 k_segments = 16.0f;
@@ -114,10 +142,8 @@ void DebugDraw::DrawCircle(const b2Vec2& center, EGE::float32 radius, const b2Co
 
     float32 scale = manager()->simulationToWorldScaleFactor();
  
-    component->vertexBuffer()->setSemantics(RenderObjectFactory::VS_V3_C4);
 
-    // TAGE - set buffer size
-    float32* data = (float32*) component->vertexBuffer()->lock(0, (u32) k_segments);
+    float32* data = (float32*) lockVertices(component, (u32) k_segments);
 
 	  for (int32 i = 0; i < k_segments; ++i)
 	  {
@@ -136,16 +162,16 @@ void DebugDraw::DrawCircle(const b2Vec2& center, EGE::float32 radius, const b2Co
 
     component->vertexBuffer()->unlock(data - 1);
 
-    app()->graphics()->renderer()->addForRendering(component);
+    addForRendering(component);
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void DebugDraw::DrawSolidCircle(const b2Vec2& center, EGE::float32 radius, const b2Vec2& axis, const b2Color& color)
 {
-  PRenderComponent component_fill = ege_new RenderComponent(app(), "DebugDraw::DrawSolidCircle-fill", EGEGraphics::RP_PHYSICS_DEBUG, 
-                                                            EGEGraphics::RPT_TRIANGLE_FAN);
-  PRenderComponent component_frame = ege_new RenderComponent(app(), "DebugDraw::DrawSolidCircle-frame", EGEGraphics::RP_PHYSICS_DEBUG, 
-                                                            EGEGraphics::RPT_LINE_LOOP);
+  EGE_UNUSED(axis);
+
+  PRenderComponent component_fill = createRenderComponent("DebugDraw::DrawSolidCircle-fill", EGEGraphics::RPT_TRIANGLE_FAN);
+  PRenderComponent component_frame = createRenderComponent("DebugDraw::DrawSolidCircle-frame", EGEGraphics::RPT_LINE_LOOP);
 
   PMaterial material = ege_new Material(NULL);
   RenderPass* pass = material->addPass(NULL);
@@ -161,12 +187,9 @@ void DebugDraw::DrawSolidCircle(const b2Vec2& center, EGE::float32 radius, const
 
     float32 scale = manager()->simulationToWorldScaleFactor();
  
-    component_fill->vertexBuffer()->setSemantics(RenderObjectFactory::VS_V3_C4);
-    component_frame->vertexBuffer()->setSemantics(RenderObjectFactory::VS_V3_C4);
     
-    // TAGE - set buffer size
-    float32* data_fill  = (float32*) component_fill->vertexBuffer()->lock(0, (u32) k_segments);
-    float32* data_frame = (float32*) component_frame->vertexBuffer()->lock(0, (u32) k_segments);
+    float32* data_fill  = (float32*) lockVertices(component_fill, (u32) k_segments);
+    float32* data_frame = (float32*) lockVertices(component_frame, (u32) k_segments);
 
 	  for (int32 i = 0; i < (int32) k_segments; ++i)
 	  {
@@ -194,8 +217,8 @@ void DebugDraw::DrawSolidCircle(const b2Vec2& center, EGE::float32 radius, const
     component_fill->vertexBuffer()->unlock(data_fill - 1);
     component_frame->vertexBuffer()->unlock(data_frame - 1);
 
-    app()->graphics()->renderer()->addForRendering(component_fill);
-    app()->graphics()->renderer()->addForRendering(component_frame);
+    addForRendering(component_fill);
+    addForRendering(component_frame);
   }
 
 	//b2Vec2 p = center + radius * axis;
@@ -207,16 +230,13 @@ void DebugDraw::DrawSolidCircle(const b2Vec2& center, EGE::float32 radius, const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void DebugDraw::DrawSegment(const b2Vec2& p1, const b2Vec2& p2, const b2Color& color)
 {
-  PRenderComponent component = ege_new RenderComponent(app(), "DebugDraw::DrawSegment", EGEGraphics::RP_PHYSICS_DEBUG, 
-                                                       EGEGraphics::RPT_LINES);
+  PRenderComponent component = createRenderComponent("DebugDraw::DrawSegment", EGEGraphics::RPT_LINES);
   if (component->isValid())
   {
     float32 scale = manager()->simulationToWorldScaleFactor();
  
-    component->vertexBuffer()->setSemantics(RenderObjectFactory::VS_V3_C4);
 
-    // TAGE - set buffer size
-    float32* data = (float32*) component->vertexBuffer()->lock(0, 2);
+    float32* data = (float32*) lockVertices(component, 2);
 
     *data++ = p1.x * scale;
     *data++ = p1.y * scale;
@@ -236,12 +256,14 @@ void DebugDraw::DrawSegment(const b2Vec2& p1, const b2Vec2& p2, const b2Color& c
 
     component->vertexBuffer()->unlock(data - 1);
 
-    app()->graphics()->renderer()->addForRendering(component);
+    addForRendering(component);
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void DebugDraw::DrawTransform(const b2Transform& xf)
 {
+  EGE_UNUSED(xf);
+
 	//b2Vec2 p1 = xf.position, p2;
 	//const float32 k_axisScale = 0.4f;
 	//glBegin(GL_LINES);
@@ -4,12 +4,15 @@
 #ifdef EGE_PHYSICS_BOX2D
 
 #include <EGE.h>
+#include <EGEDynamicArray.h>
+#include <EGEGraphics.h>
 #include <Box2D/Box2D.h>
 
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class PhysicsManagerPrivate;
+EGE_DECLARE_SMART_CLASS(RenderComponent, PRenderComponent)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class DebugDraw : public b2DebugDraw
 {
@@ -21,6 +24,9 @@ class DebugDraw : public b2DebugDraw
     EGE_DECLARE_NEW_OPERATORS
     EGE_DECLARE_DELETE_OPERATORS
 
+    /*! Releases render components submitted so far. Should be called before each debug draw. */
+    void clear();
+
     /*! @see b2DebugDraw::DrawPolygon. */
 	  void DrawPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color) override;
     /*! @see b2DebugDraw::DrawSolidPolygon. */
@@ -40,6 +46,14 @@ class DebugDraw : public b2DebugDraw
     Application* app() const { return m_app; }
     /*! Returns pointer to Box2D physics manager. */
     PhysicsManagerPrivate* manager() const { return m_managerPrivate; }
+    /*! Adds given component for rendering keeping it alive until next clear. */
+    void addForRendering(const PRenderComponent& component);
+    /*! Creates render component for debug primitive of a given type. */
+    PRenderComponent createRenderComponent(const char* name, EGEGraphics::RenderPrimitiveType primitiveType);
+    /*! Resizes vertex buffer of a given component to hold given number of vertices and locks all of them. 
+     *  @return Pointer to locked vertex data. NULL if buffer could not be resized.
+     */
+    void* lockVertices(const PRenderComponent& component, u32 count);
 
   private:
 
@@ -47,6 +61,8 @@ class DebugDraw : public b2DebugDraw
     Application* m_app;
     /*! Pointer to Box2D physics manager. */
     PhysicsManagerPrivate* m_managerPrivate;
+    /*! Render components submitted since last clear. */
+    DynamicArray<PRenderComponent> m_renderComponents;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -4,7 +4,7 @@
 #include "Core/Physics/PhysicsJointAttract.h"
 #include "Core/Physics/Box2D/PhysicsJointAttractBox2D_p.h"
 #include "Core/Physics/Box2D/PhysicsManagerBox2D_p.h"
-#include "Core/Components/Physics/Box2D/PhysicsComponentBox2D_p.h"
+#include "Core/Component/Physics/Box2D/PhysicsComponentBox2D_p.h"
 #include <Box2D/Box2D.h>
 
 EGE_NAMESPACE_BEGIN
@@ -17,6 +17,8 @@ PhysicsJointAttractPrivate::PhysicsJointAttractPrivate(PhysicsJointAttract* pare
                                                                                                                               m_joint(NULL), 
                                                                                                                               m_managerPrivate(managerPrivate)
 {
+  PhysicsWorldLocker locker(manager());
+
   b2Body* body = d_func()->bodyA()->p_func()->body();
 
   // create ground body
@@ -41,6 +43,8 @@ PhysicsJointAttractPrivate::PhysicsJointAttractPrivate(PhysicsJointAttract* pare
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PhysicsJointAttractPrivate::~PhysicsJointAttractPrivate()
 {
+  PhysicsWorldLocker locker(manager());
+
   if (m_joint)
   {
     manager()->world()->DestroyJoint(m_joint);
@@ -61,6 +65,8 @@ bool PhysicsJointAttractPrivate::isValid() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsJointAttractPrivate::setTarget(const Vector4f& position)
 {
+  PhysicsWorldLocker locker(manager());
+
   if (isValid())
   {
     float32 scale = manager()->worldToSimulationScaleFactor();
@@ -71,6 +77,8 @@ void PhysicsJointAttractPrivate::setTarget(const Vector4f& position)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsJointAttractPrivate::setDampingRatio(float32 ratio)
 {
+  PhysicsWorldLocker locker(manager());
+
   if (m_joint)
   {
     m_joint->SetDampingRatio(ratio);
@@ -89,6 +97,8 @@ float32 PhysicsJointAttractPrivate::dampingRatio() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsJointAttractPrivate::setFrequency(float32 frequencyHz)
 {
+  PhysicsWorldLocker locker(manager());
+
   if (m_joint)
   {
     m_joint->SetFrequency(frequencyHz);
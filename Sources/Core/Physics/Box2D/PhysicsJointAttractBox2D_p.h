@@ -4,7 +4,7 @@
 #ifdef EGE_PHYSICS_BOX2D
 
 #include <EGE.h>
-#include <EGEVector.h>
+#include <EGEVector4.h>
 
 class b2MouseJoint;
 class b2Body;
@@ -4,7 +4,7 @@
 #include "Core/Physics/PhysicsJointDistance.h"
 #include "Core/Physics/Box2D/PhysicsJointDistanceBox2D_p.h"
 #include "Core/Physics/Box2D/PhysicsManagerBox2D_p.h"
-#include "Core/Components/Physics/Box2D/PhysicsComponentBox2D_p.h"
+#include "Core/Component/Physics/Box2D/PhysicsComponentBox2D_p.h"
 #include <Box2D/Box2D.h>
 
 EGE_NAMESPACE_BEGIN
@@ -17,6 +17,8 @@ PhysicsJointDistancePrivate::PhysicsJointDistancePrivate(PhysicsJointDistance* p
                                                                                                                                 m_joint(NULL), 
                                                                                                                                 m_managerPrivate(managerPrivate)
 {
+  PhysicsWorldLocker locker(manager());
+
   b2Body* bodyA = d_func()->bodyA()->p_func()->body();
   b2Body* bodyB = d_func()->bodyB()->p_func()->body();
 
@@ -35,6 +37,8 @@ PhysicsJointDistancePrivate::PhysicsJointDistancePrivate(PhysicsJointDistance* p
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PhysicsJointDistancePrivate::~PhysicsJointDistancePrivate()
 {
+  PhysicsWorldLocker locker(manager());
+
   if (m_joint)
   {
     manager()->world()->DestroyJoint(m_joint);
@@ -44,6 +48,8 @@ PhysicsJointDistancePrivate::~PhysicsJointDistancePrivate()
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsJointDistancePrivate::setLength(EGE::float32 length)
 {
+  PhysicsWorldLocker locker(manager());
+
   if (m_joint)
   {
     EGE::float32 scale = manager()->worldToSimulationScaleFactor();
@@ -71,6 +77,8 @@ bool PhysicsJointDistancePrivate::isValid() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsJointDistancePrivate::setDampingRatio(float32 ratio)
 {
+  PhysicsWorldLocker locker(manager());
+
   if (m_joint)
   {
     m_joint->SetDampingRatio(ratio);
@@ -89,6 +97,8 @@ float32 PhysicsJointDistancePrivate::dampingRatio() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsJointDistancePrivate::setFrequency(float32 frequencyHz)
 {
+  PhysicsWorldLocker locker(manager());
+
   if (m_joint)
   {
     m_joint->SetFrequency(frequencyHz);
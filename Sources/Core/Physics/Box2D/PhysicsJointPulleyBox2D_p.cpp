@@ -4,7 +4,7 @@
 #include "Core/Physics/PhysicsJointPulley.h"
 #include "Core/Physics/Box2D/PhysicsJointPulleyBox2D_p.h"
 #include "Core/Physics/Box2D/PhysicsManagerBox2D_p.h"
-#include "Core/Components/Physics/Box2D/PhysicsComponentBox2D_p.h"
+#include "Core/Component/Physics/Box2D/PhysicsComponentBox2D_p.h"
 #include <Box2D/Box2D.h>
 
 EGE_NAMESPACE_BEGIN
@@ -17,6 +17,8 @@ PhysicsJointPulleyPrivate::PhysicsJointPulleyPrivate(PhysicsJointPulley* parent,
                                                                                                                           m_joint(NULL), 
                                                                                                                           m_managerPrivate(managerPrivate)
 {
+  PhysicsWorldLocker locker(manager());
+
   EGE::float32 scale = manager()->worldToSimulationScaleFactor();
 
   b2Body* bodyA = d_func()->bodyA()->p_func()->body();
@@ -39,6 +41,8 @@ PhysicsJointPulleyPrivate::PhysicsJointPulleyPrivate(PhysicsJointPulley* parent,
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PhysicsJointPulleyPrivate::~PhysicsJointPulleyPrivate()
 {
+  PhysicsWorldLocker locker(manager());
+
   if (m_joint)
   {
     manager()->world()->DestroyJoint(m_joint);
@@ -48,6 +52,8 @@ PhysicsJointPulleyPrivate::~PhysicsJointPulleyPrivate()
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 float32 PhysicsJointPulleyPrivate::lengthA() const
 {
+  PhysicsWorldLocker locker(manager());
+
   if (m_joint)
   {
     float32 scale = manager()->simulationToWorldScaleFactor();
@@ -60,6 +66,8 @@ float32 PhysicsJointPulleyPrivate::lengthA() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 float32 PhysicsJointPulleyPrivate::lengthB() const
 {
+  PhysicsWorldLocker locker(manager());
+
   if (m_joint)
   {
     float32 scale = manager()->simulationToWorldScaleFactor();
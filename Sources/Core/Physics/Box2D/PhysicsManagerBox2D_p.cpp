@@ -2,9 +2,12 @@
 
 #include "Core/Application/Application.h"
 #include "Core/Physics/Box2D/PhysicsManagerBox2D_p.h"
-#include "Core/Components/Physics/Box2D/PhysicsComponentBox2D_p.h"
+#include "Core/Component/Physics/Box2D/PhysicsComponentBox2D_p.h"
 #include "Core/Physics/Box2D/DebugDrawBox2D.h"
+#include "Core/Physics/Box2D/PhysicsWorkThreadBox2D.h"
 #include <Box2D/Box2D.h>
+#include <EGEMath.h>
+#include <EGEAtomic.h>
 
 EGE_NAMESPACE_BEGIN
 
@@ -13,13 +16,38 @@ EGE_DEFINE_NEW_OPERATORS(PhysicsManagerPrivate)
 EGE_DEFINE_DELETE_OPERATORS(PhysicsManagerPrivate)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PhysicsManagerPrivate::PhysicsManagerPrivate(PhysicsManager* base) : m_d(base), 
+                                                                     m_world(NULL),
+                                                                     m_debugDraw(NULL),
                                                                      m_scale(1.0f), 
-                                                                     m_invScale(1.0f)
+                                                                     m_invScale(1.0f),
+                                                                     m_interpolationEnabled(true),
+                                                                     m_interpolationAlpha(1.0f),
+                                                                     m_worldLockRequests(0),
+                                                                     m_scheduledSteps(0),
+                                                                     m_scheduledTime(0LL),
+                                                                     m_scheduledAlpha(1.0f),
+                                                                     m_requestedSteps(0),
+                                                                     m_requestedTime(0LL)
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PhysicsManagerPrivate::~PhysicsManagerPrivate()
 {
+  // stop work thread
+  // NOTE: this needs to be done before world is destroyed
+  if (NULL != m_workThread)
+  {
+    m_stepsMutex->lock();
+    m_workThread->stop(0);
+    m_stepsMutex->unlock();
+
+    // wake up work thread so it can finish
+    m_stepsScheduled->wakeOne();
+    m_workThread->wait();
+
+    m_workThread = NULL;
+  }
+
   EGE_DELETE(m_world);
   EGE_DELETE(m_debugDraw);
 }
@@ -35,6 +63,10 @@ EGEResult PhysicsManagerPrivate::construct(const Dictionary& params)
     m_invScale = 1.0f / m_scale;
   }
 
+  m_interpolationEnabled = params.value(EGE_PHYSICS_PARAM_INTERPOLATION, "true").toBool();
+  
+  bool threaded = params.value(EGE_PHYSICS_PARAM_THREADED, "false").toBool();
+
   // create world
   m_world = new b2World(b2Vec2(0, 0), true);
   if (NULL == m_world)
@@ -44,7 +76,7 @@ EGEResult PhysicsManagerPrivate::construct(const Dictionary& params)
   }
 
   // create debug drawer
-  m_debugDraw = ege_new DebugDraw(base->app(), this);
+  m_debugDraw = ege_new DebugDraw(d_func()->app(), this);
   if (NULL == m_debugDraw)
   {
     // error!
@@ -56,28 +88,278 @@ EGEResult PhysicsManagerPrivate::construct(const Dictionary& params)
 
   m_world->SetDebugDraw(m_debugDraw);
 
+  // create world access mutex
+  m_worldMutex = ege_new Mutex(d_func()->app());
+  if (NULL == m_worldMutex)
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  // check if simulation is to be run on dedicated thread
+  if (threaded)
+  {
+    // create scheduling objects
+    m_stepsMutex     = ege_new Mutex(d_func()->app());
+    m_stepsScheduled = ege_new WaitCondition(d_func()->app());
+    m_stepsProcessed = ege_new WaitCondition(d_func()->app());
+    if ((NULL == m_stepsMutex) || (NULL == m_stepsScheduled) || (NULL == m_stepsProcessed))
+    {
+      // error!
+      return EGE_ERROR_NO_MEMORY;
+    }
+
+    // create work thread
+    m_workThread = ege_new PhysicsWorkThread(d_func()->app(), this);
+    if (NULL == m_workThread)
+    {
+      // error!
+      return EGE_ERROR_NO_MEMORY;
+    }
+
+    // start thread
+    if ( ! m_workThread->start())
+    {
+      // error!
+      m_workThread = NULL;
+      return EGE_ERROR;
+    }
+  }
+
   return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsManagerPrivate::update(const Time& time)
 {
+  if (NULL != m_workThread)
+  {
+    // request step
+    // NOTE: steps are handed over to work thread at synchronization point so they are processed while frame is being rendered
+    ++m_requestedSteps;
+    m_requestedTime = time;
+    return;
+  }
+
+  step(time);
+
+  // without interpolation changes can be propagated right away
+  if ( ! m_interpolationEnabled)
+  {
+    collectTransformations();
+    propagateTransformations();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerPrivate::step(const Time& time)
+{
+  // store transformations prior to simulation step
+  // NOTE: sleeping bodies are not moved by solver so their previous transformations are up to date already
+  for (b2Body* body = m_world->GetBodyList(); NULL != body; body = body->GetNext())
+  {
+    PhysicsComponentPrivate* component = reinterpret_cast<PhysicsComponentPrivate*>(body->GetUserData());
+    if ((NULL != component) && (body->IsAwake() || component->m_movedInLastStep))
+    {
+      component->storePreviousTransformation();
+    }
+  }
+
   m_world->Step(time.seconds(), 8, 3);
   m_world->ClearForces();
 
-  // go thru all bodies and emit tranformation changes
-  // NOTE: this is due no way we can detect only the bodies which has been really changed in Box2D :-/
-  b2Body* node = m_world->GetBodyList();
-  while (node)
+  // go thru all bodies and find the ones which really moved
+  // NOTE: body which went asleep during this step could still have been moved
+  for (b2Body* body = m_world->GetBodyList(); NULL != body; body = body->GetNext())
+  {
+    PhysicsComponentPrivate* component = reinterpret_cast<PhysicsComponentPrivate*>(body->GetUserData());
+    if (NULL != component)
+    {
+      component->m_movedInLastStep = (body->IsAwake() || component->m_movedInLastStep) && component->isTransformationChanged();
+      if (component->m_movedInLastStep && ! component->m_transformationPending)
+      {
+        // add to propagation queue
+        m_pendingComponents.push_back(component);
+        component->m_transformationPending = true;
+      }
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerPrivate::interpolate(float32 alpha)
+{
+  alpha = m_interpolationEnabled ? Math::Clamp(alpha, 0.0f, 1.0f) : 1.0f;
+
+  if (NULL != m_workThread)
+  {
+    // wait until all steps scheduled in previous frame are done
+    // NOTE: they have been processed while previous frame was rendered so usually there is nothing to wait for
+    m_stepsMutex->lock();
+    while (0 < m_scheduledSteps)
+    {
+      m_stepsProcessed->wait(m_stepsMutex);
+    }
+    m_stepsMutex->unlock();
+
+    // retrieve results
+    // NOTE: work thread is idle now, lock is taken for safety of shared resources only
+    // NOTE: Box2D bodies are back buffer owned by work thread while render transformations are front buffer visible to the rest of the engine
+    lockWorld();
+    collectTransformations();
+    unlockWorld();
+
+    // interpolate by factor of the frame collected steps were scheduled in
+    // NOTE: this way rendered transformations lag one frame behind but consistently refer to the steps results of which are collected
+    m_interpolationAlpha = m_scheduledAlpha;
+    m_scheduledAlpha     = alpha;
+
+    // hand over steps requested in current frame
+    if (0 < m_requestedSteps)
+    {
+      m_stepsMutex->lock();
+      m_scheduledSteps = m_requestedSteps;
+      m_scheduledTime  = m_requestedTime;
+      m_stepsMutex->unlock();
+
+      m_stepsScheduled->wakeOne();
+
+      m_requestedSteps = 0;
+    }
+
+    propagateTransformations();
+    return;
+  }
+
+  m_interpolationAlpha = alpha;
+
+  if (m_interpolationEnabled)
+  {
+    collectTransformations();
+    propagateTransformations();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerPrivate::threadUpdate()
+{
+  // wait for steps to process
+  m_stepsMutex->lock();
+  while ((0 == m_scheduledSteps) && ! m_workThread->isStopping())
+  {
+    m_stepsScheduled->wait(m_stepsMutex);
+  }
+
+  const bool stepPending = (0 < m_scheduledSteps);
+  const Time stepTime    = m_scheduledTime;
+  m_stepsMutex->unlock();
+
+  if ( ! stepPending)
+  {
+    // stopping
+    return;
+  }
+
+  // process single step
+  // NOTE: world is locked for one step at a time only so other threads can access it in between
+  m_worldMutex->lock();
+  step(stepTime);
+  m_worldMutex->unlock();
+
+  // notify synchronization point if all done
+  m_stepsMutex->lock();
+  if (0 == --m_scheduledSteps)
+  {
+    m_stepsProcessed->wakeAll();
+  }
+  m_stepsMutex->unlock();
+
+  // let threads waiting for world access go first
+  // NOTE: mutex does not guarantee fairness so it could be reacquired right away otherwise
+  while (0 < egeAtomicLoad(m_worldLockRequests))
+  {
+    Thread::YieldCurrent();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerPrivate::lockWorld()
+{
+  egeAtomicIncrement(m_worldLockRequests);
+  m_worldMutex->lock();
+  egeAtomicDecrement(m_worldLockRequests);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerPrivate::unlockWorld()
+{
+  m_worldMutex->unlock();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerPrivate::collectTransformations()
+{
+  // go thru all pending components
+  for (size_t i = 0; i < m_pendingComponents.size(); ++i)
+  {
+    PhysicsComponentPrivate* component = m_pendingComponents[i];
+    if (NULL != component)
+    {
+      // update transformations visible to the rest of the engine
+      component->updateRenderTransformation();
+
+      // add to propagation pool
+      m_propagatedComponents.push_back(component);
+    }
+  }
+
+  // keep components which are still in motion as their interpolated transformations are going to change in the next frame as well
+  size_t count = 0;
+  for (size_t i = 0; i < m_pendingComponents.size(); ++i)
   {
-    b2Body* b = node;
-    node = node->GetNext();
+    PhysicsComponentPrivate* component = m_pendingComponents[i];
+    if (NULL == component)
+    {
+      // removed
+      continue;
+    }
 
-    PhysicsComponentPrivate* component = (PhysicsComponentPrivate*) b->GetUserData();
-    if (component)
+    if (m_interpolationEnabled && component->m_movedInLastStep)
+    {
+      m_pendingComponents[count++] = component;
+    }
+    else
+    {
+      component->m_transformationPending = false;
+    }
+  }
+
+  m_pendingComponents.resize(count);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerPrivate::propagateTransformations()
+{
+  // NOTE: iterating by index as components destroyed from within signal handlers are removed from the pool by nulling their entries
+  for (size_t i = 0; i < m_propagatedComponents.size(); ++i)
+  {
+    PhysicsComponentPrivate* component = m_propagatedComponents[i];
+    if (NULL != component)
     {
       emit component->d_func()->transformationChanged();
     }
   }
+
+  m_propagatedComponents.clear();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerPrivate::removePendingComponent(PhysicsComponentPrivate* component)
+{
+  s32 index = m_pendingComponents.indexOf(component);
+  if (0 <= index)
+  {
+    m_pendingComponents[index] = NULL;
+  }
+
+  index = m_propagatedComponents.indexOf(component);
+  if (0 <= index)
+  {
+    m_propagatedComponents[index] = NULL;
+  }
+
+  component->m_transformationPending = false;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsManagerPrivate::SayGoodbye(b2Fixture* fixture)
@@ -100,14 +382,37 @@ void PhysicsManagerPrivate::SayGoodbye(b2Joint* joint)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsManagerPrivate::setGravity(const Vector4f& gravity)
 {
+  PhysicsWorldLocker locker(this);
+
   world()->SetGravity(b2Vec2(gravity.x * worldToSimulationScaleFactor(), gravity.y * worldToSimulationScaleFactor()));
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsManagerPrivate::render()
 {
+  PhysicsWorldLocker locker(this);
+
+  // release components rendered in previous frame
+  m_debugDraw->clear();
+
   m_world->DrawDebugData();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PhysicsWorldLocker::PhysicsWorldLocker(PhysicsManagerPrivate* manager) : m_manager(manager->isThreaded() ? manager : NULL)
+{
+  if (NULL != m_manager)
+  {
+    m_manager->lockWorld();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PhysicsWorldLocker::~PhysicsWorldLocker()
+{
+  if (NULL != m_manager)
+  {
+    m_manager->unlockWorld();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
 
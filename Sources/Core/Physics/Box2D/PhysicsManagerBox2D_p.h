@@ -5,7 +5,11 @@
 
 #include <EGE.h>
 #include <EGETime.h>
-#include <Box2D/Box2d.h>
+#include <EGEDynamicArray.h>
+#include <EGEThread.h>
+#include <EGEMutex.h>
+#include <EGEWaitCondition.h>
+#include <Box2D/Box2D.h>
 #include "Core/Physics/PhysicsManager.h"
 #include "Core/Physics/PhysicsJointDistance.h"
 #include "Core/Physics/PhysicsJointAttract.h"
@@ -21,6 +25,7 @@ EGE_DECLARE_SMART_CLASS(PhysicsJointAttract, PPhysicsJointAttract)
 EGE_DECLARE_SMART_CLASS(PhysicsJointPulley, PPhysicsJointPulley)
 
 class PhysicsManager;
+class PhysicsComponentPrivate;
 class DebugDraw;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class PhysicsManagerPrivate : public b2DestructionListener
@@ -39,6 +44,11 @@ class PhysicsManagerPrivate : public b2DestructionListener
     EGEResult construct(const Dictionary& params);
     /*! Updates manager. */
     void update(const Time& time);
+    /*! Interpolates rendered transformations between two last simulation steps. 
+     *  @note When simulation runs on work thread this is synchronization point. Results of steps scheduled in previous frame are collected and steps 
+     *        scheduled in current frame are handed over to work thread so they are processed while current frame is being rendered.
+     */
+    void interpolate(float32 alpha);
     /*! Renders data. */
     void render();
     /*! Sets gravity. */
@@ -49,6 +59,22 @@ class PhysicsManagerPrivate : public b2DestructionListener
     float32 worldToSimulationScaleFactor() const { return m_scale; }
     /*! Returns simulation world to world scale coefficient. */
     float32 simulationToWorldScaleFactor() const { return m_invScale; }
+    /*! Returns current interpolation factor between previous and current simulation step. */
+    float32 interpolationAlpha() const { return m_interpolationAlpha; }
+    /*! Removes given component from transformation change propagation queue. */
+    void removePendingComponent(PhysicsComponentPrivate* component);
+    /*! Returns TRUE if simulation is run on dedicated work thread. */
+    bool isThreaded() const { return NULL != m_workThread; }
+    /*! Locks Box2D world for exclusive access. 
+     *  @note Work thread lets pending lock requests through between simulation steps.
+     */
+    void lockWorld();
+    /*! Unlocks Box2D world. */
+    void unlockWorld();
+    /*! Waits for scheduled simulation steps and processes single one.
+     *  @note This is called from work thread.
+     */
+    void threadUpdate();
 
   private:
 
@@ -56,6 +82,14 @@ class PhysicsManagerPrivate : public b2DestructionListener
   	void SayGoodbye(b2Fixture* fixture) override;
     /*! b2DestructionListener override. Box2D joint is about to be destroyed. */
   	void SayGoodbye(b2Joint* joint) override;
+    /*! Performs single simulation step and queues all components which moved. */
+    void step(const Time& time);
+    /*! Updates transformations of all pending components and moves them to propagation pool.
+     *  @note When simulation runs on work thread this is to be called at synchronization point only.
+     */
+    void collectTransformations();
+    /*! Emits transformation change notifications for all components in propagation pool. */
+    void propagateTransformations();
 
   private:
 
@@ -67,6 +101,58 @@ class PhysicsManagerPrivate : public b2DestructionListener
     float32 m_scale;
     /*! Simulation world to extrnal world scale coeficient. Inverse of scale factor. */
     float32 m_invScale;
+    /*! Interpolation enable flag. */
+    bool m_interpolationEnabled;
+    /*! Current interpolation factor between previous and current simulation step. */
+    float32 m_interpolationAlpha;
+    /*! Components which transformation changes are yet to be collected. 
+     *  @note When simulation runs on work thread this is shared resource.
+     */
+    DynamicArray<PhysicsComponentPrivate*> m_pendingComponents;
+    /*! Components which transformation changes are to be propagated. */
+    DynamicArray<PhysicsComponentPrivate*> m_propagatedComponents;
+    /*! Simulation work thread. NULL if simulation is run on main thread. */
+    PThread m_workThread;
+    /*! Box2D world access mutex. */
+    PMutex m_worldMutex;
+    /*! Number of threads other than work thread waiting for world access mutex. */
+    volatile u32 m_worldLockRequests;
+    /*! Simulation steps scheduling mutex. 
+     *  @note This is separate from world access mutex so scheduling never waits for simulation step in progress.
+     */
+    PMutex m_stepsMutex;
+    /*! Wait condition signaled when simulation steps are scheduled for work thread. */
+    PWaitCondition m_stepsScheduled;
+    /*! Wait condition signaled when work thread processed all scheduled simulation steps. */
+    PWaitCondition m_stepsProcessed;
+    /*! Number of simulation steps scheduled for work thread. 
+     *  @note This is shared resource.
+     */
+    s32 m_scheduledSteps;
+    /*! Duration of simulation steps scheduled for work thread. 
+     *  @note This is shared resource.
+     */
+    Time m_scheduledTime;
+    /*! Interpolation factor requested in the frame simulation steps being processed by work thread were scheduled in. */
+    float32 m_scheduledAlpha;
+    /*! Number of simulation steps requested in current frame. They are handed over to work thread at synchronization point. */
+    s32 m_requestedSteps;
+    /*! Duration of simulation steps requested in current frame. */
+    Time m_requestedTime;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Convienience class serializing Box2D world access with simulation work thread. No locking takes place when simulation is run on main thread. */
+class PhysicsWorldLocker
+{
+  public:
+
+    PhysicsWorldLocker(PhysicsManagerPrivate* manager);
+   ~PhysicsWorldLocker();
+
+  private:
+
+    /*! Physics manager which world is accessed. NULL if no locking is required. */
+    PhysicsManagerPrivate* m_manager;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
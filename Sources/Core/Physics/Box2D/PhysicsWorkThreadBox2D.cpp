@@ -0,0 +1,32 @@
+#ifdef EGE_PHYSICS_BOX2D
+
+#include "Core/Application/Application.h"
+#include "Core/Physics/Box2D/PhysicsManagerBox2D_p.h"
+#include "Core/Physics/Box2D/PhysicsWorkThreadBox2D.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PhysicsWorkThread::PhysicsWorkThread(Application* app, PhysicsManagerPrivate* manager) : Thread(app),
+                                                                                         m_manager(manager)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PhysicsWorkThread::~PhysicsWorkThread()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 PhysicsWorkThread::run()
+{
+  while ( ! isStopping())
+  {
+    m_manager->threadUpdate();
+  }
+
+  return 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_PHYSICS_BOX2D
\ No newline at end of file
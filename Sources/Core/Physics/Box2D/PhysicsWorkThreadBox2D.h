@@ -0,0 +1,39 @@
+#ifndef EGE_CORE_PHYSICSWORKTHREADBOX2D_H
+#define EGE_CORE_PHYSICSWORKTHREADBOX2D_H
+
+#ifdef EGE_PHYSICS_BOX2D
+
+/*! Physics manager's working thread responsible for running Box2D simulation steps in parallel with the rest of the frame. 
+ */
+
+#include "EGEThread.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class PhysicsManagerPrivate;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class PhysicsWorkThread : public Thread
+{
+  public:
+
+    PhysicsWorkThread(Application* app, PhysicsManagerPrivate* manager);
+   ~PhysicsWorkThread();
+
+  private:
+
+    /*! @see Thread::run */
+    EGE::s32 run() override;
+
+  private:
+
+    /*! Physics manager instance. */
+    PhysicsManagerPrivate* m_manager;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_PHYSICS_BOX2D
+
+#endif // EGE_CORE_PHYSICSWORKTHREADBOX2D_H
\ No newline at end of file
@@ -38,6 +38,11 @@ void PhysicsManagerPrivate::update(const Time& time)
   EGE_UNUSED(time);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerPrivate::interpolate(float32 alpha)
+{
+  EGE_UNUSED(alpha);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsManagerPrivate::setGravity(const Vector4f& gravity)
 {
 }
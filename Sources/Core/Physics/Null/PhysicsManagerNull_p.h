@@ -37,6 +37,8 @@ class PhysicsManagerPrivate
     EGEResult construct(const Dictionary& params);
     /*! Updates manager. */
     void update(const Time& time);
+    /*! Interpolates rendered transformations between two last simulation steps. */
+    void interpolate(float32 alpha);
     /*! Renders data. */
     void render();
     /*! Sets gravity. */
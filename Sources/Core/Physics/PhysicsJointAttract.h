@@ -2,6 +2,7 @@
 #define EGE_CORE_PHYSICSJOINTATTRACT_H
 
 #include "EGE.h"
+#include "EGEVector4.h"
 #include "Core/Physics/PhysicsJoint.h"
 
 EGE_NAMESPACE_BEGIN
@@ -68,6 +68,11 @@ void PhysicsManager::update(const Time& time)
   //}
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManager::interpolate(float32 alpha)
+{
+  p_func()->interpolate(alpha);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void PhysicsManager::setGravity(const Vector4f& gravity)
 {
   p_func()->setGravity(gravity);
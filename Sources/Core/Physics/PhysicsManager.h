@@ -40,6 +40,13 @@ class PhysicsManager : public Object
     EGEResult construct(const Dictionary& params);
     /*! Updates manager. */
     void update(const Time& time);
+    /*! Interpolates rendered transformations between two last simulation steps.
+     *  @param  alpha Fraction of update interval which passed since last simulation step. Value in [0-1] interval.
+     *  @note   This is to be called once per frame after all simulation steps for the frame has been done.
+     *  @note   If simulation runs on dedicated thread, this collects results of simulation steps requested in previous frame and starts ones requested
+     *          in current frame. Rendered transformations lag one frame behind then.
+     */
+    void interpolate(float32 alpha);
     /*! Renders data. */
     void render();
     /*! Sets gravity. */
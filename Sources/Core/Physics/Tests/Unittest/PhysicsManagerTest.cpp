@@ -0,0 +1,297 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGEApplication.h>
+#include <EGEMemory.h>
+#include <EGEPhysics.h>
+#include <EGETimer.h>
+#include <EGEThread.h>
+#include <vector>
+
+#ifdef EGE_PHYSICS_BOX2D
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of colliding bodies. */
+#define BODIES_COUNT      30
+/*! Number of colliding bodies loading simulation when testing world access. */
+#define LOAD_BODIES_COUNT 600
+/*! Number of simulated frames. */
+#define FRAMES_COUNT      60
+/*! Number of simulation steps scheduled at once when testing world access. */
+#define STEPS_COUNT       50
+/*! Gravity acceleration. */
+#define GRAVITY           10.0f
+/*! Maximal duration of scheduled simulation steps (in microseconds). */
+#define TIMEOUT           5000000LL
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Headless application instance. */
+class PhysicsTestApplication : public Application
+{
+  public:
+
+    /*! @see Application::onInitialized. */
+    void onInitialized() override {}
+    /*! @see Application::version. */
+    Version version() const override { return Version(1, 0, 0); }
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class PhysicsManagerTest : public TestBase
+{
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void TearDown();
+
+  protected:
+
+    /*! Creates application with given physics threading mode. */
+    void createApplication(bool threaded);
+    /*! Creates ground and given number of dynamic bodies falling on it and colliding with each other. */
+    void createScene(s32 bodiesCount);
+    /*! Creates dynamic body not colliding with anything. */
+    PPhysicsComponent createProbe();
+    /*! Simulates scene and stores resulting transformations of all bodies after each frame.
+     *  @param  threaded  TRUE if simulation is to be run on work thread.
+     *  @param  results   Array of transformation components to append to.
+     */
+    void simulate(bool threaded, std::vector<float32>& results);
+
+  protected:
+
+    /*! Application instance. */
+    PhysicsTestApplication* m_app;
+    /*! Simulated bodies. */
+    DynamicArray<PPhysicsComponent> m_bodies;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerTest::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerTest::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerTest::TearDown()
+{
+  m_bodies.clear();
+
+  EGE_DELETE(m_app);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerTest::createApplication(bool threaded)
+{
+  Dictionary params;
+  params[EGE_RENDER_TARGET_PARAM_NAME]    = EGE_PRIMARY_RENDER_TARGET_NAME;
+  params[EGE_RENDER_TARGET_PARAM_WIDTH]   = "1024";
+  params[EGE_RENDER_TARGET_PARAM_HEIGHT]  = "768";
+  params[EGE_ENGINE_PARAM_HEADLESS]       = "true";
+  params[EGE_PHYSICS_PARAM_THREADED]      = threaded ? "true" : "false";
+
+  m_app = ege_new PhysicsTestApplication();
+  ASSERT_TRUE(NULL != m_app);
+  ASSERT_EQ(EGE_SUCCESS, m_app->construct(params));
+
+  m_app->physicsManager()->setGravity(Vector4f(0, -GRAVITY, 0, 0));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerTest::createScene(s32 bodiesCount)
+{
+  // NOTE: bodies of the same positive group always collide
+  EGEPhysics::CollisionData collisionData;
+  collisionData.policy = 1;
+
+  // create ground
+  PPhysicsComponent ground = ege_new PhysicsComponent(m_app, "ground", EGEPhysics::COMPONENT_STATIC);
+  ASSERT_TRUE(NULL != ground);
+
+  DynamicArray<Vector4f> points;
+  points.push_back(Vector4f(-50, -1, 0, 1));
+  points.push_back(Vector4f(50, -1, 0, 1));
+  points.push_back(Vector4f(50, 1, 0, 1));
+  points.push_back(Vector4f(-50, 1, 0, 1));
+  EXPECT_TRUE(ground->addPolygonShape(points, 0, collisionData));
+
+  m_bodies.push_back(ground);
+
+  // create bodies stacked above ground
+  // NOTE: every other row is shifted so bodies roll and rotate when colliding
+  for (s32 i = 0; i < bodiesCount; ++i)
+  {
+    PPhysicsComponent body = ege_new PhysicsComponent(m_app, String::Format("body-%d", i), EGEPhysics::COMPONENT_DYNAMIC);
+    ASSERT_TRUE(NULL != body);
+
+    EXPECT_TRUE(body->addCircleShape(0.5f, 1.0f, collisionData));
+    body->setPosition(Vector4f((i % 6 - 3) * 1.1f + (i / 6 % 2) * 0.3f, 2.0f + (i / 6) * 1.1f, 0, 1));
+
+    m_bodies.push_back(body);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PPhysicsComponent PhysicsManagerTest::createProbe()
+{
+  // NOTE: default collision data makes body never collide
+  PPhysicsComponent probe = ege_new PhysicsComponent(m_app, "probe", EGEPhysics::COMPONENT_DYNAMIC);
+  if (NULL != probe)
+  {
+    probe->addCircleShape(0.5f, 1.0f);
+    probe->setPosition(Vector4f(100, 100, 0, 1));
+  }
+
+  return probe;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PhysicsManagerTest::simulate(bool threaded, std::vector<float32>& results)
+{
+  createApplication(threaded);
+  createScene(BODIES_COUNT);
+
+  PhysicsManager* manager = m_app->physicsManager();
+
+  for (s32 frame = 0; frame < FRAMES_COUNT; ++frame)
+  {
+    // vary number of steps per frame and interpolation factor
+    const s32 steps = 1 + frame % 3;
+    for (s32 i = 0; i < steps; ++i)
+    {
+      manager->update(Time(1.0f / 60.0f));
+    }
+
+    manager->interpolate(0.25f * (frame % 4));
+
+    // store results
+    for (DynamicArray<PPhysicsComponent>::const_iterator it = m_bodies.begin(); it != m_bodies.end(); ++it)
+    {
+      const PPhysicsComponent& body = *it;
+
+      const Vector4f position             = body->position();
+      const Vector4f interpolatedPosition = body->interpolatedPosition();
+      const Quaternionf orientation       = body->orientation();
+
+      results.push_back(position.x);
+      results.push_back(position.y);
+      results.push_back(interpolatedPosition.x);
+      results.push_back(interpolatedPosition.y);
+      results.push_back(orientation.x);
+      results.push_back(orientation.y);
+      results.push_back(orientation.z);
+      results.push_back(orientation.w);
+    }
+  }
+
+  TearDown();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(PhysicsManagerTest, ThreadedMatchesSingleThreaded)
+{
+  std::vector<float32> expected;
+  std::vector<float32> actual;
+
+  simulate(false, expected);
+  simulate(true, actual);
+
+  const size_t frameSize = 8 * (BODIES_COUNT + 1);
+
+  // NOTE: simulation steps are exactly the same, only thread executing them differs
+  // NOTE: threaded simulation processes steps while frame is rendered so its results are visible one frame later
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = frameSize; i < actual.size(); ++i)
+  {
+    ASSERT_EQ(expected[i - frameSize], actual[i]) << "Mismatch at frame " << i / frameSize;
+  }
+
+  // make sure first body actually moved
+  // NOTE: first body follows the ground in results of each frame
+  EXPECT_NE(expected[8 + 1], expected[expected.size() - frameSize + 8 + 1]);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(PhysicsManagerTest, WorldAccessibleWhileStepping)
+{
+  // NOTE: simulation steps need to be long enough to span over number of time slices on single core machines
+  createApplication(true);
+  createScene(LOAD_BODIES_COUNT);
+
+  PPhysicsComponent probe = createProbe();
+  ASSERT_TRUE(NULL != probe);
+
+  PhysicsManager* manager = m_app->physicsManager();
+
+  const float32 stepTime = 1.0f / 60.0f;
+
+  // schedule number of steps at once
+  // NOTE: steps are handed over to work thread at synchronization point
+  for (s32 i = 0; i < STEPS_COUNT; ++i)
+  {
+    manager->update(Time(stepTime));
+  }
+
+  manager->interpolate(0);
+
+  // access world until all steps are done
+  // NOTE: probe is falling freely so number of steps done so far can be deduced from its velocity
+  // NOTE: linear velocity query locks the world, which is possible in between the steps
+  bool intermediateObserved = false;
+  s32 stepsDone = 0;
+  const s64 startTime = Timer::GetMicroseconds();
+  while ((STEPS_COUNT > stepsDone) && (TIMEOUT > Timer::GetMicroseconds() - startTime))
+  {
+    stepsDone = static_cast<s32>(-probe->linearVelocity().y / (GRAVITY * stepTime) + 0.5f);
+    if ((0 < stepsDone) && (STEPS_COUNT > stepsDone))
+    {
+      intermediateObserved = true;
+    }
+  }
+
+  // collect results
+  manager->interpolate(0);
+
+  EXPECT_TRUE(intermediateObserved);
+  EXPECT_EQ(STEPS_COUNT, stepsDone);
+
+  // NOTE: probe needs to be released before application
+  probe = NULL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(PhysicsManagerTest, ResultsCollectedAtNextSynchronizationPoint)
+{
+  createApplication(true);
+
+  PPhysicsComponent probe = createProbe();
+  ASSERT_TRUE(NULL != probe);
+
+  PhysicsManager* manager = m_app->physicsManager();
+
+  const float32 startY = probe->position().y;
+
+  // request step and hand it over to work thread
+  manager->update(Time(1.0f / 60.0f));
+  manager->interpolate(1.0f);
+
+  // wait until step is done
+  // NOTE: linear velocity is queried from simulation world directly
+  const s64 startTime = Timer::GetMicroseconds();
+  while ((0 == probe->linearVelocity().y) && (TIMEOUT > Timer::GetMicroseconds() - startTime))
+  {
+    Thread::YieldCurrent();
+  }
+
+  EXPECT_GT(0.0f, probe->linearVelocity().y);
+
+  // rendered transformation should not change until next synchronization point
+  EXPECT_EQ(startY, probe->position().y);
+
+  manager->interpolate(1.0f);
+  EXPECT_GT(startY, probe->position().y);
+
+  // NOTE: probe needs to be released before application
+  probe = NULL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#endif // EGE_PHYSICS_BOX2D
\ No newline at end of file
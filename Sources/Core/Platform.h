@@ -9,6 +9,7 @@ inline void ege_noop() {}
 // EGE_PLATFORM_WIN32
 // EGE_PLATFORM_AIRPLAY
 // EGE_PLATFORM_IOS
+// EGE_PLATFORM_POSIX
 
 // Available rendering APIs
 // EGE_RENDERING_OPENGL_FIXED
@@ -53,6 +54,12 @@ inline void ege_noop() {}
   #define EGE_PLATFORM_AIRPLAY 1
 #endif // AIRPLAY_BUILD
 
+// NOTE: POSIX platform is headless, it is meant for running engine core on servers (tools, tests, benchmarks)
+#if defined(__linux__) && ! AIRPLAY_BUILD
+  #define EGE_PLATFORM_POSIX 1
+  #define PLATFORM_CLASSNAME(classname) classname##Posix
+#endif // __linux__ && ! AIRPLAY_BUILD
+
 #ifdef __APPLE__
   #include "TargetConditionals.h"
 
@@ -101,6 +108,11 @@ inline void ege_noop() {}
 #include <cmath>
 #endif // EGE_PLATFORM_IOS
 
+#if EGE_PLATFORM_POSIX
+#include <cmath>
+#include <assert.h>
+#endif // EGE_PLATFORM_POSIX
+
 // Compiler specific
 #ifdef __GNUC__
 #define override
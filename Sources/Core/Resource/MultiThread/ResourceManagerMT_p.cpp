@@ -20,6 +20,13 @@ ResourceManagerPrivate::ResourceManagerPrivate(ResourceManager* base) : m_d(base
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 ResourceManagerPrivate::~ResourceManagerPrivate()
 {
+  // check if work thread is still running (ie manager has not been shut down)
+  if ((NULL != m_workThread) && m_workThread->isRunning())
+  {
+    // stop it before synchronization objects are gone
+    shutDown();
+    m_workThread->wait();
+  }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGEResult ResourceManagerPrivate::construct()
@@ -227,18 +234,15 @@ void ResourceManagerPrivate::threadUpdate()
   // NOTE: stop processing when not ready (ie closing)
   while (m_pendingList.empty() && (ResourceManager::STATE_READY == m_state))
   {
+    m_mutex->lock();
+
     // check if no more data to process
-    if (m_scheduledList.empty())
+    // NOTE: state is checked again under lock so shut down request cannot be missed
+    if (m_scheduledList.empty() && (ResourceManager::STATE_READY == m_state))
     {
       // wait for data
-      m_mutex->lock();
       m_commandsToProcess->wait(m_mutex);
     }
-    else
-    {
-      // just lock and retrieve data
-      m_mutex->lock();
-    }
 
     // copy scheduled data
     ProcessingBatchList newScheduledData(m_scheduledList);
@@ -360,8 +364,10 @@ ResourceManager::ResourceProcessPolicy ResourceManagerPrivate::resourceProcessPo
 void ResourceManagerPrivate::shutDown()
 {
   // mark we are to be closed
+  m_mutex->lock();
   m_state = ResourceManager::STATE_CLOSING;
-  
+  m_mutex->unlock();
+
   // request stop
   m_workThread->stop(0);
 
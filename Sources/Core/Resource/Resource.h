@@ -43,7 +43,7 @@ class IResource : public Object
      *  @param  path  full path to resource definition file.
      *  @param  tag   xml element with resource definition. 
      */
-    virtual EGEResult create(const String& path, const PXmlElement& tag) = 0;
+    virtual EGEResult create(const String& path, const XmlElementHandle& tag) = 0;
     /*! Loads resource. 
      *  @return Returns EGE_SUCCESS if resource has been loaded. EGE_WAIT if resource is being loaded.
      */
@@ -55,7 +55,7 @@ const String& ResourceCurve::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceCurve::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceCurve::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
@@ -64,8 +64,8 @@ EGEResult ResourceCurve::create(const String& path, const PXmlElement& tag)
   bool error = false;
 
   // get data
-  m_name  = tag->attribute("name");
-  m_type  = MapCurveTypeName(tag->attribute("type").toLower(), EBezier);
+  m_name  = tag.attribute("name");
+  m_type  = MapCurveTypeName(String(tag.attribute("type")).toLower(), EBezier);
 
   // check if obligatory data is wrong
   if (error || m_name.empty())
@@ -76,20 +76,20 @@ EGEResult ResourceCurve::create(const String& path, const PXmlElement& tag)
   }
 
   // go thru all sub node
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
     // check child
-    if (NODE_POINT == child->name())
+    if (child.hasName(NODE_POINT))
     {
       PointData point;
 
-      point.position             = StringUtils::ToVector3f(child->attribute("pos", "0 0 0"), &error);
-      point.tangent              = StringUtils::ToVector3f(child->attribute("tangent", "0 0 0"), &error);
-      point.beginTangentOverride = child->hasAttribute("begin-tangent");
+      point.position             = StringUtils::ToVector3f(child.attribute("pos", "0 0 0"), &error);
+      point.tangent              = StringUtils::ToVector3f(child.attribute("tangent", "0 0 0"), &error);
+      point.beginTangentOverride = child.hasAttribute("begin-tangent");
       if (point.beginTangentOverride)
       {
-        point.beginTangent = StringUtils::ToVector3f(child->attribute("begin-tangent", "0 0 0"), &error);
+        point.beginTangent = StringUtils::ToVector3f(child.attribute("begin-tangent", "0 0 0"), &error);
       }
 
       if (error)
@@ -112,7 +112,7 @@ EGEResult ResourceCurve::create(const String& path, const PXmlElement& tag)
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   // check if success
@@ -3,11 +3,15 @@
 #include "EGEFile.h"
 #include "EGEResources.h"
 #include "EGEDirectory.h"
+#include "EGECipher.h"
+#include "EGEApplication.h"
 
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 static const char* KResourceDataDebugName = "ResourceData";
+static const char* KCipherNameXOR         = "xor";
+static const char* KCipherNameAES         = "aes";
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGE_DEFINE_NEW_OPERATORS(ResourceData)
 EGE_DEFINE_DELETE_OPERATORS(ResourceData)
@@ -31,18 +35,19 @@ const String& ResourceData::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceData::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceData::create(const String& path, const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
   // get data
   bool error = false;
-  m_name   = tag->attribute("name");
-  m_path   = tag->attribute("path");
-  m_nulled = tag->attribute("nulled").toBool(&error);
+  m_name   = tag.attribute("name");
+  m_path   = tag.attribute("path");
+  m_nulled = tag.boolAttribute("nulled", &error);
+  m_cipherName = String(tag.attribute("cipher")).toLower();
 
   // check if obligatory data is wrong
-  if (m_name.empty() || m_path.empty() || error)
+  if (m_name.empty() || m_path.empty() || error || ( ! m_cipherName.empty() && (KCipherNameXOR != m_cipherName) && (KCipherNameAES != m_cipherName)))
   {
     // error!
     egeWarning(KResourceDataDebugName) << "Failed for name:" << m_name;
@@ -81,9 +86,36 @@ EGEResult ResourceData::load()
 
     // get file size
     s64 size = file.size();
+    if (-1 == size)
+    {
+      // error!
+      return EGE_ERROR_IO;
+    }
+
+    // check if data is ciphered
+    PCipher cipher;
+    if ( ! m_cipherName.empty())
+    {
+      cipher = createCipher();
+      if (NULL == cipher)
+      {
+        // error!
+        return EGE_ERROR;
+      }
+
+      // decipher entire file while reading
+      CipherStream stream(cipher);
+      if (size != stream.read(file, size))
+      {
+        // error!
+        return EGE_ERROR_IO;
+      }
 
+      // NOTE: deciphered data is owned by cipher
+      buffer = cipher->result();
+    }
     // read entire file
-    if ((-1 == size) || (size != file.read(buffer, size)))
+    else if (size != file.read(buffer, size))
     {
       // error!
       return EGE_ERROR_IO;
@@ -103,7 +135,8 @@ EGEResult ResourceData::load()
     }
 
     // success
-    m_data = buffer;
+    m_data   = buffer;
+    m_cipher = cipher;
 
     // set flag
     m_state = STATE_LOADED;
@@ -115,11 +148,35 @@ EGEResult ResourceData::load()
 void ResourceData::unload()
 {
   // clean up
-  m_data = NULL;
+  m_data   = NULL;
+  m_cipher = NULL;
 
   // reset flag
   m_state = STATE_UNLOADED;
 }
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PCipher ResourceData::createCipher() const
+{
+  const PCipherKey& key = app()->resourceManager()->cipherKey();
+  if (NULL == key)
+  {
+    // error!
+    egeWarning(KResourceDataDebugName) << "No cipher key for:" << m_name;
+    return NULL;
+  }
+
+  PCipher cipher;
+  if (KCipherNameXOR == m_cipherName)
+  {
+    cipher = ege_new CipherXOR(EDecrypt, key);
+  }
+  else if (KCipherNameAES == m_cipherName)
+  {
+    cipher = ege_new CipherAES(EDecrypt, key, app()->jobSystem());
+  }
+
+  return cipher;
+}
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
  EGE_NAMESPACE_END
\ No newline at end of file
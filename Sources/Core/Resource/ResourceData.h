@@ -3,6 +3,7 @@
 
 /** Data resource definition class. This object (resource) contains definition of location to particular data buffer (file).
  *   Upon loading it contains data buffer filled with data in the given location.
+ *   Data can be ciphered with XOR or AES cipher (see 'cipher' attribute) using key set in resource manager. Such data is deciphered while being read.
  */
 
 #include "EGE.h"
@@ -17,6 +18,7 @@ EGE_NAMESPACE_BEGIN
 class ResourceGroup;
 
 EGE_DECLARE_SMART_CLASS(ResourceData, PResourceData)
+EGE_DECLARE_SMART_CLASS(Cipher, PCipher)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class ResourceData : public IResource
 {
@@ -33,7 +35,7 @@ class ResourceData : public IResource
     /*! @see IResource::name. */
     const String& name() const override;
     /*! @see IResource::create. */ 
-    EGEResult create(const String& path, const PXmlElement& tag) override;
+    EGEResult create(const String& path, const XmlElementHandle& tag) override;
     /*! @see IResource::load. */
     EGEResult load() override;
     /*! @see IResource::unload. */
@@ -47,6 +49,8 @@ class ResourceData : public IResource
     ResourceData(Application* app, ResourceGroup* group);
     /*! Returns whether data is NULL terminated.*/
     bool isNulled() const { return m_nulled; }
+    /*! Creates cipher deciphering data. Returns NULL if cipher could not be created. */
+    PCipher createCipher() const;
 
   private:
 
@@ -54,8 +58,12 @@ class ResourceData : public IResource
     String m_name;
     /*! Flag indicating if data should be NULL terminated upon loading. */
     bool m_nulled;
+    /*! Name of the cipher data is ciphered with. Empty if data is not ciphered. */
+    String m_cipherName;
     /*! Data object created from resource. NULL if not created yet. */
     PDataBuffer m_data;
+    /*! Cipher owning deciphered data. NULL if data is not ciphered or not loaded. */
+    PCipher m_cipher;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
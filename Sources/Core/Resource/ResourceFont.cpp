@@ -46,7 +46,7 @@ const String& ResourceFont::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceFont::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceFont::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
@@ -55,9 +55,9 @@ EGEResult ResourceFont::create(const String& path, const PXmlElement& tag)
   bool error = false;
 
   // get data
-  m_name         = tag->attribute("name");
-  m_materialName = tag->attribute("material");
-  m_height       = tag->attribute("height").toInt(&error);
+  m_name         = tag.attribute("name");
+  m_materialName = tag.attribute("material");
+  m_height       = tag.intAttribute("height", &error);
 
   // check if obligatory data is wrong
   if (m_name.empty() || m_materialName.empty() || error)
@@ -67,22 +67,22 @@ EGEResult ResourceFont::create(const String& path, const PXmlElement& tag)
     return EGE_ERROR_BAD_PARAM;
   }
 
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
     // check if GLYPH element
-    if ("glyph" == child->name())
+    if (child.hasName("glyph"))
     {
       GlyphData glyph;
 
       error = false;
 
-      u16 value                   = (u16) child->attribute("value").toInt(&error);
-      glyph.m_textureRect.x       = child->attribute("image-x").toFloat(&error);
-      glyph.m_textureRect.y       = child->attribute("image-y").toFloat(&error);
-      glyph.m_textureRect.width   = child->attribute("image-width").toFloat(&error);
-      glyph.m_textureRect.height  = child->attribute("image-height").toFloat(&error);
-      glyph.m_width               = child->attribute("width").toInt(&error);
+      u16 value                   = (u16) child.intAttribute("value", &error);
+      glyph.m_textureRect.x       = child.floatAttribute("image-x", &error);
+      glyph.m_textureRect.y       = child.floatAttribute("image-y", &error);
+      glyph.m_textureRect.width   = child.floatAttribute("image-width", &error);
+      glyph.m_textureRect.height  = child.floatAttribute("image-height", &error);
+      glyph.m_width               = child.intAttribute("width", &error);
 
       // check for errors
       if (error)
@@ -96,7 +96,7 @@ EGEResult ResourceFont::create(const String& path, const PXmlElement& tag)
     }
 
     // go to next element
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   // check if success
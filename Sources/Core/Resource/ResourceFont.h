@@ -48,7 +48,7 @@ class ResourceFont : public IResource
     /*! @see IResource::name. */
     const String& name() const override;
     /*! @see IResource::create. */ 
-    EGEResult create(const String& path, const PXmlElement& tag) override;
+    EGEResult create(const String& path, const XmlElementHandle& tag) override;
     /*! @see IResource::load. */
     EGEResult load() override;
     /*! @see IResource::unload. */
@@ -30,15 +30,15 @@ ResourceGroup::~ResourceGroup()
   destroy();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceGroup::create(const String& path,  const PXmlElement& tag)
+EGEResult ResourceGroup::create(const String& path, const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
   bool error = false;
 
   // get data
-  m_name        = tag->attribute("name");
-  m_overridable = tag->attribute("overridable", false);
+  m_name        = tag.attribute("name");
+  m_overridable = tag.attribute("overridable", false);
   m_path        = path;
 
   // check if wrong data
@@ -50,11 +50,11 @@ EGEResult ResourceGroup::create(const String& path,  const PXmlElement& tag)
   }
 
   // go thru all children
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
     // check if dependancy entry
-    if (NODE_DEPENDANCY == child->name())
+    if (child.hasName(NODE_DEPENDANCY))
     {
       // add dependancy
       if (EGE_SUCCESS != (result = addDependancy(child)))
@@ -66,7 +66,7 @@ EGEResult ResourceGroup::create(const String& path,  const PXmlElement& tag)
     else
     {
       // create resource instance
-      PResource resource = manager()->createResource(child->name(), this);
+      PResource resource = manager()->createResource(child.name(), this);
       if (resource)
       {
         // initialize from XML
@@ -86,7 +86,7 @@ EGEResult ResourceGroup::create(const String& path,  const PXmlElement& tag)
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   return result;
@@ -225,24 +225,8 @@ EGEResult ResourceGroup::unload()
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PResource ResourceGroup::resource(const String& typeName, const String& name) const
 {
-  PResource resource;
-  
-  // get all resources of a given type
-  std::pair<ResourcesMap::const_iterator, ResourcesMap::const_iterator> range = m_resources.equal_range(typeName);
-
-  // go thru all resources of a given type
-  for (ResourcesMap::const_iterator it = range.first; it != range.second; ++it)
-  {
-    // check if resource of a given name found
-    if (it->second->name() == name)
-    {
-      // found
-      resource = it->second;
-      break;
-    }
-  }
-
-  return resource;
+  u64 key;
+  return FindIndexKey(typeName, name, key) ? m_index.value(key, NULL) : NULL;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 List<PResource> ResourceGroup::resources(const String& typeName) const
@@ -291,20 +275,37 @@ void ResourceGroup::destroy()
     // remove from pool
     m_resources.erase(it++);
   }
+
+  m_index.clear();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGEResult ResourceGroup::addResource(const PResource& resource)
 {
+  // intern names for index
+  // NOTE: name could not be interned only if name table is full, in which case it would clash with empty name
+  const Name typeName(resource->typeName());
+  const Name name(resource->name());
+  if ((typeName.isEmpty() && ! resource->typeName().empty()) || (name.isEmpty() && ! resource->name().empty()))
+  {
+    // error!
+    egeCritical(KResourceGroupDebugName) << "Could not intern name of resource" << resource->name();
+    return EGE_ERROR_NO_MEMORY;
+  }
+
   // add to pool
   m_resources.insert(resource->typeName(), resource);
 
+  // add to index
+  // NOTE: this does not overwrite resource of the same type and name already present
+  m_index.insert(IndexKey(typeName, name), resource);
+
   return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceGroup::addDependancy(const PXmlElement& tag)
+EGEResult ResourceGroup::addDependancy(const XmlElementHandle& tag)
 {
   // get data
-  String name = tag->attribute("name");
+  String name = tag.attribute("name");
 
   // check if wrong data
   if (name.empty())
@@ -358,6 +359,7 @@ EGEResult ResourceGroup::overrideBy(const PResourceGroup& group)
         // override
         egeWarning(KResourceGroupDebugName) << "Overriding resource" << incomingResource->name();
         itRes->second = incomingResource;
+        m_index[IndexKey(incomingResource->typeName(), incomingResource->name())] = incomingResource;
 
         // override group
         incomingResource->m_group = this;
@@ -389,5 +391,25 @@ const String& ResourceGroup::path() const
   return m_path;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u64 ResourceGroup::IndexKey(const Name& typeName, const Name& name)
+{
+  return (static_cast<u64>(typeName.id()) << 32) | name.id();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool ResourceGroup::FindIndexKey(const String& typeName, const String& name, u64& key)
+{
+  // NOTE: strings are not interned as names of every indexed resource are interned already
+  const Name typeNameId = Name::Find(typeName);
+  const Name nameId     = Name::Find(name);
+  if ((typeNameId.isEmpty() && ! typeName.empty()) || (nameId.isEmpty() && ! name.empty()))
+  {
+    // not found
+    return false;
+  }
+
+  key = IndexKey(typeNameId, nameId);
+  return true;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "EGE.h"
 #include "EGEXml.h"
 #include "EGEString.h"
+#include "EGEName.h"
 #include "EGEStringList.h"
 #include "EGEList.h"
 #include "EGEMap.h"
@@ -55,7 +56,7 @@ class ResourceGroup : public Object
      *  @param  path  full path to resource definition file.
      *  @param  tag   xml element with resource definition. 
      */
-    EGEResult create(const String& path,  const PXmlElement& tag);
+    EGEResult create(const String& path, const XmlElementHandle& tag);
     /*! Loads the group resources. 
      *  @note When loading is successfully done resourceGroupLoaded signal is emitted. If group was already loaded no singal is emitted.
      *  @return When group is successfully loaded EGE_SUCCESS is returned. If group was already loaded, EGE_ERROR_ALREADY_EXISTS is returned.
@@ -68,7 +69,9 @@ class ResourceGroup : public Object
     EGEResult unload();
     /*! Returns group name. */
     const String& name() const { return m_name; }
-    /*! Returns resource of a given type and name. */
+    /*! Returns resource of a given type and name. 
+     *  @note Look-up is done thru the index so it does not depend on number of resources in the group. Given strings are not interned.
+     */
     PResource resource(const String& typeName, const String& name) const;
     /*! Returns list of all resources of the given type. 
      *  @param Type of the resource to be requested. If empty all resource will be returned.
@@ -93,17 +96,32 @@ class ResourceGroup : public Object
     /*! Returns path to group directory. */
     const String& path() const;
 
+  public:
+
+    /*! Returns index key for a given resource type and name. 
+     *  @note Key is unique for each pair of type and name.
+     */
+    static u64 IndexKey(const Name& typeName, const Name& name);
+    /*! Finds index key for a given resource type and name without interning them. 
+     *  @return TRUE if key has been found. Otherwise, FALSE in which case no resource of a given type and name is indexed.
+     */
+    static bool FindIndexKey(const String& typeName, const String& name, u64& key);
+
   private:
 
     /*! Destroys group. */
     void destroy();
     /* Adds dependancy. */
-    EGEResult addDependancy(const PXmlElement& tag);
+    EGEResult addDependancy(const XmlElementHandle& tag);
 
   private:
 
     /*! Container holding all group resources sorted by type name. */
     typedef MultiMap<String, PResource> ResourcesMap;
+    /*! Container indexing resources by type and name. 
+     *  @see IndexKey.
+     */
+    typedef HashMap<u64, PResource> ResourcesIndex;
 
   private:
 
@@ -115,6 +133,8 @@ class ResourceGroup : public Object
     String m_path;
     /*! Resources map. */
     ResourcesMap m_resources;
+    /*! Resources index. In case of duplicates, first added resource is indexed. */
+    ResourcesIndex m_index;
     /*! Is group loaded. */
     bool m_loaded;
     /*! Dependancy list. */
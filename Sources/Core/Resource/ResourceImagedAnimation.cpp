@@ -5,6 +5,7 @@
 #include "EGEXml.h"
 #include "EGEResources.h"
 #include "EGEStringUtils.h"
+#include "EGEDirectory.h"
 #include "EGEDebug.h"
 
 EGE_NAMESPACE_BEGIN
@@ -39,18 +40,17 @@ const String& ResourceImagedAnimation::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceImagedAnimation::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceImagedAnimation::create(const String& path, const XmlElementHandle& tag)
 {
-  EGE_UNUSED(path);
-
   EGEResult result = EGE_SUCCESS;
 
   bool error = false;
 
   // get data
-  m_name        = tag->attribute("name");
-  m_fps         = tag->attribute("fps").toFloat(&error);
-  m_displaySize = StringUtils::ToVector2f(tag->attribute("size"), &error);
+  m_name                = tag.attribute("name");
+  m_fps                 = tag.floatAttribute("fps", &error);
+  m_displaySize         = StringUtils::ToVector2f(tag.attribute("size"), &error);
+  String definitionPath = tag.attribute("path");
 
   // check if obligatory data is wrong
   if (error || m_name.empty())
@@ -60,22 +60,33 @@ EGEResult ResourceImagedAnimation::create(const String& path, const PXmlElement&
     return EGE_ERROR_BAD_PARAM;
   }
 
+  // check if objects and frames are defined in external file
+  if ( ! definitionPath.empty())
+  {
+    if (EGE_SUCCESS != (result = loadDefinition(Directory::Join(path, definitionPath))))
+    {
+      // error!
+      egeWarning(KResourceImagedAnimationDebugName) << "Could not load definition for name:" << m_name;
+      return result;
+    }
+  }
+
   // go thru all sub nodes
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
     // check child
-    if (NODE_OBJECT == child->name())
+    if (child.hasName(NODE_OBJECT))
     {
       // add object
       result = addObject(child);
     }
-    else if (NODE_FRAME == child->name())
+    else if (child.hasName(NODE_FRAME))
     {
       // add frame
       result = addFrame(child);
     }
-    else if (NODE_SEQUENCE == child->name())
+    else if (child.hasName(NODE_SEQUENCE))
     {
       // add sequence
       result = addSequence(child);
@@ -89,7 +100,7 @@ EGEResult ResourceImagedAnimation::create(const String& path, const PXmlElement&
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   // check if success
@@ -171,6 +182,10 @@ void ResourceImagedAnimation::unload()
 
   //m_sequenceResources.clear();
 
+  // release geometry
+  // NOTE: instances still using it keep it alive
+  m_geometry = NULL;
+
   // reset flag
   m_state = STATE_UNLOADED;
 }
@@ -202,6 +217,44 @@ EGEResult ResourceImagedAnimation::setInstance(const PImagedAnimation& instance)
   // clear instance
   instance->clear();
 
+  // check if geometry is not created yet
+  // NOTE: geometry is created once and shared by all instances
+  if (NULL == m_geometry)
+  {
+    EGEResult result = createGeometry();
+    if (EGE_SUCCESS != result)
+    {
+      // error!
+      return result;
+    }
+  }
+
+  instance->setFPS(m_fps);
+  instance->setName(name());
+  instance->setDisplaySize(m_displaySize);
+  instance->setGeometry(m_geometry);
+
+  // add sequencers
+  for (SequenceResourceList::iterator it = m_sequenceResources.begin(); it != m_sequenceResources.end(); ++it)
+  {
+    PResourceSequencer seqRes = *it;
+
+    // create instance of sequencer
+    PSequencer seq = seqRes->createInstance();
+    if (NULL == seq)
+    {
+      // error!
+      return EGE_ERROR_NO_MEMORY;
+    }
+
+    instance->addSequencer(seq);
+  }
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult ResourceImagedAnimation::createGeometry()
+{
   // add objects
   Map<s32, EGEImagedAnimation::Object> objects;
   for (ObjectDataArray::const_iterator it = m_objects.begin(); it != m_objects.end(); ++it)
@@ -263,129 +316,95 @@ EGEResult ResourceImagedAnimation::setInstance(const PImagedAnimation& instance)
     // clean up
     actions.clear();
   }
-  
-  instance->setFPS(m_fps);
-  instance->setName(name());
-  instance->setDisplaySize(m_displaySize);
-  instance->addData(objects, allActions);
 
-  // add sequencers
-  for (SequenceResourceList::iterator it = m_sequenceResources.begin(); it != m_sequenceResources.end(); ++it)
+  // create geometry
+  m_geometry = ege_new ImagedAnimationGeometry(app(), name(), objects, allActions);
+  if (NULL == m_geometry)
   {
-    PResourceSequencer seqRes = *it;
-
-    // create instance of sequencer
-    PSequencer seq = seqRes->createInstance();
-    if (NULL == seq)
-    {
-      // error!
-      return EGE_ERROR_NO_MEMORY;
-    }
-
-    instance->addSequencer(seq);
+    // error!
+    return EGE_ERROR_NO_MEMORY;
   }
 
   return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceImagedAnimation::addObject(const PXmlElement& tag)
+EGEResult ResourceImagedAnimation::addObject(const XmlElementHandle& tag)
 {
   ObjectData data;
 
   bool error = false;
 
   // get data
-  data.id = tag->attribute("id").toInt(&error);
+  const char* id = tag.attribute("id");
+  data.id = StringUtils::ToInt(id, &error);
 
-  if (error)
+  if (error || ('\0' == *id))
   {
     // error!
     return EGE_ERROR;
   }
 
   // go thru all sub nodes
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  for (XmlElementHandle child = tag.firstChild(NODE_CHILD); child.isValid(); child = child.nextChild(NODE_CHILD))
   {
-    error = false;
+    ObjectChildData childData;
 
-    // check child
-    if (NODE_CHILD == child->name())
-    {
-      ObjectChildData childData;
-
-      childData.materialName = child->attribute("material");
-      childData.translate    = StringUtils::ToVector2f(child->attribute("translate", "0 0"), &error);
-      childData.scale        = StringUtils::ToVector2f(child->attribute("scale", "1 1"), &error);
-      childData.skew         = StringUtils::ToVector2f(child->attribute("skew", "0 0"), &error);
-      childData.rect         = StringUtils::ToRectf(child->attribute("rect", "0 0 0 0"), &error);
-      childData.size         = StringUtils::ToVector2f(child->attribute("size", "0 0"), &error);
-
-      if (error)
-      {
-        // error!
-        return EGE_ERROR;
-      }
+    childData.materialName = child.attribute("material");
+    childData.translate    = StringUtils::ToVector2f(child.attribute("translate", "0 0"), &error);
+    childData.scale        = StringUtils::ToVector2f(child.attribute("scale", "1 1"), &error);
+    childData.skew         = StringUtils::ToVector2f(child.attribute("skew", "0 0"), &error);
+    childData.rect         = StringUtils::ToRectf(child.attribute("rect", "0 0 0 0"), &error);
+    childData.size         = StringUtils::ToVector2f(child.attribute("size", "0 0"), &error);
 
-      // add to pool
-      data.children << childData;
+    if (error)
+    {
+      // error!
+      return EGE_ERROR;
     }
 
-    // go to next child
-    child = child->nextChild();
+    // add to pool
+    data.children << childData;
   }
 
   m_objects.push_back(data);
   return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceImagedAnimation::addFrame(const PXmlElement& tag)
+EGEResult ResourceImagedAnimation::addFrame(const XmlElementHandle& tag)
 {
-  EGEResult result = EGE_SUCCESS;
-
   FrameData data;
 
   // go thru all sub nodes
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  for (XmlElementHandle child = tag.firstChild(NODE_ACTION); child.isValid(); child = child.nextChild(NODE_ACTION))
   {
-    // check child
-    if (NODE_ACTION == child->name())
-    {
-      // add action
-      result = addAction(child, &data);
-    }
-
-    // check if failed
-    if (EGE_SUCCESS != result)
+    // add action
+    if (EGE_SUCCESS != addAction(child, &data))
     {
       // error, done!
       break;
     }
-
-    // go to next child
-    child = child->nextChild();
   }
 
   m_frames.push_back(data);
   return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceImagedAnimation::addAction(const PXmlElement& tag, FrameData* frameData) const
+EGEResult ResourceImagedAnimation::addAction(const XmlElementHandle& tag, FrameData* frameData) const
 {
   bool error = false;
 
   FrameActionData action;
 
   // get data
-  action.objectId   = tag->attribute("object-id").toInt(&error);
- // action.queue      = tag->attribute("queue").toInt(&error);
-  action.translate  = StringUtils::ToVector2f(tag->attribute("translate", "0 0"), &error);
-  action.scale      = StringUtils::ToVector2f(tag->attribute("scale", "1 1"), &error);
-  action.skew       = StringUtils::ToVector2f(tag->attribute("skew", "0 0"), &error);
-  action.color      = StringUtils::ToColor(tag->attribute("color", "1 1 1 1"), &error);
-
-  if (error)
+  const char* objectId = tag.attribute("object-id");
+  action.objectId   = StringUtils::ToInt(objectId, &error);
+ // action.queue      = tag.intAttribute("queue", &error);
+  action.translate  = StringUtils::ToVector2f(tag.attribute("translate", "0 0"), &error);
+  action.scale      = StringUtils::ToVector2f(tag.attribute("scale", "1 1"), &error);
+  action.skew       = StringUtils::ToVector2f(tag.attribute("skew", "0 0"), &error);
+  action.color      = StringUtils::ToColor(tag.attribute("color", "1 1 1 1"), &error);
+
+  if (error || ('\0' == *objectId))
   {
     // error!
     return EGE_ERROR;
@@ -397,7 +416,7 @@ EGEResult ResourceImagedAnimation::addAction(const PXmlElement& tag, FrameData*
   return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceImagedAnimation::addSequence(const PXmlElement& tag)
+EGEResult ResourceImagedAnimation::addSequence(const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
@@ -433,5 +452,106 @@ EGEResult ResourceImagedAnimation::addSequence(const PXmlElement& tag)
   return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult ResourceImagedAnimation::loadDefinition(const String& fileName)
+{
+  EGEResult result;
+
+  XmlPullParser parser;
+  if (EGE_SUCCESS != (result = parser.open(fileName)))
+  {
+    // error!
+    egeWarning(KResourceImagedAnimationDebugName) << "Could not open definition file:" << fileName;
+    return result;
+  }
+
+  ObjectData* object = NULL;
+  FrameData* frame   = NULL;
+
+  bool error = false;
+
+  // process entire document in a single pass
+  XmlPullParser::Event event;
+  while (XmlPullParser::EVENT_END_DOCUMENT != (event = parser.next()))
+  {
+    if (XmlPullParser::EVENT_ERROR == event)
+    {
+      // error!
+      egeWarning(KResourceImagedAnimationDebugName) << "Malformed definition file:" << fileName;
+      return EGE_ERROR;
+    }
+
+    // check if element closed
+    if (XmlPullParser::EVENT_END_ELEMENT == event)
+    {
+      if (parser.hasName(NODE_OBJECT))
+      {
+        object = NULL;
+      }
+      else if (parser.hasName(NODE_FRAME))
+      {
+        frame = NULL;
+      }
+    }
+    // check if element opened
+    else if (XmlPullParser::EVENT_START_ELEMENT == event)
+    {
+      if (parser.hasName(NODE_OBJECT))
+      {
+        ObjectData data;
+
+        const char* id = parser.attribute("id");
+        data.id = StringUtils::ToInt(id, &error);
+        error = error || ('\0' == *id);
+
+        m_objects.push_back(data);
+        object = &m_objects.back();
+      }
+      else if (parser.hasName(NODE_CHILD) && (NULL != object))
+      {
+        ObjectChildData childData;
+
+        childData.materialName = parser.attribute("material");
+        childData.translate    = StringUtils::ToVector2f(parser.attribute("translate", "0 0"), &error);
+        childData.scale        = StringUtils::ToVector2f(parser.attribute("scale", "1 1"), &error);
+        childData.skew         = StringUtils::ToVector2f(parser.attribute("skew", "0 0"), &error);
+        childData.rect         = StringUtils::ToRectf(parser.attribute("rect", "0 0 0 0"), &error);
+        childData.size         = StringUtils::ToVector2f(parser.attribute("size", "0 0"), &error);
+
+        // add to pool
+        object->children << childData;
+      }
+      else if (parser.hasName(NODE_FRAME))
+      {
+        m_frames.push_back(FrameData());
+        frame = &m_frames.back();
+      }
+      else if (parser.hasName(NODE_ACTION) && (NULL != frame))
+      {
+        FrameActionData action;
+
+        const char* objectId = parser.attribute("object-id");
+        action.objectId   = StringUtils::ToInt(objectId, &error);
+        action.translate  = StringUtils::ToVector2f(parser.attribute("translate", "0 0"), &error);
+        action.scale      = StringUtils::ToVector2f(parser.attribute("scale", "1 1"), &error);
+        action.skew       = StringUtils::ToVector2f(parser.attribute("skew", "0 0"), &error);
+        action.color      = StringUtils::ToColor(parser.attribute("color", "1 1 1 1"), &error);
+        error = error || ('\0' == *objectId);
+
+        // add to frame
+        frame->actions.push_back(action);
+      }
+
+      if (error)
+      {
+        // error!
+        egeWarning(KResourceImagedAnimationDebugName) << "Invalid data in definition file:" << fileName << "element:" << parser.name();
+        return EGE_ERROR_BAD_PARAM;
+      }
+    }
+  }
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
\ No newline at end of file
@@ -21,6 +21,7 @@ EGE_NAMESPACE_BEGIN
 class ResourceGroup;
 EGE_DECLARE_SMART_CLASS(ResourceImagedAnimation, PResourceImagedAnimation)
 EGE_DECLARE_SMART_CLASS(ImagedAnimation, PImagedAnimation)
+EGE_DECLARE_SMART_CLASS(ImagedAnimationGeometry, PImagedAnimationGeometry)
 EGE_DECLARE_SMART_CLASS(ResourceMaterial, PResourceMaterial)
 EGE_DECLARE_SMART_CLASS(ResourceSequencer, PResourceSequencer)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -41,7 +42,7 @@ class ResourceImagedAnimation : public IResource
     /*! @see IResource::name. */
     const String& name() const override;
     /*! @see IResource::create. */ 
-    EGEResult create(const String& path, const PXmlElement& tag) override;
+    EGEResult create(const String& path, const XmlElementHandle& tag) override;
     /*! @see IResource::load. */
     EGEResult load() override;
     /*! @see IResource::unload. */
@@ -56,13 +57,19 @@ class ResourceImagedAnimation : public IResource
 
     ResourceImagedAnimation(Application* app, ResourceGroup* group);
     /*! Adds object. */
-    EGEResult addObject(const PXmlElement& tag);
+    EGEResult addObject(const XmlElementHandle& tag);
     /*! Adds frame. */
-    EGEResult addFrame(const PXmlElement& tag);
+    EGEResult addFrame(const XmlElementHandle& tag);
     /*! Adds action to the given frame. */
-    EGEResult addAction(const PXmlElement& tag, FrameData* frameData) const;
+    EGEResult addAction(const XmlElementHandle& tag, FrameData* frameData) const;
+    /*! Loads objects and frames from external definition file. 
+     *  @note Definition file is streamed thru pull parser so no document tree is built for (usually large) animation data.
+     */
+    EGEResult loadDefinition(const String& fileName);
     /*! Adds sequence. */
-    EGEResult addSequence(const PXmlElement& tag);
+    EGEResult addSequence(const XmlElementHandle& tag);
+    /*! Creates frame geometry shared by all instances. */
+    EGEResult createGeometry();
 
   private:
     
@@ -125,6 +132,8 @@ class ResourceImagedAnimation : public IResource
     Vector2f m_displaySize;
     /*! List of sequence resources. */
     SequenceResourceList m_sequenceResources;
+    /*! Frame geometry shared by all instances. NULL if not created yet. */
+    PImagedAnimationGeometry m_geometry;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
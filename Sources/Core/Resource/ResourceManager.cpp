@@ -28,6 +28,9 @@
 #include "Core/Event/EventManager.h"
 #include "EGEXml.h"
 #include "EGEDirectory.h"
+#include "EGECipher.h"
+#include "EGEAtomic.h"
+#include "EGEThread.h"
 
 #if EGE_RESOURCEMANAGER_SINGLE_THREAD
   #include "Core/Resource/SingleThread/ResourceManagerST_p.h"
@@ -39,6 +42,7 @@ EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 const char* KResourceManagerDebugName = "EGEResourceManager";
+static const char* KResourceManifestExtension = ".egm";
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGE_DEFINE_NEW_OPERATORS(ResourceManager)
 EGE_DEFINE_DELETE_OPERATORS(ResourceManager)
@@ -74,9 +78,13 @@ static BuiltInResource l_resourcesToRegister[] = {  { RESOURCE_NAME_TEXTURE, Res
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 ResourceManager::ResourceManager(Application* app) : Object(app),
                                                      m_p(NULL),
+                                                     m_publishedResourceIndex(0),
                                                      m_totalResourcesToProcess(0),
                                                      m_processedResourcesCount(0)
 {
+  m_resourceIndexReaders[0] = 0;
+  m_resourceIndexReaders[1] = 0;
+
   ege_connect(app, frameEnd, this, ResourceManager::onFrameEnd);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -96,6 +104,14 @@ EGEResult ResourceManager::construct()
 {
   EGEResult result = EGE_SUCCESS;
 
+  // allocate resource index update mutex
+  m_resourceIndexMutex = ege_new Mutex(app());
+  if (NULL == m_resourceIndexMutex)
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
   // allocate private
   m_p = ege_new ResourceManagerPrivate(this);
   if (NULL == m_p)
@@ -133,7 +149,7 @@ EGEResult ResourceManager::construct()
   }
 
   // subscribe for event notifications
-  if ( ! app()->eventManager()->addListener(this))
+  if ( ! app()->eventManager()->addListener(this, EGE_EVENT_ID_CORE_QUIT_REQUEST))
   {
     // error!
     egeCritical(KResourceManagerDebugName) << EGE_FUNC_INFO << "Could not register for notifications!";
@@ -199,18 +215,34 @@ EGEResult ResourceManager::addResources(String filePath, bool autoDetect)
   // NOTE: if no AUTO-DETECTION is set we do exactly one search with a given filePath
   for (StringList::const_iterator it = m_dataDirs.begin(); (it != m_dataDirs.end() && ((it == m_dataDirs.begin() && !autoDetect) || autoDetect)); ++it)
   {
-    String fullPath = autoDetect ? Directory::Join(*it, filePath) : filePath;
+    const String fullPath = autoDetect ? Directory::Join(*it, filePath) : filePath;
+
+    XmlElementHandle resourcesNode;
 
+    // try compiled manifest first
+    // NOTE: manifest is used as is, resource definition file is not touched at all. Manifests are kept in sync with definitions by build step 
+    //       (see EGEManifestCompiler tool)
+    XmlCompiledDocument manifest;
     XmlDocument xml;
-    if (EGE_SUCCESS != (result = xml.load(fullPath)))
+    if (EGE_SUCCESS == (result = manifest.load(fullPath + String(KResourceManifestExtension))))
     {
-      // try another data location
-      continue;
+      // get main node
+      resourcesNode = manifest.rootHandle();
     }
+    else
+    {
+      // fall back to XML definition
+      if (EGE_SUCCESS != (result = xml.load(fullPath)))
+      {
+        // try another data location
+        continue;
+      }
 
-    // get main node
-    PXmlElement resourcesNode = xml.firstChild(NODE_RESOURCES);
-    if ((NULL == resourcesNode) || ! resourcesNode->isValid())
+      // get main node
+      resourcesNode = xml.rootHandle();
+    }
+
+    if ( ! resourcesNode.isValid() || ! resourcesNode.hasName(NODE_RESOURCES))
     {
       // error!
       egeWarning(KResourceManagerDebugName) << "Resource file" << fullPath << "has no" << NODE_RESOURCES << "tag";
@@ -235,6 +267,21 @@ EGEResult ResourceManager::addResources(String filePath, bool autoDetect)
   return atLeastOneResourceAddedSucessfully ? EGE_SUCCESS : result;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult ResourceManager::CompileManifest(const String& filePath)
+{
+  EGEResult result;
+
+  const String fullPath = Directory::FromNativeSeparators(filePath);
+
+  if (EGE_SUCCESS != (result = XmlCompiledDocument::Compile(fullPath, fullPath + String(KResourceManifestExtension))))
+  {
+    // error!
+    egeWarning(KResourceManagerDebugName) << "Could not compile manifest for" << fullPath;
+  }
+
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 /*! Adds resources from given buffer. */
 //EGEResult ResourceManager::addResources(const PDataBuffer& buffer)
 //{
@@ -269,24 +316,21 @@ void ResourceManager::addDataDirectory(const String& path)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceManager::processResourcesTag(const String& filePath, const PXmlElement& tag)
+EGEResult ResourceManager::processResourcesTag(const String& filePath, const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
   // go thru all children
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
-    // get child name
-    const String childName = child->name();
-
     // process GROUP tag
-    if (NODE_GROUP == childName)
+    if (child.hasName(NODE_GROUP))
     {
       result = addGroup(filePath, child);
     }
     // process INCLUDE tag
-    else if (NODE_INCLUDE == childName)
+    else if (child.hasName(NODE_INCLUDE))
     {
       result = processInclude(filePath, child);
     }
@@ -299,13 +343,13 @@ EGEResult ResourceManager::processResourcesTag(const String& filePath, const PXm
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   return result;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceManager::addGroup(const String& filePath, const PXmlElement& tag)
+EGEResult ResourceManager::addGroup(const String& filePath, const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
@@ -334,6 +378,8 @@ EGEResult ResourceManager::addGroup(const String& filePath, const PXmlElement& t
   
       // add into pool
       m_groups.push_back(newGroup);
+
+      addToResourceIndex(newGroup);
     }
     else
     {
@@ -350,6 +396,11 @@ EGEResult ResourceManager::addGroup(const String& filePath, const PXmlElement& t
         egeWarning(KResourceManagerDebugName) << "Group" << newGroup->name() << "already exists. Skipping.";
         result = EGE_SUCCESS;
       }
+      else if (EGE_SUCCESS == result)
+      {
+        // NOTE: some resources might have been replaced
+        rebuildResourceIndex();
+      }
     }
   }
 
@@ -404,15 +455,30 @@ PResource ResourceManager::resource(const String& typeName, const String& name,
   }
   else
   {
-    // go thru all groups
-    for (GroupList::const_iterator it = m_groups.begin(); it != m_groups.end(); ++it)
+    u64 key;
+    if ( ! ResourceGroup::FindIndexKey(typeName, name, key))
     {
-      PResource resource = (*it)->resource(typeName, name);
-      if (resource)
+      // not found
+      return NULL;
+    }
+
+    while (true)
+    {
+      // announce look-up in published index
+      const u32 published = egeAtomicLoad(m_publishedResourceIndex);
+      egeAtomicIncrement(m_resourceIndexReaders[published]);
+
+      // check if index is still published
+      // NOTE: otherwise, it might have been cleared or being rebuilt already, so look-up needs to be repeated in newly published index
+      if (published == egeAtomicLoad(m_publishedResourceIndex))
       {
-        // found
+        PResource resource = m_resourceIndices[published].value(key, NULL);
+        egeAtomicDecrement(m_resourceIndexReaders[published]);
+
         return resource;
       }
+
+      egeAtomicDecrement(m_resourceIndexReaders[published]);
     }
   }
 
@@ -426,15 +492,15 @@ bool ResourceManager::createDefaultResources()
 
   // load is as XML
   XmlDocument document;
-  if ((EGE_SUCCESS != document.load(buffer)) || (NULL == document.rootElement()) || ! document.rootElement().isValid())
+  if ((EGE_SUCCESS != document.load(buffer)) || ! document.rootHandle().isValid())
   {
     // error!
     return false;
   }
 
   // locate group element
-  PXmlElement groupTag = document.rootElement()->firstChild(NODE_GROUP);
-  if ((NULL == groupTag) || ! groupTag->isValid())
+  XmlElementHandle groupTag = document.rootHandle().firstChild(NODE_GROUP);
+  if ( ! groupTag.isValid())
   {
     // error!
     return false;
@@ -471,6 +537,8 @@ void ResourceManager::destroyDefaultResources()
 
     // remove from pool
     m_groups.remove(defaultGroup);
+
+    rebuildResourceIndex();
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -522,6 +590,76 @@ void ResourceManager::unloadAll()
     // go to next
     //++it;
   }
+
+  rebuildResourceIndex();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ResourceManager::addToResourceIndex(const PResourceGroup& group)
+{
+  List<PResource> resources = group->resources("");
+
+  m_resourceIndexMutex->lock();
+
+  // build new index aside from published one
+  ResourceIndex& index = m_resourceIndices[1 - m_publishedResourceIndex];
+  index = m_resourceIndices[m_publishedResourceIndex];
+
+  for (List<PResource>::const_iterator it = resources.begin(); it != resources.end(); ++it)
+  {
+    const PResource& resource = *it;
+
+    // NOTE: this does not overwrite resources from groups added earlier
+    index.insert(ResourceGroup::IndexKey(resource->typeName(), resource->name()), resource);
+  }
+
+  publishResourceIndex();
+
+  m_resourceIndexMutex->unlock();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ResourceManager::rebuildResourceIndex()
+{
+  m_resourceIndexMutex->lock();
+
+  // build new index aside from published one
+  // NOTE: this way concurrent look-ups never see it partially built. Unpublished index is always empty here, see publishResourceIndex
+  ResourceIndex& index = m_resourceIndices[1 - m_publishedResourceIndex];
+
+  // go thru all groups in order
+  for (GroupList::const_iterator it = m_groups.begin(); it != m_groups.end(); ++it)
+  {
+    List<PResource> resources = (*it)->resources("");
+    for (List<PResource>::const_iterator itResource = resources.begin(); itResource != resources.end(); ++itResource)
+    {
+      const PResource& resource = *itResource;
+
+      // NOTE: this does not overwrite resources from groups added earlier
+      index.insert(ResourceGroup::IndexKey(resource->typeName(), resource->name()), resource);
+    }
+  }
+
+  publishResourceIndex();
+
+  m_resourceIndexMutex->unlock();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ResourceManager::publishResourceIndex()
+{
+  const u32 previous = m_publishedResourceIndex;
+
+  // publish
+  // NOTE: this acts as full memory barrier so index is completely built before it becomes visible to look-ups
+  egeAtomicCompareAndSet(m_publishedResourceIndex, previous, 1 - previous);
+
+  // wait for look-ups still using previous index
+  // NOTE: look-ups starting from now on detect previous index is not published anymore and do not use it
+  while (0 != egeAtomicLoad(m_resourceIndexReaders[previous]))
+  {
+    Thread::YieldCurrent();
+  }
+
+  // release resources referenced by previous index
+  m_resourceIndices[previous].clear();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PResourceMaterial ResourceManager::materialResource(const String& name, const String& groupName) const
@@ -539,13 +677,13 @@ PResourceSound ResourceManager::soundResource(const String& name, const String&
   return resource(RESOURCE_NAME_SOUND, name, groupName);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceManager::processInclude(const String& filePath, const PXmlElement& tag)
+EGEResult ResourceManager::processInclude(const String& filePath, const XmlElementHandle& tag)
 {
   bool error = false;
 
   // get data
-  String path     = tag->attribute("path");
-  bool autoDetect = tag->attribute("auto-detect", "false").toBool(&error);
+  String path     = tag.attribute("path");
+  bool autoDetect = tag.attribute("auto-detect", false);
 
   // check if obligatory data is wrong
   if (path.empty() || error)
@@ -618,9 +756,9 @@ bool ResourceManager::buildDependacyList(StringList& list, const String& groupNa
   return true;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void ResourceManager::onEventRecieved(PEvent event)
+void ResourceManager::onEventRecieved(const Event& event)
 {
-  switch (event->id())
+  switch (event.id())
   {
     case EGE_EVENT_ID_CORE_QUIT_REQUEST:
 
@@ -661,5 +799,15 @@ void ResourceManager::onFrameEnd()
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ResourceManager::setCipherKey(const PCipherKey& key)
+{
+  m_cipherKey = key;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const PCipherKey& ResourceManager::cipherKey() const
+{
+  return m_cipherKey;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
\ No newline at end of file
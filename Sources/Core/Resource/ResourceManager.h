@@ -6,12 +6,14 @@
 
 #include "EGE.h"
 #include "EGEString.h"
+#include "EGEName.h"
 #include "EGEXml.h"
 #include "EGEMap.h"
 #include "EGEList.h"
 #include "EGESignal.h"
 #include "EGETime.h"
 #include "EGEStringList.h"
+#include "EGEMutex.h"
 #include "Core/Event/EventListener.h"
 
 EGE_NAMESPACE_BEGIN
@@ -23,7 +25,8 @@ EGE_DECLARE_SMART_CLASS(IResource, PResource)
 EGE_DECLARE_SMART_CLASS(ResourceMaterial, PResourceMaterial)
 EGE_DECLARE_SMART_CLASS(ResourceText, PResourceText)
 EGE_DECLARE_SMART_CLASS(ResourceSound, PResourceSound)
-EGE_DECLARE_SMART_CLASS(Event, PEvent)
+EGE_DECLARE_SMART_CLASS(CipherKey, PCipherKey)
+class Event;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 typedef PResource (*egeResourceCreateFunc)(Application* app, ResourceGroup* group);
 class ResourceManagerPrivate;
@@ -75,6 +78,14 @@ class ResourceManager : public Object, public IEventListener
       RLP_RESOURCE          /*!< Loads single resource at a time. */
     };
 
+  public:
+
+    /*! Compiles resource definition file into binary manifest stored next to it. 
+     *  @param filePath  Path to resource definition file to compile.
+     *  @note  This is intended to be done offline (see EGEManifestCompiler tool). Manifest needs to be recompiled whenever resource definition file changes.
+     */
+    static EGEResult CompileManifest(const String& filePath);
+
   public:
 
     /*! Creates object. */
@@ -89,6 +100,8 @@ class ResourceManager : public Object, public IEventListener
      *  @param filePath    Path to resource definition file which is to be added into resources.
      *  @param autoDetect  If TRUE file given by filePath will be looked for within currently registered data paths. Otherwise, filePath will be treated as
      *                     absolute path.
+     *  @note  If compiled manifest exists next to resource definition file it is used instead of the XML definition. Definition file is not accessed
+     *         at all in such case, manifests are expected to be kept up to date by build step.
      */
     EGEResult addResources(String filePath, bool autoDetect = true);
     /*! Loads group with given name. 
@@ -101,7 +114,12 @@ class ResourceManager : public Object, public IEventListener
     void unloadGroup(const String& name);
     /*! Gets group of the given name. */
     PResourceGroup group(const String& name) const;
-    /*! Returns resource of a given type and name. Optionally, from given group only. */
+    /*! Returns resource of a given type and name. Optionally, from given group only. 
+     *  @note If no group is given, global index is used so look-up does not depend on number of groups or resources. If more than one group contains 
+     *        resource of a given type and name, the one from the group added first is returned.
+     *  @note This method is thread safe as long as no group is given. Global index look-ups do not lock.
+     *  @note Given strings are not interned, so look-ups of resources which do not exist do not grow name table.
+     */
     PResource resource(const String& typeName, const String& name, const String& groupName = "") const;
     /*! Returns material resource of a given name. Optionally, from given group only. */
     PResourceMaterial materialResource(const String& name, const String& groupName = "") const;
@@ -117,6 +135,12 @@ class ResourceManager : public Object, public IEventListener
     PResource createResource(const String& typeName, ResourceGroup* group);
     /*! Returns resource processing policy. */
     ResourceProcessPolicy resourceProcessPolicy() const;
+    /*! Sets key used to decipher ciphered resource data. 
+     *  @note Key should be set before any group containing ciphered resources is loaded.
+     */
+    void setCipherKey(const PCipherKey& key);
+    /*! Returns key used to decipher ciphered resource data. NULL if not set. */
+    const PCipherKey& cipherKey() const;
 
   protected slots:
 
@@ -129,12 +153,12 @@ class ResourceManager : public Object, public IEventListener
      *  @param  filePath  relative (with respect to resource root directory) path to resouce file.
      *  @param  tag       resource element to process. 
      */
-    EGEResult processResourcesTag(const String& filePath, const PXmlElement& tag);
+    EGEResult processResourcesTag(const String& filePath, const XmlElementHandle& tag);
     /*! Add new group from XML data.
     *   @param  filePath  relative (with respect to resource root directory) path to resouce file containing the group definition.
     *   @param  tag       group element to process. 
     */
-    EGEResult addGroup(const String& filePath, const PXmlElement& tag);
+    EGEResult addGroup(const String& filePath, const XmlElementHandle& tag);
     /*! Creates default resources. */
     bool createDefaultResources();
     /*! Destroys default resources. */
@@ -143,17 +167,27 @@ class ResourceManager : public Object, public IEventListener
      *  @param  filePath  relative (with respect to resource root directory) path to resouce file containing the group definition.
      *  @param  tag       include element to process. 
      */
-    EGEResult processInclude(const String& filePath, const PXmlElement& tag);
+    EGEResult processInclude(const String& filePath, const XmlElementHandle& tag);
     /*! Builds dependancy list for a given group. */
     bool buildDependacyList(StringList& list, const String& groupName) const;
     /*! @see IEventListener::onEventRecieved. */
-    void onEventRecieved(PEvent event) override;
+    void onEventRecieved(const Event& event) override;
     /*! Shuts down. */
     void shutDown();
     /*! Processes commands. */
     void processCommands();
     /*! Unloads all groups. This is called from ResourceManager thread. */
     void unloadAll();
+    /*! Adds resources of a given group to global index. 
+     *  @note Resources already in the index are not overwritten.
+     */
+    void addToResourceIndex(const PResourceGroup& group);
+    /*! Rebuilds global index from all groups. */
+    void rebuildResourceIndex();
+    /*! Publishes unpublished global index for look-ups. 
+     *  @note Previously published index is cleared once all look-ups using it are done.
+     */
+    void publishResourceIndex();
 
   private:
 
@@ -164,6 +198,10 @@ class ResourceManager : public Object, public IEventListener
     };
 
     typedef List<PResourceGroup> GroupList;
+    /*! Container indexing resources of all groups by type and name. 
+     *  @see ResourceGroup::IndexKey.
+     */
+    typedef HashMap<u64, PResource> ResourceIndex;
 
   private:
 
@@ -173,12 +211,25 @@ class ResourceManager : public Object, public IEventListener
     StringList m_dataDirs;
     /*! Resource groups defined */
     GroupList m_groups;
+    /*! Global resource indices. 
+     *  @note One of them is published for look-ups and it is never modified while published. The other one is built aside whenever groups change and 
+     *        then published in place of the first one. This way look-ups never wait for index updates.
+     */
+    ResourceIndex m_resourceIndices[2];
+    /*! Index of published global resource index. */
+    mutable volatile u32 m_publishedResourceIndex;
+    /*! Number of look-ups in progress for each global resource index. */
+    mutable volatile u32 m_resourceIndexReaders[2];
+    /*! Global resource index update mutex. Look-ups do not use it. */
+    PMutex m_resourceIndexMutex;
     /*! Registered resources sorted by type name. */
     Map<String, ResourceRegistryEntry> m_registeredResources;
     /*! Total number of resources to process yet. */
     u32 m_totalResourcesToProcess;
     /*! Number of resources processed so far. */
     u32 m_processedResourcesCount;
+    /*! Key used to decipher ciphered resource data. */
+    PCipherKey m_cipherKey;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
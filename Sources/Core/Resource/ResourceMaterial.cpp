@@ -14,17 +14,17 @@ EGE_NAMESPACE_BEGIN
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 static const char* KResourceMaterialDebugName = "EGEResourceMaterial";
 
-static const String KNodeTexture     = "texture";
-static const String KNodeTextureRef  = "texture-ref";
-static const String KNodePass        = "pass";
-static const String KNodeProgramRef  = "program-ref";
-
-static const String KAttributeTextureName           = "name";
-static const String KAttributeTextureRect           = "rect";
-static const String KAttributeTextureEnvMode        = "env-mode";
-static const String KAttributeTextureManual         = "manual";
-static const String KAttributeTextureRotation       = "rotation";
-static const String KAttributeTextureTexCoordsIndex = "tex-coord";
+static const char* KNodeTexture     = "texture";
+static const char* KNodeTextureRef  = "texture-ref";
+static const char* KNodePass        = "pass";
+static const char* KNodeProgramRef  = "program-ref";
+
+static const char* KAttributeTextureName           = "name";
+static const char* KAttributeTextureRect           = "rect";
+static const char* KAttributeTextureEnvMode        = "env-mode";
+static const char* KAttributeTextureManual         = "manual";
+static const char* KAttributeTextureRotation       = "rotation";
+static const char* KAttributeTextureTexCoordsIndex = "tex-coord";
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 /*! Local function mapping texture environment mode name into value. */
 TextureEnvironmentMode MapTextureEnvironmentMode(const String& name, TextureEnvironmentMode defaultValue)
@@ -135,7 +135,7 @@ const String& ResourceMaterial::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceMaterial::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceMaterial::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
@@ -147,16 +147,16 @@ EGEResult ResourceMaterial::create(const String& path, const PXmlElement& tag)
   PassData defaultPass;
 
   // get data
-  m_name = tag->attribute("name");
+  m_name = tag.attribute("name");
 
   // also read data for default pass
-  defaultPass.m_srcBlend        = MapBlendFactor(tag->attribute("src-blend").toLower(), EGEGraphics::BF_ONE);
-  defaultPass.m_dstBlend        = MapBlendFactor(tag->attribute("dst-blend").toLower(), EGEGraphics::BF_ZERO);
-  defaultPass.m_diffuseColor    = StringUtils::ToColor(tag->attribute("diffuse-color", "1 1 1 1"), &error);
-  defaultPass.m_ambientColor    = StringUtils::ToColor(tag->attribute("ambient-color", "1 1 1 1"), &error);
-  defaultPass.m_specularColor   = StringUtils::ToColor(tag->attribute("specular-color", "0 0 0 1"), &error);
-  defaultPass.m_emissionColor   = StringUtils::ToColor(tag->attribute("emission-color", "0 0 0 1"), &error);
-  defaultPass.m_shininess       = tag->attribute("shininess", "0").toFloat(&error);
+  defaultPass.m_srcBlend        = MapBlendFactor(String(tag.attribute("src-blend")).toLower(), EGEGraphics::BF_ONE);
+  defaultPass.m_dstBlend        = MapBlendFactor(String(tag.attribute("dst-blend")).toLower(), EGEGraphics::BF_ZERO);
+  defaultPass.m_diffuseColor    = StringUtils::ToColor(tag.attribute("diffuse-color", "1 1 1 1"), &error);
+  defaultPass.m_ambientColor    = StringUtils::ToColor(tag.attribute("ambient-color", "1 1 1 1"), &error);
+  defaultPass.m_specularColor   = StringUtils::ToColor(tag.attribute("specular-color", "0 0 0 1"), &error);
+  defaultPass.m_emissionColor   = StringUtils::ToColor(tag.attribute("emission-color", "0 0 0 1"), &error);
+  defaultPass.m_shininess       = tag.hasAttribute("shininess") ? tag.floatAttribute("shininess", &error) : 0.0f;
 
   // check if obligatory data is wrong
   if (error || m_name.empty())
@@ -167,16 +167,16 @@ EGEResult ResourceMaterial::create(const String& path, const PXmlElement& tag)
   }
 
   // go thru all sub node
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
     // check child
-    if (KNodeTexture == child->name())
+    if (child.hasName(KNodeTexture))
     {
       EGE_ASSERT(false);
       result = EGE_ERROR;
     }
-    else if (KNodeTextureRef == child->name())
+    else if (child.hasName(KNodeTextureRef))
     {
       // textures without pass add to default one
       result = addTextureReference(child, defaultPass);
@@ -184,12 +184,12 @@ EGEResult ResourceMaterial::create(const String& path, const PXmlElement& tag)
       // mark to indicate default pass is in use
       defaultPassInUse = true;
     }
-    else if (KNodePass == child->name())
+    else if (child.hasName(KNodePass))
     {
       // add defined pass
       result = addPass(child);
     }
-    else if (KNodeProgramRef == child->name())
+    else if (child.hasName(KNodeProgramRef))
     {
       // add program reference (shaders without pass add to default one)
       result = addProgramReference(child, defaultPass);
@@ -206,7 +206,7 @@ EGEResult ResourceMaterial::create(const String& path, const PXmlElement& tag)
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   // check if no single pass has been defined
@@ -221,37 +221,37 @@ EGEResult ResourceMaterial::create(const String& path, const PXmlElement& tag)
   {
     PassData& pass = *it;
 
-    if (tag->hasAttribute("src-blend"))
+    if (tag.hasAttribute("src-blend"))
     {
       pass.m_srcBlend = defaultPass.m_srcBlend;
     }
 
-    if (tag->hasAttribute("dst-blend"))
+    if (tag.hasAttribute("dst-blend"))
     {
       pass.m_dstBlend = defaultPass.m_dstBlend;
     }
 
-    if (tag->hasAttribute("diffuse-color"))
+    if (tag.hasAttribute("diffuse-color"))
     {
       pass.m_diffuseColor = defaultPass.m_diffuseColor;
     }
 
-    if (tag->hasAttribute("ambient-color"))
+    if (tag.hasAttribute("ambient-color"))
     {
       pass.m_ambientColor = defaultPass.m_ambientColor;
     }
 
-    if (tag->hasAttribute("specular-color"))
+    if (tag.hasAttribute("specular-color"))
     {
       pass.m_specularColor = defaultPass.m_specularColor;
     }
 
-    if (tag->hasAttribute("emission-color"))
+    if (tag.hasAttribute("emission-color"))
     {
       pass.m_emissionColor = defaultPass.m_emissionColor;
     }
 
-    if (tag->hasAttribute("shininess"))
+    if (tag.hasAttribute("shininess"))
     {
       pass.m_shininess = defaultPass.m_shininess;
     }
@@ -348,7 +348,7 @@ void ResourceMaterial::unload()
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceMaterial::addTextureReference(const PXmlElement& tag, PassData& pass)
+EGEResult ResourceMaterial::addTextureReference(const XmlElementHandle& tag, PassData& pass)
 {
   EGEResult result = EGE_SUCCESS;
 
@@ -357,12 +357,12 @@ EGEResult ResourceMaterial::addTextureReference(const PXmlElement& tag, PassData
   bool error = false;
 
   // get data
-  textureData.name              = tag->attribute(KAttributeTextureName);
-  textureData.rect              = StringUtils::ToRectf(tag->attribute(KAttributeTextureRect, "0 0 1 1"), &error);
-  textureData.envMode           = MapTextureEnvironmentMode(tag->attribute(KAttributeTextureEnvMode, "modulate"), EM_MODULATE);
-  textureData.manual            = tag->attribute(KAttributeTextureManual, "false").toBool(&error);
-  textureData.rotationAngle     = StringUtils::ToAngle(tag->attribute(KAttributeTextureRotation, "0"), &error);
-  textureData.textureCoordIndex = tag->attribute(KAttributeTextureTexCoordsIndex, static_cast<s32>(pass.m_textureImageData.size()));
+  textureData.name              = tag.attribute(KAttributeTextureName);
+  textureData.rect              = StringUtils::ToRectf(tag.attribute(KAttributeTextureRect, "0 0 1 1"), &error);
+  textureData.envMode           = MapTextureEnvironmentMode(tag.attribute(KAttributeTextureEnvMode, "modulate"), EM_MODULATE);
+  textureData.manual            = tag.attribute(KAttributeTextureManual, false);
+  textureData.rotationAngle     = StringUtils::ToAngle(tag.attribute(KAttributeTextureRotation, "0"), &error);
+  textureData.textureCoordIndex = tag.attribute(KAttributeTextureTexCoordsIndex, static_cast<s32>(pass.m_textureImageData.size()));
 
   // check if obligatory data is wrong
   if (error || textureData.name.empty())
@@ -378,7 +378,7 @@ EGEResult ResourceMaterial::addTextureReference(const PXmlElement& tag, PassData
   return result;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceMaterial::addPass(const PXmlElement& tag)
+EGEResult ResourceMaterial::addPass(const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
@@ -391,13 +391,13 @@ EGEResult ResourceMaterial::addPass(const PXmlElement& tag)
   bool error = false;
 
   // get data
-  pass.m_srcBlend        = MapBlendFactor(tag->attribute("src-blend").toLower(), EGEGraphics::BF_ONE);
-  pass.m_dstBlend        = MapBlendFactor(tag->attribute("dst-blend").toLower(), EGEGraphics::BF_ZERO);
-  pass.m_diffuseColor    = StringUtils::ToColor(tag->attribute("diffuse-color", "1 1 1 1"), &error);
-  pass.m_ambientColor    = StringUtils::ToColor(tag->attribute("ambient-color", "1 1 1 1"), &error);
-  pass.m_specularColor   = StringUtils::ToColor(tag->attribute("specular-color", "0 0 0 1"), &error);
-  pass.m_emissionColor   = StringUtils::ToColor(tag->attribute("emission-color", "0 0 0 1"), &error);
-  pass.m_shininess       = tag->attribute("shininess", "0").toFloat(&error);
+  pass.m_srcBlend        = MapBlendFactor(String(tag.attribute("src-blend")).toLower(), EGEGraphics::BF_ONE);
+  pass.m_dstBlend        = MapBlendFactor(String(tag.attribute("dst-blend")).toLower(), EGEGraphics::BF_ZERO);
+  pass.m_diffuseColor    = StringUtils::ToColor(tag.attribute("diffuse-color", "1 1 1 1"), &error);
+  pass.m_ambientColor    = StringUtils::ToColor(tag.attribute("ambient-color", "1 1 1 1"), &error);
+  pass.m_specularColor   = StringUtils::ToColor(tag.attribute("specular-color", "0 0 0 1"), &error);
+  pass.m_emissionColor   = StringUtils::ToColor(tag.attribute("emission-color", "0 0 0 1"), &error);
+  pass.m_shininess       = tag.hasAttribute("shininess") ? tag.floatAttribute("shininess", &error) : 0.0f;
 
   if (error)
   {
@@ -406,20 +406,20 @@ EGEResult ResourceMaterial::addPass(const PXmlElement& tag)
   }
 
   // go thru all sub node
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
     // check child
-    if (KNodeTexture == child->name())
+    if (child.hasName(KNodeTexture))
     {
       EGE_ASSERT(false);
       result = EGE_ERROR;
     }
-    else if (KNodeTextureRef == child->name())
+    else if (child.hasName(KNodeTextureRef))
     {
       result = addTextureReference(child, pass);
     }
-    else if (KNodeProgramRef == child->name())
+    else if (child.hasName(KNodeProgramRef))
     {
       result = addProgramReference(child, pass);
     }
@@ -432,16 +432,16 @@ EGEResult ResourceMaterial::addPass(const PXmlElement& tag)
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   return result;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceMaterial::addProgramReference(const PXmlElement& tag, PassData& pass)
+EGEResult ResourceMaterial::addProgramReference(const XmlElementHandle& tag, PassData& pass)
 {
   // get data
-  String name = tag->attribute("name", "");
+  String name = tag.attribute("name", "");
 
   // check if invalid data
   if (name.empty())
@@ -82,7 +82,7 @@ class ResourceMaterial : public IResource
     /*! @see IResource::name. */
     const String& name() const override;
     /*! @see IResource::create. */ 
-    EGEResult create(const String& path, const PXmlElement& tag) override;
+    EGEResult create(const String& path, const XmlElementHandle& tag) override;
     /*! @see IResource::load. */
     EGEResult load() override;
     /*! @see IResource::unload. */
@@ -114,11 +114,11 @@ class ResourceMaterial : public IResource
 
     ResourceMaterial(Application* app, ResourceGroup* group);
     /*! Adds texture reference dependancy to given pass. */
-    EGEResult addTextureReference(const PXmlElement& tag, PassData& pass);
+    EGEResult addTextureReference(const XmlElementHandle& tag, PassData& pass);
     /*! Adds pass. */
-    EGEResult addPass(const PXmlElement& tag);
+    EGEResult addPass(const XmlElementHandle& tag);
     /*! Adds program reference. */
-    EGEResult addProgramReference(const PXmlElement& tag, PassData& pass);
+    EGEResult addProgramReference(const XmlElementHandle& tag, PassData& pass);
 
     /*! Loads all dependencies.
      *  @return Returns EGE_SUCCESS if all dependencies are ready (loaded). EGE_WAIT if some dependencies are still being loaded. 
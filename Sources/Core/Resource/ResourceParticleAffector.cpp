@@ -32,21 +32,21 @@ const String& ResourceParticleAffector::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceParticleAffector::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceParticleAffector::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
   EGEResult result = EGE_SUCCESS;
 
   // parse all attributes
-  PXmlAttribute attribute = tag->firstAttribute();
-  while (attribute)
+  XmlAttributeHandle attribute = tag.firstAttribute();
+  while (attribute.isValid())
   {
     // store data
-    m_parameters[attribute->name()] = attribute->value();
+    m_parameters[attribute.name()] = attribute.value();
 
     // go to next attribute
-    attribute = attribute->next();
+    attribute = attribute.next();
   }
 
   // check if obligatory data is wrong
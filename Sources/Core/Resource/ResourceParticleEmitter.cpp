@@ -34,21 +34,21 @@ const String& ResourceParticleEmitter::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceParticleEmitter::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceParticleEmitter::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
   EGEResult result = EGE_SUCCESS;
 
   // parse all attributes
-  PXmlAttribute attribute = tag->firstAttribute();
-  while (attribute)
+  XmlAttributeHandle attribute = tag.firstAttribute();
+  while (attribute.isValid())
   {
     // store data
-    m_parameters[attribute->name()] = attribute->value();
+    m_parameters[attribute.name()] = attribute.value();
 
     // go to next attribute
-    attribute = attribute->next();
+    attribute = attribute.next();
   }
 
   // check if obligatory data is wrong
@@ -63,11 +63,11 @@ EGEResult ResourceParticleEmitter::create(const String& path, const PXmlElement&
   m_name = m_parameters["name"];
 
   // go thru all sub node
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
     // check child
-    if (NODE_AFFECTOR == child->name())
+    if (child.hasName(NODE_AFFECTOR))
     {
       // add affector
       result = addAffector(child);
@@ -81,7 +81,7 @@ EGEResult ResourceParticleEmitter::create(const String& path, const PXmlElement&
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   // check if success
@@ -191,10 +191,10 @@ PParticleEmitter ResourceParticleEmitter::createInstance()
   return object;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceParticleEmitter::addAffector(const PXmlElement& tag)
+EGEResult ResourceParticleEmitter::addAffector(const XmlElementHandle& tag)
 {
   // get obligatory data
-  String name = tag->attribute("name");
+  String name = tag.attribute("name");
   if (name.empty())
   {
     // error!
@@ -36,7 +36,7 @@ class ResourceParticleEmitter : public IResource
     /*! @see IResource::name. */
     const String& name() const override;
     /*! @see IResource::create. */ 
-    EGEResult create(const String& path, const PXmlElement& tag) override;
+    EGEResult create(const String& path, const XmlElementHandle& tag) override;
     /*! @see IResource::load. */
     EGEResult load() override;
     /*! @see IResource::unload. */
@@ -49,7 +49,7 @@ class ResourceParticleEmitter : public IResource
 
     ResourceParticleEmitter(Application* app, ResourceGroup* group);
     /*! Adds affector. */
-    EGEResult addAffector(const PXmlElement& tag);
+    EGEResult addAffector(const XmlElementHandle& tag);
 
   private:
 
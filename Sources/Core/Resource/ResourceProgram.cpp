@@ -39,12 +39,12 @@ const String& ResourceProgram::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceProgram::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceProgram::create(const String& path, const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
   // get data
-  m_name = tag->attribute("name");
+  m_name = tag.attribute("name");
 
   // check if obligatory data is wrong
   if (m_name.empty())
@@ -55,11 +55,11 @@ EGEResult ResourceProgram::create(const String& path, const PXmlElement& tag)
   }
 
   // go thru all sub node
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
     // check child
-    if (NODE_SHADER_REF == child->name())
+    if (child.hasName(NODE_SHADER_REF))
     {
       // add shader reference
       result = addShaderReference(child);
@@ -73,7 +73,7 @@ EGEResult ResourceProgram::create(const String& path, const PXmlElement& tag)
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   // set state
@@ -156,10 +156,10 @@ void ResourceProgram::onRequestComplete(PObject object)
   m_state = STATE_LOADED;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceProgram::addShaderReference(const PXmlElement& tag)
+EGEResult ResourceProgram::addShaderReference(const XmlElementHandle& tag)
 {
   // get data
-  String name = tag->attribute("name");
+  String name = tag.attribute("name");
   if (name.empty())
   {
     // error!
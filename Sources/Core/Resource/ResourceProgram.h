@@ -36,7 +36,7 @@ class ResourceProgram : public IResource
     /*! @see IResource::name. */
     const String& name() const override;
     /*! @see IResource::create. */ 
-    EGEResult create(const String& path, const PXmlElement& tag) override;
+    EGEResult create(const String& path, const XmlElementHandle& tag) override;
     /*! @see IResource::load. */
     EGEResult load() override;
     /*! @see IResource::unload. */
@@ -49,7 +49,7 @@ class ResourceProgram : public IResource
 
     ResourceProgram(Application* app, ResourceGroup* group);
     /*! Adds shader reference. */
-    EGEResult addShaderReference(const PXmlElement& tag);
+    EGEResult addShaderReference(const XmlElementHandle& tag);
     /*! Loads all dependencies.
      *  @return Returns EGE_SUCCESS if all dependencies are ready (loaded). EGE_WAIT if some dependencies are still being loaded. 
      *          Otherwise one of the error values.
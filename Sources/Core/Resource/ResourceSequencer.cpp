@@ -30,7 +30,7 @@ const String& ResourceSequencer::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceSequencer::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceSequencer::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
@@ -38,10 +38,10 @@ EGEResult ResourceSequencer::create(const String& path, const PXmlElement& tag)
 
   // get data
   bool error = false;
-  m_name        = tag->attribute("name");
-  m_repeatable  = tag->attribute("repeat", "false").toBool(&error);
+  m_name        = tag.attribute("name");
+  m_repeatable  = tag.attribute("repeat", false);
 
-  String frameIds = tag->attribute("frames");
+  String frameIds = tag.attribute("frames");
   StringArray frames = frameIds.split(" ");
 
   for (int i = 0; i < static_cast<s32>(frames.size()); ++i)
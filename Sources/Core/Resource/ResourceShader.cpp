@@ -54,16 +54,16 @@ const String& ResourceShader::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceShader::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceShader::create(const String& path, const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
   bool error = false;
 
   // get data
-  m_name = tag->attribute("name");
-  m_path = tag->attribute("path");
-  m_type = MapShaderTypeName(tag->attribute("type").toLower());
+  m_name = tag.attribute("name");
+  m_path = tag.attribute("path");
+  m_type = MapShaderTypeName(String(tag.attribute("type")).toLower());
 
   // check if obligatory data is wrong
   if (m_name.empty() || m_path.empty() || (EGEGraphics::UNKNOWN_SHADER == m_type) || error)
@@ -33,16 +33,16 @@ const String& ResourceSound::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceSound::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceSound::create(const String& path, const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
   bool error = false;
 
   // get data
-  m_name    = tag->attribute("name");
-  m_path    = tag->attribute("path");
-  m_pitch   = tag->attribute("pitch", "1.0").toFloat(&error);
+  m_name    = tag.attribute("name");
+  m_path    = tag.attribute("path");
+  m_pitch   = tag.hasAttribute("pitch") ? tag.floatAttribute("pitch", &error) : 1.0f;
 
   // check if obligatory data is wrong
   if (m_name.empty() || m_path.empty() || error)
@@ -36,7 +36,7 @@ const String& ResourceSpriteAnimation::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceSpriteAnimation::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceSpriteAnimation::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
@@ -45,9 +45,9 @@ EGEResult ResourceSpriteAnimation::create(const String& path, const PXmlElement&
   bool error = false;
 
   // get data
-  m_name      = tag->attribute("name");
-  m_sheetName = tag->attribute("sheet");
-  m_fps       = tag->attribute("fps").toFloat(&error);
+  m_name      = tag.attribute("name");
+  m_sheetName = tag.attribute("sheet");
+  m_fps       = tag.floatAttribute("fps", &error);
 
   // check if obligatory data is wrong
   if (error || m_name.empty() || m_sheetName.empty())
@@ -58,10 +58,10 @@ EGEResult ResourceSpriteAnimation::create(const String& path, const PXmlElement&
   }
 
   // go thru all sub nodes
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
-    if (NODE_SEQUENCE == child->name())
+    if (child.hasName(NODE_SEQUENCE))
     {
       // add sequence
       result = addSequence(child);
@@ -75,7 +75,7 @@ EGEResult ResourceSpriteAnimation::create(const String& path, const PXmlElement&
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   // invalidate frame data
@@ -238,7 +238,7 @@ void ResourceSpriteAnimation::calculateFrameData()
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceSpriteAnimation::addSequence(const PXmlElement& tag)
+EGEResult ResourceSpriteAnimation::addSequence(const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
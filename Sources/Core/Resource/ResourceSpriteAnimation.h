@@ -39,7 +39,7 @@ class ResourceSpriteAnimation : public IResource
     /*! @see IResource::name. */
     const String& name() const override;
     /*! @see IResource::create. */ 
-    EGEResult create(const String& path, const PXmlElement& tag) override;
+    EGEResult create(const String& path, const XmlElementHandle& tag) override;
     /*! @see IResource::load. */
     EGEResult load() override;
     /*! @see IResource::unload. */
@@ -62,7 +62,7 @@ class ResourceSpriteAnimation : public IResource
     /*! Returns spritesheet object containing sprite. */
      PResourceSpritesheet sheet() const { return m_sheet; }
     /*! Adds sequence. */
-    EGEResult addSequence(const PXmlElement& tag);
+    EGEResult addSequence(const XmlElementHandle& tag);
 
   private:
 
@@ -31,7 +31,7 @@ const String& ResourceSpritesheet::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceSpritesheet::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceSpritesheet::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
@@ -40,12 +40,12 @@ EGEResult ResourceSpritesheet::create(const String& path, const PXmlElement& tag
   bool error = false;
 
   // get data
-  m_name            = tag->attribute("name");
-  m_textureName     = tag->attribute("texture");
-  m_frameWidth      = tag->attribute("frame-width").toInt(&error);
-  m_frameHeight     = tag->attribute("frame-height").toInt(&error);
-  m_frameCount      = tag->attribute("frames").toInt(&error);
-  m_framesPerRow    = tag->attribute("frames-per-row").toInt(&error);
+  m_name            = tag.attribute("name");
+  m_textureName     = tag.attribute("texture");
+  m_frameWidth      = tag.intAttribute("frame-width", &error);
+  m_frameHeight     = tag.intAttribute("frame-height", &error);
+  m_frameCount      = tag.intAttribute("frames", &error);
+  m_framesPerRow    = tag.intAttribute("frames-per-row", &error);
 
   // check if obligatory data is wrong
   if (error || m_name.empty() || m_textureName.empty())
@@ -33,14 +33,14 @@ const String& ResourceText::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceText::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceText::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
   EGEResult result = EGE_SUCCESS;
 
   // get data
-  m_name = tag->attribute("name");
+  m_name = tag.attribute("name");
 
   // check if obligatory data is wrong
   if (m_name.empty())
@@ -51,11 +51,11 @@ EGEResult ResourceText::create(const String& path, const PXmlElement& tag)
   }
 
   // go thru all children
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
     // check if language node
-    if (NODE_LANG == child->name())
+    if (child.hasName(NODE_LANG))
     {
       result = addLocalization(child);
     }
@@ -67,7 +67,7 @@ EGEResult ResourceText::create(const String& path, const PXmlElement& tag)
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   // check if success
@@ -94,11 +94,11 @@ void ResourceText::unload()
   m_state = STATE_UNLOADED;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceText::addLocalization(const PXmlElement& tag)
+EGEResult ResourceText::addLocalization(const XmlElementHandle& tag)
 {
   // get data
-  String name = tag->attribute("name");
-  Text value  = tag->attribute("value");
+  String name = tag.attribute("name");
+  Text value  = tag.attribute("value");
 
   // check if data is present
   if (name.empty() || value.empty())
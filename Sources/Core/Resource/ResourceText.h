@@ -32,7 +32,7 @@ class ResourceText : public IResource
     /*! @see IResource::name. */
     const String& name() const override;
     /*! @see IResource::create. */ 
-    EGEResult create(const String& path, const PXmlElement& tag) override;
+    EGEResult create(const String& path, const XmlElementHandle& tag) override;
     /*! @see IResource::load. */
     EGEResult load() override;
     /*! @see IResource::unload. */
@@ -45,7 +45,7 @@ class ResourceText : public IResource
 
     ResourceText(Application* app, ResourceGroup* group);
     /*! Adds text localization. */
-    EGEResult addLocalization(const PXmlElement& tag);
+    EGEResult addLocalization(const XmlElementHandle& tag);
     /*! Returns index of translation for given numerous. */
     s32 translationIndex(s32 numerous) const;
 
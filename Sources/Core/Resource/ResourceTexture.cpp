@@ -97,23 +97,23 @@ const String& ResourceTexture::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceTexture::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceTexture::create(const String& path, const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
   bool error = false;
 
   // get data
-  m_name            = tag->attribute("name");
-  m_path            = tag->attribute("path");
-  m_dataType        = tag->attribute("data");
-  m_type            = tag->attribute("type").toLower();
-  m_minFilter       = MapFilterName(tag->attribute("min-filter").toLower(), TF_NEAREST);
-  m_magFilter       = MapFilterName(tag->attribute("mag-filter").toLower(), TF_NEAREST);
-  m_addressingModeS = MapTextureAddressingName(tag->attribute("mode-s").toLower(), AM_REPEAT);
-  m_addressingModeT = MapTextureAddressingName(tag->attribute("mode-t").toLower(), AM_REPEAT);
-  m_rotation        = StringUtils::ToAngle(tag->attribute("rotation", "0"), &error);
-  m_mipmap          = tag->attribute("mipmap", "false").toBool(&error);
+  m_name            = tag.attribute("name");
+  m_path            = tag.attribute("path");
+  m_dataType        = tag.attribute("data");
+  m_type            = String(tag.attribute("type")).toLower();
+  m_minFilter       = MapFilterName(String(tag.attribute("min-filter")).toLower(), TF_NEAREST);
+  m_magFilter       = MapFilterName(String(tag.attribute("mag-filter")).toLower(), TF_NEAREST);
+  m_addressingModeS = MapTextureAddressingName(String(tag.attribute("mode-s")).toLower(), AM_REPEAT);
+  m_addressingModeT = MapTextureAddressingName(String(tag.attribute("mode-t")).toLower(), AM_REPEAT);
+  m_rotation        = StringUtils::ToAngle(tag.attribute("rotation", "0"), &error);
+  m_mipmap          = tag.attribute("mipmap", false);
 
   // check if any embedded data type
   if ( ! m_dataType.empty())
@@ -235,12 +235,12 @@ void ResourceTexture::onRequestComplete(PObject object)
   egeAtomicCompareAndSet(reinterpret_cast<u32&>(m_state), m_state, STATE_LOADED);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceTexture::loadTextureData(const PXmlElement& tag)
+EGEResult ResourceTexture::loadTextureData(const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
   // get XML element text
-  String text = tag->text();
+  String text = tag.text();
 
   // remove all spaces
   text.replaceAll(" ", "");
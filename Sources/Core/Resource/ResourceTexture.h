@@ -36,7 +36,7 @@ class ResourceTexture : public IResource
     /*! @see IResource::name. */
     const String& name() const override;
     /*! @see IResource::create. */ 
-    EGEResult create(const String& path, const PXmlElement& tag) override;
+    EGEResult create(const String& path, const XmlElementHandle& tag) override;
     /*! @see IResource::load. */
     EGEResult load() override;
     /*! @see IResource::unload. */
@@ -61,7 +61,7 @@ class ResourceTexture : public IResource
     /*! Gets texture addressing mode for T coordinate. */
     TextureAddressingMode adressingModeT() const;
     /*! Creates and loads texture data from XML text. */
-    EGEResult loadTextureData(const PXmlElement& tag);
+    EGEResult loadTextureData(const XmlElementHandle& tag);
     /*! Returns mip-mapping flag. */
     bool mipmap() const;
 
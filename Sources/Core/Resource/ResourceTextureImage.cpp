@@ -33,7 +33,7 @@ const String& ResourceTextureImage::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceTextureImage::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceTextureImage::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
@@ -42,10 +42,10 @@ EGEResult ResourceTextureImage::create(const String& path, const PXmlElement& ta
   bool error = false;
 
   // get data
-  m_name          = tag->attribute("name");
-  m_textureName   = tag->attribute("texture");
-  m_rect          = StringUtils::ToRectf(tag->attribute("rect", "0 0 0 0"), &error);
-  m_rotationAngle = StringUtils::ToAngle(tag->attribute("rotation", "0"), &error);
+  m_name          = tag.attribute("name");
+  m_textureName   = tag.attribute("texture");
+  m_rect          = StringUtils::ToRectf(tag.attribute("rect", "0 0 0 0"), &error);
+  m_rotationAngle = StringUtils::ToAngle(tag.attribute("rotation", "0"), &error);
 
   // check if obligatory data is wrong
   if (error || m_name.empty() || m_textureName.empty())
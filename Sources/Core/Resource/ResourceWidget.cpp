@@ -36,21 +36,21 @@ const String& ResourceWidget::name() const
   return m_name;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceWidget::create(const String& path, const PXmlElement& tag)
+EGEResult ResourceWidget::create(const String& path, const XmlElementHandle& tag)
 {
   EGE_UNUSED(path);
 
   EGEResult result = EGE_SUCCESS;
 
   // parse all attributes
-  PXmlAttribute attribute = tag->firstAttribute();
-  while (attribute)
+  XmlAttributeHandle attribute = tag.firstAttribute();
+  while (attribute.isValid())
   {
     // store data
-    m_parameters[attribute->name()] = attribute->value();
+    m_parameters[attribute.name()] = attribute.value();
 
     // go to next attribute
-    attribute = attribute->next();
+    attribute = attribute.next();
   }
 
   bool error = false;
@@ -65,16 +65,16 @@ EGEResult ResourceWidget::create(const String& path, const PXmlElement& tag)
   }
 
   // go thru all sub node
-  PXmlElement child = tag->firstChild();
-  while (child->isValid())
+  XmlElementHandle child = tag.firstChild();
+  while (child.isValid())
   {
     // check child
-    if (NODE_CHILD == child->name())
+    if (child.hasName(NODE_CHILD))
     {
       // process child
       result = processChild(child);
     }
-    else if (NODE_FRAME == child->name())
+    else if (child.hasName(NODE_FRAME))
     {
       // process frame
       result = processFrame(child);
@@ -88,7 +88,7 @@ EGEResult ResourceWidget::create(const String& path, const PXmlElement& tag)
     }
 
     // go to next child
-    child = child->nextChild();
+    child = child.nextChild();
   }
 
   // check if success
@@ -181,7 +181,7 @@ PWidget ResourceWidget::createInstance()
   return object;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceWidget::processChild(const PXmlElement& tag)
+EGEResult ResourceWidget::processChild(const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
@@ -190,9 +190,9 @@ EGEResult ResourceWidget::processChild(const PXmlElement& tag)
   ChildData childData;
 
   // retrieve data
-  childData.name        = tag->attribute("name");
-  childData.offset      = StringUtils::ToVector2f(tag->attribute("offset", "0 0"), &error);
-  childData.widgetName  = tag->attribute("widget-name");
+  childData.name        = tag.attribute("name");
+  childData.offset      = StringUtils::ToVector2f(tag.attribute("offset", "0 0"), &error);
+  childData.widgetName  = tag.attribute("widget-name");
  
   // check for error
   if (childData.name.empty() || childData.widgetName.empty() || error)
@@ -218,22 +218,22 @@ EGEResult ResourceWidget::processChild(const PXmlElement& tag)
   return result;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-EGEResult ResourceWidget::processFrame(const PXmlElement& tag)
+EGEResult ResourceWidget::processFrame(const XmlElementHandle& tag)
 {
   EGEResult result = EGE_SUCCESS;
 
   bool error = false;
 
   // retrieve data
-  m_frameData.topLeftRect       = StringUtils::ToRecti(tag->attribute("top-left-rect"), &error);
-  m_frameData.topMiddleRect     = StringUtils::ToRecti(tag->attribute("top-middle-rect"), &error);
-  m_frameData.topRightRect      = StringUtils::ToRecti(tag->attribute("top-right-rect"), &error);
-  m_frameData.middleLeftRect    = StringUtils::ToRecti(tag->attribute("middle-left-rect"), &error);
-  m_frameData.fillRect          = StringUtils::ToRecti(tag->attribute("fill-rect"), &error);
-  m_frameData.middleRightRect   = StringUtils::ToRecti(tag->attribute("middle-right-rect"), &error);
-  m_frameData.bottomLeftRect    = StringUtils::ToRecti(tag->attribute("bottom-left-rect"), &error);
-  m_frameData.bottomMiddleRect  = StringUtils::ToRecti(tag->attribute("bottom-middle-rect"), &error);
-  m_frameData.bottomRightRect   = StringUtils::ToRecti(tag->attribute("bottom-right-rect"), &error);
+  m_frameData.topLeftRect       = StringUtils::ToRecti(tag.attribute("top-left-rect"), &error);
+  m_frameData.topMiddleRect     = StringUtils::ToRecti(tag.attribute("top-middle-rect"), &error);
+  m_frameData.topRightRect      = StringUtils::ToRecti(tag.attribute("top-right-rect"), &error);
+  m_frameData.middleLeftRect    = StringUtils::ToRecti(tag.attribute("middle-left-rect"), &error);
+  m_frameData.fillRect          = StringUtils::ToRecti(tag.attribute("fill-rect"), &error);
+  m_frameData.middleRightRect   = StringUtils::ToRecti(tag.attribute("middle-right-rect"), &error);
+  m_frameData.bottomLeftRect    = StringUtils::ToRecti(tag.attribute("bottom-left-rect"), &error);
+  m_frameData.bottomMiddleRect  = StringUtils::ToRecti(tag.attribute("bottom-middle-rect"), &error);
+  m_frameData.bottomRightRect   = StringUtils::ToRecti(tag.attribute("bottom-right-rect"), &error);
 
   // check for error
   if (error)
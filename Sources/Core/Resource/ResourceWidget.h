@@ -36,7 +36,7 @@ class ResourceWidget : public IResource
     /*! @see IResource::name. */
     const String& name() const override;
     /*! @see IResource::create. */ 
-    EGEResult create(const String& path, const PXmlElement& tag) override;
+    EGEResult create(const String& path, const XmlElementHandle& tag) override;
     /*! @see IResource::load. */
     EGEResult load() override;
     /*! @see IResource::unload. */
@@ -49,9 +49,9 @@ class ResourceWidget : public IResource
 
     ResourceWidget(Application* app, ResourceGroup* group);
     /*! Processes child data. */
-    EGEResult processChild(const PXmlElement& tag);
+    EGEResult processChild(const XmlElementHandle& tag);
     /*! Processes frame data. */
-    EGEResult processFrame(const PXmlElement& tag);
+    EGEResult processFrame(const XmlElementHandle& tag);
 
   private:
 
@@ -0,0 +1,246 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGEApplication.h>
+#include <EGEMemory.h>
+#include <EGEName.h>
+#include <EGEResources.h>
+#include <EGEThread.h>
+#include <EGEAtomic.h>
+#include <stdio.h>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+static const char* KDefinitionFilePath = "resource-manager-test.xml";
+static const char* KManifestFilePath   = "resource-manager-test.xml.egm";
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Headless application instance. */
+class ResourceManagerTestApplication : public Application
+{
+  public:
+
+    /*! @see Application::onInitialized. */
+    void onInitialized() override {}
+    /*! @see Application::version. */
+    Version version() const override { return Version(1, 0, 0); }
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Thread repeatedly looking up given resource until stopped. */
+class LookUpThread : public Thread
+{
+  public:
+
+    LookUpThread(ResourceManager* manager, const String& name) : Thread(NULL), m_manager(manager), m_name(name), m_done(0), m_lookUpCount(0), 
+                                                                  m_failureCount(0) {}
+
+    /*! Requests look-ups to be stopped. */
+    void done() { egeAtomicIncrement(m_done); }
+    /*! Returns number of look-ups done. */
+    u32 lookUpCount() { return egeAtomicLoad(m_lookUpCount); }
+    /*! Returns number of look-ups which have not found resource. */
+    u32 failureCount() const { return m_failureCount; }
+
+  private:
+
+    /*! @see Thread::run. */
+    s32 run() override
+    {
+      while (0 == egeAtomicLoad(m_done))
+      {
+        if (NULL == m_manager->resource(RESOURCE_NAME_DATA, m_name))
+        {
+          ++m_failureCount;
+        }
+
+        egeAtomicIncrement(m_lookUpCount);
+      }
+
+      return 0;
+    }
+
+  private:
+
+    /*! Manager to look up resource thru. */
+    ResourceManager* m_manager;
+    /*! Name of resource to look up. */
+    String m_name;
+    /*! Stop request flag. */
+    volatile u32 m_done;
+    /*! Number of look-ups done. */
+    volatile u32 m_lookUpCount;
+    /*! Number of look-ups which have not found resource. */
+    u32 m_failureCount;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class ResourceManagerTest : public TestBase
+{
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void SetUp();
+    virtual void TearDown();
+
+  protected:
+
+    /*! Writes resource definition file containing single group of a given name. Group contains single data resource named after group. */
+    void writeDefinition(const char* groupName);
+    /*! Returns resource manager. */
+    ResourceManager* resourceManager() const { return m_app->resourceManager(); }
+
+  protected:
+
+    /*! Application instance. */
+    ResourceManagerTestApplication* m_app;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ResourceManagerTest::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ResourceManagerTest::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ResourceManagerTest::SetUp()
+{
+  remove(KDefinitionFilePath);
+  remove(KManifestFilePath);
+
+  Dictionary params;
+  params[EGE_RENDER_TARGET_PARAM_NAME]    = EGE_PRIMARY_RENDER_TARGET_NAME;
+  params[EGE_RENDER_TARGET_PARAM_WIDTH]   = "1024";
+  params[EGE_RENDER_TARGET_PARAM_HEIGHT]  = "768";
+  params[EGE_ENGINE_PARAM_HEADLESS]       = "true";
+
+  m_app = ege_new ResourceManagerTestApplication();
+  ASSERT_TRUE(NULL != m_app);
+  ASSERT_EQ(EGE_SUCCESS, m_app->construct(params));
+
+  // NOTE: test files are located in working directory
+  resourceManager()->addDataDirectory(".");
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ResourceManagerTest::TearDown()
+{
+  EGE_DELETE(m_app);
+
+  remove(KDefinitionFilePath);
+  remove(KManifestFilePath);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ResourceManagerTest::writeDefinition(const char* groupName)
+{
+  FILE* file = fopen(KDefinitionFilePath, "wb");
+  ASSERT_TRUE(NULL != file);
+
+  fprintf(file, "<resources>\n  <group name=\"%s\">\n    <data name=\"%s-data\" path=\"data.bin\" nulled=\"false\" />\n  </group>\n</resources>\n", groupName, 
+          groupName);
+
+  EXPECT_EQ(0, fclose(file));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ResourceManagerTest, LoadFromManifest)
+{
+  writeDefinition("manifest-group");
+  EXPECT_EQ(EGE_SUCCESS, ResourceManager::CompileManifest(KDefinitionFilePath));
+
+  // NOTE: definition file is removed so resources can only come from manifest
+  EXPECT_EQ(0, remove(KDefinitionFilePath));
+
+  EXPECT_EQ(EGE_SUCCESS, resourceManager()->addResources(KDefinitionFilePath));
+  EXPECT_TRUE(NULL != resourceManager()->group("manifest-group"));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ResourceManagerTest, LoadFromUpToDateManifest)
+{
+  writeDefinition("manifest-group");
+  EXPECT_EQ(EGE_SUCCESS, ResourceManager::CompileManifest(KDefinitionFilePath));
+
+  EXPECT_EQ(EGE_SUCCESS, resourceManager()->addResources(KDefinitionFilePath));
+  EXPECT_TRUE(NULL != resourceManager()->group("manifest-group"));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ResourceManagerTest, FallBackToDefinitionIfManifestMissing)
+{
+  writeDefinition("definition-group");
+
+  EXPECT_EQ(EGE_SUCCESS, resourceManager()->addResources(KDefinitionFilePath));
+  EXPECT_TRUE(NULL != resourceManager()->group("definition-group"));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ResourceManagerTest, ManifestUsedWithoutCheckingDefinition)
+{
+  writeDefinition("manifest-group");
+  EXPECT_EQ(EGE_SUCCESS, ResourceManager::CompileManifest(KDefinitionFilePath));
+
+  // change definition without recompiling manifest
+  // NOTE: keeping manifests up to date is responsibility of build step
+  writeDefinition("definition-group");
+
+  EXPECT_EQ(EGE_SUCCESS, resourceManager()->addResources(KDefinitionFilePath));
+  EXPECT_TRUE(NULL != resourceManager()->group("manifest-group"));
+  EXPECT_TRUE(NULL == resourceManager()->group("definition-group"));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ResourceManagerTest, FailIfNoDefinition)
+{
+  EXPECT_NE(EGE_SUCCESS, resourceManager()->addResources(KDefinitionFilePath));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ResourceManagerTest, LookUpDoesNotInternNames)
+{
+  writeDefinition("definition-group");
+  EXPECT_EQ(EGE_SUCCESS, resourceManager()->addResources(KDefinitionFilePath));
+
+  // existing resource
+  EXPECT_TRUE(NULL != resourceManager()->resource(RESOURCE_NAME_DATA, "definition-group-data"));
+  EXPECT_TRUE(NULL != resourceManager()->resource(RESOURCE_NAME_DATA, "definition-group-data", "definition-group"));
+
+  // unknown resources
+  const u32 count = Name::Count();
+  EXPECT_TRUE(NULL == resourceManager()->resource(RESOURCE_NAME_DATA, "resource-manager-test-unknown"));
+  EXPECT_TRUE(NULL == resourceManager()->resource("resource-manager-test-unknown-type", "definition-group-data"));
+  EXPECT_TRUE(NULL == resourceManager()->resource(RESOURCE_NAME_DATA, "resource-manager-test-unknown", "definition-group"));
+  EXPECT_EQ(count, Name::Count());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ResourceManagerTest, LookUpWhileGroupsAreAdded)
+{
+  writeDefinition("definition-group");
+  EXPECT_EQ(EGE_SUCCESS, resourceManager()->addResources(KDefinitionFilePath));
+
+  LookUpThread* thread = ege_new LookUpThread(resourceManager(), "definition-group-data");
+  ASSERT_TRUE(NULL != thread);
+  PThread threadRef = thread;
+  ASSERT_TRUE(thread->start());
+
+  while (0 == thread->lookUpCount())
+  {
+    Thread::YieldCurrent();
+  }
+
+  // keep republishing index while other thread looks up resource present from the very beginning
+  for (u32 i = 0; i < 100; ++i)
+  {
+    writeDefinition(String::Format("definition-group-%d", i).toAscii());
+    EXPECT_EQ(EGE_SUCCESS, resourceManager()->addResources(KDefinitionFilePath));
+  }
+
+  thread->done();
+  thread->wait();
+  EXPECT_TRUE(thread->isFinished());
+
+  EXPECT_EQ(0U, thread->failureCount());
+
+  // all groups are indexed
+  for (u32 i = 0; i < 100; ++i)
+  {
+    EXPECT_TRUE(NULL != resourceManager()->resource(RESOURCE_NAME_DATA, String::Format("definition-group-%d-data", i)));
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
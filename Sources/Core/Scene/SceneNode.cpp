@@ -186,15 +186,16 @@ const Matrix4f& SceneNode::worldMatrix() const
 { 
   if ( ! m_worldMatrix.isValid())
   {
-    Quaternionf orientation = physics()->orientation();
-    Vector4f position = physics()->position();
+    Quaternionf orientation = physics()->interpolatedOrientation();
+    Vector4f position = physics()->interpolatedPosition();
     Vector4f scale = physics()->scale();
   
-    m_worldMatrix = Math::CreateMatrix(position, scale, orientation);
+    m_worldMatrix = Matrix4f(position, scale, orientation);
   
     if (NULL != parent())
     {
-      m_worldMatrix = static_cast<SceneNode*>(parent())->worldMatrix().multiply(m_worldMatrix);
+      // NOTE: all world matrices are composed of translation, rotation and scale only, thus affine
+      m_worldMatrix = static_cast<SceneNode*>(parent())->worldMatrix().multiplyAffine(m_worldMatrix);
     }
   }
 
@@ -1,4 +1,6 @@
 #include "Core/Screen/Screen.h"
+#include "Core/Graphics/Viewport.h"
+#include "Core/UI/Widget.h"
 
 EGE_NAMESPACE_BEGIN
 
@@ -14,6 +16,13 @@ Screen::Screen(Application* app, const String& name) : Object(app),
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Screen::~Screen()
 {
+  // disconnect from widgets
+  for (DynamicArray<PWidget>::iterator it = m_widgets.begin(); it != m_widgets.end(); ++it)
+  {
+    ege_disconnect(*it, renderCacheInvalidated, this, Screen::invalidateRenderCache);
+  }
+
+  setRenderCacheEnabled(false);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 EGEResult Screen::construct()
@@ -64,5 +73,57 @@ void Screen::leave()
   // do nothing
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Screen::setRenderCacheEnabled(bool enable)
+{
+  if (enable && (NULL == m_renderCache))
+  {
+    m_renderCache = ege_new RenderCache(app(), "screen-" + name());
+    if (NULL != m_renderCache)
+    {
+      ege_connect(m_renderCache, renderRequested, this, Screen::onRenderCacheRequested);
+    }
+  }
+  else if (!enable && (NULL != m_renderCache))
+  {
+    ege_disconnect(m_renderCache, renderRequested, this, Screen::onRenderCacheRequested);
+    m_renderCache = NULL;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Screen::invalidateRenderCache()
+{
+  if (NULL != m_renderCache)
+  {
+    m_renderCache->invalidate();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Screen::addWidget(const PWidget& widget)
+{
+  if ((NULL != widget) && ! m_widgets.contains(widget))
+  {
+    ege_connect(widget, renderCacheInvalidated, this, Screen::invalidateRenderCache);
+    m_widgets.push_back(widget);
+
+    invalidateRenderCache();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Screen::removeWidget(const PWidget& widget)
+{
+  if (m_widgets.contains(widget))
+  {
+    ege_disconnect(widget, renderCacheInvalidated, this, Screen::invalidateRenderCache);
+    m_widgets.remove(widget);
+
+    invalidateRenderCache();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Screen::onRenderCacheRequested(IRenderer* renderer)
+{
+  render(m_renderCache->viewport(), renderer);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
\ No newline at end of file
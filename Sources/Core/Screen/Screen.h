@@ -9,6 +9,8 @@
 #include "EGETime.h"
 #include "EGEInput.h"
 #include "EGEString.h"
+#include "EGEDynamicArray.h"
+#include "Core/Graphics/RenderCache.h"
 
 EGE_NAMESPACE_BEGIN
 
@@ -16,6 +18,7 @@ EGE_NAMESPACE_BEGIN
 class Viewport;
 class IRenderer;
 EGE_DECLARE_SMART_CLASS(Screen, PScreen)
+EGE_DECLARE_SMART_CLASS(Widget, PWidget)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class Screen : public Object
 {
@@ -54,6 +57,30 @@ class Screen : public Object
     bool isEnabled() const { return !m_disabled; }
     /*! Returns name. */
     const String& name() const { return m_name; }
+    /*! Enables/disables render cache.
+     *  @note When enabled, screen is rendered into a texture once and then drawn as a single quad for as long as it is not invalidated.
+     *  @note Screen content is expected to be laid out in viewport's logical space with top-left corner at the origin.
+     */
+    void setRenderCacheEnabled(bool enable);
+    /*! Returns TRUE if render cache is enabled. */
+    bool isRenderCacheEnabled() const { return NULL != m_renderCache; }
+    /*! Returns render cache. NULL if disabled. */
+    PRenderCache renderCache() const { return m_renderCache; }
+    /*! Invalidates render cache. 
+     *  @note This should be called whenever look of the screen changes in a way not tracked thru its widgets.
+     */
+    void invalidateRenderCache();
+    /*! Adds top-level widget rendered by the screen. 
+     *  @note Any change of look of the widget hierarchy invalidates screen render cache.
+     */
+    void addWidget(const PWidget& widget);
+    /*! Removes top-level widget rendered by the screen. */
+    void removeWidget(const PWidget& widget);
+
+  private slots:
+
+    /*! Slot called when content is to be rendered into render cache. */
+    void onRenderCacheRequested(IRenderer* renderer);
 
   private:
 
@@ -61,6 +88,10 @@ class Screen : public Object
     String m_name;
     /*! Disabled flag. */
     bool m_disabled;
+    /*! Render cache. NULL if disabled. */
+    PRenderCache m_renderCache;
+    /*! Top-level widgets rendered by the screen. */
+    DynamicArray<PWidget> m_widgets;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -1,6 +1,7 @@
 #include "Core/Application/Application.h"
 #include "Core/Screen/Screen.h"
 #include "Core/Screen/ScreenManager.h"
+#include "Core/Graphics/Viewport.h"
 #include "EGESignal.h"
 
 EGE_NAMESPACE_BEGIN
@@ -97,7 +98,9 @@ void ScreenManager::show(PScreen screen)
   }
 
   // enter new screen
+  // NOTE: entering may change screen look
   screen->enter();
+  screen->invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void ScreenManager::hide()
@@ -117,6 +120,7 @@ void ScreenManager::hide()
   if (NULL != top())
   {
     top()->enter();
+    top()->invalidateRenderCache();
   }
 
   // check if visibility changed and more than 2 screens
@@ -168,7 +172,7 @@ void ScreenManager::render(Viewport* viewport, IRenderer* renderer)
         // render current screen
         if (screen->isEnabled())
         {
-          screen->render(viewport, renderer);
+          renderScreen(screen, viewport, renderer);
         }
 
         // check if we have reached top level screen
@@ -186,6 +190,31 @@ void ScreenManager::render(Viewport* viewport, IRenderer* renderer)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ScreenManager::renderScreen(Screen* screen, Viewport* viewport, IRenderer* renderer)
+{
+  PRenderCache cache = screen->renderCache();
+
+  // check if screen is cached
+  if (NULL != cache)
+  {
+    const Rectf rect = viewport->logicalRect();
+
+    // make sure cache covers entire viewport
+    // NOTE: if size changes, cache is invalidated and gets refreshed before next frame
+    cache->setSize(Vector2f(rect.width, rect.height));
+
+    if (cache->isUpToDate())
+    {
+      // draw cached content
+      cache->addForRendering(renderer);
+      return;
+    }
+  }
+
+  // render directly
+  screen->render(viewport, renderer);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void ScreenManager::remove(PScreen screen)
 {
   // check if it is top screen
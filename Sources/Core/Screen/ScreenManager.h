@@ -78,6 +78,11 @@ class ScreenManager : public Object
     /*! Pointer event receiver. */
     void pointerEvent(PPointerData data);
 
+  private:
+
+    /*! Renders given screen. Screen's render cache is used whenever it is up to date. */
+    void renderScreen(Screen* screen, Viewport* viewport, IRenderer* renderer);
+
   private:
 
     typedef List<PScreen> ScreenList;
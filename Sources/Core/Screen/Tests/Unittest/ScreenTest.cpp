@@ -0,0 +1,228 @@
+#include "TestFramework/Interface/TestBase.h"
+#include "Core/Graphics/Camera.h"
+#include <EGEApplication.h>
+#include <EGEGraphics.h>
+#include <EGEMemory.h>
+#include <EGEScreen.h>
+#include <EGEUI.h>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Headless application instance. */
+class ScreenTestApplication : public Application
+{
+  public:
+
+    /*! @see Application::onInitialized. */
+    void onInitialized() override {}
+    /*! @see Application::version. */
+    Version version() const override { return Version(1, 0, 0); }
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Frameless widget with no look of its own. */
+class TestWidget : public Widget
+{
+  public:
+
+    TestWidget(Application* app, const String& name) : Widget(app, name, EGE_OBJECT_UID_GENERIC) {}
+
+  private:
+
+    /*! @see Widget::isFrameless. */
+    bool isFrameless() const override { return true; }
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Opaque screen rendering single widget and counting how many times it was rendered. */
+class TestScreen : public Screen
+{
+  public:
+
+    TestScreen(Application* app, const PWidget& widget) : Screen(app, "test"), m_widget(widget), m_renderCount(0) {}
+
+    /*! @see Screen::render. */
+    void render(const Viewport* viewport, IRenderer* renderer) override
+    {
+      EGE_UNUSED(viewport);
+
+      m_widget->addForRendering(renderer);
+      m_renderCount++;
+    }
+    /*! @see Screen::hasTransparency. */
+    bool hasTransparency() const override { return false; }
+    /*! Returns number of times screen content was rendered. */
+    s32 renderCount() const { return m_renderCount; }
+
+  private:
+
+    /*! Rendered widget. */
+    PWidget m_widget;
+    /*! Number of times screen content was rendered. */
+    s32 m_renderCount;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class ScreenTest : public TestBase
+{
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void SetUp();
+    virtual void TearDown();
+
+  protected:
+
+    /*! Renders single frame. */
+    void renderFrame();
+
+  protected:
+
+    /*! Application instance. */
+    ScreenTestApplication* m_app;
+    /*! Top-level widget rendered by screen. */
+    PWidget m_root;
+    /*! Child of top-level widget. */
+    PWidget m_child;
+    /*! Tested screen. */
+    TestScreen* m_screen;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ScreenTest::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ScreenTest::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ScreenTest::SetUp()
+{
+  Dictionary params;
+  params[EGE_RENDER_TARGET_PARAM_NAME]    = EGE_PRIMARY_RENDER_TARGET_NAME;
+  params[EGE_RENDER_TARGET_PARAM_WIDTH]   = "1024";
+  params[EGE_RENDER_TARGET_PARAM_HEIGHT]  = "768";
+  params[EGE_ENGINE_PARAM_LANDSCAPE_MODE] = "true";
+  params[EGE_ENGINE_PARAM_HEADLESS]       = "true";
+
+  m_app = ege_new ScreenTestApplication();
+  ASSERT_TRUE(NULL != m_app);
+  ASSERT_EQ(EGE_SUCCESS, m_app->construct(params));
+
+  // setup main viewport
+  // NOTE: screens are rendered together with the scene
+  PRenderTarget window = m_app->graphics()->renderTarget(EGE_PRIMARY_RENDER_TARGET_NAME);
+  ASSERT_TRUE(NULL != window);
+  ASSERT_TRUE(NULL != window->addViewport("main", ege_new Camera("main", m_app->sceneManager())));
+
+  // create widgets
+  m_root  = ege_new TestWidget(m_app, "root");
+  m_child = ege_new TestWidget(m_app, "child");
+  ASSERT_TRUE((NULL != m_root) && (NULL != m_child));
+  ASSERT_EQ(EGE_SUCCESS, m_root->addChild(m_child));
+
+  // create cached screen
+  m_screen = ege_new TestScreen(m_app, m_root);
+  ASSERT_TRUE(NULL != m_screen);
+
+  m_screen->setRenderCacheEnabled(true);
+  ASSERT_TRUE(m_screen->isRenderCacheEnabled());
+
+  m_screen->addWidget(m_root);
+
+  m_app->screenManager()->show(m_screen);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ScreenTest::TearDown()
+{
+  if (NULL != m_app)
+  {
+    m_app->screenManager()->removeAll();
+  }
+
+  m_child = NULL;
+  m_root  = NULL;
+
+  EGE_DELETE(m_app);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void ScreenTest::renderFrame()
+{
+  m_app->graphics()->render();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ScreenTest, CacheIsReused)
+{
+  // NOTE: first frame renders directly while cache is being created, second one fills the cache
+  renderFrame();
+  renderFrame();
+  EXPECT_TRUE(m_screen->renderCache()->isUpToDate());
+  EXPECT_EQ(2, m_screen->renderCount());
+
+  // nothing changes, cached content is drawn
+  renderFrame();
+  renderFrame();
+  EXPECT_TRUE(m_screen->renderCache()->isUpToDate());
+  EXPECT_EQ(2, m_screen->renderCount());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ScreenTest, ChildWidgetChangeInvalidatesCache)
+{
+  renderFrame();
+  renderFrame();
+  ASSERT_TRUE(m_screen->renderCache()->isUpToDate());
+  const s32 renderCount = m_screen->renderCount();
+
+  // change look of the child
+  m_child->setVisible(false);
+  EXPECT_FALSE(m_screen->renderCache()->isUpToDate());
+
+  // cache is refreshed ahead of the next frame
+  renderFrame();
+  EXPECT_TRUE(m_screen->renderCache()->isUpToDate());
+  EXPECT_EQ(renderCount + 1, m_screen->renderCount());
+
+  // change child in a way tracked by the child itself
+  m_child->setSize(Vector2f(20, 20));
+  EXPECT_FALSE(m_screen->renderCache()->isUpToDate());
+
+  renderFrame();
+  EXPECT_TRUE(m_screen->renderCache()->isUpToDate());
+  EXPECT_EQ(renderCount + 2, m_screen->renderCount());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ScreenTest, TopLevelWidgetChangeInvalidatesCache)
+{
+  renderFrame();
+  renderFrame();
+  ASSERT_TRUE(m_screen->renderCache()->isUpToDate());
+
+  // move top-level widget
+  // NOTE: widget itself looks the same, but screen does not
+  m_root->setPosition(Vector4f(10, 10, 0));
+  EXPECT_FALSE(m_screen->renderCache()->isUpToDate());
+
+  renderFrame();
+  EXPECT_TRUE(m_screen->renderCache()->isUpToDate());
+
+  // hide it
+  m_root->setVisible(false);
+  EXPECT_FALSE(m_screen->renderCache()->isUpToDate());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(ScreenTest, RemovedWidgetDoesNotInvalidateCache)
+{
+  m_screen->removeWidget(m_root);
+
+  renderFrame();
+  renderFrame();
+  ASSERT_TRUE(m_screen->renderCache()->isUpToDate());
+
+  m_child->setVisible(false);
+  EXPECT_TRUE(m_screen->renderCache()->isUpToDate());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -11,10 +11,195 @@
 #define _SIGNAL_H_
 
 #include "Delegate.h"
-#include <set>
+#include <stddef.h>
 
 namespace Gallant {
 
+// TAGE - flat storage of delegates connected to a signal
+//        first few delegates are kept inline so signals with few slots never allocate
+//        delegates disconnected during emission are only cleared in place, storage is compacted once outermost emission is done
+template< class DelegateType, size_t InlineCapacity = 2 >
+class DelegateList
+{
+public:
+	DelegateList() : m_data( m_inline ), m_size( 0 ), m_capacity( InlineCapacity ), m_emitDepth( 0 ), m_dirty( false )
+	{
+	}
+
+	DelegateList( const DelegateList& other ) : m_data( m_inline ), m_size( 0 ), m_capacity( InlineCapacity ), m_emitDepth( 0 ), m_dirty( false )
+	{
+		append( other );
+	}
+
+	~DelegateList()
+	{
+		if (m_data != m_inline)
+		{
+			delete [] m_data;
+		}
+	}
+
+	DelegateList& operator = ( const DelegateList& other )
+	{
+		if (this != &other)
+		{
+			clear();
+			append( other );
+		}
+		return *this;
+	}
+
+	bool empty() const
+	{
+		return 0 == m_size;
+	}
+
+	size_t size() const
+	{
+		return m_size;
+	}
+
+	const DelegateType& operator [] ( size_t index ) const
+	{
+		return m_data[index];
+	}
+
+	void insert( const DelegateType& delegate )
+	{
+		// TAGE - connecting the same delegate more than once has no effect
+		if (delegate.empty() || (m_size != find( delegate )))
+		{
+			return;
+		}
+
+		if (m_size == m_capacity)
+		{
+			reserve( m_capacity * 2 );
+		}
+
+		m_data[m_size++] = delegate;
+	}
+
+	void erase( const DelegateType& delegate )
+	{
+		const size_t index = find( delegate );
+		if (index == m_size)
+		{
+			return;
+		}
+
+		if (0 < m_emitDepth)
+		{
+			// TAGE - emission in progress, keep indices valid
+			m_data[index].clear();
+			m_dirty = true;
+		}
+		else
+		{
+			for (size_t i = index + 1; i < m_size; ++i)
+			{
+				m_data[i - 1] = m_data[i];
+			}
+			m_data[--m_size].clear();
+		}
+	}
+
+	void clear()
+	{
+		if (0 < m_emitDepth)
+		{
+			for (size_t i = 0; i < m_size; ++i)
+			{
+				m_data[i].clear();
+			}
+			m_dirty = true;
+		}
+		else
+		{
+			m_size = 0;
+		}
+	}
+
+	void beginEmit()
+	{
+		++m_emitDepth;
+	}
+
+	void endEmit()
+	{
+		if ((0 == --m_emitDepth) && m_dirty)
+		{
+			compact();
+		}
+	}
+
+private:
+	size_t find( const DelegateType& delegate ) const
+	{
+		for (size_t i = 0; i < m_size; ++i)
+		{
+			if (m_data[i] == delegate)
+			{
+				return i;
+			}
+		}
+		return m_size;
+	}
+
+	void append( const DelegateList& other )
+	{
+		for (size_t i = 0; i < other.m_size; ++i)
+		{
+			insert( other.m_data[i] );
+		}
+	}
+
+	void reserve( size_t capacity )
+	{
+		DelegateType* data = new DelegateType[capacity];
+		for (size_t i = 0; i < m_size; ++i)
+		{
+			data[i] = m_data[i];
+		}
+
+		if (m_data != m_inline)
+		{
+			delete [] m_data;
+		}
+
+		m_data     = data;
+		m_capacity = capacity;
+	}
+
+	void compact()
+	{
+		size_t count = 0;
+		for (size_t i = 0; i < m_size; ++i)
+		{
+			if ( ! m_data[i].empty())
+			{
+				m_data[count++] = m_data[i];
+			}
+		}
+
+		for (size_t i = count; i < m_size; ++i)
+		{
+			m_data[i].clear();
+		}
+
+		m_size  = count;
+		m_dirty = false;
+	}
+
+private:
+	DelegateType m_inline[InlineCapacity];
+	DelegateType* m_data;
+	size_t m_size;
+	size_t m_capacity;
+	int m_emitDepth;
+	bool m_dirty;
+};
+
 template< class Param0 = void >
 class Signal0
 {
@@ -22,9 +207,8 @@ public:
 	typedef Delegate0< void > _Delegate;
 
 private:
-	typedef std::set<_Delegate> DelegateList;
-	typedef typename DelegateList::iterator DelegateIterator;
-	DelegateList delegateList;
+	typedef Gallant::DelegateList<_Delegate> DelegateList;
+	mutable DelegateList delegateList;
 
 public:
 	void Connect( _Delegate delegate )
@@ -63,15 +247,26 @@ public:
 
 	void Emit() const
 	{
-		for (DelegateIterator i = delegateList.begin(); i != delegateList.end();)
+		if (delegateList.empty())
 		{
-      // TAGE - already go to next iterator here to be able to proceed with iteration in the case current iterator gets erased in emission function
-      //        ie. due to signal disconnection in emitter function
-      DelegateIterator current = i++;
+			return;
+		}
+
+		// TAGE - only delegates connected before emission starts are called
+		//        delegates disconnected in emitter function are cleared in place so iteration remains valid
+		delegateList.beginEmit();
 
-      // now safetly call emitter function of current iterator
-			(*current)();
+		const size_t count = delegateList.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const _Delegate current = delegateList[i];
+			if ( ! current.empty())
+			{
+				current();
+			}
 		}
+
+		delegateList.endEmit();
 	}
 
 	void operator() () const
@@ -88,9 +283,8 @@ public:
 	typedef Delegate1< Param1 > _Delegate;
 
 private:
-	typedef std::set<_Delegate> DelegateList;
-	typedef typename DelegateList::iterator DelegateIterator;
-	DelegateList delegateList;
+	typedef Gallant::DelegateList<_Delegate> DelegateList;
+	mutable DelegateList delegateList;
 
 public:
 	void Connect( _Delegate delegate )
@@ -129,15 +323,26 @@ public:
 
 	void Emit( Param1 p1 ) const
 	{
-		for (DelegateIterator i = delegateList.begin(); i != delegateList.end();)
+		if (delegateList.empty())
 		{
-      // TAGE - already go to next iterator here to be able to proceed with iteration in the case current iterator gets erased in emission function
-      //        ie. due to signal disconnection in emitter function
-      DelegateIterator current = i++;
+			return;
+		}
+
+		// TAGE - only delegates connected before emission starts are called
+		//        delegates disconnected in emitter function are cleared in place so iteration remains valid
+		delegateList.beginEmit();
 
-      // now safetly call emitter function of current iterator
-			(*current)(p1);
+		const size_t count = delegateList.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const _Delegate current = delegateList[i];
+			if ( ! current.empty())
+			{
+				current(p1);
+			}
 		}
+
+		delegateList.endEmit();
 	}
 
 	void operator() ( Param1 p1 ) const
@@ -154,9 +359,8 @@ public:
 	typedef Delegate2< Param1, Param2 > _Delegate;
 
 private:
-	typedef std::set<_Delegate> DelegateList;
-	typedef typename DelegateList::iterator DelegateIterator;
-	DelegateList delegateList;
+	typedef Gallant::DelegateList<_Delegate> DelegateList;
+	mutable DelegateList delegateList;
 
 public:
 	void Connect( _Delegate delegate )
@@ -195,15 +399,26 @@ public:
 
 	void Emit( Param1 p1, Param2 p2 ) const
 	{
-		for (DelegateIterator i = delegateList.begin(); i != delegateList.end();)
+		if (delegateList.empty())
 		{
-      // TAGE - already go to next iterator here to be able to proceed with iteration in the case current iterator gets erased in emission function
-      //        ie. due to signal disconnection in emitter function
-      DelegateIterator current = i++;
+			return;
+		}
+
+		// TAGE - only delegates connected before emission starts are called
+		//        delegates disconnected in emitter function are cleared in place so iteration remains valid
+		delegateList.beginEmit();
 
-      // now safetly call emitter function of current iterator
-			(*current)(p1, p2);
+		const size_t count = delegateList.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const _Delegate current = delegateList[i];
+			if ( ! current.empty())
+			{
+				current(p1, p2);
+			}
 		}
+
+		delegateList.endEmit();
 	}
 
 	void operator() ( Param1 p1, Param2 p2 ) const
@@ -220,9 +435,8 @@ public:
 	typedef Delegate3< Param1, Param2, Param3 > _Delegate;
 
 private:
-	typedef std::set<_Delegate> DelegateList;
-	typedef typename DelegateList::iterator DelegateIterator;
-	DelegateList delegateList;
+	typedef Gallant::DelegateList<_Delegate> DelegateList;
+	mutable DelegateList delegateList;
 
 public:
 	void Connect( _Delegate delegate )
@@ -261,15 +475,26 @@ public:
 
 	void Emit( Param1 p1, Param2 p2, Param3 p3 ) const
 	{
-		for (DelegateIterator i = delegateList.begin(); i != delegateList.end();)
+		if (delegateList.empty())
 		{
-      // TAGE - already go to next iterator here to be able to proceed with iteration in the case current iterator gets erased in emission function
-      //        ie. due to signal disconnection in emitter function
-      DelegateIterator current = i++;
+			return;
+		}
+
+		// TAGE - only delegates connected before emission starts are called
+		//        delegates disconnected in emitter function are cleared in place so iteration remains valid
+		delegateList.beginEmit();
 
-      // now safetly call emitter function of current iterator
-			(*current)(p1, p2, p3);
+		const size_t count = delegateList.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const _Delegate current = delegateList[i];
+			if ( ! current.empty())
+			{
+				current(p1, p2, p3);
+			}
 		}
+
+		delegateList.endEmit();
 	}
 
 	void operator() ( Param1 p1, Param2 p2, Param3 p3 ) const
@@ -286,9 +511,8 @@ public:
 	typedef Delegate4< Param1, Param2, Param3, Param4 > _Delegate;
 
 private:
-	typedef std::set<_Delegate> DelegateList;
-	typedef typename DelegateList::iterator DelegateIterator;
-	DelegateList delegateList;
+	typedef Gallant::DelegateList<_Delegate> DelegateList;
+	mutable DelegateList delegateList;
 
 public:
 	void Connect( _Delegate delegate )
@@ -327,15 +551,26 @@ public:
 
 	void Emit( Param1 p1, Param2 p2, Param3 p3, Param4 p4 ) const
 	{
-		for (DelegateIterator i = delegateList.begin(); i != delegateList.end();)
+		if (delegateList.empty())
 		{
-      // TAGE - already go to next iterator here to be able to proceed with iteration in the case current iterator gets erased in emission function
-      //        ie. due to signal disconnection in emitter function
-      DelegateIterator current = i++;
+			return;
+		}
+
+		// TAGE - only delegates connected before emission starts are called
+		//        delegates disconnected in emitter function are cleared in place so iteration remains valid
+		delegateList.beginEmit();
 
-      // now safetly call emitter function of current iterator
-			(*current)(p1, p2, p3, p4);
+		const size_t count = delegateList.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const _Delegate current = delegateList[i];
+			if ( ! current.empty())
+			{
+				current(p1, p2, p3, p4);
+			}
 		}
+
+		delegateList.endEmit();
 	}
 
 	void operator() ( Param1 p1, Param2 p2, Param3 p3, Param4 p4 ) const
@@ -352,9 +587,8 @@ public:
 	typedef Delegate5< Param1, Param2, Param3, Param4, Param5 > _Delegate;
 
 private:
-	typedef std::set<_Delegate> DelegateList;
-	typedef typename DelegateList::iterator DelegateIterator;
-	DelegateList delegateList;
+	typedef Gallant::DelegateList<_Delegate> DelegateList;
+	mutable DelegateList delegateList;
 
 public:
 	void Connect( _Delegate delegate )
@@ -393,15 +627,26 @@ public:
 
 	void Emit( Param1 p1, Param2 p2, Param3 p3, Param4 p4, Param5 p5 ) const
 	{
-		for (DelegateIterator i = delegateList.begin(); i != delegateList.end();)
+		if (delegateList.empty())
 		{
-      // TAGE - already go to next iterator here to be able to proceed with iteration in the case current iterator gets erased in emission function
-      //        ie. due to signal disconnection in emitter function
-      DelegateIterator current = i++;
+			return;
+		}
+
+		// TAGE - only delegates connected before emission starts are called
+		//        delegates disconnected in emitter function are cleared in place so iteration remains valid
+		delegateList.beginEmit();
 
-      // now safetly call emitter function of current iterator
-			(*current)(p1, p2, p3, p4, p5);
+		const size_t count = delegateList.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const _Delegate current = delegateList[i];
+			if ( ! current.empty())
+			{
+				current(p1, p2, p3, p4, p5);
+			}
 		}
+
+		delegateList.endEmit();
 	}
 
 	void operator() ( Param1 p1, Param2 p2, Param3 p3, Param4 p4, Param5 p5 ) const
@@ -418,9 +663,8 @@ public:
 	typedef Delegate6< Param1, Param2, Param3, Param4, Param5, Param6 > _Delegate;
 
 private:
-	typedef std::set<_Delegate> DelegateList;
-	typedef typename DelegateList::iterator DelegateIterator;
-	DelegateList delegateList;
+	typedef Gallant::DelegateList<_Delegate> DelegateList;
+	mutable DelegateList delegateList;
 
 public:
 	void Connect( _Delegate delegate )
@@ -459,15 +703,26 @@ public:
 
 	void Emit( Param1 p1, Param2 p2, Param3 p3, Param4 p4, Param5 p5, Param6 p6 ) const
 	{
-		for (DelegateIterator i = delegateList.begin(); i != delegateList.end();)
+		if (delegateList.empty())
 		{
-      // TAGE - already go to next iterator here to be able to proceed with iteration in the case current iterator gets erased in emission function
-      //        ie. due to signal disconnection in emitter function
-      DelegateIterator current = i++;
+			return;
+		}
+
+		// TAGE - only delegates connected before emission starts are called
+		//        delegates disconnected in emitter function are cleared in place so iteration remains valid
+		delegateList.beginEmit();
 
-      // now safetly call emitter function of current iterator
-			(*current)(p1, p2, p3, p4, p5, p6);
+		const size_t count = delegateList.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const _Delegate current = delegateList[i];
+			if ( ! current.empty())
+			{
+				current(p1, p2, p3, p4, p5, p6);
+			}
 		}
+
+		delegateList.endEmit();
 	}
 
 	void operator() ( Param1 p1, Param2 p2, Param3 p3, Param4 p4, Param5 p5, Param6 p6 ) const
@@ -484,9 +739,8 @@ public:
 	typedef Delegate7< Param1, Param2, Param3, Param4, Param5, Param6, Param7 > _Delegate;
 
 private:
-	typedef std::set<_Delegate> DelegateList;
-	typedef typename DelegateList::iterator DelegateIterator;
-	DelegateList delegateList;
+	typedef Gallant::DelegateList<_Delegate> DelegateList;
+	mutable DelegateList delegateList;
 
 public:
 	void Connect( _Delegate delegate )
@@ -525,15 +779,26 @@ public:
 
 	void Emit( Param1 p1, Param2 p2, Param3 p3, Param4 p4, Param5 p5, Param6 p6, Param7 p7 ) const
 	{
-		for (DelegateIterator i = delegateList.begin(); i != delegateList.end();)
+		if (delegateList.empty())
 		{
-      // TAGE - already go to next iterator here to be able to proceed with iteration in the case current iterator gets erased in emission function
-      //        ie. due to signal disconnection in emitter function
-      DelegateIterator current = i++;
+			return;
+		}
+
+		// TAGE - only delegates connected before emission starts are called
+		//        delegates disconnected in emitter function are cleared in place so iteration remains valid
+		delegateList.beginEmit();
 
-      // now safetly call emitter function of current iterator
-			(*current)(p1, p2, p3, p4, p5, p6, p7);
+		const size_t count = delegateList.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const _Delegate current = delegateList[i];
+			if ( ! current.empty())
+			{
+				current(p1, p2, p3, p4, p5, p6, p7);
+			}
 		}
+
+		delegateList.endEmit();
 	}
 
 	void operator() ( Param1 p1, Param2 p2, Param3 p3, Param4 p4, Param5 p5, Param6 p6, Param7 p7 ) const
@@ -550,9 +815,8 @@ public:
 	typedef Delegate8< Param1, Param2, Param3, Param4, Param5, Param6, Param7, Param8 > _Delegate;
 
 private:
-	typedef std::set<_Delegate> DelegateList;
-	typedef typename DelegateList::iterator DelegateIterator;
-	DelegateList delegateList;
+	typedef Gallant::DelegateList<_Delegate> DelegateList;
+	mutable DelegateList delegateList;
 
 public:
 	void Connect( _Delegate delegate )
@@ -591,15 +855,26 @@ public:
 
 	void Emit( Param1 p1, Param2 p2, Param3 p3, Param4 p4, Param5 p5, Param6 p6, Param7 p7, Param8 p8 ) const
 	{
-		for (DelegateIterator i = delegateList.begin(); i != delegateList.end();)
+		if (delegateList.empty())
 		{
-      // TAGE - already go to next iterator here to be able to proceed with iteration in the case current iterator gets erased in emission function
-      //        ie. due to signal disconnection in emitter function
-      DelegateIterator current = i++;
+			return;
+		}
+
+		// TAGE - only delegates connected before emission starts are called
+		//        delegates disconnected in emitter function are cleared in place so iteration remains valid
+		delegateList.beginEmit();
 
-      // now safetly call emitter function of current iterator
-			(*current)(p1, p2, p3, p4, p5, p6, p7, p8);
+		const size_t count = delegateList.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const _Delegate current = delegateList[i];
+			if ( ! current.empty())
+			{
+				current(p1, p2, p3, p4, p5, p6, p7, p8);
+			}
 		}
+
+		delegateList.endEmit();
 	}
 
 	void operator() ( Param1 p1, Param2 p2, Param3 p3, Param4 p4, Param5 p5, Param6 p6, Param7 p7, Param8 p8 ) const
@@ -0,0 +1,157 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGESignal.h>
+#include <vector>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class SignalTest : public TestBase
+{
+  public:
+
+    /*! Slot recording its call. */
+    void onFirst(s32 value);
+    /*! Slot recording its call. */
+    void onSecond(s32 value);
+    /*! Slot recording its call and disconnecting itself. */
+    void onDisconnectSelf(s32 value);
+    /*! Slot recording its call and disconnecting second slot. */
+    void onDisconnectSecond(s32 value);
+    /*! Slot recording its call and connecting second slot. */
+    void onConnectSecond(s32 value);
+
+  protected:
+
+    virtual void SetUp();
+    virtual void TearDown();
+
+  protected:
+
+    /*! Tested signal. */
+    Signal1<s32> m_signal;
+    /*! Recorded calls. First slot adds 100, second adds 200 etc. to emitted value. */
+    std::vector<s32> m_calls;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void SignalTest::SetUp()
+{
+  m_calls.clear();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void SignalTest::TearDown()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void SignalTest::onFirst(s32 value)
+{
+  m_calls.push_back(100 + value);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void SignalTest::onSecond(s32 value)
+{
+  m_calls.push_back(200 + value);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void SignalTest::onDisconnectSelf(s32 value)
+{
+  m_calls.push_back(300 + value);
+  m_signal.Disconnect(this, &SignalTest::onDisconnectSelf);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void SignalTest::onDisconnectSecond(s32 value)
+{
+  m_calls.push_back(400 + value);
+  m_signal.Disconnect(this, &SignalTest::onSecond);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void SignalTest::onConnectSecond(s32 value)
+{
+  m_calls.push_back(500 + value);
+  m_signal.Connect(this, &SignalTest::onSecond);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(SignalTest, ConnectDisconnect)
+{
+  // emit with no slots
+  m_signal.Emit(1);
+  EXPECT_TRUE(m_calls.empty());
+
+  // connect slots
+  // NOTE: same slot connected twice should be called once only
+  m_signal.Connect(this, &SignalTest::onFirst);
+  m_signal.Connect(this, &SignalTest::onSecond);
+  m_signal.Connect(this, &SignalTest::onFirst);
+
+  m_signal.Emit(1);
+  ASSERT_EQ(2U, m_calls.size());
+  EXPECT_EQ(101, m_calls[0]);
+  EXPECT_EQ(201, m_calls[1]);
+
+  // disconnect
+  m_calls.clear();
+  m_signal.Disconnect(this, &SignalTest::onFirst);
+
+  m_signal.Emit(2);
+  ASSERT_EQ(1U, m_calls.size());
+  EXPECT_EQ(202, m_calls[0]);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(SignalTest, DisconnectDuringEmission)
+{
+  m_signal.Connect(this, &SignalTest::onDisconnectSelf);
+  m_signal.Connect(this, &SignalTest::onDisconnectSecond);
+  m_signal.Connect(this, &SignalTest::onSecond);
+  m_signal.Connect(this, &SignalTest::onFirst);
+
+  // NOTE: second slot is disconnected before it is reached so it should not be called
+  m_signal.Emit(1);
+  ASSERT_EQ(3U, m_calls.size());
+  EXPECT_EQ(301, m_calls[0]);
+  EXPECT_EQ(401, m_calls[1]);
+  EXPECT_EQ(101, m_calls[2]);
+
+  // NOTE: disconnected slots should not be called anymore
+  m_calls.clear();
+  m_signal.Emit(2);
+  ASSERT_EQ(2U, m_calls.size());
+  EXPECT_EQ(402, m_calls[0]);
+  EXPECT_EQ(102, m_calls[1]);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(SignalTest, ConnectDuringEmission)
+{
+  m_signal.Connect(this, &SignalTest::onConnectSecond);
+
+  // NOTE: slots connected during emission are called from next emission on
+  m_signal.Emit(1);
+  ASSERT_EQ(1U, m_calls.size());
+  EXPECT_EQ(501, m_calls[0]);
+
+  m_calls.clear();
+  m_signal.Emit(2);
+  ASSERT_EQ(2U, m_calls.size());
+  EXPECT_EQ(502, m_calls[0]);
+  EXPECT_EQ(202, m_calls[1]);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(SignalTest, Copy)
+{
+  // NOTE: more slots than fit inline
+  m_signal.Connect(this, &SignalTest::onFirst);
+  m_signal.Connect(this, &SignalTest::onSecond);
+  m_signal.Connect(this, &SignalTest::onDisconnectSecond);
+  m_signal.Connect(this, &SignalTest::onConnectSecond);
+
+  Signal1<s32> copy = m_signal;
+
+  // NOTE: disconnection from original signal should not affect copy
+  m_signal.Disconnect(this, &SignalTest::onFirst);
+
+  copy.Emit(0);
+  ASSERT_EQ(4U, m_calls.size());
+  EXPECT_EQ(100, m_calls[0]);
+  EXPECT_EQ(200, m_calls[1]);
+  EXPECT_EQ(400, m_calls[2]);
+  EXPECT_EQ(500, m_calls[3]);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
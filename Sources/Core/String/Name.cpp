@@ -0,0 +1,203 @@
+#include "Core/String/Name.h"
+#include "EGEAtomic.h"
+#include "EGEDebug.h"
+#include "EGEThread.h"
+#include <string.h>
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of hash table slots. Needs to be power of 2.
+ *  @note Table is kept at most half full to keep probe sequences short.
+ */
+#define SLOT_COUNT (EGE_NAME_MAX_COUNT * 2)
+/*! FNV-1a hash offset basis. This is also the hash of an empty string. */
+#define FNV_OFFSET_BASIS 2166136261U
+/*! FNV-1a hash prime. */
+#define FNV_PRIME 16777619U
+/*! Slot value marking slot reserved by a thread which is interning a string into it. */
+#define RESERVED_ID 0xffffffffU
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Interned string entry. */
+struct NameEntry
+{
+  NameEntry(const char* string, u32 length, u32 hash) : string(std::string(string, length)), hash(hash) {}
+
+  /*! Interned string. */
+  String string;
+  /*! Hash of the string. */
+  u32 hash;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// NOTE: all data is zero initialized so names can be created during static initialization
+/*! Hash table slots. Each holds id of the entry, 0 if empty or RESERVED_ID while entry is being created. Slots are only ever published once. */
+static volatile u32 l_slots[SLOT_COUNT];
+/*! Entries indexed by id. Entry is always stored before its id gets published in a slot. */
+static NameEntry* l_entries[EGE_NAME_MAX_COUNT + 1];
+/*! Number of ids handed out so far. Ids are handed out to reserved slots only, so every id up to EGE_NAME_MAX_COUNT gets published. */
+static volatile u32 l_entryCount = 0;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Calculates hash of a given string (32-bit FNV-1a). */
+static u32 CalculateHash(const char* string, u32 length)
+{
+  u32 hash = FNV_OFFSET_BASIS;
+  for (u32 i = 0; i < length; ++i)
+  {
+    hash ^= static_cast<u8>(string[i]);
+    hash *= FNV_PRIME;
+  }
+
+  return hash;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Reports table overflow. 
+ *  @note Message is printed directly as regular debug output creates names itself. It is printed once only but in every build configuration as any name 
+ *        which could not be interned becomes empty and is equal to all other such names.
+ */
+static void ReportTableFull()
+{
+  static volatile u32 l_reported = 0;
+
+  if (egeAtomicCompareAndSet(l_reported, 0, 1))
+  {
+    Debug::Print("Name table is full! Increase EGE_NAME_MAX_COUNT.");
+  }
+
+  EGE_ASSERT_X(false, "Name table is full!");
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Name::Name() : m_id(0),
+               m_hash(FNV_OFFSET_BASIS)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Name::Name(const char* string)
+{
+  *this = Lookup(string, (NULL != string) ? static_cast<u32>(strlen(string)) : 0, true);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Name::Name(const String& string)
+{
+  *this = Lookup(string.c_str(), static_cast<u32>(string.length()), true);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Name::Name(u32 id, u32 hash) : m_id(id),
+                               m_hash(hash)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Name Name::Find(const String& string)
+{
+  return Lookup(string.c_str(), static_cast<u32>(string.length()), false);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 Name::Hash(const String& string)
+{
+  return CalculateHash(string.c_str(), static_cast<u32>(string.length()));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 Name::Count()
+{
+  // NOTE: ids beyond capacity are not counted
+  const u32 count = egeAtomicLoad(l_entryCount);
+  return (EGE_NAME_MAX_COUNT < count) ? EGE_NAME_MAX_COUNT : count;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const String& Name::toString() const
+{
+  static const String KEmpty;
+
+  return (0 == m_id) ? KEmpty : l_entries[m_id]->string;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Name Name::Lookup(const char* string, u32 length, bool intern)
+{
+  // check if empty
+  if (0 == length)
+  {
+    // done
+    return Name();
+  }
+
+  const u32 hash = CalculateHash(string, length);
+
+  // go thru slots starting from the one pointed by hash (linear probing)
+  for (u32 i = 0, slot = hash & (SLOT_COUNT - 1); i < SLOT_COUNT; ++i, slot = (slot + 1) & (SLOT_COUNT - 1))
+  {
+    u32 id = egeAtomicLoad(l_slots[slot]);
+
+    // check if empty slot reached
+    if (0 == id)
+    {
+      // check if string is not to be interned
+      if ( ! intern)
+      {
+        // not found
+        return Name();
+      }
+
+      // try to reserve slot
+      // NOTE: id and entry are allocated only once slot is reserved, so nothing is lost when another thread takes the slot in the meantime
+      if (egeAtomicCompareAndSet(l_slots[slot], 0, RESERVED_ID))
+      {
+        const u32 newId = egeAtomicIncrement(l_entryCount);
+        if (EGE_NAME_MAX_COUNT < newId)
+        {
+          // give id and slot back
+          egeAtomicDecrement(l_entryCount);
+          egeAtomicCompareAndSet(l_slots[slot], RESERVED_ID, 0);
+
+          ReportTableFull();
+          return Name();
+        }
+
+        l_entries[newId] = new NameEntry(string, length, hash);
+
+        // publish entry
+        egeAtomicCompareAndSet(l_slots[slot], RESERVED_ID, newId);
+        return Name(newId, hash);
+      }
+
+      // slot has been taken by another thread, check what has been stored there
+      id = egeAtomicLoad(l_slots[slot]);
+    }
+
+    // wait for entry if slot is being interned into by another thread
+    // NOTE: entry is being allocated only so it should be available shortly
+    while (RESERVED_ID == id)
+    {
+      Thread::YieldCurrent();
+      id = egeAtomicLoad(l_slots[slot]);
+    }
+
+    // check if slot has been given back
+    // NOTE: this happens only when table is full
+    if (0 == id)
+    {
+      if (intern)
+      {
+        ReportTableFull();
+      }
+
+      return Name();
+    }
+
+    // check if found
+    const NameEntry* entry = l_entries[id];
+    if ((entry->hash == hash) && (entry->string.length() == length) && (0 == memcmp(entry->string.c_str(), string, length)))
+    {
+      return Name(id, hash);
+    }
+  }
+
+  // table is full
+  if (intern)
+  {
+    ReportTableFull();
+  }
+
+  return Name();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef EGE_CORE_STRING_NAME_H
+#define EGE_CORE_STRING_NAME_H
+
+/** Name is an interned string identifier. Every distinct string is stored once in a global table and represented by a small unique id, so names can be copied
+ *  and compared as cheaply as integers. Names are meant to be used as keys for look-ups ie. of resources, components or shader uniforms.
+ *  Interning is lock-free so names can be created from any thread. Interned strings are never released, so look-ups of arbitrary strings should use Find.
+ *  @note Ids are unique for the lifetime of the process only. They should not be persisted.
+ *  @note Ordering of names is the order of ids, not the lexicographical one.
+ */
+
+#include "EGETypes.h"
+#include "EGEString.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Maximal number of distinct names which can be interned. */
+#define EGE_NAME_MAX_COUNT 32768
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class Name
+{
+  public:
+
+    Name();
+    /*! Constructs name of a given string, interning it if needed. 
+     *  @note If name table is full, it is reported and name is empty.
+     */
+    Name(const char* string);
+    /*! @see Name(const char*). */
+    Name(const String& string);
+
+  operators:
+
+    bool operator == (const Name& other) const { return m_id == other.m_id; }
+    bool operator != (const Name& other) const { return m_id != other.m_id; }
+    bool operator < (const Name& other) const { return m_id < other.m_id; }
+
+  public:
+
+    /*! Returns name of a given string if it has been interned already.
+     *  @param  string  String to look for.
+     *  @return Name of a given string. Empty name if string has not been interned yet.
+     *  @note This never interns a string so it can be used for look-ups of arbitrary strings without growing the table.
+     */
+    static Name Find(const String& string);
+    /*! Returns number of interned names. */
+    static u32 Count();
+    /*! Calculates hash of a given string. 
+     *  @note Returned value is the same as the hash of the name created from the string. String is not interned.
+     */
+    static u32 Hash(const String& string);
+
+  public:
+
+    /*! Returns unique id. Empty name has id 0. */
+    u32 id() const { return m_id; }
+    /*! Returns hash of the string. */
+    u32 hash() const { return m_hash; }
+    /*! Returns TRUE if name is empty. */
+    bool isEmpty() const { return 0 == m_id; }
+    /*! Returns interned string. */
+    const String& toString() const;
+
+  private:
+
+    Name(u32 id, u32 hash);
+
+    /*! Looks up given string in table and optionally interns it if not found.
+     *  @param  string  String to look up.
+     *  @param  length  Length of the string (in bytes).
+     *  @param  intern  If TRUE string is interned if not found.
+     *  @return Name of the string. Empty name if string is empty, not found or table is full.
+     */
+    static Name Lookup(const char* string, u32 length, bool intern);
+
+  private:
+
+    /*! Unique id. */
+    u32 m_id;
+    /*! Cached hash of the string. */
+    u32 m_hash;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_STRING_NAME_H
\ No newline at end of file
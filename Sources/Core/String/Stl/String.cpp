@@ -139,49 +139,12 @@ s64 String::toInt64(bool* error) const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool String::toBool(bool* error) const
 {
-  if (empty())
-  {
-    if (error)
-    {
-      *error = true;
-    }
-
-    return false;
-  }
-
-  // make lowercase copy
-  String copy = *this;
-  copy.toLower();
-
-  bool value = (copy == "true");
-
-  return value;
+  return StringUtils::ToBool(c_str(), error);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 float32 String::toFloat(bool* error) const
 {
-  if (empty())
-  {
-    if (error)
-    {
-      *error = true;
-    }
-
-    return 0;
-  }
-
-  const char* text = c_str();
-  char* end;
-
-  float32 value = (float32) strtod(text, &end);
-
-  // check for error
-  if (error && (0 != *end))
-  {
-    *error = true;
-  }
-
-  return value;
+  return StringUtils::ToFloat(c_str(), error);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 String String::FromNumber(s32 value)
@@ -3,6 +3,8 @@
 #include "EGEVector3.h"
 #include "EGEDebug.h"
 #include <cerrno>
+#include <cstdlib>
+#include <cctype>
 
 EGE_NAMESPACE_BEGIN
 
@@ -21,9 +23,62 @@ s32 StringUtils::FromHex(const char* hexInText, bool* error)
   return value;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+float32 StringUtils::ToFloat(const char* text, bool* error)
+{
+  if ((NULL == text) || ('\0' == *text))
+  {
+    if (error)
+    {
+      *error = true;
+    }
+
+    return 0;
+  }
+
+  char* end;
+  float32 value = static_cast<float32>(strtod(text, &end));
+
+  // check for error
+  if (error && ('\0' != *end))
+  {
+    *error = true;
+  }
+
+  return value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool StringUtils::ToBool(const char* text, bool* error)
+{
+  if ((NULL == text) || ('\0' == *text))
+  {
+    if (error)
+    {
+      *error = true;
+    }
+
+    return false;
+  }
+
+  // compare case insensitive
+  // NOTE: done without making lowercase copy
+  const char* pattern = "true";
+  while (('\0' != *text) && (tolower(*text) == *pattern))
+  {
+    ++text;
+    ++pattern;
+  }
+
+  return ('\0' == *text) && ('\0' == *pattern);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Color StringUtils::ToColor(const String& string, bool* error)
 {
-  if (string.empty())
+  return ToColor(string.toAscii(), error);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Color StringUtils::ToColor(const char* text, bool* error)
+{
+  if ((NULL == text) || ('\0' == *text))
   {
     if (error)
     {
@@ -37,7 +92,7 @@ Color StringUtils::ToColor(const String& string, bool* error)
   Color color = Color::BLACK;
 
   // check if not even RGB was able to be read
-  if (3 > sscanf(string.toAscii(), "%f %f %f %f", &color.red, &color.green, &color.blue, &color.alpha) && error)
+  if (3 > sscanf(text, "%f %f %f %f", &color.red, &color.green, &color.blue, &color.alpha) && error)
   {
     *error = true;
   }
@@ -47,7 +102,12 @@ Color StringUtils::ToColor(const String& string, bool* error)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Rectf StringUtils::ToRectf(const String& string, bool* error)
 {
-  if (string.empty())
+  return ToRectf(string.toAscii(), error);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Rectf StringUtils::ToRectf(const char* text, bool* error)
+{
+  if ((NULL == text) || ('\0' == *text))
   {
     if (error)
     {
@@ -58,7 +118,7 @@ Rectf StringUtils::ToRectf(const String& string, bool* error)
   }
 
   Rectf rect;
-  if (4 > sscanf(string.toAscii(), "%f %f %f %f", &rect.x, &rect.y, &rect.width, &rect.height) && error)
+  if (4 > sscanf(text, "%f %f %f %f", &rect.x, &rect.y, &rect.width, &rect.height) && error)
   {
     *error = true;
   }
@@ -68,7 +128,12 @@ Rectf StringUtils::ToRectf(const String& string, bool* error)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Recti StringUtils::ToRecti(const String& string, bool* error)
 {
-  if (string.empty())
+  return ToRecti(string.toAscii(), error);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Recti StringUtils::ToRecti(const char* text, bool* error)
+{
+  if ((NULL == text) || ('\0' == *text))
   {
     if (error)
     {
@@ -79,7 +144,7 @@ Recti StringUtils::ToRecti(const String& string, bool* error)
   }
 
   Recti rect;
-  if (4 > sscanf(string.toAscii(), "%d %d %d %d", &rect.x, &rect.y, &rect.width, &rect.height) && error)
+  if (4 > sscanf(text, "%d %d %d %d", &rect.x, &rect.y, &rect.width, &rect.height) && error)
   {
     *error = true;
   }
@@ -89,7 +154,12 @@ Recti StringUtils::ToRecti(const String& string, bool* error)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Vector2f StringUtils::ToVector2f(const String& string, bool* error)
 {
-  if (string.empty())
+  return ToVector2f(string.toAscii(), error);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Vector2f StringUtils::ToVector2f(const char* text, bool* error)
+{
+  if ((NULL == text) || ('\0' == *text))
   {
     if (error)
     {
@@ -100,7 +170,7 @@ Vector2f StringUtils::ToVector2f(const String& string, bool* error)
   }
 
   Vector2f vec;
-  if (2 > sscanf(string.toAscii(), "%f %f", &vec.x, &vec.y) && error)
+  if (2 > sscanf(text, "%f %f", &vec.x, &vec.y) && error)
   {
     *error = true;
   }
@@ -25,6 +25,20 @@ class StringUtils
      *  @param  Returns converted value. This value is only reliable if there were no errors during the conversion.
      */
     static s32 FromHex(const char* hexInText, bool* error = NULL);
+    /*! Converts text to float. 
+     *  @param  text   Text to convert.
+     *  @param  error  Error flag placeholder. If not NULL this will hold conversion result.
+     *  @return Converted value.
+     *  @note Returned value should be only considered valid if no error has been reported during the conversion.
+     */
+    static float32 ToFloat(const char* text, bool* error = NULL);
+    /*! Converts text to boolean. Only case insensitive "true" is converted into TRUE.
+     *  @param  text   Text to convert.
+     *  @param  error  Error flag placeholder. If not NULL this will hold conversion result.
+     *  @return Converted value.
+     *  @note Returned value should be only considered valid if no error has been reported during the conversion.
+     */
+    static bool ToBool(const char* text, bool* error = NULL);
 
     /*! Converts string to color. 
      *  @param  string  String to convert.
@@ -33,6 +47,8 @@ class StringUtils
      *  @note Returned value should be only considered valid if no error has been reported during the conversion.
      */
     static Color ToColor(const String& string, bool* error = NULL);
+    /*! @see ToColor. */
+    static Color ToColor(const char* text, bool* error = NULL);
     /*! Converts string to rectangle of floats. 
      *  @param  string  String to convert
      *  @param  error   Error flag placeholder. If not NULL this will hold conversion result.
@@ -40,6 +56,8 @@ class StringUtils
      *  @note Returned value should be only considered valid if no error has been reported during the conversion.
      */
     static Rectf ToRectf(const String& string, bool* error = NULL);
+    /*! @see ToRectf. */
+    static Rectf ToRectf(const char* text, bool* error = NULL);
     /*! Converts string to rectangle of signed integers. 
      *  @param  string  String to convert.
      *  @param  error   Error flag placeholder. If not NULL this will hold conversion result.
@@ -47,6 +65,8 @@ class StringUtils
      *  @note Returned value should be only considered valid if no error has been reported during the conversion.
      */
     static Recti ToRecti(const String& string, bool* error = NULL);
+    /*! @see ToRecti. */
+    static Recti ToRecti(const char* text, bool* error = NULL);
     /*! Converts string to 2D vector of floats.
      *  @param  string  String to convert
      *  @param  error   Error flag placeholder. If not NULL this will hold conversion result.
@@ -54,6 +74,8 @@ class StringUtils
      *  @note Returned value should be only considered valid if no error has been reported during the conversion.
      */
     static Vector2f ToVector2f(const String& string, bool* error = NULL);
+    /*! @see ToVector2f. */
+    static Vector2f ToVector2f(const char* text, bool* error = NULL);
     /*! Converts string to 2D vector of signed integers. 
      *  @param  string  String to convert.
      *  @param  error   Error flag placeholder. If not NULL this will hold conversion result.
@@ -0,0 +1,170 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGEName.h>
+#include <EGEJobSystem.h>
+#include <EGEMemory.h>
+#include <set>
+#include <vector>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of distinct names interned concurrently. */
+#define CONCURRENT_NAMES_COUNT 4000
+/*! Number of times each name is interned concurrently. */
+#define CONCURRENT_REPEATS     4
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class NameTest : public TestBase
+{
+  public:
+
+    /*! Range job interning names for given indicies. */
+    void onIntern(u32 begin, u32 end);
+
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    /*! Names interned by jobs. */
+    std::vector<Name> m_names;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void NameTest::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void NameTest::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void NameTest::onIntern(u32 begin, u32 end)
+{
+  for (u32 i = begin; i < end; ++i)
+  {
+    m_names[i] = Name(String::Format("concurrent-%u", i % CONCURRENT_NAMES_COUNT));
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(NameTest, Empty)
+{
+  Name name;
+
+  EXPECT_TRUE(name.isEmpty());
+  EXPECT_EQ(0U, name.id());
+  EXPECT_TRUE(name.toString().empty());
+
+  EXPECT_EQ(name, Name(""));
+  EXPECT_EQ(name, Name(String()));
+  EXPECT_EQ(name.hash(), Name::Hash(""));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(NameTest, Intern)
+{
+  Name name1("texture");
+  Name name2(String("texture"));
+  Name name3("material");
+
+  EXPECT_FALSE(name1.isEmpty());
+  EXPECT_FALSE(name3.isEmpty());
+
+  // same strings map to the same name
+  EXPECT_EQ(name1, name2);
+  EXPECT_EQ(name1.id(), name2.id());
+  EXPECT_EQ(name1.hash(), name2.hash());
+
+  // different strings map to different names
+  EXPECT_NE(name1, name3);
+  EXPECT_NE(name1.id(), name3.id());
+
+  // original strings are retained
+  EXPECT_EQ(String("texture"), name1.toString());
+  EXPECT_EQ(String("material"), name3.toString());
+
+  // hash of the name is the hash of the string
+  EXPECT_EQ(Name::Hash("texture"), name1.hash());
+  EXPECT_EQ(Name::Hash("material"), name3.hash());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(NameTest, Find)
+{
+  const String string = "never-interned-before";
+
+  // check not found if not interned yet
+  EXPECT_TRUE(Name::Find(string).isEmpty());
+
+  // check find does not intern
+  const u32 count = Name::Count();
+  EXPECT_TRUE(Name::Find(string).isEmpty());
+  EXPECT_EQ(count, Name::Count());
+
+  // intern and check found
+  Name name(string);
+  EXPECT_EQ(count + 1, Name::Count());
+  EXPECT_EQ(name, Name::Find(string));
+
+  // check interning again does not grow the table
+  EXPECT_EQ(name, Name(string));
+  EXPECT_EQ(count + 1, Name::Count());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(NameTest, SimilarStrings)
+{
+  // NOTE: these differ by a single character or length only
+  const char* strings[] = { "a", "b", "ab", "ba", "abc", "abd", "name1", "name2", "name10", "name01" };
+  const u32 count = sizeof (strings) / sizeof (strings[0]);
+
+  for (u32 i = 0; i < count; ++i)
+  {
+    for (u32 j = 0; j < count; ++j)
+    {
+      EXPECT_EQ(i == j, Name(strings[i]) == Name(strings[j]));
+    }
+
+    EXPECT_EQ(String(strings[i]), Name(strings[i]).toString());
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(NameTest, ConcurrentIntern)
+{
+  PJobSystem jobSystem = ege_new JobSystem(NULL);
+  ASSERT_TRUE(NULL != jobSystem);
+  ASSERT_EQ(EGE_SUCCESS, jobSystem->construct(3));
+
+  m_names.resize(CONCURRENT_NAMES_COUNT * CONCURRENT_REPEATS);
+
+  const u32 count = Name::Count();
+
+  // intern
+  // NOTE: small batches so each name is likely to be interned by several threads at the same time
+  jobSystem->parallelFor(static_cast<u32>(m_names.size()), 8, ege_make_slot(this, NameTest::onIntern));
+
+  // validate all threads got the same names for the same strings
+  std::set<u32> ids;
+  for (u32 i = 0; i < CONCURRENT_NAMES_COUNT; ++i)
+  {
+    const Name& name = m_names[i];
+
+    EXPECT_FALSE(name.isEmpty());
+    EXPECT_EQ(String::Format("concurrent-%u", i), name.toString());
+
+    for (u32 j = 1; j < CONCURRENT_REPEATS; ++j)
+    {
+      EXPECT_EQ(name, m_names[i + j * CONCURRENT_NAMES_COUNT]);
+    }
+
+    ids.insert(name.id());
+  }
+
+  // validate all names are distinct
+  EXPECT_EQ(static_cast<size_t>(CONCURRENT_NAMES_COUNT), ids.size());
+
+  // validate no id has been lost in races
+  EXPECT_EQ(count + CONCURRENT_NAMES_COUNT, Name::Count());
+
+  m_names.clear();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,447 @@
+#include "Core/Threading/JobSystem.h"
+#include "Core/Threading/JobWorkerThread.h"
+#include "EGEDebug.h"
+#include "EGEMath.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* KJobSystemDebugName = "EGEJobSystem";
+/*! Number of unsuccessful attempts to find a job after which thread starts yielding rather than spinning. */
+const u32 KJobSystemSpinCount = 64;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(JobSystem)
+EGE_DEFINE_DELETE_OPERATORS(JobSystem)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+JobSystem::JobSystem(Application* app) : Object(app, EGE_OBJECT_UID_JOB_SYSTEM),
+                                         m_queuedJobs(0),
+                                         m_sleepingWorkers(0),
+                                         m_startedWorkers(0),
+                                         m_stopping(false)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+JobSystem::~JobSystem()
+{
+  shutdown();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult JobSystem::construct(s32 workerCount)
+{
+  // check if number of workers is to be determined automatically
+  if (0 > workerCount)
+  {
+    // NOTE: calling thread is also executing jobs while waiting for them
+    workerCount = Math::Max(static_cast<s32>(Thread::HardwareConcurrency()) - 1, 0);
+  }
+
+  // create sleep objects
+  m_sleepMutex    = ege_new Mutex(app());
+  m_wakeCondition = ege_new WaitCondition(app());
+  if ((NULL == m_sleepMutex) || (NULL == m_wakeCondition))
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  // create queues
+  // NOTE: first queue belongs to calling thread
+  m_queues.resize(workerCount + 1);
+  m_threadIds.resize(workerCount + 1, NULL);
+  for (u32 i = 0; i < m_queues.size(); ++i)
+  {
+    JobQueue& queue = m_queues[i];
+
+    queue.mutex = ege_new Mutex(app());
+    if (NULL == queue.mutex)
+    {
+      // error!
+      return EGE_ERROR_NO_MEMORY;
+    }
+
+    queue.jobs.resize(EGE_JOB_QUEUE_CAPACITY);
+    queue.first = 0;
+    queue.count = 0;
+  }
+
+  m_threadIds[0] = Thread::CurrentId();
+
+  // create workers
+  for (s32 i = 0; i < workerCount; ++i)
+  {
+    PThread worker = ege_new JobWorkerThread(app(), this, i + 1);
+    if ((NULL == worker) || ! worker->isValid())
+    {
+      // error!
+      return EGE_ERROR_NO_MEMORY;
+    }
+
+    m_workers.push_back(worker);
+
+    if ( ! worker->start())
+    {
+      // error!
+      egeCritical(KJobSystemDebugName) << EGE_FUNC_INFO << "Could not start worker thread!";
+      return EGE_ERROR;
+    }
+  }
+
+  // wait until all workers registered themselves
+  // NOTE: this way thread identifiers are known before any job is submitted
+  while (egeAtomicLoad(m_startedWorkers) != m_workers.size())
+  {
+    Thread::YieldCurrent();
+  }
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystem::shutdown()
+{
+  // request stop
+  if (NULL != m_sleepMutex)
+  {
+    m_sleepMutex->lock();
+    m_stopping = true;
+    m_wakeCondition->wakeAll();
+    m_sleepMutex->unlock();
+  }
+
+  // wait for workers
+  // NOTE: workers drain all queues before finishing
+  for (DynamicArray<PThread>::iterator it = m_workers.begin(); it != m_workers.end(); ++it)
+  {
+    (*it)->wait();
+  }
+
+  m_workers.clear();
+
+  // execute whatever is left
+  Job job;
+  while ( ! m_queues.empty() && acquire(0, job))
+  {
+    execute(job);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 JobSystem::workerCount() const
+{
+  return static_cast<u32>(m_workers.size());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystem::run(const JobFunction& function, void* data, JobCounter* counter, const JobCounter* dependency)
+{
+  Job job;
+  job.function   = function;
+  job.data       = data;
+  job.counter    = counter;
+  job.dependency = dependency;
+
+  if (NULL != counter)
+  {
+    egeAtomicIncrement(counter->m_value);
+  }
+
+  // check if job cannot be queued
+  if (m_workers.empty())
+  {
+    // execute immediately
+    execute(job);
+    return;
+  }
+
+  // account job before it is pushed
+  // NOTE: once pushed, job can be acquired, and thus accounted out, by other thread right away. Accounting it afterwards could wrap the counter around
+  egeAtomicIncrement(m_queuedJobs);
+  if ( ! push(currentQueueIndex(), job))
+  {
+    egeAtomicDecrement(m_queuedJobs);
+
+    // execute immediately
+    execute(job);
+    return;
+  }
+
+  // wake up worker if any is sleeping
+  // NOTE: job is accounted before sleeping workers are checked, and workers check it after declaring themselves sleeping, so no wake up is lost
+  if (0 < egeAtomicLoad(m_sleepingWorkers))
+  {
+    m_sleepMutex->lock();
+    m_wakeCondition->wakeOne();
+    m_sleepMutex->unlock();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystem::wait(const JobCounter& counter)
+{
+  const u32 index = currentQueueIndex();
+
+  u32 attempt = 0;
+  while ( ! counter.isDone())
+  {
+    // help with any pending job
+    // NOTE: if there is none, remaining jobs are being executed by other threads so just back off until they are done
+    Job job;
+    if (acquire(index, job) && execute(job))
+    {
+      attempt = 0;
+    }
+    else
+    {
+      Backoff(attempt);
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystem::parallelFor(u32 count, u32 batchSize, const JobRangeFunction& function)
+{
+  if (0 == count)
+  {
+    // nothing to do
+    return;
+  }
+
+  // determine batches
+  batchSize = Math::Max(batchSize, 1U);
+  u32 batchCount = (count + batchSize - 1) / batchSize;
+  if (EGE_JOB_PARALLEL_FOR_MAX_BATCHES < batchCount)
+  {
+    batchSize  = (count + EGE_JOB_PARALLEL_FOR_MAX_BATCHES - 1) / EGE_JOB_PARALLEL_FOR_MAX_BATCHES;
+    batchCount = (count + batchSize - 1) / batchSize;
+  }
+
+  // check if there is nothing to parallelize
+  if ((1 == batchCount) || m_workers.empty())
+  {
+    function(0, count);
+    return;
+  }
+
+  // submit batches
+  // NOTE: batches are kept on stack as this function does not return before all of them are done
+  ParallelForBatch batches[EGE_JOB_PARALLEL_FOR_MAX_BATCHES];
+  JobCounter counter;
+
+  for (u32 i = 0; i < batchCount; ++i)
+  {
+    ParallelForBatch& batch = batches[i];
+
+    batch.function = function;
+    batch.begin    = i * batchSize;
+    batch.end      = Math::Min(batch.begin + batchSize, count);
+
+    run(ege_make_slot(this, JobSystem::executeParallelForBatch), &batch, &counter);
+  }
+
+  wait(counter);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystem::workerLoop(u32 index)
+{
+  // register
+  m_threadIds[index] = Thread::CurrentId();
+  egeAtomicIncrement(m_startedWorkers);
+
+  u32 attempt = 0;
+  while (true)
+  {
+    Job job;
+    if (acquire(index, job))
+    {
+      if (execute(job))
+      {
+        attempt = 0;
+      }
+      else
+      {
+        // NOTE: only jobs waiting for dependencies are available, let others progress
+        Backoff(attempt);
+      }
+      continue;
+    }
+
+    // check if done
+    // NOTE: stop request is only honored once there is nothing left to do
+    if (m_stopping)
+    {
+      break;
+    }
+
+    // sleep until more work arrives
+    m_sleepMutex->lock();
+    egeAtomicIncrement(m_sleepingWorkers);
+
+    while ((0 == egeAtomicLoad(m_queuedJobs)) && ! m_stopping)
+    {
+      m_wakeCondition->wait(m_sleepMutex);
+    }
+
+    egeAtomicDecrement(m_sleepingWorkers);
+    m_sleepMutex->unlock();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 JobSystem::currentQueueIndex() const
+{
+  void* id = Thread::CurrentId();
+
+  for (u32 i = 1; i < m_threadIds.size(); ++i)
+  {
+    if (m_threadIds[i] == id)
+    {
+      return i;
+    }
+  }
+
+  return 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool JobSystem::push(u32 index, const Job& job, bool front)
+{
+  JobQueue& queue = m_queues[index];
+
+  bool result = false;
+
+  queue.mutex->lock();
+  if (EGE_JOB_QUEUE_CAPACITY > queue.count)
+  {
+    if (front)
+    {
+      queue.first = (queue.first + EGE_JOB_QUEUE_CAPACITY - 1) % EGE_JOB_QUEUE_CAPACITY;
+      queue.jobs[queue.first] = job;
+    }
+    else
+    {
+      queue.jobs[(queue.first + queue.count) % EGE_JOB_QUEUE_CAPACITY] = job;
+    }
+    ++queue.count;
+
+    result = true;
+  }
+  queue.mutex->unlock();
+
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool JobSystem::acquire(u32 index, Job& job)
+{
+  // check if there is nothing to do at all
+  if (0 == egeAtomicLoad(m_queuedJobs))
+  {
+    return false;
+  }
+
+  const u32 queueCount = static_cast<u32>(m_queues.size());
+
+  // take most recent job from own queue first
+  // NOTE: it is most likely to operate on data still in cache
+  JobQueue& ownQueue = m_queues[index];
+
+  bool found = false;
+
+  ownQueue.mutex->lock();
+  if (0 < ownQueue.count)
+  {
+    --ownQueue.count;
+    job = ownQueue.jobs[(ownQueue.first + ownQueue.count) % EGE_JOB_QUEUE_CAPACITY];
+
+    found = true;
+  }
+  ownQueue.mutex->unlock();
+
+  // steal oldest job from other queues
+  for (u32 i = 1; ! found && (i < queueCount); ++i)
+  {
+    JobQueue& queue = m_queues[(index + i) % queueCount];
+
+    queue.mutex->lock();
+    if (0 < queue.count)
+    {
+      job = queue.jobs[queue.first];
+      queue.first = (queue.first + 1) % EGE_JOB_QUEUE_CAPACITY;
+      --queue.count;
+
+      found = true;
+    }
+    queue.mutex->unlock();
+  }
+
+  if (found)
+  {
+    egeAtomicDecrement(m_queuedJobs);
+  }
+
+  return found;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool JobSystem::execute(const Job& job)
+{
+  // check if dependency is not met yet
+  if ((NULL != job.dependency) && ! job.dependency->isDone())
+  {
+    // put it back
+    // NOTE: waiting here could deadlock as jobs dependency tracks may be suspended further down the stack of this very thread
+    if ( ! m_workers.empty() && requeue(job))
+    {
+      return false;
+    }
+
+    // NOTE: either all queues are full, which means there is plenty of work other threads can progress with, or workers are gone already
+    wait(*job.dependency);
+  }
+
+  job.function(job.data);
+
+  if (NULL != job.counter)
+  {
+    egeAtomicDecrement(job.counter->m_value);
+  }
+
+  return true;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool JobSystem::requeue(const Job& job)
+{
+  const u32 index      = currentQueueIndex();
+  const u32 queueCount = static_cast<u32>(m_queues.size());
+
+  // account job before it is pushed
+  // NOTE: see run()
+  egeAtomicIncrement(m_queuedJobs);
+
+  // push to the front of the own queue preferably
+  // NOTE: this way owner continues with more recent jobs, which the dependency is likely to be among, while job becomes first to be stolen by others
+  for (u32 i = 0; i < queueCount; ++i)
+  {
+    if (push((index + i) % queueCount, job, true))
+    {
+      return true;
+    }
+  }
+
+  egeAtomicDecrement(m_queuedJobs);
+  return false;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystem::Backoff(u32& attempt)
+{
+  // spin for a while first as jobs are short and more work is likely to appear soon, then give up time slices to threads doing actual work
+  if (KJobSystemSpinCount > attempt)
+  {
+    ++attempt;
+  }
+  else
+  {
+    Thread::YieldCurrent();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystem::executeParallelForBatch(void* data)
+{
+  const ParallelForBatch* batch = reinterpret_cast<const ParallelForBatch*>(data);
+
+  batch->function(batch->begin, batch->end);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,198 @@
+#ifndef EGE_CORE_JOBSYSTEM_H
+#define EGE_CORE_JOBSYSTEM_H
+
+/** Job system is a shared pool of worker threads executing short pieces of work (jobs) on behalf of any engine subsystem.
+ *  Every worker owns a queue of jobs. Jobs submitted from within a job are pushed into queue of the executing worker and are taken from its back. Idle 
+ *  workers steal jobs from the front of other queues. Jobs submitted from any other thread are pushed into the queue owned by the main thread.
+ *  Completion of jobs is tracked thru counters. Thread waiting for a counter executes pending jobs until counter drops to zero, so waiting never blocks
+ *  the progress of the work being waited for. Jobs whose dependency is not met yet are put back to the front of the queue rather than waited for.
+ *  If no worker threads are created, jobs are executed immediately on submission.
+ */
+
+#include "EGE.h"
+#include "EGEAtomic.h"
+#include "EGEDynamicArray.h"
+#include "EGEMutex.h"
+#include "EGESignal.h"
+#include "EGEThread.h"
+#include "EGEWaitCondition.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Maximal number of jobs each queue can hold. If queue is full, submitted job is executed immediately. */
+#define EGE_JOB_QUEUE_CAPACITY 1024
+/*! Maximal number of batches single parallel loop is split into. */
+#define EGE_JOB_PARALLEL_FOR_MAX_BATCHES 64
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DECLARE_SMART_CLASS(JobSystem, PJobSystem)
+class JobWorkerThread;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Job function. Called with data pointer submitted together with job. */
+typedef Delegate1<void*> JobFunction;
+/*! Job range function. Called with [begin, end) range of indices to process. */
+typedef Delegate2<u32, u32> JobRangeFunction;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Counter of unfinished jobs. Counter is increased on every submission and decreased once job is done. */
+class JobCounter
+{
+  public:
+
+    JobCounter() : m_value(0) {}
+
+    /*! Returns TRUE if all jobs associated with counter are done. */
+    inline bool isDone() const;
+    /*! Returns number of unfinished jobs. */
+    inline u32 value() const;
+
+  private:
+
+    /*! Number of unfinished jobs. */
+    mutable volatile u32 m_value;
+
+    friend class JobSystem;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class JobSystem : public Object
+{
+  public:
+
+    JobSystem(Application* app);
+   ~JobSystem();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+  public:
+
+    /*! Constructs object. 
+     *  @param  workerCount Number of worker threads to create. Negative value creates one worker per each hardware thread but the calling one.
+     *  @return EGE_SUCCESS on success.
+     */
+    EGEResult construct(s32 workerCount = -1);
+    /*! Stops and releases all worker threads. 
+     *  @note All pending jobs are executed before workers are released.
+     */
+    void shutdown();
+
+    /*! Returns number of worker threads. */
+    u32 workerCount() const;
+
+    /*! Submits job for execution.
+     *  @param  function    Function to execute.
+     *  @param  data        Data passed to function.
+     *  @param  counter     Counter to be increased now and decreased once job is done. Can be NULL.
+     *  @param  dependency  Counter which job depends on. Job is not started before dependency counter drops to zero. Can be NULL.
+     *  @note Job and dependency counters must remain valid until job is done.
+     *  @note Jobs dependency counter tracks should be submitted before dependent job is.
+     */
+    void run(const JobFunction& function, void* data, JobCounter* counter = NULL, const JobCounter* dependency = NULL);
+    /*! Waits until all jobs associated with given counter are done. 
+     *  @note Calling thread executes pending jobs while waiting. It is safe to call it from within a job.
+     */
+    void wait(const JobCounter& counter);
+    /*! Processes [0, count) range of indices in parallel and waits until all are processed.
+     *  @param  count     Number of indices to process.
+     *  @param  batchSize Minimal number of indices processed by single job.
+     *  @param  function  Function to be called for each batch of indices.
+     *  @note Function is called concurrently from different threads.
+     */
+    void parallelFor(u32 count, u32 batchSize, const JobRangeFunction& function);
+
+  private:
+
+    /*! Job descriptor. */
+    struct Job
+    {
+      JobFunction function;           /*!< Function to call. */
+      void* data;                     /*!< Function data. */
+      JobCounter* counter;            /*!< Counter to decrease once job is done. Can be NULL. */
+      const JobCounter* dependency;   /*!< Counter job is waiting for. Can be NULL. */
+    };
+
+    /*! Job queue owned by single thread. 
+     *  @note Queue is a fixed-capacity ring buffer. Owner pushes and pops at the back, other threads steal from the front.
+     */
+    struct JobQueue
+    {
+      PMutex mutex;                   /*!< Access mutex. */
+      DynamicArray<Job> jobs;         /*!< Ring buffer of jobs. */
+      u32 first;                      /*!< Index of the front job. */
+      u32 count;                      /*!< Number of jobs in queue. */
+    };
+
+    /*! Parallel loop batch descriptor. */
+    struct ParallelForBatch
+    {
+      JobRangeFunction function;      /*!< Function to call. */
+      u32 begin;                      /*!< First index to process. */
+      u32 end;                        /*!< Index after the last one to process. */
+    };
+
+  private:
+
+    /*! Worker thread main loop. 
+     *  @param  index Index of the queue owned by worker.
+     */
+    void workerLoop(u32 index);
+    /*! Returns index of the queue owned by calling thread. Threads other than workers share main thread queue. */
+    u32 currentQueueIndex() const;
+    /*! Pushes job into given queue. Returns FALSE if queue is full. 
+     *  @param  index Index of the queue.
+     *  @param  job   Job to push.
+     *  @param  front If TRUE job is pushed to the front of the queue, otherwise to its back.
+     */
+    bool push(u32 index, const Job& job, bool front = false);
+    /*! Takes job from given queue first and then from any other queue. Returns FALSE if no job is available. */
+    bool acquire(u32 index, Job& job);
+    /*! Executes given job. 
+     *  @return FALSE if job could not be executed yet due to unmet dependency and was put back into queue.
+     */
+    bool execute(const Job& job);
+    /*! Puts back job into any queue with some free space. Returns FALSE if all queues are full. */
+    bool requeue(const Job& job);
+    /*! Backs off thread which could not find any job to execute. 
+     *  @param  attempt Number of consecutive unsuccessful attempts. Updated on return.
+     */
+    static void Backoff(u32& attempt);
+    /*! Job function processing single parallel loop batch. */
+    void executeParallelForBatch(void* data);
+
+  private:
+
+    /*! Job queues. Queue at index 0 belongs to main thread, others to workers. */
+    DynamicArray<JobQueue> m_queues;
+    /*! Worker threads. */
+    DynamicArray<PThread> m_workers;
+    /*! Thread identifiers of queues owners. */
+    DynamicArray<void*> m_threadIds;
+    /*! Number of jobs in all queues. Jobs are accounted before they are pushed so it never goes below zero. */
+    volatile u32 m_queuedJobs;
+    /*! Number of workers sleeping due to lack of work. */
+    volatile u32 m_sleepingWorkers;
+    /*! Number of workers which registered their thread identifiers. */
+    volatile u32 m_startedWorkers;
+    /*! Sleep mutex. */
+    PMutex m_sleepMutex;
+    /*! Wait condition workers are sleeping on. */
+    PWaitCondition m_wakeCondition;
+    /*! Stop request flag. */
+    volatile bool m_stopping;
+
+    friend class JobWorkerThread;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline bool JobCounter::isDone() const
+{
+  return 0 == value();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+inline u32 JobCounter::value() const
+{
+  return egeAtomicLoad(m_value);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_JOBSYSTEM_H
\ No newline at end of file
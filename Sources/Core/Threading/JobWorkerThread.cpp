@@ -0,0 +1,25 @@
+#include "Core/Threading/JobWorkerThread.h"
+#include "Core/Threading/JobSystem.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+JobWorkerThread::JobWorkerThread(Application* app, JobSystem* system, u32 index) : Thread(app),
+                                                                                   m_system(system),
+                                                                                   m_index(index)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+JobWorkerThread::~JobWorkerThread()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 JobWorkerThread::run()
+{
+  m_system->workerLoop(m_index);
+
+  return 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef EGE_CORE_JOBWORKERTHREAD_H
+#define EGE_CORE_JOBWORKERTHREAD_H
+
+/*! Job system's worker thread executing jobs from its own queue and stealing them from other queues. 
+ */
+
+#include "EGEThread.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class JobSystem;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class JobWorkerThread : public Thread
+{
+  public:
+
+    JobWorkerThread(Application* app, JobSystem* system, u32 index);
+   ~JobWorkerThread();
+
+  private:
+
+    /*! @see Thread::run */
+    EGE::s32 run() override;
+
+  private:
+
+    /*! Job system instance. */
+    JobSystem* m_system;
+    /*! Index of the queue owned by thread. */
+    u32 m_index;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_JOBWORKERTHREAD_H
\ No newline at end of file
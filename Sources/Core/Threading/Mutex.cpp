@@ -53,10 +53,13 @@ bool Mutex::unlock()
   bool result = false;
   if (m_p)
   {
+    // NOTE: flag is cleared while mutex is still owned, otherwise it could overwrite flag set by thread which has just acquired the mutex
+    m_locked = false;
+
     result = m_p->unlock();
-    if (result)
+    if ( ! result)
     {
-      m_locked = false;
+      m_locked = true;
     }
   }
 
@@ -1,5 +1,16 @@
 #include "Core/Threading/PThread/Thread_p.h"
 #include "Core/Threading/Thread.h"
+#include "EGEMath.h"
+
+#if EGE_PLATFORM_AIRPLAY
+  #include <s3eDevice.h>
+#else
+  #include <sched.h>
+#endif // EGE_PLATFORM_AIRPLAY
+
+#if EGE_PLATFORM_IOS || EGE_PLATFORM_POSIX
+  #include <unistd.h>
+#endif // EGE_PLATFORM_IOS || EGE_PLATFORM_POSIX
 
 EGE_NAMESPACE_BEGIN
 
@@ -24,9 +35,6 @@ void* ThreadPrivate::ThreadFunc(void* userData)
   
   Thread* base = me->d_func();
 
-  // set flags
-  me->m_running = true;
-
   // emit
   emit base->started(base);
 
@@ -40,14 +48,16 @@ void* ThreadPrivate::ThreadFunc(void* userData)
     result = base->m_exitCode;
   }
 
-  // set flags
-  me->m_running    = false;
-  me->m_finished   = true;
-  base->m_stopping = false;
-
   // emit
   emit base->finished(base);
 
+  // set flags
+  // NOTE: this is done after emission and running flag is cleared last, so thread object is not accessed anymore once thread is not reported as 
+  //       running and can be deleted
+  base->m_stopping = false;
+  me->m_finished   = true;
+  me->m_running    = false;
+
   // clean up
   pthread_exit(reinterpret_cast<void*>(result));
 
@@ -63,10 +73,19 @@ bool ThreadPrivate::start()
   pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
 
   // set flags
+  // NOTE: thread is reported as running from now on, so it is waited for even if it is stopped before it gets scheduled
   m_finished = false;
+  m_running  = true;
   
   // start thread
-  return 0 == pthread_create(&m_thread, &attr, &ThreadPrivate::ThreadFunc, this);
+  if (0 != pthread_create(&m_thread, &attr, &ThreadPrivate::ThreadFunc, this))
+  {
+    // error!
+    m_running = false;
+    return false;
+  }
+
+  return true;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool ThreadPrivate::isRunning() const
@@ -93,12 +112,32 @@ void ThreadPrivate::cancel()
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void* Thread::CurrentId()
 {
-#if EGE_PLATFORM_AIRPLAY || EGE_PLATFORM_IOS
+#if EGE_PLATFORM_AIRPLAY || EGE_PLATFORM_IOS || EGE_PLATFORM_POSIX
   return reinterpret_cast<void*>(pthread_self());
 #else
   return pthread_self().p;
 #endif // EGE_PLATFORM_AIRPLAY
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 Thread::HardwareConcurrency()
+{
+#if EGE_PLATFORM_AIRPLAY
+  return 1;
+#elif EGE_PLATFORM_IOS || EGE_PLATFORM_POSIX
+  return static_cast<u32>(Math::Max(sysconf(_SC_NPROCESSORS_ONLN), 1L));
+#else
+  return static_cast<u32>(Math::Max(pthread_num_processors_np(), 1));
+#endif // EGE_PLATFORM_AIRPLAY
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Thread::YieldCurrent()
+{
+#if EGE_PLATFORM_AIRPLAY
+  s3eDeviceYield(0);
+#else
+  sched_yield();
+#endif // EGE_PLATFORM_AIRPLAY
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
\ No newline at end of file
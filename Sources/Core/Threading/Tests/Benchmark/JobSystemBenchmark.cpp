@@ -0,0 +1,139 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGEJobSystem.h>
+#include <EGEMath.h>
+#include <EGEMemory.h>
+#include <EGETimer.h>
+#include <vector>
+
+/** Micro-benchmark of job system scaling.
+ *  The same CPU bound workload is processed in parallel with increasing number of threads. Reported speedup is relative to the single thread case.
+ *  Note that speedup is naturally limited by the number of hardware threads of the machine running the benchmark.
+ */
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of elements processed in a single pass. */
+#define ELEMENTS_COUNT  65536
+/*! Number of iterations done for every element. */
+#define ITERATIONS      64
+/*! Minimal number of elements processed by single job. */
+#define BATCH_SIZE      256
+/*! Number of passes done before measurement starts. */
+#define WARMUP_PASSES   2
+/*! Number of measured passes. */
+#define MEASURED_PASSES 10
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class JobSystemBenchmark : public TestBase
+{
+  public:
+
+    /*! Range job processing elements within range. */
+    void onProcessRange(u32 begin, u32 end);
+
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void SetUp();
+
+  protected:
+
+    /*! Runs benchmark with given number of threads. Returns average pass duration (in microseconds). */
+    s64 measure(u32 threadCount);
+
+  protected:
+
+    /*! Input values. */
+    std::vector<float32> m_input;
+    /*! Output values. */
+    std::vector<float32> m_output;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemBenchmark::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemBenchmark::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemBenchmark::SetUp()
+{
+  m_input.clear();
+  for (s32 i = 0; i < ELEMENTS_COUNT; ++i)
+  {
+    m_input.push_back(random(100.0f));
+  }
+
+  // NOTE: results are stored so no calculation can be optimized away
+  m_output.resize(ELEMENTS_COUNT, 0);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemBenchmark::onProcessRange(u32 begin, u32 end)
+{
+  for (u32 i = begin; i < end; ++i)
+  {
+    float32 value = m_input[i];
+    for (s32 j = 0; j < ITERATIONS; ++j)
+    {
+      value = Math::Sqrt(value * value + 1.0f) * 0.5f + Math::Sin(value);
+    }
+
+    m_output[i] = value;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s64 JobSystemBenchmark::measure(u32 threadCount)
+{
+  // NOTE: calling thread is one of the threads processing jobs
+  PJobSystem jobSystem = ege_new JobSystem(NULL);
+  EXPECT_TRUE(NULL != jobSystem);
+  EXPECT_EQ(EGE_SUCCESS, jobSystem->construct(threadCount - 1));
+
+  // warm up
+  for (s32 i = 0; i < WARMUP_PASSES; ++i)
+  {
+    jobSystem->parallelFor(ELEMENTS_COUNT, BATCH_SIZE, ege_make_slot(this, JobSystemBenchmark::onProcessRange));
+  }
+
+  // measure
+  const s64 startTime = Timer::GetMicroseconds();
+
+  for (s32 i = 0; i < MEASURED_PASSES; ++i)
+  {
+    jobSystem->parallelFor(ELEMENTS_COUNT, BATCH_SIZE, ege_make_slot(this, JobSystemBenchmark::onProcessRange));
+  }
+
+  return (Timer::GetMicroseconds() - startTime) / MEASURED_PASSES;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(JobSystemBenchmark, ParallelForScaling)
+{
+  const u32 threadCounts[] = { 1, 2, 4, 8, 16 };
+
+  // reference single threaded results
+  const s64 baseDuration = measure(1);
+  const std::vector<float32> expected = m_output;
+
+  std::cout << "[ BENCH    ] ParallelForScaling: hardware threads " << Thread::HardwareConcurrency() << std::endl;
+
+  for (u32 i = 0; i < sizeof (threadCounts) / sizeof (threadCounts[0]); ++i)
+  {
+    const s64 duration = (1 == threadCounts[i]) ? baseDuration : measure(threadCounts[i]);
+
+    std::cout << "[ BENCH    ] ParallelForScaling: threads " << threadCounts[i] << ", passes " << MEASURED_PASSES << " x " << ELEMENTS_COUNT << ", avg "
+              << duration << "us, speedup " << (static_cast<float32>(baseDuration) / Math::Max(duration, 1LL)) << std::endl;
+
+    RecordProperty(String::Format("AveragePassDuration%d", threadCounts[i]).toAscii(), static_cast<int>(duration));
+
+    // validate results
+    EXPECT_TRUE(expected == m_output);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
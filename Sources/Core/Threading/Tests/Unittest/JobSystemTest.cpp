@@ -0,0 +1,290 @@
+#include "TestFramework/Interface/TestBase.h"
+#include <EGEAtomic.h>
+#include <EGEJobSystem.h>
+#include <EGEMemory.h>
+#include <vector>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Number of worker threads used by tests. */
+#define WORKERS_COUNT 3
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class JobSystemTest : public TestBase
+{
+  public:
+
+    /*! Job incrementing value pointed by data. */
+    void onIncrement(void* data);
+    /*! Job storing sum of all values into result. */
+    void onSum(void* data);
+    /*! Job spawning number of increment jobs and waiting for them. */
+    void onSpawn(void* data);
+    /*! Job spawning number of increment jobs and a sum job depending on counter given by data, and waiting for the increments. */
+    void onSpawnDependent(void* data);
+    /*! Range job incrementing values within range. */
+    void onIncrementRange(u32 begin, u32 end);
+
+  protected:
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+  protected:
+
+    virtual void SetUp();
+    virtual void TearDown();
+
+  protected:
+
+    /*! Tested job system. */
+    PJobSystem m_jobSystem;
+    /*! Values modified by jobs. */
+    std::vector<u32> m_values;
+    /*! Sum of values. */
+    u32 m_sum;
+    /*! Sum job counter. */
+    JobCounter m_sumCounter;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemTest::SetUpTestCase()
+{
+  EXPECT_TRUE(MemoryManager::Initialize());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemTest::TearDownTestCase()
+{
+  MemoryManager::Deinitialize();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemTest::SetUp()
+{
+  m_jobSystem = ege_new JobSystem(NULL);
+  ASSERT_TRUE(NULL != m_jobSystem);
+  ASSERT_EQ(EGE_SUCCESS, m_jobSystem->construct(WORKERS_COUNT));
+  ASSERT_EQ(static_cast<u32>(WORKERS_COUNT), m_jobSystem->workerCount());
+
+  m_sum = 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemTest::TearDown()
+{
+  m_jobSystem = NULL;
+  m_values.clear();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemTest::onIncrement(void* data)
+{
+  egeAtomicIncrement(*reinterpret_cast<u32*>(data));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemTest::onSum(void* data)
+{
+  EGE_UNUSED(data);
+
+  for (std::vector<u32>::const_iterator it = m_values.begin(); it != m_values.end(); ++it)
+  {
+    m_sum += *it;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemTest::onSpawn(void* data)
+{
+  u32* values = reinterpret_cast<u32*>(data);
+
+  JobCounter counter;
+  for (u32 i = 0; i < 10; ++i)
+  {
+    m_jobSystem->run(ege_make_slot(this, JobSystemTest::onIncrement), &values[i], &counter);
+  }
+
+  // NOTE: waiting from within a job is allowed
+  m_jobSystem->wait(counter);
+  EXPECT_TRUE(counter.isDone());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemTest::onSpawnDependent(void* data)
+{
+  const JobCounter* outerCounter = reinterpret_cast<const JobCounter*>(data);
+
+  JobCounter counter;
+  for (u32 i = 0; i < m_values.size(); ++i)
+  {
+    m_jobSystem->run(ege_make_slot(this, JobSystemTest::onIncrement), &m_values[i], &counter);
+  }
+
+  // NOTE: sum job is the most recent one in the queue, so it is likely to be picked up while waiting below, but it depends on this very job
+  m_jobSystem->run(ege_make_slot(this, JobSystemTest::onSum), NULL, &m_sumCounter, outerCounter);
+
+  m_jobSystem->wait(counter);
+  EXPECT_TRUE(counter.isDone());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void JobSystemTest::onIncrementRange(u32 begin, u32 end)
+{
+  for (u32 i = begin; i < end; ++i)
+  {
+    m_values[i]++;
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(JobSystemTest, RunAndWait)
+{
+  m_values.resize(1000, 0);
+
+  JobCounter counter;
+  for (u32 i = 0; i < m_values.size(); ++i)
+  {
+    m_jobSystem->run(ege_make_slot(this, JobSystemTest::onIncrement), &m_values[i], &counter);
+  }
+
+  m_jobSystem->wait(counter);
+
+  EXPECT_TRUE(counter.isDone());
+  for (u32 i = 0; i < m_values.size(); ++i)
+  {
+    EXPECT_EQ(1U, m_values[i]);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(JobSystemTest, Dependency)
+{
+  m_values.resize(500, 0);
+
+  JobCounter incrementCounter;
+  JobCounter sumCounter;
+
+  for (u32 i = 0; i < m_values.size(); ++i)
+  {
+    m_jobSystem->run(ege_make_slot(this, JobSystemTest::onIncrement), &m_values[i], &incrementCounter);
+  }
+
+  // NOTE: sum job is the most recent one in the queue, so it is likely to be picked up first, but should not run before all increments are done
+  m_jobSystem->run(ege_make_slot(this, JobSystemTest::onSum), NULL, &sumCounter, &incrementCounter);
+
+  m_jobSystem->wait(sumCounter);
+
+  EXPECT_TRUE(incrementCounter.isDone());
+  EXPECT_EQ(static_cast<u32>(m_values.size()), m_sum);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(JobSystemTest, DependencyOnWaitingJob)
+{
+  m_values.resize(10, 0);
+
+  // NOTE: sum job cannot be done while spawning job is waiting, so it must not be waited for on the same stack
+  JobCounter counter;
+  m_jobSystem->run(ege_make_slot(this, JobSystemTest::onSpawnDependent), &counter, &counter);
+
+  m_jobSystem->wait(counter);
+  m_jobSystem->wait(m_sumCounter);
+
+  EXPECT_TRUE(m_sumCounter.isDone());
+  EXPECT_EQ(static_cast<u32>(m_values.size()), m_sum);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(JobSystemTest, NestedJobs)
+{
+  m_values.resize(100 * 10, 0);
+
+  JobCounter counter;
+  for (u32 i = 0; i < 100; ++i)
+  {
+    m_jobSystem->run(ege_make_slot(this, JobSystemTest::onSpawn), &m_values[i * 10], &counter);
+  }
+
+  m_jobSystem->wait(counter);
+
+  for (u32 i = 0; i < m_values.size(); ++i)
+  {
+    EXPECT_EQ(1U, m_values[i]);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(JobSystemTest, SubmitAndStealHammer)
+{
+  const u32 KRoundsCount   = 100;
+  const u32 KSpawnersCount = 64;
+  const u32 KDirectCount   = 100;
+
+  // NOTE: each spawning job submits its jobs to its own worker queue, from which they are stolen by others, while main thread keeps submitting too
+  m_values.resize(KSpawnersCount * 10 + KDirectCount, 0);
+
+  for (u32 round = 0; round < KRoundsCount; ++round)
+  {
+    JobCounter counter;
+    for (u32 i = 0; i < KSpawnersCount; ++i)
+    {
+      m_jobSystem->run(ege_make_slot(this, JobSystemTest::onSpawn), &m_values[i * 10], &counter);
+    }
+
+    for (u32 i = 0; i < KDirectCount; ++i)
+    {
+      m_jobSystem->run(ege_make_slot(this, JobSystemTest::onIncrement), &m_values[KSpawnersCount * 10 + i], &counter);
+    }
+
+    m_jobSystem->wait(counter);
+    EXPECT_TRUE(counter.isDone());
+  }
+
+  // validate every job has been executed exactly once
+  for (u32 i = 0; i < m_values.size(); ++i)
+  {
+    EXPECT_EQ(KRoundsCount, m_values[i]);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(JobSystemTest, ParallelFor)
+{
+  const u32 counts[] = { 0, 1, 7, 64, 1000, 100003 };
+
+  for (u32 i = 0; i < sizeof (counts) / sizeof (counts[0]); ++i)
+  {
+    m_values.clear();
+    m_values.resize(counts[i], 0);
+
+    m_jobSystem->parallelFor(counts[i], 16, ege_make_slot(this, JobSystemTest::onIncrementRange));
+
+    // validate each index has been processed exactly once
+    for (u32 j = 0; j < counts[i]; ++j)
+    {
+      EXPECT_EQ(1U, m_values[j]);
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(JobSystemTest, NoWorkers)
+{
+  PJobSystem jobSystem = ege_new JobSystem(NULL);
+  ASSERT_TRUE(NULL != jobSystem);
+  ASSERT_EQ(EGE_SUCCESS, jobSystem->construct(0));
+  EXPECT_EQ(0U, jobSystem->workerCount());
+
+  u32 value = 0;
+
+  // NOTE: without workers jobs are executed immediately
+  JobCounter counter;
+  jobSystem->run(ege_make_slot(this, JobSystemTest::onIncrement), &value, &counter);
+  EXPECT_TRUE(counter.isDone());
+  EXPECT_EQ(1U, value);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(JobSystemTest, Shutdown)
+{
+  m_values.resize(1000, 0);
+
+  // NOTE: jobs are not waited for, shutdown should execute all of them
+  for (u32 i = 0; i < m_values.size(); ++i)
+  {
+    m_jobSystem->run(ege_make_slot(this, JobSystemTest::onIncrement), &m_values[i]);
+  }
+
+  m_jobSystem->shutdown();
+  EXPECT_EQ(0U, m_jobSystem->workerCount());
+
+  for (u32 i = 0; i < m_values.size(); ++i)
+  {
+    EXPECT_EQ(1U, m_values[i]);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
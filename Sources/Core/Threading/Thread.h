@@ -37,6 +37,10 @@ class Thread : public Object
 
     /*! Returns current tread identifier. */
     static void* CurrentId();
+    /*! Returns number of hardware threads available. */
+    static u32 HardwareConcurrency();
+    /*! Gives up the rest of the time slice of the calling thread to other threads ready to run. */
+    static void YieldCurrent();
 
   public:
 
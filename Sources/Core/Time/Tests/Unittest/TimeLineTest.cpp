@@ -1,5 +1,5 @@
 #include "TestFramework/Interface/TestBase.h"
-#include <EGETimeLine.h>
+#include <EGETimeline.h>
 #include <vector>
 
 EGE_NAMESPACE
@@ -1,6 +1,6 @@
 #include "TestFramework/Interface/TestBase.h"
 #include <EGETimer.h>
-#include <windows.h>
+#include <EGEDevice.h>
 
 EGE_NAMESPACE
 
@@ -43,7 +43,7 @@ void TimerTest::TearDown()
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void TimerTest::osSleep(u32 miliseconds)
 {
-  Sleep(miliseconds);
+  Device::Sleep(miliseconds);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 TEST_F(TimerTest, GetMiliseconds)
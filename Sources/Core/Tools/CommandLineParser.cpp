@@ -1,5 +1,6 @@
 #include "Core/Tools/CommandLineParser.h"
 #include "EGEDebug.h"
+#include <string.h>
 
 EGE_NAMESPACE_BEGIN
 
@@ -186,7 +186,7 @@ bool Dialog::initialize(const Dictionary& params)
   }
 
   // go thru all children
-  for (ChildrenDataMap::iterator it = m_children.begin(); it != m_children.end(); ++it)
+  for (ChildDataArray::iterator it = m_children.begin(); it != m_children.end(); ++it)
   {
   }
 
@@ -119,11 +119,15 @@ bool Label::initialize(const Dictionary& params)
 void Label::setText(const Text& text)
 {
   m_textOverlay->setText(text);
+
+  invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Label::setFont(PFont font)
 {
   m_textOverlay->setFont(font);
+
+  invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Vector2f Label::contentSize()
@@ -144,6 +148,8 @@ void Label::setTextAlignment(Alignment alignment)
 {
   m_textOverlay->setTextAlignment(alignment);
   //m_textOverlay->setAlignment(alignment);
+
+  invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
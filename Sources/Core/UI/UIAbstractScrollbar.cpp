@@ -182,6 +182,11 @@ void UIAbstractScrollbar::setOffset(s32 offset)
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool UIAbstractScrollbar::isFading() const
+{
+  return (STATE_FADING_IN == m_state) || (STATE_FADING_OUT == m_state);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void UIAbstractScrollbar::addForRendering(IRenderer* renderer, const Matrix4f& transform)
 {
   if (!isVisible() || (STATE_HIDDEN == m_state))
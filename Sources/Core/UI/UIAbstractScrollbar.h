@@ -48,6 +48,8 @@ class UIAbstractScrollbar : public Widget
     void setPageSize(s32 size);
     /*! Returns render data component. */
     const PRenderComponent& renderData() const { return m_renderData; }
+    /*! Returns TRUE if scrollbar is fading in or out. */
+    bool isFading() const;
 
   protected:
 
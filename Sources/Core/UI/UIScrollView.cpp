@@ -92,11 +92,18 @@ void UIScrollView::setContentSize(const Vector2f& size)
 
     // invalidate scrollbars
     m_scrollbarsNeedUpdate = true;
+
+    invalidateRenderCache();
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void UIScrollView::update(const Time& time)
 {
+  // store current look related data
+  // NOTE: scrollbars are not children so their changes need to be tracked here
+  const Vector2f previousOffset = m_offset;
+  const bool scrollbarsFading   = m_verticalScroll->isFading() || m_horizontalScroll->isFading();
+
   // check if animating
   if (STATE_ANIMATING == m_state)
   {
@@ -222,6 +229,12 @@ void UIScrollView::update(const Time& time)
   m_verticalScroll->update(time);
   m_horizontalScroll->update(time);
 
+  // check if look has changed
+  if ((previousOffset != m_offset) || scrollbarsFading || m_verticalScroll->isFading() || m_horizontalScroll->isFading())
+  {
+    invalidateRenderCache();
+  }
+
   // call base class
   Widget::update(time);
 }
@@ -329,6 +342,8 @@ void UIScrollView::setOffset(const Vector2f& offset, bool animate)
     {
       // go to offset immedialely
       m_offset = offset;
+
+      invalidateRenderCache();
     }
   }
 }
@@ -376,6 +391,29 @@ void UIScrollView::addForRendering(IRenderer* renderer, const Matrix4f& transfor
   Widget::addForRendering(renderer, transform);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Rectf UIScrollView::childrenVisibleRect() const
+{
+  // NOTE: children are not affected by scroll offset
+  return Rectf(0, 0, size().x, size().y);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Rectf UIScrollView::visibleContentRect() const
+{
+  return Rectf(m_offset.x, m_offset.y, size().x, size().y);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool UIScrollView::isContentVisible(const Overlay* overlay, const Vector2f& pageOffset) const
+{
+  // determine overlay rectangle in content space
+  // NOTE: this follows the way overlays position themselves
+  Vector2f pos(overlay->physics()->position().x, overlay->physics()->position().y);
+  Vector2f finalSize(overlay->size().x * overlay->physics()->scale().x, overlay->size().y * overlay->physics()->scale().y);
+
+  pos = Math::Align(pos, finalSize, ALIGN_TOP_LEFT, overlay->alignment());
+
+  return visibleContentRect().intersects(Rectf(pos.x + pageOffset.x, pos.y + pageOffset.y, finalSize.x, finalSize.y));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void UIScrollView::onSizeChanged(const Vector2f& size)
 {
   EGE_UNUSED(size);
@@ -18,6 +18,7 @@ EGE_NAMESPACE_BEGIN
 EGE_DECLARE_SMART_CLASS(UIScrollView, PUIScrollView)
 EGE_DECLARE_SMART_CLASS(UIHorizontalScrollbar, PUIHorizontalScrollbar)
 EGE_DECLARE_SMART_CLASS(UIVerticalScrollbar, PUIVerticalScrollbar)
+class Overlay;
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class UIScrollView : public Widget
 {
@@ -61,6 +62,17 @@ class UIScrollView : public Widget
     bool isFrameless() const override;
     /*! @see Widget::addForRendering. */
     void addForRendering(IRenderer* renderer, const Matrix4f& transform = Matrix4f::IDENTITY) override;
+    /*! @see Widget::childrenVisibleRect. */
+    Rectf childrenVisibleRect() const override;
+
+    /*! Returns part of the content (in content space) which is currently visible. */
+    Rectf visibleContentRect() const;
+    /*! Returns TRUE if given content overlay can be seen. 
+     *  @param  overlay     Overlay to test.
+     *  @param  pageOffset  Additional offset (in content space) the overlay is rendered with.
+     *  @note Overlays which cannot be seen should not be submitted for rendering at all.
+     */
+    bool isContentVisible(const Overlay* overlay, const Vector2f& pageOffset = Vector2f::ZERO) const;
 
     /*! Begins move. */
     virtual void beginMove(s32 x, s32 y);
@@ -103,9 +103,11 @@ void UIScrollablePageView::addForRendering(IRenderer* renderer, const Matrix4f&
     const ObjectsList& list = m_objects[i];
 
     // apply page offset to content matrix
+    const Vector2f pageOffset(i * pageSize().x, 0);
     Matrix4f matrix = contentMatrix;
-    matrix.setTranslation(matrix.translationX() + i * pageSize().x, matrix.translationY(), matrix.translationZ());
+    matrix.setTranslation(matrix.translationX() + pageOffset.x, matrix.translationY(), matrix.translationZ());
 
+    // NOTE: objects lying outside of visible area are skipped
     for (ObjectsList::const_iterator it = list.begin(); it != list.end(); ++it)
     {
       switch ((*it)->uid())
@@ -114,8 +116,11 @@ void UIScrollablePageView::addForRendering(IRenderer* renderer, const Matrix4f&
           {
             TextOverlay* overlay = ege_cast<TextOverlay*>(*it);
 
-            overlay->renderData()->setClipRect(clipRect);
-            overlay->addForRendering(renderer, matrix);
+            if (isContentVisible(overlay, pageOffset))
+            {
+              overlay->renderData()->setClipRect(clipRect);
+              overlay->addForRendering(renderer, matrix);
+            }
           }
           break;
 
@@ -123,8 +128,11 @@ void UIScrollablePageView::addForRendering(IRenderer* renderer, const Matrix4f&
           {
             ImageOverlay* overlay = ege_cast<ImageOverlay*>(*it);
 
-            overlay->renderData()->setClipRect(clipRect);
-            overlay->addForRendering(renderer, matrix);
+            if (isContentVisible(overlay, pageOffset))
+            {
+              overlay->renderData()->setClipRect(clipRect);
+              overlay->addForRendering(renderer, matrix);
+            }
           }
           break;
       }
@@ -218,6 +226,9 @@ EGEResult UIScrollablePageView::addObject(PObject object, u32 pageIdx)
       // add to pool
       m_objects[pageIdx].push_back(object);
 
+      // content look has changed
+      invalidateRenderCache();
+
       result = EGE_SUCCESS;
       break;
   }
@@ -239,6 +250,9 @@ void UIScrollablePageView::removeObject(PObject object)
         // remove from list
         list.erase(itList);
 
+        // content look has changed
+        invalidateRenderCache();
+
         // done
         return;
       }
@@ -316,6 +330,8 @@ UIScrollablePageView::ObjectsList UIScrollablePageView::objects(s32 pageIdx) con
 void UIScrollablePageView::removeAllObjects()
 {
   m_objects.clear();
+
+  invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void UIScrollablePageView::setPageCount(s32 count)
@@ -327,6 +343,8 @@ void UIScrollablePageView::setPageCount(s32 count)
 
     // update content size
     recalculateContentArea();
+
+    invalidateRenderCache();
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
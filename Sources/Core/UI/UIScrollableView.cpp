@@ -118,7 +118,10 @@ void UIScrollableView::addForRendering(IRenderer* renderer, const Matrix4f& tran
   Matrix4f combined = transform.multiply(m_physics.transformationMatrix());
   pos = Vector4f(combined.translationX(), combined.translationY(), combined.translationZ());
 
-  // render all objects
+  const Rectf clipRect(pos.x, pos.y, m_size.x, m_size.y);
+
+  // render all visible objects
+  // NOTE: objects scrolled out of view are skipped so long lists cost only as much as what can be seen
   for (ObjectsList::iterator it = m_objects.begin(); it != m_objects.end(); ++it)
   {
     switch ((*it)->uid())
@@ -128,8 +131,11 @@ void UIScrollableView::addForRendering(IRenderer* renderer, const Matrix4f& tran
         {
           Overlay* overlay = ege_cast<Overlay*>(*it);
 
-          overlay->renderData()->setClipRect(Rectf(pos.x, pos.y, m_size.x, m_size.y));          
-          overlay->addForRendering(renderer, contentMatrix);
+          if (isContentVisible(overlay))
+          {
+            overlay->renderData()->setClipRect(clipRect);
+            overlay->addForRendering(renderer, contentMatrix);
+          }
         }
         break;
     }
@@ -161,6 +167,7 @@ EGEResult UIScrollableView::addObject(PObject object)
 
       // invalidate content
       m_dirtyContent = true;
+      invalidateRenderCache();
 
       result = EGE_SUCCESS;
       break;
@@ -173,12 +180,14 @@ void UIScrollableView::removeObject(PObject object)
 {
   m_objects.remove(object);
   m_dirtyContent = true;
+  invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void UIScrollableView::removeAllObjects()
 {
   m_objects.clear();
   m_dirtyContent = true;
+  invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Vector2f UIScrollableView::contentSize()
@@ -233,6 +242,7 @@ void UIScrollableView::transformationChanged()
 {
   // invalidate content
   m_dirtyContent = true;
+  invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool UIScrollableView::isFrameless() const
@@ -322,6 +332,7 @@ void UIScrollableView::setAutoContentSize(bool enable)
     {
       // invalidate content
       m_dirtyContent = true;
+      invalidateRenderCache();
     }
   }
 }
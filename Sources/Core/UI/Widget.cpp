@@ -25,6 +25,12 @@ Widget::~Widget()
 {
   ege_disconnect(&m_physics, transformationChanged, this, Widget::onTransformationChanged);
 
+  if (NULL != m_renderCache)
+  {
+    ege_disconnect(m_renderCache, renderRequested, this, Widget::onRenderCacheRequested);
+    m_renderCache = NULL;
+  }
+
   EGE_DELETE(m_widgetFrame);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -65,10 +71,17 @@ bool Widget::initialize(const Dictionary& params)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Widget::update(const Time& time)
 {
+  // check if render data is about to be regenerated
+  // NOTE: this is done here, ahead of rendering, so render caches are refreshed in time
+  if (m_renderDataInvalid)
+  {
+    invalidateRenderCache();
+  }
+
   // update children
-  for (ChildrenDataMap::const_iterator it = m_children.begin(); it != m_children.end(); ++it)
+  for (ChildDataArray::const_iterator it = m_children.begin(); it != m_children.end(); ++it)
   {
-    const ChildData& childData = it->second;
+    const ChildData& childData = *it;
 
     childData.widget->update(time);
   }
@@ -88,25 +101,31 @@ void Widget::addForRendering(IRenderer* renderer, const Matrix4f& transform)
     }
 
     // apply alignment
-    Vector2f pos(m_physics.position().x, m_physics.position().y);
-    pos = Math::Align(pos, size(), ALIGN_TOP_LEFT, alignment());
+    const Rectf rect = localRect();
 
     // update translation
     Matrix4f matrix = m_physics.transformationMatrix();
-    matrix.setTranslation(pos.x, pos.y, 0);
+    matrix.setTranslation(rect.x, rect.y, 0);
+
+    const Matrix4f localTransform = transform * matrix;
 
     // render frame
     if (NULL != m_widgetFrame)
     {
-      m_widgetFrame->addForRendering(renderer, transform * matrix);
+      m_widgetFrame->addForRendering(renderer, localTransform);
     }
 
     // render children
-    for (ChildrenDataMap::const_iterator it = m_children.begin(); it != m_children.end(); ++it)
+    // NOTE: children lying entirely outside visible area are skipped so cost is proportional to what can be seen
+    const Rectf visibleRect = childrenVisibleRect();
+    for (ChildDataArray::const_iterator it = m_children.begin(); it != m_children.end(); ++it)
     {
-      const ChildData& childData = it->second;
+      const ChildData& childData = *it;
 
-      childData.widget->addForRendering(renderer, transform * matrix);
+      if (visibleRect.isNull() || visibleRect.intersects(childData.widget->localRect()))
+      {
+        addChildForRendering(childData.widget, renderer, localTransform);
+      }
     }
   }
 }
@@ -116,6 +135,9 @@ void Widget::setVisible(bool set)
   if (m_visible != set)
   {
     m_visible = set;
+
+    // parent look changes
+    invalidateParentRenderCache();
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -128,6 +150,7 @@ void Widget::setMaterial(const PMaterial& material)
 
   // invalidate render data
   m_renderDataInvalid = true;
+  invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Widget::pointerEvent(PPointerData data)
@@ -145,15 +168,20 @@ void Widget::pointerEvent(PPointerData data)
   if (rect.contains(static_cast<float32>(data->x()), static_cast<float32>(data->y())))
   {
     // pass to children
-    for (ChildrenDataMap::const_iterator it = m_children.begin(); it != m_children.end(); ++it)
+    const Rectf visibleRect = childrenVisibleRect();
+    for (ChildDataArray::const_iterator it = m_children.begin(); it != m_children.end(); ++it)
     {
-      const ChildData& childData = it->second;
+      const ChildData& childData = *it;
 
       // update position into local space of the child
       // NOTE: content's position is in widget's local space
       //PointerData localData(data->action(), data->button(), static_cast<s32>(pos.x), static_cast<s32>(pos.y), data->index());
 
-      childData.widget->pointerEvent(data);
+      // check if child can be seen at all
+      if (visibleRect.isNull() || visibleRect.intersects(childData.widget->localRect()))
+      {
+        childData.widget->pointerEvent(data);
+      }
     }
   }
 }
@@ -163,7 +191,7 @@ EGEResult Widget::addChild(PWidget widget)
   EGE_ASSERT(NULL == widget->parent());
 
   // check if widget with that name exists
-  if (m_children.contains(widget->name()))
+  if (m_childIndex.contains(widget->name()))
   {
     // error!
     return EGE_ERROR_ALREADY_EXISTS;
@@ -173,26 +201,27 @@ EGEResult Widget::addChild(PWidget widget)
   childData.widget = widget;
 
   // add to pool
-  m_children.insert(widget->name(), childData);
+  // NOTE: children are appended so draw order follows order of addition
+  m_childIndex.insert(widget->name(), static_cast<u32>(m_children.size()));
+  m_children.push_back(childData);
 
   // set child parent
   widget->m_parent = this;
 
+  invalidateRenderCache();
+
   return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Widget::removeChild(PWidget widget)
 {
   // find proper widget
-  for (ChildrenDataMap::iterator it = m_children.begin(); it != m_children.end(); ++it)
+  for (u32 i = 0; i < static_cast<u32>(m_children.size()); ++i)
   {
-    if (it->second.widget == widget)
+    if (m_children[i].widget == widget)
     {
       // remove from pool
-      m_children.erase(it);
-
-      // reset parent
-      widget->m_parent = NULL;
+      removeChildAt(i);
       return;
     }
   }
@@ -201,34 +230,57 @@ void Widget::removeChild(PWidget widget)
 void Widget::removeChild(const String& name)
 {
   // find proper widget
-  for (ChildrenDataMap::iterator it = m_children.begin(); it != m_children.end(); ++it)
+  ChildIndexMap::const_iterator it = m_childIndex.find(name);
+  if (it != m_childIndex.end())
   {
-    if (it->first == name)
-    {
-      PWidget widget = it->second.widget;
+    // remove from pool
+    removeChildAt(it->second);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Widget::removeChildAt(u32 index)
+{
+  EGE_ASSERT(index < static_cast<u32>(m_children.size()));
 
-      // remove from pool
-      m_children.erase(it);
+  PWidget widget = m_children[index].widget;
 
-      // reset parent
-      widget->m_parent = NULL;
-      return;
-    }
+  // remove from pool
+  m_children.erase(m_children.begin() + index);
+
+  // update indicies of all children which followed
+  rebuildChildIndex();
+
+  // reset parent
+  widget->m_parent = NULL;
+
+  invalidateRenderCache();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Widget::rebuildChildIndex()
+{
+  m_childIndex.clear();
+
+  for (u32 i = 0; i < static_cast<u32>(m_children.size()); ++i)
+  {
+    m_childIndex.insert(m_children[i].widget->name(), i);
   }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Widget::removeAllChildren()
 {
   // go thru all children
-  for (ChildrenDataMap::iterator it = m_children.begin(); it != m_children.end(); ++it)
+  for (ChildDataArray::iterator it = m_children.begin(); it != m_children.end(); ++it)
   {
-    PWidget& widget = it->second.widget;
+    PWidget& widget = it->widget;
 
     // reset parent
     widget->m_parent = NULL;
   }
 
   m_children.clear();
+  m_childIndex.clear();
+
+  invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Widget::generateRenderData()
@@ -254,9 +306,9 @@ Vector2f Widget::size() const
   //  m_size.y = Math::Clamp(contentSize.y, minFrameSize.y, (0.0f == m_maxSize.y) ? hugeSize : m_maxSize.y);
 
   //  // go thru all children and reassign layouts
-  //  for (ChildrenDataMap::iterator it = m_children.begin(); it != m_children.end(); ++it)
+  //  for (ChildDataArray::iterator it = m_children.begin(); it != m_children.end(); ++it)
   //  {
-  //    ChildData& data = it->second;
+  //    ChildData& data = *it;
 
   //    data.widget->setPosition(Vector4f(data.rect.x * m_size.x, data.rect.y * m_size.y, 0));
   //    data.widget->setSize(Vector2f(data.rect.width * m_size.x, data.rect.height * m_size.y));
@@ -282,22 +334,38 @@ Vector2f Widget::size() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PWidget Widget::child(const String& name) const
 {
-  // go thru all children
-  for (ChildrenDataMap::const_iterator it = m_children.begin(); it != m_children.end(); ++it)
+  // check if found
+  ChildIndexMap::const_iterator it = m_childIndex.find(name);
+  if (it != m_childIndex.end())
   {
-    // check if found
-    if (it->first == name)
-    {
-      return it->second.widget;
-    }
+    return m_children[it->second].widget;
   }
 
   return NULL;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 Widget::childCount() const
+{
+  return static_cast<u32>(m_children.size());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PWidget Widget::childAt(u32 index) const
+{
+  return (index < childCount()) ? m_children[index].widget : NULL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Widget::setName(const String& name)
 {
-  m_name = name;
+  if (m_name != name)
+  {
+    m_name = name;
+
+    // update name index of parent
+    if (NULL != m_parent)
+    {
+      m_parent->rebuildChildIndex();
+    }
+  }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 Vector2f Widget::contentSize()
@@ -305,9 +373,9 @@ Vector2f Widget::contentSize()
   Vector2f biggestSize = Vector2f::ZERO;
 
   // go thru all children
-  for (ChildrenDataMap::iterator it = m_children.begin(); it != m_children.end(); ++it)
+  for (ChildDataArray::iterator it = m_children.begin(); it != m_children.end(); ++it)
   {
-    //const ChildData& data = it->second;
+    //const ChildData& data = *it;
 
     // determine content size
     //Vector2f contentSize = data.widget->contentSize();
@@ -335,6 +403,8 @@ void Widget::setSize(const Vector2f& size)
       m_widgetFrame->setSize(size);
     }
 
+    invalidateRenderCache();
+
     // emit
     emit sizeChanged(size);
   }
@@ -360,12 +430,14 @@ void Widget::setAlpha(float32 alpha)
   }
 
   // apply to all children
-  for (ChildrenDataMap::iterator it = m_children.begin(); it != m_children.end(); ++it)
+  for (ChildDataArray::iterator it = m_children.begin(); it != m_children.end(); ++it)
   {
-    ChildData& data = it->second;
+    ChildData& data = *it;
 
     data.widget->setAlpha(alpha);
   }
+
+  invalidateRenderCache();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Widget::setAlignment(Alignment alignment)
@@ -373,11 +445,124 @@ void Widget::setAlignment(Alignment alignment)
   if (m_alignment != alignment)
   {
     m_alignment = alignment;
+
+    // parent look changes
+    invalidateParentRenderCache();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Rectf Widget::localRect() const
+{
+  const Vector2f size = this->size();
+
+  // apply alignment
+  Vector2f pos(m_physics.position().x, m_physics.position().y);
+  pos = Math::Align(pos, size, ALIGN_TOP_LEFT, alignment());
+
+  return Rectf(pos.x, pos.y, size.x, size.y);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Rectf Widget::childrenVisibleRect() const
+{
+  return Rectf::INVALID;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Widget::setRenderCacheEnabled(bool enable)
+{
+  if (enable && (NULL == m_renderCache))
+  {
+    m_renderCache = ege_new RenderCache(app(), "widget-" + name());
+    if (NULL != m_renderCache)
+    {
+      ege_connect(m_renderCache, renderRequested, this, Widget::onRenderCacheRequested);
+    }
   }
+  else if (!enable && (NULL != m_renderCache))
+  {
+    ege_disconnect(m_renderCache, renderRequested, this, Widget::onRenderCacheRequested);
+    m_renderCache = NULL;
+  }
+
+  // parent needs to draw this widget differently now
+  invalidateParentRenderCache();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Widget::invalidateRenderCache()
+{
+  // go up the hierarchy
+  // NOTE: every cache on the way contains this widget
+  Widget* widget = this;
+  while (true)
+  {
+    if (NULL != widget->m_renderCache)
+    {
+      widget->m_renderCache->invalidate();
+    }
+
+    if (NULL == widget->m_parent)
+    {
+      break;
+    }
+
+    widget = widget->m_parent;
+  }
+
+  // notify owner of the hierarchy
+  emit widget->renderCacheInvalidated();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Widget::invalidateParentRenderCache()
+{
+  if (NULL != m_parent)
+  {
+    m_parent->invalidateRenderCache();
+  }
+  else
+  {
+    // NOTE: top-level widget look changes for its owner only
+    emit renderCacheInvalidated();
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Widget::addChildForRendering(const PWidget& child, IRenderer* renderer, const Matrix4f& transform)
+{
+  const PRenderCache& cache = child->m_renderCache;
+
+  // check if child is cached
+  if ((NULL != cache) && child->isVisible())
+  {
+    const Rectf rect = child->localRect();
+
+    // make sure cache covers entire child
+    // NOTE: if size changes, cache is invalidated and gets refreshed before next frame
+    cache->setSize(Vector2f(rect.width, rect.height));
+
+    if (cache->isUpToDate())
+    {
+      // draw cached content at the child's position
+      cache->addForRendering(renderer, transform * Math::CreateMatrix(Vector4f(rect.x, rect.y, 0), Vector4f::ONE, Quaternionf::IDENTITY));
+      return;
+    }
+  }
+
+  // render directly
+  child->addForRendering(renderer, transform);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Widget::onRenderCacheRequested(IRenderer* renderer)
+{
+  const Rectf rect = localRect();
+
+  // render self so that top-left corner lands at the origin
+  addForRendering(renderer, Math::CreateMatrix(Vector4f(-rect.x, -rect.y, 0), Vector4f::ONE, Quaternionf::IDENTITY));
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Widget::onTransformationChanged()
 {
+  // parent look changes
+  // NOTE: own cache remains valid as it is drawn at the new place
+  invalidateParentRenderCache();
+
   // check if not invalid yet
   if (!m_globalTransformationMatrixInvalid)
   {
@@ -385,9 +570,9 @@ void Widget::onTransformationChanged()
     m_globalTransformationMatrixInvalid = true;
 
     // notify children
-    for (ChildrenDataMap::iterator it = m_children.begin(); it != m_children.end(); ++it)
+    for (ChildDataArray::iterator it = m_children.begin(); it != m_children.end(); ++it)
     {
-      it->second.widget->onTransformationChanged();
+      it->widget->onTransformationChanged();
     }
   }
 }
@@ -8,9 +8,12 @@
 #include "EGETime.h"
 #include "EGEInput.h"
 #include "EGEMap.h"
+#include "EGEDynamicArray.h"
+#include "EGERect.h"
 #include "EGESignal.h"
 #include "EGERenderComponent.h"
 #include "Core/UI/WidgetFrame.h"
+#include "Core/Graphics/RenderCache.h"
 #include "Core/Component/Physics/PhysicsComponent.h"
 
 EGE_NAMESPACE_BEGIN
@@ -35,6 +38,10 @@ class Widget : public Object
     Signal1<const Vector2f&> sizeChanged;
     /*! Signal emitted when position of the widget changes. */
     Signal1<const Vector4f&> positionChanged;
+    /*! Signal emitted by top-level widget when look of its hierarchy changes. 
+     *  @note Owner rendering the widget, such as screen, can use it to invalidate its own render cache.
+     */
+    Signal0<> renderCacheInvalidated;
 
   public:
 
@@ -73,6 +80,12 @@ class Widget : public Object
     void removeAllChildren();
     /*! Returns child with a given name. */
     PWidget child(const String& name) const;
+    /*! Returns number of children. */
+    u32 childCount() const;
+    /*! Returns child at a given index. 
+     *  @note Children are kept, updated and rendered in order they were added.
+     */
+    PWidget childAt(u32 index) const;
 
     /*! Returns pointer to parent widget. NULL if no parent is set. */
     Widget* parent() const { return m_parent; }
@@ -94,6 +107,27 @@ class Widget : public Object
     /*! Returns current widget alignment. */
     Alignment alignment() const { return m_alignment; }
 
+    /*! Returns widget's rectangle in parent's local space. 
+     *  @note Alignment is taken into account. Rotation and scale are not.
+     */
+    Rectf localRect() const;
+
+    /*! Enables/disables render cache.
+     *  @note When enabled, widget together with all its children is rendered into a texture once and then drawn as a single quad for as long as 
+     *        nothing changes within it.
+     *  @note Cache is used when widget is rendered as a child of another widget. Top-level widgets can be cached together with their screen.
+     *  @note Rotation and scale of the widget are baked into the cache.
+     */
+    void setRenderCacheEnabled(bool enable);
+    /*! Returns TRUE if render cache is enabled. */
+    bool isRenderCacheEnabled() const { return NULL != m_renderCache; }
+    /*! Returns render cache. NULL if disabled. */
+    PRenderCache renderCache() const { return m_renderCache; }
+    /*! Invalidates render cache of the widget and all its ancestors. 
+     *  @note This should be called whenever look of the widget changes in a way not tracked by the base class.
+     */
+    void invalidateRenderCache();
+
   protected:
 
     Widget(Application* app, const String& name, u32 uid, egeObjectDeleteFunc deleteFunc = NULL);
@@ -103,6 +137,13 @@ class Widget : public Object
     const Matrix4f& globalTransformationMatrix() const;
     /*! Constructs object. */
     virtual EGEResult construct();
+    /*! Adds given child for rendering. Child's render cache is used whenever it is up to date. */
+    void addChildForRendering(const PWidget& child, IRenderer* renderer, const Matrix4f& transform);
+    /*! Returns rectangle (in local space) within which children can be seen.
+     *  @note Children whose rectangles lie entirely outside of it are neither rendered nor receive pointer events.
+     *  @note Default implementation returns INVALID rectangle meaning no culling is done.
+     */
+    virtual Rectf childrenVisibleRect() const;
 
   private:
 
@@ -113,6 +154,19 @@ class Widget : public Object
 
     /*! Slot called when own transformation has been changed. */
     void onTransformationChanged();
+    /*! Slot called when content is to be rendered into render cache. */
+    void onRenderCacheRequested(IRenderer* renderer);
+
+  private:
+
+    /*! Removes child at a given index. */
+    void removeChildAt(u32 index);
+    /*! Rebuilds children name index. */
+    void rebuildChildIndex();
+    /*! Invalidates render cache of the parent, or notifies the owner if there is no parent. 
+     *  @note This is to be used when widget is drawn differently by its parent, but its own look does not change.
+     */
+    void invalidateParentRenderCache();
 
   protected:
 
@@ -122,7 +176,8 @@ class Widget : public Object
       PWidget widget;                       /*!< Child widget. */
     };
 
-    typedef Map<String, ChildData> ChildrenDataMap;
+    typedef DynamicArray<ChildData> ChildDataArray;
+    typedef Map<String, u32> ChildIndexMap;
 
   protected:
 
@@ -144,10 +199,14 @@ class Widget : public Object
     WidgetFrame* m_widgetFrame;
     /*! Pointer to parent widget. */
     Widget* m_parent;
-    /*! Children data map. */
-    ChildrenDataMap m_children;
+    /*! Children data array. Kept in order of addition. */
+    ChildDataArray m_children;
+    /*! Map of children indicies (into data array) keyed by name. */
+    ChildIndexMap m_childIndex;
     /*! Widget alignment. */
     Alignment m_alignment;
+    /*! Render cache. NULL if disabled. */
+    PRenderCache m_renderCache;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
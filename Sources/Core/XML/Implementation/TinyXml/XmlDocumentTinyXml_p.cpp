@@ -148,5 +148,10 @@ PXmlElement XmlDocumentPrivate::rootElement()
   return element;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlElementHandle XmlDocumentPrivate::rootHandle() const
+{
+  return XmlElementHandle(m_xml.RootElement());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
\ No newline at end of file
@@ -8,7 +8,7 @@
 */
 
 #include "EGE.h"
-#include "String.h"
+#include "EGEString.h"
 #include <tinyxml.h>
 
 EGE_NAMESPACE_BEGIN
@@ -43,6 +43,8 @@ class XmlDocumentPrivate
 
     /*! Returns root element. */
     PXmlElement rootElement();
+    /*! Returns handle to root element. */
+    XmlElementHandle rootHandle() const;
 
   private:
 
@@ -1,8 +1,9 @@
-#include "Core/Xml/Interface/XmlAttribute.h"
+#include "Core/XML/Interface/XmlAttribute.h"
+#include "Core/XML/Interface/XmlCompiledDocument.h"
 #include "EGEDebug.h"
 
 #if EGE_XML_TINYXML
-  #include "Core/XML/Implementation/TinyXml/XMLAttributeTinyXML_p.h"
+  #include "Core/XML/Implementation/TinyXml/XmlAttributeTinyXml_p.h"
 #endif // EGE_XML_TINYXML
 
 EGE_NAMESPACE_BEGIN
@@ -11,11 +12,22 @@ EGE_NAMESPACE_BEGIN
 EGE_DEFINE_NEW_OPERATORS(XmlAttribute)
 EGE_DEFINE_DELETE_OPERATORS(XmlAttribute)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-XmlAttribute::XmlAttribute() : Object(NULL)
+XmlAttribute::XmlAttribute() : Object(NULL), 
+                               m_document(NULL), 
+                               m_index(0), 
+                               m_endIndex(0)
 {
   m_p = ege_new XmlAttributePrivate(this);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlAttribute::XmlAttribute(const XmlCompiledDocument* document, u32 index, u32 endIndex) : Object(NULL), 
+                                                                                          m_p(NULL), 
+                                                                                          m_document(document), 
+                                                                                          m_index(index), 
+                                                                                          m_endIndex(endIndex)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 XmlAttribute::~XmlAttribute()
 {
   EGE_DELETE(m_p);
@@ -23,11 +35,21 @@ XmlAttribute::~XmlAttribute()
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool XmlAttribute::isValid() const
 {
+  if (NULL != m_document)
+  {
+    return m_index < m_endIndex;
+  }
+
   return (NULL != m_p) && m_p->isValid();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 String XmlAttribute::name() const
 {
+  if (NULL != m_document)
+  {
+    return isValid() ? String(m_document->string(m_document->attribute(m_index).name)) : String();
+  }
+
   if (isValid())
   {
     return p_func()->name();
@@ -38,6 +60,11 @@ String XmlAttribute::name() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 String XmlAttribute::value() const
 {
+  if (NULL != m_document)
+  {
+    return isValid() ? String(m_document->string(m_document->attribute(m_index).value)) : String();
+  }
+
   if (isValid())
   {
     return p_func()->value();
@@ -48,6 +75,11 @@ String XmlAttribute::value() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PXmlAttribute XmlAttribute::next() const
 {
+  if (NULL != m_document)
+  {
+    return isValid() ? m_document->createAttribute(m_index + 1, m_endIndex) : NULL;
+  }
+
   if (isValid())
   {
     return p_func()->next();
@@ -0,0 +1,551 @@
+#include "Core/XML/Interface/XmlCompiledDocument.h"
+#include "Core/XML/Interface/XmlDocument.h"
+#include "Core/XML/Interface/XmlElement.h"
+#include "Core/XML/Interface/XmlAttribute.h"
+#include "EGEDataBuffer.h"
+#include "EGEFile.h"
+#include "EGEHash.h"
+#include <string.h>
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(XmlCompiledDocument)
+EGE_DEFINE_DELETE_OPERATORS(XmlCompiledDocument)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+static const u32 KCompiledDocumentMagic   = 0x58454745;  // 'EGEX'
+static const u32 KCompiledDocumentVersion = 2;
+static const u32 KInvalidIndex            = 0xffffffff;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// NOTE: header consists of magic, version, string count, string data size, element count, attribute count and source hash
+static const s64 KHeaderSize    = 6 * sizeof (u32) + sizeof (u64);
+static const s64 KElementSize   = 6 * sizeof (u32);
+static const s64 KAttributeSize = 4 * sizeof (u32) + sizeof (s64) + sizeof (float32);
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlCompiledDocument::XmlCompiledDocument() : Object(NULL),
+                                             m_sourceHash(0)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlCompiledDocument::~XmlCompiledDocument()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlCompiledDocument::isValid() const
+{
+  return (NULL != m_buffer) && ! m_elements.empty();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult XmlCompiledDocument::Compile(const PXmlElement& root, const PDataBuffer& buffer, u64 sourceHash)
+{
+  if ((NULL == root) || ! root->isValid() || (NULL == buffer))
+  {
+    // error!
+    return EGE_ERROR_BAD_PARAM;
+  }
+
+  // build tables
+  CompileContext context;
+  CompileElement(root, context);
+
+  // calculate string data size
+  u32 stringDataSize = 0;
+  for (DynamicArray<String>::const_iterator it = context.strings.begin(); it != context.strings.end(); ++it)
+  {
+    stringDataSize += static_cast<u32>(it->length()) + 1;
+  }
+
+  // preallocate
+  const s64 size = KHeaderSize + context.strings.size() * sizeof (u32) + stringDataSize + context.elements.size() * KElementSize + 
+                   context.attributes.size() * KAttributeSize;
+  if (EGE_SUCCESS != buffer->setCapacity(buffer->writeOffset() + size))
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  // write header
+  *buffer << KCompiledDocumentMagic;
+  *buffer << KCompiledDocumentVersion;
+  *buffer << static_cast<u32>(context.strings.size());
+  *buffer << stringDataSize;
+  *buffer << static_cast<u32>(context.elements.size());
+  *buffer << static_cast<u32>(context.attributes.size());
+  *buffer << sourceHash;
+
+  // write string offsets
+  u32 offset = 0;
+  for (DynamicArray<String>::const_iterator it = context.strings.begin(); it != context.strings.end(); ++it)
+  {
+    *buffer << offset;
+    offset += static_cast<u32>(it->length()) + 1;
+  }
+
+  // write string data
+  for (DynamicArray<String>::const_iterator it = context.strings.begin(); it != context.strings.end(); ++it)
+  {
+    // NOTE: strings are stored null terminated so they can be referenced directly
+    buffer->write(it->toAscii(), it->length() + 1);
+  }
+
+  // write elements
+  for (ElementArray::const_iterator it = context.elements.begin(); it != context.elements.end(); ++it)
+  {
+    *buffer << it->name << it->text << it->firstAttribute << it->attributeCount << it->firstChild << it->nextSibling;
+  }
+
+  // write attributes
+  for (AttributeArray::const_iterator it = context.attributes.begin(); it != context.attributes.end(); ++it)
+  {
+    *buffer << it->name << it->value << it->flags << it->intValue << it->int64Value << it->floatValue;
+  }
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult XmlCompiledDocument::Compile(const String& xmlFileName, const String& fileName)
+{
+  EGEResult result;
+
+  PDataBuffer xmlData = ege_new DataBuffer();
+  PDataBuffer buffer  = ege_new DataBuffer();
+  if ((NULL == xmlData) || (NULL == buffer))
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  // load source document
+  // NOTE: raw data is kept so its hash can be stored
+  XmlDocument xml;
+  if ((EGE_SUCCESS != (result = ReadFile(xmlFileName, xmlData))) || (EGE_SUCCESS != (result = xml.load(xmlData))))
+  {
+    // error!
+    return result;
+  }
+
+  // compile
+  if (EGE_SUCCESS != (result = Compile(xml.rootElement(), buffer, SourceHash(xmlData))))
+  {
+    // error!
+    return result;
+  }
+
+  // store
+  File file(fileName);
+  if (EGE_SUCCESS != (result = file.open(EGEFile::MODE_WRITE_ONLY)))
+  {
+    // error!
+    return result;
+  }
+
+  if (buffer->size() != file.write(buffer))
+  {
+    // error!
+    return EGE_ERROR_IO;
+  }
+
+  file.close();
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u64 XmlCompiledDocument::SourceHash(const PDataBuffer& xmlData)
+{
+  return Hash::FromData64(reinterpret_cast<const u8*>(xmlData->data()), static_cast<s32>(xmlData->size()));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult XmlCompiledDocument::ReadFile(const String& fileName, const PDataBuffer& buffer)
+{
+  EGEResult result;
+
+  File file(fileName);
+  if ( ! file.exists())
+  {
+    // error!
+    return EGE_ERROR_NOT_FOUND;
+  }
+
+  if (EGE_SUCCESS != (result = file.open(EGEFile::MODE_READ_ONLY)))
+  {
+    // error!
+    return result;
+  }
+
+  // read entire file at once
+  s64 size = file.size();
+  if ((-1 == size) || (EGE_SUCCESS != buffer->setCapacity(size)) || (size != file.read(buffer, size)))
+  {
+    // error!
+    return EGE_ERROR_IO;
+  }
+
+  file.close();
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 XmlCompiledDocument::CompileElement(const PXmlElement& element, CompileContext& context)
+{
+  const u32 index = static_cast<u32>(context.elements.size());
+
+  Element entry;
+  entry.name           = InternString(element->name(), context);
+  entry.text           = InternString(element->text(), context);
+  entry.firstAttribute = static_cast<u32>(context.attributes.size());
+  entry.attributeCount = 0;
+  entry.firstChild     = KInvalidIndex;
+  entry.nextSibling    = KInvalidIndex;
+
+  // pre-parse attributes
+  PXmlAttribute xmlAttribute = element->firstAttribute();
+  while (xmlAttribute)
+  {
+    const String value = xmlAttribute->value();
+
+    Attribute attribute;
+    attribute.name       = InternString(xmlAttribute->name(), context);
+    attribute.value      = InternString(value, context);
+    attribute.flags      = 0;
+    attribute.intValue   = 0;
+    attribute.int64Value = 0;
+    attribute.floatValue = 0;
+
+    // NOTE: conversions are the same as the ones done by XmlElement::attribute overloads
+    bool error = false;
+    attribute.intValue = value.toInt(&error);
+    if ( ! error)
+    {
+      attribute.flags |= AF_INT;
+    }
+
+    error = false;
+    attribute.int64Value = value.toInt64(&error);
+    if ( ! error)
+    {
+      attribute.flags |= AF_INT64;
+    }
+
+    error = false;
+    attribute.floatValue = value.toFloat(&error);
+    if ( ! error)
+    {
+      attribute.flags |= AF_FLOAT;
+    }
+
+    error = false;
+    if (value.toBool(&error))
+    {
+      attribute.flags |= AF_BOOL_TRUE;
+    }
+
+    if ( ! error)
+    {
+      attribute.flags |= AF_BOOL;
+    }
+
+    context.attributes.push_back(attribute);
+    ++entry.attributeCount;
+
+    // go to next attribute
+    xmlAttribute = xmlAttribute->next();
+  }
+
+  // add element
+  // NOTE: element is added before children so it is always stored in pre-order
+  context.elements.push_back(entry);
+
+  // process children
+  u32 previousChild = KInvalidIndex;
+  PXmlElement child = element->firstChild();
+  while (child->isValid())
+  {
+    const u32 childIndex = CompileElement(child, context);
+
+    // link
+    if (KInvalidIndex == previousChild)
+    {
+      context.elements[index].firstChild = childIndex;
+    }
+    else
+    {
+      context.elements[previousChild].nextSibling = childIndex;
+    }
+
+    previousChild = childIndex;
+
+    // go to next child
+    child = child->nextChild();
+  }
+
+  return index;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 XmlCompiledDocument::InternString(const String& string, CompileContext& context)
+{
+  // check if already present
+  Map<String, u32>::const_iterator it = context.stringIndices.find(string);
+  if (it != context.stringIndices.end())
+  {
+    // done
+    return it->second;
+  }
+
+  // add new entry
+  const u32 index = static_cast<u32>(context.strings.size());
+  context.strings.push_back(string);
+  context.stringIndices.insert(string, index);
+
+  return index;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult XmlCompiledDocument::load(const String& fileName)
+{
+  EGEResult result;
+
+  PDataBuffer buffer = ege_new DataBuffer();
+  if (NULL == buffer)
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  if (EGE_SUCCESS != (result = ReadFile(fileName, buffer)))
+  {
+    // error!
+    return result;
+  }
+
+  return load(buffer);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult XmlCompiledDocument::load(const PDataBuffer& buffer)
+{
+  // reset
+  m_buffer = NULL;
+  m_strings.clear();
+  m_elements.clear();
+  m_attributes.clear();
+  m_sourceHash = 0;
+
+  if (NULL == buffer)
+  {
+    // error!
+    return EGE_ERROR_NOT_FOUND;
+  }
+
+  const s64 headerOffset = buffer->readOffset();
+  if (KHeaderSize > (buffer->size() - headerOffset))
+  {
+    // error!
+    return EGE_ERROR;
+  }
+
+  // read header
+  u32 magic;
+  u32 version;
+  u32 stringCount;
+  u32 stringDataSize;
+  u32 elementCount;
+  u32 attributeCount;
+  u64 sourceHash;
+  *buffer >> magic >> version >> stringCount >> stringDataSize >> elementCount >> attributeCount >> sourceHash;
+
+  if ((KCompiledDocumentMagic != magic) || (KCompiledDocumentVersion != version) || (0 == elementCount))
+  {
+    // error!
+    return EGE_ERROR_NOT_SUPPORTED;
+  }
+
+  // check if size is valid
+  const s64 expectedSize = KHeaderSize + static_cast<s64>(stringCount) * sizeof (u32) + stringDataSize + static_cast<s64>(elementCount) * KElementSize + 
+                           static_cast<s64>(attributeCount) * KAttributeSize;
+  if (expectedSize > (buffer->size() - headerOffset))
+  {
+    // error!
+    return EGE_ERROR;
+  }
+
+  // read string table
+  const s64 stringDataOffset = buffer->readOffset() + stringCount * sizeof (u32);
+
+  m_strings.reserve(stringCount);
+  for (u32 i = 0; i < stringCount; ++i)
+  {
+    u32 offset;
+    *buffer >> offset;
+
+    if (offset >= stringDataSize)
+    {
+      // error!
+      m_strings.clear();
+      return EGE_ERROR;
+    }
+
+    // NOTE: strings are referenced in place so each of them needs to be terminated within string data
+    const char* string = reinterpret_cast<const char*>(buffer->data(stringDataOffset + offset));
+    if (NULL == memchr(string, '\0', stringDataSize - offset))
+    {
+      // error!
+      m_strings.clear();
+      return EGE_ERROR;
+    }
+
+    m_strings.push_back(string);
+  }
+
+  buffer->setReadOffset(stringDataOffset + stringDataSize);
+
+  // read element table
+  m_elements.resize(elementCount);
+  for (ElementArray::iterator it = m_elements.begin(); it != m_elements.end(); ++it)
+  {
+    *buffer >> it->name >> it->text >> it->firstAttribute >> it->attributeCount >> it->firstChild >> it->nextSibling;
+  }
+
+  // read attribute table
+  m_attributes.resize(attributeCount);
+  for (AttributeArray::iterator it = m_attributes.begin(); it != m_attributes.end(); ++it)
+  {
+    *buffer >> it->name >> it->value >> it->flags >> it->intValue >> it->int64Value >> it->floatValue;
+  }
+
+  // validate references
+  for (ElementArray::const_iterator it = m_elements.begin(); it != m_elements.end(); ++it)
+  {
+    if ((it->name >= stringCount) || (it->text >= stringCount) || (it->firstAttribute + it->attributeCount > attributeCount) || 
+        ((KInvalidIndex != it->firstChild) && (it->firstChild >= elementCount)) || 
+        ((KInvalidIndex != it->nextSibling) && (it->nextSibling >= elementCount)))
+    {
+      // error!
+      m_elements.clear();
+      m_attributes.clear();
+      m_strings.clear();
+      return EGE_ERROR;
+    }
+  }
+
+  for (AttributeArray::const_iterator it = m_attributes.begin(); it != m_attributes.end(); ++it)
+  {
+    if ((it->name >= stringCount) || (it->value >= stringCount))
+    {
+      // error!
+      m_elements.clear();
+      m_attributes.clear();
+      m_strings.clear();
+      return EGE_ERROR;
+    }
+  }
+
+  m_buffer     = buffer;
+  m_sourceHash = sourceHash;
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PXmlElement XmlCompiledDocument::firstChild(const String& name)
+{
+  return createElement(isValid() ? findElement(0, name.toAscii()) : KInvalidIndex);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PXmlElement XmlCompiledDocument::rootElement()
+{
+  return createElement(isValid() ? 0 : KInvalidIndex);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlElementHandle XmlCompiledDocument::rootHandle() const
+{
+  return isValid() ? XmlElementHandle(this, 0) : XmlElementHandle();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlCompiledDocument::isUpToDate(const String& xmlFileName) const
+{
+  // check if XML is not available
+  if ( ! File::Exists(xmlFileName))
+  {
+    // nothing to compare with
+    return true;
+  }
+
+  PDataBuffer xmlData = ege_new DataBuffer();
+  if ((NULL == xmlData) || (EGE_SUCCESS != ReadFile(xmlFileName, xmlData)))
+  {
+    // error!
+    return false;
+  }
+
+  return isValid() && (SourceHash(xmlData) == m_sourceHash);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlCompiledDocument::isValidElement(u32 index) const
+{
+  return index < m_elements.size();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlCompiledDocument::string(u32 index) const
+{
+  return m_strings[index];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const XmlCompiledDocument::Element& XmlCompiledDocument::element(u32 index) const
+{
+  return m_elements[index];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const XmlCompiledDocument::Attribute& XmlCompiledDocument::attribute(u32 index) const
+{
+  return m_attributes[index];
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 XmlCompiledDocument::findElement(u32 index, const char* name) const
+{
+  const bool anyName = (NULL == name) || ('\0' == *name);
+
+  // go thru all siblings
+  while (KInvalidIndex != index)
+  {
+    const Element& entry = m_elements[index];
+
+    // check if found
+    if (anyName || (0 == strcmp(name, string(entry.name))))
+    {
+      // found
+      break;
+    }
+
+    index = entry.nextSibling;
+  }
+
+  return index;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const XmlCompiledDocument::Attribute* XmlCompiledDocument::findAttribute(u32 elementIndex, const char* name) const
+{
+  const Element& entry = m_elements[elementIndex];
+
+  // go thru all attributes of element
+  for (u32 i = entry.firstAttribute; i < entry.firstAttribute + entry.attributeCount; ++i)
+  {
+    const Attribute& attribute = m_attributes[i];
+    if (0 == strcmp(name, string(attribute.name)))
+    {
+      // found
+      return &attribute;
+    }
+  }
+
+  return NULL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PXmlElement XmlCompiledDocument::createElement(u32 index) const
+{
+  return ege_new XmlElement(this, index);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PXmlAttribute XmlCompiledDocument::createAttribute(u32 index, u32 endIndex) const
+{
+  return (index < endIndex) ? ege_new XmlAttribute(this, index, endIndex) : NULL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
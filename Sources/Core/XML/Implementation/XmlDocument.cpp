@@ -1,10 +1,10 @@
-#include "Core/XML/Interface/XMLDocument.h"
-#include "Core/XML/Interface/XMLElement.h"
+#include "Core/XML/Interface/XmlDocument.h"
+#include "Core/XML/Interface/XmlElement.h"
 #include "EGEDataBuffer.h"
 #include "EGEFile.h"
 
 #if EGE_XML_TINYXML
-  #include "Core/XML/Implementation/TinyXml/XMLDocumentTinyXML_p.h"
+  #include "Core/XML/Implementation/TinyXml/XmlDocumentTinyXml_p.h"
 #endif // EGE_XML_TINYXML
 
 EGE_NAMESPACE_BEGIN
@@ -111,5 +111,15 @@ PXmlElement XmlDocument::rootElement()
   return NULL;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlElementHandle XmlDocument::rootHandle() const
+{
+  if (isValid())
+  {
+    return p_func()->rootHandle();
+  }
+
+  return XmlElementHandle();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
\ No newline at end of file
@@ -1,9 +1,10 @@
-#include "Core/Xml/Interface/XmlElement.h"
-#include "Core/Xml/Interface/XmlAttribute.h"
+#include "Core/XML/Interface/XmlElement.h"
+#include "Core/XML/Interface/XmlAttribute.h"
+#include "Core/XML/Interface/XmlCompiledDocument.h"
 #include "EGEStringUtils.h"
 
 #if EGE_XML_TINYXML
-  #include "Core/XML/Implementation/TinyXml/XMLElementTinyXML_p.h"
+  #include "Core/XML/Implementation/TinyXml/XmlElementTinyXml_p.h"
 #endif // EGE_XML_TINYXML
 
 EGE_NAMESPACE_BEGIN
@@ -12,18 +13,31 @@ EGE_NAMESPACE_BEGIN
 EGE_DEFINE_NEW_OPERATORS(XmlElement)
 EGE_DEFINE_DELETE_OPERATORS(XmlElement)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-XmlElement::XmlElement() : Object(NULL)
+XmlElement::XmlElement() : Object(NULL), 
+                           m_document(NULL), 
+                           m_index(0)
 {
   m_p = ege_new XmlElementPrivate(this);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-XmlElement::XmlElement(const String& name) : Object(NULL)
+XmlElement::XmlElement(const String& name) : Object(NULL), 
+                                              m_document(NULL), 
+                                              m_index(0)
 {
   m_p = ege_new XmlElementPrivate(this, name);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 XmlElement::XmlElement(XmlElementPrivate* p) : Object(NULL), 
-                                               m_p(p)
+                                               m_p(p), 
+                                               m_document(NULL), 
+                                               m_index(0)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlElement::XmlElement(const XmlCompiledDocument* document, u32 index) : Object(NULL), 
+                                                                        m_p(NULL), 
+                                                                        m_document(document), 
+                                                                        m_index(index)
 {
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -34,11 +48,22 @@ XmlElement::~XmlElement()
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool XmlElement::isValid() const
 {
+  if (NULL != m_document)
+  {
+    return m_document->isValidElement(m_index);
+  }
+
   return (NULL != m_p) && m_p->isValid();
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 String XmlElement::attribute(const String& name, const String& defValue) const
 {
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name.toAscii()) : NULL;
+    return (NULL != attribute) ? String(m_document->string(attribute->value)) : defValue;
+  }
+
   if (isValid())
   {
     return p_func()->attribute(name, defValue);
@@ -49,6 +74,11 @@ String XmlElement::attribute(const String& name, const String& defValue) const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 String XmlElement::attribute(const String& name, const char* defValue) const
 {
+  if (NULL != m_document)
+  {
+    return attribute(name, String(defValue));
+  }
+
   if (isValid())
   {
     return p_func()->attribute(name, String(defValue));
@@ -61,7 +91,16 @@ s32 XmlElement::attribute(const String& name, s32 defValue) const
 {
   s32 value = defValue;
 
-  if (isValid())
+  if (NULL != m_document)
+  {
+    // NOTE: compiled documents carry pre-parsed values
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name.toAscii()) : NULL;
+    if ((NULL != attribute) && (attribute->flags & XmlCompiledDocument::AF_INT))
+    {
+      value = attribute->intValue;
+    }
+  }
+  else if (isValid())
   {
     bool error = false;
     value = p_func()->attribute(name, "").toInt(&error);
@@ -78,7 +117,15 @@ bool XmlElement::attribute(const String& name, bool defValue) const
 {
   bool value = defValue;
 
-  if (isValid())
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name.toAscii()) : NULL;
+    if ((NULL != attribute) && (attribute->flags & XmlCompiledDocument::AF_BOOL))
+    {
+      value = (0 != (attribute->flags & XmlCompiledDocument::AF_BOOL_TRUE));
+    }
+  }
+  else if (isValid())
   {
     bool error = false;
     value = p_func()->attribute(name, "").toBool(&error);
@@ -95,7 +142,15 @@ s64 XmlElement::attribute(const String& name, s64 defValue) const
 {
   s64 value = defValue;
 
-  if (isValid())
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name.toAscii()) : NULL;
+    if ((NULL != attribute) && (attribute->flags & XmlCompiledDocument::AF_INT64))
+    {
+      value = attribute->int64Value;
+    }
+  }
+  else if (isValid())
   {
     bool error = false;
     value = p_func()->attribute(name, "").toInt64(&error);
@@ -112,7 +167,15 @@ float32 XmlElement::attribute(const String& name, float32 defValue) const
 {
   float32 value = defValue;
 
-  if (isValid())
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name.toAscii()) : NULL;
+    if ((NULL != attribute) && (attribute->flags & XmlCompiledDocument::AF_FLOAT))
+    {
+      value = attribute->floatValue;
+    }
+  }
+  else if (isValid())
   {
     bool error = false;
     value = p_func()->attribute(name, "").toFloat(&error);
@@ -132,7 +195,7 @@ Time XmlElement::attribute(const String& name, const Time& defValue) const
   if (isValid())
   {
     bool error = false;
-    value = StringUtils::ToTime(p_func()->attribute(name, ""), &error);
+    value = StringUtils::ToTime(attribute(name, ""), &error);
     if (error)
     {
       value = defValue;
@@ -144,6 +207,11 @@ Time XmlElement::attribute(const String& name, const Time& defValue) const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool XmlElement::hasAttribute(const String& name) const
 {
+  if (NULL != m_document)
+  {
+    return isValid() && (NULL != m_document->findAttribute(m_index, name.toAscii()));
+  }
+
   if (isValid())
   {
     return p_func()->hasAttribute(name);
@@ -154,7 +222,7 @@ bool XmlElement::hasAttribute(const String& name) const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool XmlElement::setAttribute(const String& name, const char* value)
 {
-  if (isValid())
+  if ((NULL == m_document) && isValid())
   {
     return p_func()->setAttribute(name, String(value));
   }
@@ -164,7 +232,7 @@ bool XmlElement::setAttribute(const String& name, const char* value)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool XmlElement::setAttribute(const String& name, const String& value)
 {
-  if (isValid())
+  if ((NULL == m_document) && isValid())
   {
     return p_func()->setAttribute(name, value);
   }
@@ -174,7 +242,7 @@ bool XmlElement::setAttribute(const String& name, const String& value)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool XmlElement::setAttribute(const String& name, bool value)
 {
-  if (isValid())
+  if ((NULL == m_document) && isValid())
   {
     return p_func()->setAttribute(name, value ? "true" : "false");
   }
@@ -184,7 +252,7 @@ bool XmlElement::setAttribute(const String& name, bool value)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool XmlElement::setAttribute(const String& name, s32 value)
 {
-  if (isValid())
+  if ((NULL == m_document) && isValid())
   {
     return p_func()->setAttribute(name, String::Format("%d", value));
   }
@@ -194,7 +262,7 @@ bool XmlElement::setAttribute(const String& name, s32 value)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool XmlElement::setAttribute(const String& name, s64 value)
 {
-  if (isValid())
+  if ((NULL == m_document) && isValid())
   {
     return p_func()->setAttribute(name, String::Format("%ld", value));
   }
@@ -204,7 +272,7 @@ bool XmlElement::setAttribute(const String& name, s64 value)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool XmlElement::setAttribute(const String& name, float32 value)
 {
-  if (isValid())
+  if ((NULL == m_document) && isValid())
   {
     return p_func()->setAttribute(name, String::Format("%f", value));
   }
@@ -219,16 +287,31 @@ bool XmlElement::setAttribute(const String& name, const Time& value)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PXmlElement XmlElement::firstChild(const String& name) const
 {
+  if (NULL != m_document)
+  {
+    return m_document->createElement(isValid() ? m_document->findElement(m_document->element(m_index).firstChild, name.toAscii()) : m_index);
+  }
+
   return ege_new XmlElement(isValid() ? p_func()->firstChild(name) : NULL);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PXmlElement XmlElement::nextChild(const String& name) const
 {
+  if (NULL != m_document)
+  {
+    return m_document->createElement(isValid() ? m_document->findElement(m_document->element(m_index).nextSibling, name.toAscii()) : m_index);
+  }
+
   return ege_new XmlElement(isValid() ? p_func()->nextChild(name) : NULL);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 String XmlElement::name() const
 {
+  if (NULL != m_document)
+  {
+    return isValid() ? String(m_document->string(m_document->element(m_index).name)) : String();
+  }
+
   if (isValid())
   {
     return p_func()->name();
@@ -239,7 +322,8 @@ String XmlElement::name() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool XmlElement::appendChildElement(const PXmlElement& element)
 {
-  if (isValid())
+  // NOTE: compiled documents are read-only
+  if ((NULL == m_document) && isValid() && (NULL == element->m_document))
   {
     return p_func()->appendChildElement(element->p_func());
   }
@@ -249,6 +333,17 @@ bool XmlElement::appendChildElement(const PXmlElement& element)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PXmlAttribute XmlElement::firstAttribute() const
 {
+  if (NULL != m_document)
+  {
+    if (isValid())
+    {
+      const XmlCompiledDocument::Element& element = m_document->element(m_index);
+      return m_document->createAttribute(element.firstAttribute, element.firstAttribute + element.attributeCount);
+    }
+
+    return NULL;
+  }
+
   if (isValid())
   {
     return p_func()->firstAttribute();
@@ -259,6 +354,11 @@ PXmlAttribute XmlElement::firstAttribute() const
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 String XmlElement::text() const
 {
+  if (NULL != m_document)
+  {
+    return isValid() ? String(m_document->string(m_document->element(m_index).text)) : String();
+  }
+
   if (isValid())
   {
     return p_func()->text();
@@ -267,5 +367,20 @@ String XmlElement::text() const
   return "";
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlElementHandle XmlElement::handle() const
+{
+  if (NULL != m_document)
+  {
+    return XmlElementHandle(m_document, m_index);
+  }
+
+  if (isValid())
+  {
+    return XmlElementHandle(p_func()->element(false));
+  }
+
+  return XmlElementHandle();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,426 @@
+#include "Core/XML/Interface/XmlHandle.h"
+#include "Core/XML/Interface/XmlCompiledDocument.h"
+#include "EGEStringUtils.h"
+#include <string.h>
+
+#if EGE_XML_TINYXML
+  #include <tinyxml.h>
+#endif // EGE_XML_TINYXML
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+#if EGE_XML_TINYXML
+/*! Local function casting opaque element pointer into TinyXML one. */
+static inline const TiXmlElement* NativeElement(const void* element)
+{
+  return reinterpret_cast<const TiXmlElement*>(element);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function casting opaque attribute pointer into TinyXML one. */
+static inline const TiXmlAttribute* NativeAttribute(const void* attribute)
+{
+  return reinterpret_cast<const TiXmlAttribute*>(attribute);
+}
+#endif // EGE_XML_TINYXML
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlAttributeHandle::XmlAttributeHandle() : m_attribute(NULL), 
+                                           m_document(NULL), 
+                                           m_index(0), 
+                                           m_endIndex(0)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlAttributeHandle::XmlAttributeHandle(const void* attribute) : m_attribute(attribute), 
+                                                                m_document(NULL), 
+                                                                m_index(0), 
+                                                                m_endIndex(0)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlAttributeHandle::XmlAttributeHandle(const XmlCompiledDocument* document, u32 index, u32 endIndex) : m_attribute(NULL), 
+                                                                                                      m_document(document), 
+                                                                                                      m_index(index), 
+                                                                                                      m_endIndex(endIndex)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlAttributeHandle::isValid() const
+{
+  if (NULL != m_document)
+  {
+    return m_index < m_endIndex;
+  }
+
+  return NULL != m_attribute;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlAttributeHandle::name() const
+{
+  if ( ! isValid())
+  {
+    return "";
+  }
+
+  if (NULL != m_document)
+  {
+    return m_document->string(m_document->attribute(m_index).name);
+  }
+
+#if EGE_XML_TINYXML
+  return NativeAttribute(m_attribute)->Name();
+#else
+  return "";
+#endif // EGE_XML_TINYXML
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlAttributeHandle::value() const
+{
+  if ( ! isValid())
+  {
+    return "";
+  }
+
+  if (NULL != m_document)
+  {
+    return m_document->string(m_document->attribute(m_index).value);
+  }
+
+#if EGE_XML_TINYXML
+  return NativeAttribute(m_attribute)->Value();
+#else
+  return "";
+#endif // EGE_XML_TINYXML
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlAttributeHandle XmlAttributeHandle::next() const
+{
+  if ( ! isValid())
+  {
+    return XmlAttributeHandle();
+  }
+
+  if (NULL != m_document)
+  {
+    return XmlAttributeHandle(m_document, m_index + 1, m_endIndex);
+  }
+
+#if EGE_XML_TINYXML
+  return XmlAttributeHandle(NativeAttribute(m_attribute)->Next());
+#else
+  return XmlAttributeHandle();
+#endif // EGE_XML_TINYXML
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlElementHandle::XmlElementHandle() : m_element(NULL), 
+                                       m_document(NULL), 
+                                       m_index(0)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlElementHandle::XmlElementHandle(const void* element) : m_element(element), 
+                                                          m_document(NULL), 
+                                                          m_index(0)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlElementHandle::XmlElementHandle(const XmlCompiledDocument* document, u32 index) : m_element(NULL), 
+                                                                                    m_document(document), 
+                                                                                    m_index(index)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlElementHandle::isValid() const
+{
+  if (NULL != m_document)
+  {
+    return m_document->isValidElement(m_index);
+  }
+
+  return NULL != m_element;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlElementHandle::name() const
+{
+  if ( ! isValid())
+  {
+    return "";
+  }
+
+  if (NULL != m_document)
+  {
+    return m_document->string(m_document->element(m_index).name);
+  }
+
+#if EGE_XML_TINYXML
+  return NativeElement(m_element)->Value();
+#else
+  return "";
+#endif // EGE_XML_TINYXML
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlElementHandle::hasName(const char* name) const
+{
+  return isValid() && (0 == strcmp(this->name(), name));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlElementHandle::text() const
+{
+  if ( ! isValid())
+  {
+    return "";
+  }
+
+  if (NULL != m_document)
+  {
+    return m_document->string(m_document->element(m_index).text);
+  }
+
+#if EGE_XML_TINYXML
+  // go thru all child siblings
+  for (const TiXmlNode* node = NativeElement(m_element)->FirstChild(); NULL != node; node = node->NextSibling())
+  {
+    // check if text node
+    if (TiXmlNode::TINYXML_TEXT == node->Type())
+    {
+      // found
+      return node->Value();
+    }
+  }
+#endif // EGE_XML_TINYXML
+
+  return "";
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlElementHandle::hasAttribute(const char* name) const
+{
+  return NULL != attribute(name, static_cast<const char*>(NULL));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlElementHandle::attribute(const char* name, const char* defValue) const
+{
+  const char* value = NULL;
+
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name) : NULL;
+    if (NULL != attribute)
+    {
+      value = m_document->string(attribute->value);
+    }
+  }
+#if EGE_XML_TINYXML
+  else if (isValid())
+  {
+    value = NativeElement(m_element)->Attribute(name);
+  }
+#endif // EGE_XML_TINYXML
+
+  return (NULL != value) ? value : defValue;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 XmlElementHandle::attribute(const char* name, s32 defValue) const
+{
+  // check if compiled document
+  // NOTE: compiled documents carry pre-parsed values
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name) : NULL;
+    return ((NULL != attribute) && (attribute->flags & XmlCompiledDocument::AF_INT)) ? attribute->intValue : defValue;
+  }
+
+  const char* text = attribute(name, "");
+  if ('\0' == *text)
+  {
+    return defValue;
+  }
+
+  bool error = false;
+  s32 value = StringUtils::ToInt(text, &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlElementHandle::attribute(const char* name, bool defValue) const
+{
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name) : NULL;
+    return ((NULL != attribute) && (attribute->flags & XmlCompiledDocument::AF_BOOL)) ? (0 != (attribute->flags & XmlCompiledDocument::AF_BOOL_TRUE)) 
+                                                                                    : defValue;
+  }
+
+  bool error = false;
+  bool value = StringUtils::ToBool(attribute(name, ""), &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+float32 XmlElementHandle::attribute(const char* name, float32 defValue) const
+{
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name) : NULL;
+    return ((NULL != attribute) && (attribute->flags & XmlCompiledDocument::AF_FLOAT)) ? attribute->floatValue : defValue;
+  }
+
+  bool error = false;
+  float32 value = StringUtils::ToFloat(attribute(name, ""), &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Vector2f XmlElementHandle::attribute(const char* name, const Vector2f& defValue) const
+{
+  bool error = false;
+  Vector2f value = StringUtils::ToVector2f(attribute(name, ""), &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Rectf XmlElementHandle::attribute(const char* name, const Rectf& defValue) const
+{
+  bool error = false;
+  Rectf value = StringUtils::ToRectf(attribute(name, ""), &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Color XmlElementHandle::attribute(const char* name, const Color& defValue) const
+{
+  bool error = false;
+  Color value = StringUtils::ToColor(attribute(name, ""), &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 XmlElementHandle::intAttribute(const char* name, bool* error) const
+{
+  // check if compiled document
+  // NOTE: compiled documents carry pre-parsed values
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name) : NULL;
+    if ((NULL != attribute) && (attribute->flags & XmlCompiledDocument::AF_INT))
+    {
+      return attribute->intValue;
+    }
+
+    if (error)
+    {
+      *error = true;
+    }
+
+    return 0;
+  }
+
+  const char* text = attribute(name, "");
+  if ('\0' == *text)
+  {
+    if (error)
+    {
+      *error = true;
+    }
+
+    return 0;
+  }
+
+  return StringUtils::ToInt(text, error);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlElementHandle::boolAttribute(const char* name, bool* error) const
+{
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name) : NULL;
+    if ((NULL != attribute) && (attribute->flags & XmlCompiledDocument::AF_BOOL))
+    {
+      return 0 != (attribute->flags & XmlCompiledDocument::AF_BOOL_TRUE);
+    }
+
+    if (error)
+    {
+      *error = true;
+    }
+
+    return false;
+  }
+
+  return StringUtils::ToBool(attribute(name, ""), error);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+float32 XmlElementHandle::floatAttribute(const char* name, bool* error) const
+{
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Attribute* attribute = isValid() ? m_document->findAttribute(m_index, name) : NULL;
+    if ((NULL != attribute) && (attribute->flags & XmlCompiledDocument::AF_FLOAT))
+    {
+      return attribute->floatValue;
+    }
+
+    if (error)
+    {
+      *error = true;
+    }
+
+    return 0;
+  }
+
+  return StringUtils::ToFloat(attribute(name, ""), error);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlAttributeHandle XmlElementHandle::firstAttribute() const
+{
+  if ( ! isValid())
+  {
+    return XmlAttributeHandle();
+  }
+
+  if (NULL != m_document)
+  {
+    const XmlCompiledDocument::Element& element = m_document->element(m_index);
+    return XmlAttributeHandle(m_document, element.firstAttribute, element.firstAttribute + element.attributeCount);
+  }
+
+#if EGE_XML_TINYXML
+  return XmlAttributeHandle(NativeElement(m_element)->FirstAttribute());
+#else
+  return XmlAttributeHandle();
+#endif // EGE_XML_TINYXML
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlElementHandle XmlElementHandle::firstChild(const char* name) const
+{
+  if ( ! isValid())
+  {
+    return XmlElementHandle();
+  }
+
+  if (NULL != m_document)
+  {
+    return XmlElementHandle(m_document, m_document->findElement(m_document->element(m_index).firstChild, name));
+  }
+
+#if EGE_XML_TINYXML
+  return XmlElementHandle((NULL == name) ? NativeElement(m_element)->FirstChildElement() : NativeElement(m_element)->FirstChildElement(name));
+#else
+  return XmlElementHandle();
+#endif // EGE_XML_TINYXML
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlElementHandle XmlElementHandle::nextChild(const char* name) const
+{
+  if ( ! isValid())
+  {
+    return XmlElementHandle();
+  }
+
+  if (NULL != m_document)
+  {
+    return XmlElementHandle(m_document, m_document->findElement(m_document->element(m_index).nextSibling, name));
+  }
+
+#if EGE_XML_TINYXML
+  return XmlElementHandle((NULL == name) ? NativeElement(m_element)->NextSiblingElement() : NativeElement(m_element)->NextSiblingElement(name));
+#else
+  return XmlElementHandle();
+#endif // EGE_XML_TINYXML
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,670 @@
+#include "Core/XML/Interface/XmlPullParser.h"
+#include "EGEDataBuffer.h"
+#include "EGEFile.h"
+#include "EGEStringUtils.h"
+#include <string.h>
+#include <stdlib.h>
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(XmlPullParser)
+EGE_DEFINE_DELETE_OPERATORS(XmlPullParser)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function returning TRUE if given character is a whitespace. */
+static inline bool IsSpace(char c)
+{
+  return (' ' == c) || ('\t' == c) || ('\n' == c) || ('\r' == c);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function returning TRUE if given character terminates element or attribute name. */
+static inline bool IsNameTerminator(char c)
+{
+  return ('\0' == c) || IsSpace(c) || ('/' == c) || ('>' == c) || ('=' == c);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function decoding entity at given source position into given destination. 
+ *  @param  source       Source text starting with ampersand.
+ *  @param  destination  Destination to write decoded characters to. Updated accordingly.
+ *  @return Number of source characters consumed.
+ *  @note Decoded representation is never longer than encoded one so it is safe to decode in place.
+ */
+static u32 DecodeEntity(const char* source, char*& destination)
+{
+  struct Entity
+  {
+    const char* text;
+    u32 length;
+    char value;
+  };
+
+  static const Entity KEntities[] = { { "&lt;", 4, '<' }, { "&gt;", 4, '>' }, { "&amp;", 5, '&' }, { "&quot;", 6, '"' }, { "&apos;", 6, '\'' } };
+
+  // check named entities
+  for (u32 i = 0; i < sizeof (KEntities) / sizeof (Entity); ++i)
+  {
+    if (0 == strncmp(source, KEntities[i].text, KEntities[i].length))
+    {
+      *destination++ = KEntities[i].value;
+      return KEntities[i].length;
+    }
+  }
+
+  // check character references
+  if ('#' == source[1])
+  {
+    const bool hex    = ('x' == source[2]);
+    const char* start = source + (hex ? 3 : 2);
+    char* end;
+
+    unsigned long code = strtoul(start, &end, hex ? 16 : 10);
+    if ((end != start) && (';' == *end) && (0 < code) && (0x110000 > code))
+    {
+      // encode as UTF-8
+      if (0x80 > code)
+      {
+        *destination++ = static_cast<char>(code);
+      }
+      else if (0x800 > code)
+      {
+        *destination++ = static_cast<char>(0xc0 | (code >> 6));
+        *destination++ = static_cast<char>(0x80 | (code & 0x3f));
+      }
+      else if (0x10000 > code)
+      {
+        *destination++ = static_cast<char>(0xe0 | (code >> 12));
+        *destination++ = static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+        *destination++ = static_cast<char>(0x80 | (code & 0x3f));
+      }
+      else
+      {
+        *destination++ = static_cast<char>(0xf0 | (code >> 18));
+        *destination++ = static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+        *destination++ = static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+        *destination++ = static_cast<char>(0x80 | (code & 0x3f));
+      }
+
+      return static_cast<u32>(end - source) + 1;
+    }
+  }
+
+  // unknown entity, copy as is
+  *destination++ = *source;
+  return 1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlPullParser::XmlPullParser() : Object(NULL), 
+                                 m_cursor(NULL), 
+                                 m_markupPending(false), 
+                                 m_endPending(false), 
+                                 m_event(EVENT_NONE), 
+                                 m_name(""), 
+                                 m_text("")
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlPullParser::~XmlPullParser()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult XmlPullParser::open(const String& fileName)
+{
+  EGEResult result;
+
+  File file(fileName);
+  if ( ! file.exists())
+  {
+    // error!
+    return EGE_ERROR_NOT_FOUND;
+  }
+
+  if (EGE_SUCCESS != (result = file.open(EGEFile::MODE_READ_ONLY)))
+  {
+    // error!
+    return result;
+  }
+
+  PDataBuffer buffer = ege_new DataBuffer();
+  if (NULL == buffer)
+  {
+    // error!
+    return EGE_ERROR_NO_MEMORY;
+  }
+
+  // read entire file at once
+  // NOTE: additional byte is reserved for null terminator
+  s64 size = file.size();
+  if ((-1 == size) || (EGE_SUCCESS != buffer->setCapacity(size + 1)) || (size != file.read(buffer, size)))
+  {
+    // error!
+    return EGE_ERROR_IO;
+  }
+
+  file.close();
+
+  return open(buffer);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult XmlPullParser::open(const PDataBuffer& buffer)
+{
+  // reset
+  m_buffer        = NULL;
+  m_cursor        = NULL;
+  m_markupPending = false;
+  m_endPending    = false;
+  m_event         = EVENT_NONE;
+  m_name          = "";
+  m_text          = "";
+  m_attributes.clear();
+  m_elements.clear();
+
+  if (NULL == buffer)
+  {
+    // error!
+    return EGE_ERROR_NOT_FOUND;
+  }
+
+  // make sure data is null terminated
+  if ((0 == buffer->size()) || ('\0' != *reinterpret_cast<const char*>(buffer->data(buffer->size() - 1))))
+  {
+    s8 null = 0;
+    buffer->setWriteOffset(buffer->size());
+    if (1 != buffer->write(&null, 1))
+    {
+      // error!
+      return EGE_ERROR_NO_MEMORY;
+    }
+  }
+
+  m_buffer = buffer;
+  m_cursor = reinterpret_cast<char*>(buffer->data(buffer->readOffset()));
+
+  // skip UTF-8 byte order mark
+  if (0 == strncmp(m_cursor, "\xef\xbb\xbf", 3))
+  {
+    m_cursor += 3;
+  }
+
+  // preallocate so no allocations are done for typical documents while parsing
+  m_attributes.reserve(16);
+  m_elements.reserve(16);
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlPullParser::Event XmlPullParser::next()
+{
+  // check if nothing more to process
+  if ((NULL == m_cursor) || (EVENT_ERROR == m_event) || (EVENT_END_DOCUMENT == m_event))
+  {
+    return (NULL == m_cursor) ? error() : m_event;
+  }
+
+  // clean up after previous event
+  if (EVENT_END_ELEMENT == m_event)
+  {
+    m_elements.pop_back();
+  }
+
+  m_attributes.clear();
+  m_name = "";
+  m_text = "";
+
+  // check if empty element is to be closed
+  if (m_endPending)
+  {
+    m_endPending = false;
+    m_name       = m_elements.back();
+    m_event      = EVENT_END_ELEMENT;
+    return m_event;
+  }
+
+  while (true)
+  {
+    // check if markup
+    if (m_markupPending || ('<' == *m_cursor))
+    {
+      m_markupPending = false;
+      ++m_cursor;
+
+      if ('?' == *m_cursor)
+      {
+        // skip processing instruction
+        if ( ! skipPast("?>"))
+        {
+          return error();
+        }
+      }
+      else if (0 == strncmp(m_cursor, "!--", 3))
+      {
+        // skip comment
+        if ( ! skipPast("-->"))
+        {
+          return error();
+        }
+      }
+      else if (0 == strncmp(m_cursor, "![CDATA[", 8))
+      {
+        char* text = m_cursor + 8;
+        char* end  = strstr(text, "]]>");
+        if (NULL == end)
+        {
+          return error();
+        }
+
+        *end     = '\0';
+        m_cursor = end + 3;
+        m_text   = text;
+        m_event  = EVENT_TEXT;
+        return m_event;
+      }
+      else if ('!' == *m_cursor)
+      {
+        // skip document type declaration including internal subset
+        s32 brackets = 0;
+        while (('\0' != *m_cursor) && (('>' != *m_cursor) || (0 < brackets)))
+        {
+          if ('[' == *m_cursor)
+          {
+            ++brackets;
+          }
+          else if (']' == *m_cursor)
+          {
+            --brackets;
+          }
+
+          ++m_cursor;
+        }
+
+        if ('\0' == *m_cursor)
+        {
+          return error();
+        }
+
+        ++m_cursor;
+      }
+      else if ('/' == *m_cursor)
+      {
+        ++m_cursor;
+        return parseEndTag();
+      }
+      else
+      {
+        return parseStartTag();
+      }
+    }
+    // check if end of data
+    else if ('\0' == *m_cursor)
+    {
+      // NOTE: all elements should be closed by now
+      if ( ! m_elements.empty())
+      {
+        return error();
+      }
+
+      m_event = EVENT_END_DOCUMENT;
+      return m_event;
+    }
+    // process text
+    else if (EVENT_TEXT == parseText())
+    {
+      return m_event;
+    }
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult XmlPullParser::skipElement()
+{
+  if (EVENT_START_ELEMENT != m_event)
+  {
+    // error!
+    return EGE_ERROR;
+  }
+
+  const s32 elementDepth = depth();
+
+  // process until element is closed
+  Event event;
+  while ((EVENT_ERROR != (event = next())) && (EVENT_END_DOCUMENT != event))
+  {
+    if ((EVENT_END_ELEMENT == event) && (elementDepth == depth()))
+    {
+      // done
+      return EGE_SUCCESS;
+    }
+  }
+
+  return EGE_ERROR;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlPullParser::Event XmlPullParser::parseStartTag()
+{
+  char* name = m_cursor;
+
+  // find end of name
+  while ( ! IsNameTerminator(*m_cursor))
+  {
+    ++m_cursor;
+  }
+
+  if (name == m_cursor)
+  {
+    // error!
+    return error();
+  }
+
+  // terminate name
+  // NOTE: c holds character which has been overwritten, cursor points past it
+  char c = *m_cursor;
+  *m_cursor++ = '\0';
+
+  // process attributes
+  while (true)
+  {
+    while (IsSpace(c))
+    {
+      c = *m_cursor++;
+    }
+
+    // check if end of tag
+    if ('>' == c)
+    {
+      break;
+    }
+
+    // check if end of empty element
+    if ('/' == c)
+    {
+      if ('>' != *m_cursor)
+      {
+        // error!
+        return error();
+      }
+
+      ++m_cursor;
+      m_endPending = true;
+      break;
+    }
+
+    if (('\0' == c) || ('=' == c))
+    {
+      // error!
+      return error();
+    }
+
+    // find end of attribute name
+    char* attributeName = m_cursor - 1;
+    while ( ! IsNameTerminator(*m_cursor))
+    {
+      ++m_cursor;
+    }
+
+    c = *m_cursor;
+    *m_cursor++ = '\0';
+
+    // find value
+    while (IsSpace(c))
+    {
+      c = *m_cursor++;
+    }
+
+    if ('=' != c)
+    {
+      // error!
+      return error();
+    }
+
+    c = *m_cursor++;
+    while (IsSpace(c))
+    {
+      c = *m_cursor++;
+    }
+
+    if (('"' != c) && ('\'' != c))
+    {
+      // error!
+      return error();
+    }
+
+    // decode value in place
+    char* value = m_cursor;
+    char* out   = m_cursor;
+    while (('\0' != *m_cursor) && (c != *m_cursor))
+    {
+      if ('&' == *m_cursor)
+      {
+        m_cursor += DecodeEntity(m_cursor, out);
+      }
+      else
+      {
+        *out++ = *m_cursor++;
+      }
+    }
+
+    if ('\0' == *m_cursor)
+    {
+      // error!
+      return error();
+    }
+
+    // terminate value and move past closing quote
+    *out = '\0';
+    ++m_cursor;
+
+    AttributeData attribute;
+    attribute.name  = attributeName;
+    attribute.value = value;
+    m_attributes.push_back(attribute);
+
+    c = *m_cursor++;
+  }
+
+  m_elements.push_back(name);
+
+  m_name  = name;
+  m_event = EVENT_START_ELEMENT;
+  return m_event;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlPullParser::Event XmlPullParser::parseEndTag()
+{
+  char* name = m_cursor;
+
+  // find end of name
+  while ( ! IsNameTerminator(*m_cursor))
+  {
+    ++m_cursor;
+  }
+
+  char* nameEnd = m_cursor;
+  while (IsSpace(*m_cursor))
+  {
+    ++m_cursor;
+  }
+
+  if (('>' != *m_cursor) || (name == nameEnd) || m_elements.empty())
+  {
+    // error!
+    return error();
+  }
+
+  *nameEnd = '\0';
+  ++m_cursor;
+
+  // check if matches currently opened element
+  if (0 != strcmp(name, m_elements.back()))
+  {
+    // error!
+    return error();
+  }
+
+  m_name  = m_elements.back();
+  m_event = EVENT_END_ELEMENT;
+  return m_event;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlPullParser::Event XmlPullParser::parseText()
+{
+  char* text = m_cursor;
+  char* out  = m_cursor;
+
+  // decode and condense whitespaces in place
+  bool space = false;
+  while (('\0' != *m_cursor) && ('<' != *m_cursor))
+  {
+    if (IsSpace(*m_cursor))
+    {
+      space = true;
+      ++m_cursor;
+      continue;
+    }
+
+    if (space && (out != text))
+    {
+      *out++ = ' ';
+    }
+
+    space = false;
+
+    if ('&' == *m_cursor)
+    {
+      m_cursor += DecodeEntity(m_cursor, out);
+    }
+    else
+    {
+      *out++ = *m_cursor++;
+    }
+  }
+
+  // check if whitespaces only
+  if (out == text)
+  {
+    return EVENT_NONE;
+  }
+
+  // NOTE: terminator may overwrite opening bracket of next markup
+  m_markupPending = ('<' == *m_cursor);
+  *out = '\0';
+
+  m_text  = text;
+  m_event = EVENT_TEXT;
+  return m_event;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlPullParser::skipPast(const char* sequence)
+{
+  char* end = strstr(m_cursor, sequence);
+  if (NULL == end)
+  {
+    return false;
+  }
+
+  m_cursor = end + strlen(sequence);
+  return true;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+XmlPullParser::Event XmlPullParser::error()
+{
+  m_event = EVENT_ERROR;
+  return m_event;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlPullParser::name() const
+{
+  return m_name;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlPullParser::hasName(const char* name) const
+{
+  return 0 == strcmp(m_name, name);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlPullParser::text() const
+{
+  return m_text;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 XmlPullParser::attributeCount() const
+{
+  return static_cast<u32>(m_attributes.size());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlPullParser::attributeName(u32 index) const
+{
+  return (index < attributeCount()) ? m_attributes[index].name : "";
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlPullParser::attributeValue(u32 index) const
+{
+  return (index < attributeCount()) ? m_attributes[index].value : "";
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlPullParser::hasAttribute(const char* name) const
+{
+  return NULL != attribute(name, static_cast<const char*>(NULL));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+const char* XmlPullParser::attribute(const char* name, const char* defValue) const
+{
+  for (AttributeDataArray::const_iterator it = m_attributes.begin(); it != m_attributes.end(); ++it)
+  {
+    if (0 == strcmp(name, it->name))
+    {
+      // found
+      return it->value;
+    }
+  }
+
+  return defValue;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 XmlPullParser::attribute(const char* name, s32 defValue) const
+{
+  const char* text = attribute(name, "");
+  if ('\0' == *text)
+  {
+    return defValue;
+  }
+
+  bool error = false;
+  s32 value = StringUtils::ToInt(text, &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool XmlPullParser::attribute(const char* name, bool defValue) const
+{
+  bool error = false;
+  bool value = StringUtils::ToBool(attribute(name, ""), &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+float32 XmlPullParser::attribute(const char* name, float32 defValue) const
+{
+  bool error = false;
+  float32 value = StringUtils::ToFloat(attribute(name, ""), &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Vector2f XmlPullParser::attribute(const char* name, const Vector2f& defValue) const
+{
+  bool error = false;
+  Vector2f value = StringUtils::ToVector2f(attribute(name, ""), &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Rectf XmlPullParser::attribute(const char* name, const Rectf& defValue) const
+{
+  bool error = false;
+  Rectf value = StringUtils::ToRectf(attribute(name, ""), &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+Color XmlPullParser::attribute(const char* name, const Color& defValue) const
+{
+  bool error = false;
+  Color value = StringUtils::ToColor(attribute(name, ""), &error);
+  return error ? defValue : value;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
@@ -7,11 +7,13 @@
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class XmlCompiledDocument;
 EGE_DECLARE_SMART_CLASS(XmlAttribute, PXmlAttribute)
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class XmlAttribute : public Object
 {
   friend class XmlElementPrivate;
+  friend class XmlCompiledDocument;
 
   public:
 
@@ -30,9 +32,21 @@ class XmlAttribute : public Object
     /*! Returns next attribute. NULL if this is last one. */
     PXmlAttribute next() const;
 
+  private:
+
+    /*! Only intended to be used by XmlCompiledDocument. */
+    XmlAttribute(const XmlCompiledDocument* document, u32 index, u32 endIndex);
+
   private:
 
     EGE_DECLARE_PRIVATE_IMPLEMENTATION(XmlAttribute);
+
+    /*! Compiled document attribute belongs to. NULL if attribute is not compiled one. */
+    const XmlCompiledDocument* m_document;
+    /*! Index of attribute within compiled document. */
+    u32 m_index;
+    /*! Index one past last attribute of owning element within compiled document. */
+    u32 m_endIndex;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
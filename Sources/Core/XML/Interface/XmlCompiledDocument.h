@@ -0,0 +1,164 @@
+#ifndef EGE_CORE_XML_XMLCOMPILEDDOCUMENT_H
+#define EGE_CORE_XML_XMLCOMPILEDDOCUMENT_H
+
+/*! Compiled (binary) XML document. Compiled documents are produced offline from regular XML documents and contain pre-parsed element tree with interned
+ *  strings and attribute values already converted to integer, float and boolean representations. Loading requires single file read and no text parsing.
+ *  Elements and attributes obtained from compiled document are read-only and are valid as long as the document exists.
+ *  Compiled document carries hash of the XML data it was compiled from, so it can be detected when XML changes afterwards.
+ */
+
+#include "EGE.h"
+#include "EGEString.h"
+#include "EGEDynamicArray.h"
+#include "EGEMap.h"
+#include "Core/XML/Interface/XmlHandle.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DECLARE_SMART_CLASS(XmlCompiledDocument, PXmlCompiledDocument)
+EGE_DECLARE_SMART_CLASS(XmlElement, PXmlElement)
+EGE_DECLARE_SMART_CLASS(XmlAttribute, PXmlAttribute)
+EGE_DECLARE_SMART_CLASS(DataBuffer, PDataBuffer)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class XmlCompiledDocument : public Object
+{
+  friend class XmlElement;
+  friend class XmlAttribute;
+  friend class XmlElementHandle;
+  friend class XmlAttributeHandle;
+
+  public:
+
+    XmlCompiledDocument();
+   ~XmlCompiledDocument();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+  public:
+
+    /*! Compiles element tree starting at given root element into buffer. 
+     *  @param  root        Root element of the tree to compile.
+     *  @param  buffer      Buffer compiled data is appended to.
+     *  @param  sourceHash  Hash of the XML data the tree comes from.
+     */
+    static EGEResult Compile(const PXmlElement& root, const PDataBuffer& buffer, u64 sourceHash = 0);
+    /*! Compiles XML file into compiled document file. */
+    static EGEResult Compile(const String& xmlFileName, const String& fileName);
+    /*! Returns hash of given XML data as stored in compiled documents. */
+    static u64 SourceHash(const PDataBuffer& xmlData);
+
+  public:
+
+    /*! Returns TRUE if object is valid. */
+    bool isValid() const;
+    /*! Loads document from a given file. */
+    EGEResult load(const String& fileName);
+    /*! Loads document from a given buffer. 
+     *  @note Buffer is referenced by the document. It should not be changed afterwards.
+     */
+    EGEResult load(const PDataBuffer& buffer);
+
+    /*! Returns first child with the given name. */
+    PXmlElement firstChild(const String& name);
+    /*! Returns root element. */
+    PXmlElement rootElement();
+    /*! Returns handle to root element. */
+    XmlElementHandle rootHandle() const;
+    /*! Returns TRUE if document has been compiled from current content of a given XML file. 
+     *  @note Document is considered up to date if XML file does not exist. This is the case when only compiled documents are shipped.
+     *  @note Requires whole XML file to be read and hashed. This is intended for tools and build steps rather than for use at runtime.
+     */
+    bool isUpToDate(const String& xmlFileName) const;
+
+  private:
+
+    /*! Available attribute flags. */
+    enum AttributeFlags
+    {
+      AF_INT        = 0x01,       /*!< Value is valid 32-bit integer. */
+      AF_INT64      = 0x02,       /*!< Value is valid 64-bit integer. */
+      AF_FLOAT      = 0x04,       /*!< Value is valid float. */
+      AF_BOOL       = 0x08,       /*!< Value is valid boolean. */
+      AF_BOOL_TRUE  = 0x10        /*!< Boolean value is TRUE. */
+    };
+
+    /*! Element entry. */
+    struct Element
+    {
+      u32 name;                   /*!< Name string index. */
+      u32 text;                   /*!< Text string index. */
+      u32 firstAttribute;         /*!< Index of first attribute. */
+      u32 attributeCount;         /*!< Number of attributes. */
+      u32 firstChild;             /*!< Index of first child element. */
+      u32 nextSibling;            /*!< Index of next sibling element. */
+    };
+
+    /*! Attribute entry. */
+    struct Attribute
+    {
+      u32 name;                   /*!< Name string index. */
+      u32 value;                  /*!< Value string index. */
+      u32 flags;                  /*!< Attribute flags. Combination of AttributeFlags values. */
+      s32 intValue;               /*!< Pre-parsed 32-bit integer value. */
+      s64 int64Value;             /*!< Pre-parsed 64-bit integer value. */
+      float32 floatValue;         /*!< Pre-parsed float value. */
+    };
+
+    /*! Compilation context. */
+    struct CompileContext
+    {
+      DynamicArray<Element> elements;
+      DynamicArray<Attribute> attributes;
+      DynamicArray<String> strings;
+      Map<String, u32> stringIndices;
+    };
+
+    typedef DynamicArray<Element> ElementArray;
+    typedef DynamicArray<Attribute> AttributeArray;
+    typedef DynamicArray<const char*> StringPointerArray;
+
+  private:
+
+    /*! Reads entire content of a given file into buffer. */
+    static EGEResult ReadFile(const String& fileName, const PDataBuffer& buffer);
+    /*! Compiles given element and its children. Returns index of compiled element. */
+    static u32 CompileElement(const PXmlElement& element, CompileContext& context);
+    /*! Returns index of given string within string table. Adds string to the table if not present yet. */
+    static u32 InternString(const String& string, CompileContext& context);
+    /*! Returns TRUE if given element index is valid. */
+    bool isValidElement(u32 index) const;
+    /*! Returns string of a given index. */
+    const char* string(u32 index) const;
+    /*! Returns element of a given index. */
+    const Element& element(u32 index) const;
+    /*! Returns attribute of a given index. */
+    const Attribute& attribute(u32 index) const;
+    /*! Returns index of the first element with a given name starting at given element index. Any element matches if name is NULL or empty. */
+    u32 findElement(u32 index, const char* name) const;
+    /*! Returns pointer to attribute of a given name of a given element. NULL if not found. */
+    const Attribute* findAttribute(u32 elementIndex, const char* name) const;
+    /*! Creates element object for a given element index. */
+    PXmlElement createElement(u32 index) const;
+    /*! Creates attribute object for a given attribute index. Returns NULL if index is outside of [index, endIndex) range. */
+    PXmlAttribute createAttribute(u32 index, u32 endIndex) const;
+
+  private:
+
+    /*! Buffer with compiled data. */
+    PDataBuffer m_buffer;
+    /*! String table. Points into buffer. */
+    StringPointerArray m_strings;
+    /*! Element table. */
+    ElementArray m_elements;
+    /*! Attribute table. */
+    AttributeArray m_attributes;
+    /*! Hash of XML data document has been compiled from. */
+    u64 m_sourceHash;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_XML_XMLCOMPILEDDOCUMENT_H
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "EGE.h"
 #include "EGEString.h"
+#include "Core/XML/Interface/XmlHandle.h"
 
 EGE_NAMESPACE_BEGIN
 
@@ -40,6 +41,8 @@ class XmlDocument : public Object
 
     /*! Returns root element. */
     PXmlElement rootElement();
+    /*! Returns handle to root element. */
+    XmlElementHandle rootHandle() const;
 
   private:
 
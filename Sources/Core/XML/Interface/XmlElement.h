@@ -4,11 +4,13 @@
 #include "EGE.h"
 #include "EGEString.h"
 #include "EGETime.h"
+#include "Core/XML/Interface/XmlHandle.h"
 
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class XmlElementPrivate;
+class XmlCompiledDocument;
 
 EGE_DECLARE_SMART_CLASS(XmlElement, PXmlElement)
 EGE_DECLARE_SMART_CLASS(XmlAttribute, PXmlAttribute)
@@ -16,6 +18,7 @@ EGE_DECLARE_SMART_CLASS(XmlAttribute, PXmlAttribute)
 class XmlElement : public Object
 {
    friend class XmlDocumentPrivate;
+   friend class XmlCompiledDocument;
 
   public:
 
@@ -91,15 +94,27 @@ class XmlElement : public Object
     /*! Appends new child element. */
     bool appendChildElement(const PXmlElement& element);
 
+    /*! Returns lightweight handle to this element. 
+     *  @note Handle remains valid as long as the owning document exists, regardless of this object lifetime.
+     */
+    XmlElementHandle handle() const;
+
   private:
 
     /*! Only intended to be used by XmlDocumentPrivate. */
     XmlElement();
     XmlElement(XmlElementPrivate* p);
+    /*! Only intended to be used by XmlCompiledDocument. */
+    XmlElement(const XmlCompiledDocument* document, u32 index);
 
   private:
 
     EGE_DECLARE_PRIVATE_IMPLEMENTATION(XmlElement);
+
+    /*! Compiled document element belongs to. NULL if element is not compiled one. */
+    const XmlCompiledDocument* m_document;
+    /*! Index of element within compiled document. */
+    u32 m_index;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
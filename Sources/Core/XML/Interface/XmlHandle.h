@@ -0,0 +1,124 @@
+#ifndef EGE_CORE_XML_XMLHANDLE_H
+#define EGE_CORE_XML_XMLHANDLE_H
+
+/*! Lightweight, non-owning cursors over XML document trees. Unlike XmlElement and XmlAttribute, handles are plain values which do not allocate when
+ *  traversing the tree and return names and values as pointers into the document data instead of String copies. Handles (and pointers returned by them)
+ *  are valid as long as the document they were obtained from exists and is not modified.
+ */
+
+#include "EGE.h"
+#include "EGEColor.h"
+#include "EGERect.h"
+#include "EGEVector2.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class XmlCompiledDocument;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class XmlAttributeHandle
+{
+  friend class XmlElementHandle;
+
+  public:
+
+    XmlAttributeHandle();
+
+    /*! Returns TRUE if handle points to valid attribute. */
+    bool isValid() const;
+    /*! Returns name. Empty string if handle is invalid. */
+    const char* name() const;
+    /*! Returns value. Empty string if handle is invalid. */
+    const char* value() const;
+    /*! Returns next attribute. Returned handle is invalid if this is last one. */
+    XmlAttributeHandle next() const;
+
+  private:
+
+    /*! Creates handle for given native attribute. */
+    explicit XmlAttributeHandle(const void* attribute);
+    /*! Creates handle for given attribute of compiled document. */
+    XmlAttributeHandle(const XmlCompiledDocument* document, u32 index, u32 endIndex);
+
+  private:
+
+    /*! Native attribute. NULL for compiled document attributes. */
+    const void* m_attribute;
+    /*! Compiled document attribute belongs to. NULL for native attributes. */
+    const XmlCompiledDocument* m_document;
+    /*! Index of attribute within compiled document. */
+    u32 m_index;
+    /*! Index one past last attribute of owning element within compiled document. */
+    u32 m_endIndex;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class XmlElementHandle
+{
+  friend class XmlElement;
+  friend class XmlDocumentPrivate;
+  friend class XmlCompiledDocument;
+
+  public:
+
+    XmlElementHandle();
+
+    /*! Returns TRUE if handle points to valid element. */
+    bool isValid() const;
+    /*! Returns element name. Empty string if handle is invalid. */
+    const char* name() const;
+    /*! Returns TRUE if element is of a given name. */
+    bool hasName(const char* name) const;
+    /*! Returns element's first text. Empty string if there is no text. */
+    const char* text() const;
+
+    /*! Returns TRUE if given attribute exists. */
+    bool hasAttribute(const char* name) const;
+    /*! Returns value of given attribute if present. Otherwise, returns default value. */
+    const char* attribute(const char* name, const char* defValue = "") const;
+    /*! Returns value of given attribute if present and valid. Otherwise, returns default value. */
+    s32 attribute(const char* name, s32 defValue) const;
+    /*! Returns value of given attribute if present and valid. Otherwise, returns default value. */
+    bool attribute(const char* name, bool defValue) const;
+    /*! Returns value of given attribute if present and valid. Otherwise, returns default value. */
+    float32 attribute(const char* name, float32 defValue) const;
+    /*! Returns value of given attribute if present and valid. Otherwise, returns default value. */
+    Vector2f attribute(const char* name, const Vector2f& defValue) const;
+    /*! Returns value of given attribute if present and valid. Otherwise, returns default value. */
+    Rectf attribute(const char* name, const Rectf& defValue) const;
+    /*! Returns value of given attribute if present and valid. Otherwise, returns default value. */
+    Color attribute(const char* name, const Color& defValue) const;
+    /*! Returns value of given attribute as integer. Error flag is set if attribute is not present or is not valid integer. */
+    s32 intAttribute(const char* name, bool* error) const;
+    /*! Returns value of given attribute as boolean. Error flag is set if attribute is not present or is empty. */
+    bool boolAttribute(const char* name, bool* error) const;
+    /*! Returns value of given attribute as float. Error flag is set if attribute is not present or is not valid float. */
+    float32 floatAttribute(const char* name, bool* error) const;
+    /*! Returns first attribute. Returned handle is invalid if there are no attributes. */
+    XmlAttributeHandle firstAttribute() const;
+
+    /*! Returns first child element. If any name is given returned will be first element with given name. */
+    XmlElementHandle firstChild(const char* name = NULL) const;
+    /*! Returns next child (sibling) element. If any name is given returned will be next element with given name. */
+    XmlElementHandle nextChild(const char* name = NULL) const;
+
+  private:
+
+    /*! Creates handle for given native element. */
+    explicit XmlElementHandle(const void* element);
+    /*! Creates handle for given element of compiled document. */
+    XmlElementHandle(const XmlCompiledDocument* document, u32 index);
+
+  private:
+
+    /*! Native element. NULL for compiled document elements. */
+    const void* m_element;
+    /*! Compiled document element belongs to. NULL for native elements. */
+    const XmlCompiledDocument* m_document;
+    /*! Index of element within compiled document. */
+    u32 m_index;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_XML_XMLHANDLE_H
\ No newline at end of file
@@ -0,0 +1,145 @@
+#ifndef EGE_CORE_XML_XMLPULLPARSER_H
+#define EGE_CORE_XML_XMLPULLPARSER_H
+
+/*! Pull-mode XML parser. Intended for large documents which should be processed in a single pass without building the document tree in memory.
+ *  Parsing is done in place: names, values and texts reported by the parser point into the parsed buffer (which gets modified) and are valid as long
+ *  as the parser exists. Attribute values and texts have the standard entities already decoded. Texts have whitespaces condensed.
+ *  Processing instructions, comments and document type declarations are skipped.
+ */
+
+#include "EGE.h"
+#include "EGEString.h"
+#include "EGEDynamicArray.h"
+#include "EGEColor.h"
+#include "EGERect.h"
+#include "EGEVector2.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DECLARE_SMART_CLASS(XmlPullParser, PXmlPullParser)
+EGE_DECLARE_SMART_CLASS(DataBuffer, PDataBuffer)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class XmlPullParser : public Object
+{
+  public:
+
+    XmlPullParser();
+   ~XmlPullParser();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+  public:
+
+    /*! Available events. */
+    enum Event
+    {
+      EVENT_NONE = 0,           /*!< No data has been processed yet. */
+      EVENT_START_ELEMENT,      /*!< Element has been opened. */
+      EVENT_END_ELEMENT,        /*!< Element has been closed. */
+      EVENT_TEXT,               /*!< Text (or CDATA section) has been read. */
+      EVENT_END_DOCUMENT,       /*!< End of document has been reached. */
+      EVENT_ERROR               /*!< Document is malformed. */
+    };
+
+  public:
+
+    /*! Opens document from a given file. */
+    EGEResult open(const String& fileName);
+    /*! Opens document from a given buffer. 
+     *  @note Buffer content is modified during parsing. 
+     */
+    EGEResult open(const PDataBuffer& buffer);
+    /*! Advances to next event and returns it. */
+    Event next();
+    /*! Skips the rest of the current element (including all its children). 
+     *  @note  Can only be called when current event is EVENT_START_ELEMENT. On success, current event is EVENT_END_ELEMENT of the skipped element.
+     */
+    EGEResult skipElement();
+
+    /*! Returns current event. */
+    Event event() const { return m_event; }
+    /*! Returns current element depth. Root element has depth of 1. */
+    s32 depth() const { return static_cast<s32>(m_elements.size()); }
+    /*! Returns element name for EVENT_START_ELEMENT and EVENT_END_ELEMENT events. Empty string otherwise. */
+    const char* name() const;
+    /*! Returns TRUE if current element is of a given name. */
+    bool hasName(const char* name) const;
+    /*! Returns text for EVENT_TEXT event. Empty string otherwise. */
+    const char* text() const;
+
+    /*! Returns number of attributes of current element. */
+    u32 attributeCount() const;
+    /*! Returns name of attribute at given index. */
+    const char* attributeName(u32 index) const;
+    /*! Returns value of attribute at given index. */
+    const char* attributeValue(u32 index) const;
+    /*! Returns TRUE if given attribute exists in current element. */
+    bool hasAttribute(const char* name) const;
+    /*! Returns value of given attribute of current element if present. Otherwise, returns default value. */
+    const char* attribute(const char* name, const char* defValue = "") const;
+    /*! Returns value of given attribute of current element if present and valid. Otherwise, returns default value. */
+    s32 attribute(const char* name, s32 defValue) const;
+    /*! Returns value of given attribute of current element if present and valid. Otherwise, returns default value. */
+    bool attribute(const char* name, bool defValue) const;
+    /*! Returns value of given attribute of current element if present and valid. Otherwise, returns default value. */
+    float32 attribute(const char* name, float32 defValue) const;
+    /*! Returns value of given attribute of current element if present and valid. Otherwise, returns default value. */
+    Vector2f attribute(const char* name, const Vector2f& defValue) const;
+    /*! Returns value of given attribute of current element if present and valid. Otherwise, returns default value. */
+    Rectf attribute(const char* name, const Rectf& defValue) const;
+    /*! Returns value of given attribute of current element if present and valid. Otherwise, returns default value. */
+    Color attribute(const char* name, const Color& defValue) const;
+
+  private:
+
+    /*! Parses start tag. Cursor is expected to point right after the opening bracket. */
+    Event parseStartTag();
+    /*! Parses end tag. Cursor is expected to point right after the closing tag opening sequence. */
+    Event parseEndTag();
+    /*! Parses text. */
+    Event parseText();
+    /*! Skips cursor past the given terminating sequence. Returns FALSE if sequence was not found. */
+    bool skipPast(const char* sequence);
+    /*! Sets error state. */
+    Event error();
+
+  private:
+
+    /*! Attribute data struct. */
+    struct AttributeData
+    {
+      const char* name;
+      const char* value;
+    };
+
+    typedef DynamicArray<AttributeData> AttributeDataArray;
+    typedef DynamicArray<const char*> ElementNameArray;
+
+  private:
+
+    /*! Buffer with document data. */
+    PDataBuffer m_buffer;
+    /*! Current parsing position. */
+    char* m_cursor;
+    /*! TRUE if markup starts at current parsing position even though its opening bracket has been overwritten. */
+    bool m_markupPending;
+    /*! TRUE if current element was empty one and its end element event is still to be reported. */
+    bool m_endPending;
+    /*! Current event. */
+    Event m_event;
+    /*! Current name. */
+    const char* m_name;
+    /*! Current text. */
+    const char* m_text;
+    /*! Attributes of current element. */
+    AttributeDataArray m_attributes;
+    /*! Stack of names of currently opened elements. */
+    ElementNameArray m_elements;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_CORE_XML_XMLPULLPARSER_H
\ No newline at end of file
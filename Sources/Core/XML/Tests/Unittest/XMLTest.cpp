@@ -43,12 +43,14 @@ void XMLTest::SetUp()
 {
   // cleanup
   remove("Xml-test/generated.xml");
+  remove("Xml-test/generated.egm");
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 void XMLTest::TearDown()
 {
   // cleanup
   remove("Xml-test/generated.xml");
+  remove("Xml-test/generated.egm");
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 PDataBuffer XMLTest::loadFileToBuffer(const String& fileName) const
@@ -58,7 +60,9 @@ PDataBuffer XMLTest::loadFileToBuffer(const String& fileName) const
   EXPECT_TRUE(NULL != file);
 
   // find file size
-  long fileSize = _filelength(_fileno(file));
+  fseek(file, 0, SEEK_END);
+  long fileSize = ftell(file);
+  fseek(file, 0, SEEK_SET);
   EXPECT_NE(-1L, fileSize);
 
   // allocate buffer of a required size
@@ -328,3 +332,354 @@ TEST_F(XMLTest, SaveDocument)
   EXPECT_EQ(0, EGE_MEMCMP(fileBuffer->data(), buffer.data(), static_cast<size_t>(fileBuffer->size())));
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(XMLTest, LoadCompiledDocumentFromEmptyBuffer)
+{
+  PDataBuffer buffer;
+
+  // load compiled document from buffer
+  XmlCompiledDocument document;
+  EXPECT_EQ(EGE_ERROR_NOT_FOUND, document.load(buffer));
+  EXPECT_FALSE(document.isValid());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(XMLTest, LoadCompiledDocumentFromXmlBuffer)
+{
+  // load XML content
+  PDataBuffer buffer = loadFileToBuffer("Xml-test/valid.xml");
+  EXPECT_TRUE(NULL != buffer);
+
+  // try to load XML as compiled document
+  XmlCompiledDocument document;
+  EXPECT_EQ(EGE_ERROR_NOT_SUPPORTED, document.load(buffer));
+  EXPECT_FALSE(document.isValid());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(XMLTest, DecodeCompiledDocument)
+{
+  // load from file
+  XmlDocument xml;
+  EXPECT_EQ(EGE_SUCCESS, xml.load("Xml-test/valid.xml"));
+
+  // compile
+  PDataBuffer buffer = ege_new DataBuffer();
+  EXPECT_TRUE(NULL != buffer);
+  EXPECT_EQ(EGE_SUCCESS, XmlCompiledDocument::Compile(xml.rootElement(), buffer));
+
+  // load compiled document
+  XmlCompiledDocument document;
+  EXPECT_EQ(EGE_SUCCESS, document.load(buffer));
+  EXPECT_TRUE(document.isValid());
+
+  // process root element
+  PXmlElement root = document.firstChild("top-element");
+  EXPECT_TRUE(NULL != root);
+  EXPECT_TRUE(root->isValid());
+  EXPECT_EQ("top-element", root->name());
+  EXPECT_FALSE(document.firstChild("unexisting-element")->isValid());
+
+  // process elements
+  PXmlElement element = root->firstChild();
+  EXPECT_TRUE(element->isValid());
+  EXPECT_EQ("second-level-element-1", element->name());
+
+  element = element->nextChild();
+  EXPECT_TRUE(element->isValid());
+  EXPECT_EQ("second-level-element-2", element->name());
+  EXPECT_FALSE(element->nextChild()->isValid());
+  EXPECT_TRUE(NULL == element->firstAttribute());
+  EXPECT_EQ("", element->text());
+
+  // process text
+  element = element->firstChild("third-level-element");
+  EXPECT_TRUE(element->isValid());
+  EXPECT_EQ("This is some text And even more text here", element->text());
+  EXPECT_FALSE(element->nextChild()->isValid());
+
+  // process attributes
+  element = root->firstChild("second-level-element-1");
+  EXPECT_TRUE(element->isValid());
+  EXPECT_TRUE(element->hasAttribute("attribute-1"));
+  EXPECT_TRUE(element->hasAttribute("attribute-4"));
+  EXPECT_FALSE(element->hasAttribute("attribute-0"));
+
+  u32 attributeCount = 0;
+  for (PXmlAttribute attribute = element->firstAttribute(); NULL != attribute; attribute = attribute->next())
+  {
+    EXPECT_TRUE(attribute->isValid());
+    EXPECT_EQ(attribute->value(), element->attribute(attribute->name(), String("none")));
+    ++attributeCount;
+  }
+  EXPECT_EQ(4U, attributeCount);
+
+  EXPECT_EQ("text", element->attribute("attribute-1", String("none")));
+  EXPECT_EQ("text", element->attribute("attribute-1", "none"));
+  EXPECT_EQ("none", element->attribute("attribute-0", "none"));
+  EXPECT_EQ(1, element->attribute("attribute-2", 0));
+  EXPECT_EQ(5, element->attribute("attribute-1", 5));
+  EXPECT_EQ(2.5f, element->attribute("attribute-3", 0.0f));
+  EXPECT_EQ(true, element->attribute("attribute-4", false));
+
+  // compiled documents are read-only
+  EXPECT_FALSE(element->setAttribute("attribute-5", "text"));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(XMLTest, DecodeElementHandles)
+{
+  // load from file
+  XmlDocument document;
+  EXPECT_EQ(EGE_SUCCESS, document.load("Xml-test/valid.xml"));
+
+  // process root element
+  XmlElementHandle root = document.rootHandle();
+  EXPECT_TRUE(root.isValid());
+  EXPECT_STREQ("top-element", root.name());
+  EXPECT_TRUE(root.hasName("top-element"));
+  EXPECT_FALSE(root.firstChild("unexisting-element").isValid());
+
+  // process elements
+  XmlElementHandle element = root.firstChild();
+  EXPECT_TRUE(element.isValid());
+  EXPECT_STREQ("second-level-element-1", element.name());
+
+  element = element.nextChild();
+  EXPECT_TRUE(element.isValid());
+  EXPECT_STREQ("second-level-element-2", element.name());
+  EXPECT_FALSE(element.nextChild().isValid());
+  EXPECT_FALSE(element.firstAttribute().isValid());
+
+  // process text
+  element = element.firstChild("third-level-element");
+  EXPECT_TRUE(element.isValid());
+  EXPECT_STREQ("This is some text And even more text here", element.text());
+
+  // process attributes
+  element = root.firstChild("second-level-element-1");
+  EXPECT_TRUE(element.hasAttribute("attribute-1"));
+  EXPECT_FALSE(element.hasAttribute("attribute-0"));
+
+  u32 attributeCount = 0;
+  for (XmlAttributeHandle attribute = element.firstAttribute(); attribute.isValid(); attribute = attribute.next())
+  {
+    EXPECT_STREQ(attribute.value(), element.attribute(attribute.name(), "none"));
+    ++attributeCount;
+  }
+  EXPECT_EQ(4U, attributeCount);
+
+  EXPECT_STREQ("text", element.attribute("attribute-1", "none"));
+  EXPECT_STREQ("none", element.attribute("attribute-0", "none"));
+  EXPECT_EQ(1, element.attribute("attribute-2", 0));
+  EXPECT_EQ(5, element.attribute("attribute-1", 5));
+  EXPECT_EQ(2.5f, element.attribute("attribute-3", 0.0f));
+  EXPECT_EQ(true, element.attribute("attribute-4", false));
+
+  // process compiled document
+  PDataBuffer buffer = ege_new DataBuffer();
+  EXPECT_TRUE(NULL != buffer);
+  EXPECT_EQ(EGE_SUCCESS, XmlCompiledDocument::Compile(document.rootElement(), buffer));
+
+  XmlCompiledDocument compiled;
+  EXPECT_EQ(EGE_SUCCESS, compiled.load(buffer));
+
+  element = compiled.rootHandle().firstChild("second-level-element-1");
+  EXPECT_TRUE(element.isValid());
+  EXPECT_EQ(1, element.attribute("attribute-2", 0));
+  EXPECT_EQ(2.5f, element.attribute("attribute-3", 0.0f));
+  EXPECT_STREQ("This is some text And even more text here", compiled.rootHandle().firstChild("second-level-element-2").firstChild().text());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(XMLTest, DecodeRequiredAttributeHandles)
+{
+  XmlDocument document;
+  EXPECT_EQ(EGE_SUCCESS, document.load("Xml-test/valid.xml"));
+
+  PDataBuffer buffer = ege_new DataBuffer();
+  EXPECT_TRUE(NULL != buffer);
+  EXPECT_EQ(EGE_SUCCESS, XmlCompiledDocument::Compile(document.rootElement(), buffer));
+
+  XmlCompiledDocument compiled;
+  EXPECT_EQ(EGE_SUCCESS, compiled.load(buffer));
+
+  // NOTE: native and compiled elements are expected to behave the same
+  const XmlElementHandle elements[] = { document.rootHandle().firstChild("second-level-element-1"), 
+                                        compiled.rootHandle().firstChild("second-level-element-1") };
+  for (u32 i = 0; i < sizeof (elements) / sizeof (elements[0]); ++i)
+  {
+    const XmlElementHandle& element = elements[i];
+    EXPECT_TRUE(element.isValid());
+
+    // valid values
+    bool error = false;
+    EXPECT_EQ(1, element.intAttribute("attribute-2", &error));
+    EXPECT_EQ(2.5f, element.floatAttribute("attribute-3", &error));
+    EXPECT_TRUE(element.boolAttribute("attribute-4", &error));
+    EXPECT_FALSE(error);
+
+    // invalid values
+    error = false;
+    EXPECT_EQ(0, element.intAttribute("attribute-1", &error));
+    EXPECT_TRUE(error);
+
+    error = false;
+    EXPECT_EQ(0.0f, element.floatAttribute("attribute-1", &error));
+    EXPECT_TRUE(error);
+
+    // missing values
+    error = false;
+    EXPECT_EQ(0, element.intAttribute("attribute-0", &error));
+    EXPECT_TRUE(error);
+
+    error = false;
+    EXPECT_FALSE(element.boolAttribute("attribute-0", &error));
+    EXPECT_TRUE(error);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(XMLTest, LoadCorruptedCompiledDocument)
+{
+  XmlDocument xml;
+  EXPECT_EQ(EGE_SUCCESS, xml.load("Xml-test/valid.xml"));
+
+  PDataBuffer buffer = ege_new DataBuffer();
+  EXPECT_TRUE(NULL != buffer);
+  EXPECT_EQ(EGE_SUCCESS, XmlCompiledDocument::Compile(xml.rootElement(), buffer));
+
+  // locate string table
+  u32 magic;
+  u32 version;
+  u32 stringCount;
+  u32 stringDataSize;
+  *buffer >> magic >> version >> stringCount >> stringDataSize;
+
+  const s64 stringOffsetsOffset = 6 * sizeof (u32) + sizeof (u64);
+  const s64 stringDataOffset    = stringOffsetsOffset + stringCount * sizeof (u32);
+  ASSERT_LT(0U, stringCount);
+
+  // unterminated last string
+  char* lastCharacter = reinterpret_cast<char*>(buffer->data(stringDataOffset + stringDataSize - 1));
+  EXPECT_EQ('\0', *lastCharacter);
+  *lastCharacter = 'x';
+
+  XmlCompiledDocument document;
+  buffer->setReadOffset(0);
+  EXPECT_EQ(EGE_ERROR, document.load(buffer));
+  EXPECT_FALSE(document.isValid());
+
+  *lastCharacter = '\0';
+
+  // string starting outside of string data
+  u32* firstStringOffset = reinterpret_cast<u32*>(buffer->data(stringOffsetsOffset));
+  const u32 originalOffset = *firstStringOffset;
+  *firstStringOffset = stringDataSize;
+
+  buffer->setReadOffset(0);
+  EXPECT_EQ(EGE_ERROR, document.load(buffer));
+  EXPECT_FALSE(document.isValid());
+
+  // restored document is fine
+  *firstStringOffset = originalOffset;
+
+  buffer->setReadOffset(0);
+  EXPECT_EQ(EGE_SUCCESS, document.load(buffer));
+  EXPECT_TRUE(document.isValid());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(XMLTest, CompiledDocumentUpToDate)
+{
+  // compile
+  EXPECT_EQ(EGE_SUCCESS, XmlCompiledDocument::Compile("Xml-test/valid.xml", "Xml-test/generated.egm"));
+
+  XmlCompiledDocument document;
+  EXPECT_EQ(EGE_SUCCESS, document.load("Xml-test/generated.egm"));
+  EXPECT_TRUE(document.isValid());
+
+  // compiled from given XML only
+  EXPECT_TRUE(document.isUpToDate("Xml-test/valid.xml"));
+  EXPECT_FALSE(document.isUpToDate("Xml-test/ill-formatted.xml"));
+
+  // nothing to compare with
+  EXPECT_TRUE(document.isUpToDate("Xml-test/unexisting.xml"));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(XMLTest, PullParseDocument)
+{
+  XmlPullParser parser;
+  EXPECT_EQ(EGE_SUCCESS, parser.open("Xml-test/valid.xml"));
+
+  EXPECT_EQ(XmlPullParser::EVENT_START_ELEMENT, parser.next());
+  EXPECT_STREQ("top-element", parser.name());
+  EXPECT_EQ(1, parser.depth());
+
+  // empty element
+  EXPECT_EQ(XmlPullParser::EVENT_START_ELEMENT, parser.next());
+  EXPECT_STREQ("second-level-element-1", parser.name());
+  EXPECT_EQ(2, parser.depth());
+  EXPECT_EQ(4U, parser.attributeCount());
+  EXPECT_STREQ("attribute-1", parser.attributeName(0));
+  EXPECT_STREQ("text", parser.attributeValue(0));
+  EXPECT_STREQ("text", parser.attribute("attribute-1", "none"));
+  EXPECT_STREQ("none", parser.attribute("attribute-0", "none"));
+  EXPECT_EQ(1, parser.attribute("attribute-2", 0));
+  EXPECT_EQ(2.5f, parser.attribute("attribute-3", 0.0f));
+  EXPECT_EQ(true, parser.attribute("attribute-4", false));
+  EXPECT_EQ(XmlPullParser::EVENT_END_ELEMENT, parser.next());
+  EXPECT_STREQ("second-level-element-1", parser.name());
+
+  // nested element with text
+  EXPECT_EQ(XmlPullParser::EVENT_START_ELEMENT, parser.next());
+  EXPECT_STREQ("second-level-element-2", parser.name());
+  EXPECT_EQ(0U, parser.attributeCount());
+  EXPECT_EQ(XmlPullParser::EVENT_START_ELEMENT, parser.next());
+  EXPECT_STREQ("third-level-element", parser.name());
+  EXPECT_EQ(3, parser.depth());
+  EXPECT_EQ(XmlPullParser::EVENT_TEXT, parser.next());
+  EXPECT_STREQ("This is some text And even more text here", parser.text());
+  EXPECT_EQ(XmlPullParser::EVENT_END_ELEMENT, parser.next());
+  EXPECT_STREQ("third-level-element", parser.name());
+  EXPECT_EQ(XmlPullParser::EVENT_END_ELEMENT, parser.next());
+  EXPECT_STREQ("second-level-element-2", parser.name());
+
+  EXPECT_EQ(XmlPullParser::EVENT_END_ELEMENT, parser.next());
+  EXPECT_STREQ("top-element", parser.name());
+  EXPECT_EQ(XmlPullParser::EVENT_END_DOCUMENT, parser.next());
+  EXPECT_EQ(0, parser.depth());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(XMLTest, PullParseSkipElement)
+{
+  // load XML content
+  PDataBuffer buffer = loadFileToBuffer("Xml-test/valid.xml");
+  EXPECT_TRUE(NULL != buffer);
+
+  XmlPullParser parser;
+  EXPECT_EQ(EGE_SUCCESS, parser.open(buffer));
+
+  EXPECT_EQ(XmlPullParser::EVENT_START_ELEMENT, parser.next());
+  EXPECT_EQ(XmlPullParser::EVENT_START_ELEMENT, parser.next());
+  EXPECT_EQ(XmlPullParser::EVENT_END_ELEMENT, parser.next());
+  EXPECT_EQ(XmlPullParser::EVENT_START_ELEMENT, parser.next());
+  EXPECT_STREQ("second-level-element-2", parser.name());
+  EXPECT_EQ(EGE_SUCCESS, parser.skipElement());
+  EXPECT_STREQ("second-level-element-2", parser.name());
+  EXPECT_EQ(XmlPullParser::EVENT_END_ELEMENT, parser.next());
+  EXPECT_STREQ("top-element", parser.name());
+  EXPECT_EQ(XmlPullParser::EVENT_END_DOCUMENT, parser.next());
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+TEST_F(XMLTest, PullParseInvalidDocument)
+{
+  // load XML content
+  PDataBuffer buffer = loadFileToBuffer("Xml-test/ill-formatted.xml");
+  EXPECT_TRUE(NULL != buffer);
+
+  XmlPullParser parser;
+  EXPECT_EQ(EGE_SUCCESS, parser.open(buffer));
+
+  // process until error
+  XmlPullParser::Event event;
+  while ((XmlPullParser::EVENT_ERROR != (event = parser.next())) && (XmlPullParser::EVENT_END_DOCUMENT != event))
+  {
+  }
+
+  EXPECT_EQ(XmlPullParser::EVENT_ERROR, event);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
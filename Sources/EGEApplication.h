@@ -13,6 +13,7 @@ EGE_NAMESPACE_END
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 #include "Core/Application/Application.h"
+#include "Core/Application/UpdateGraph.h"
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 #endif // EGE_APPLICATION_H
\ No newline at end of file
@@ -7,14 +7,34 @@
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void egeAtomicIncrement(volatile u32& value);
-void egeAtomicDecrement(volatile u32& value);
+/*! Atomically increments value. 
+ *  @param  value Value to increment.
+ *  @return Incremented value.
+ */
+u32 egeAtomicIncrement(volatile u32& value);
+/*! Atomically decrements value. 
+ *  @param  value Value to decrement.
+ *  @return Decremented value.
+ */
+u32 egeAtomicDecrement(volatile u32& value);
+/*! Atomically adds to value. 
+ *  @param  value Value to modify.
+ *  @param  delta Value to add.
+ *  @return Resulting value.
+ */
+u32 egeAtomicAdd(volatile u32& value, s32 delta);
+/*! Atomically reads value. 
+ *  @note Read has acquire semantics so all writes done by other threads before they last modified value are visible. 
+ *  @note It is a plain load rather than read-modify-write operation, so polling it does not contend for exclusive cache line ownership.
+ */
+u32 egeAtomicLoad(volatile u32& value);
 /*! Atomically compares and sets new value depending on the outcome of comparison.
  *  @param  value         Value to test and modify.
  *  @param  compareValue  Value to compare to.
  *  @param  newValue      New value to be set if previous two are equal.
+ *  @return TRUE if new value has been set.
  */
-void egeAtomicCompareAndSet(volatile u32& value, u32 compareValue, u32 newValue);
+bool egeAtomicCompareAndSet(volatile u32& value, u32 compareValue, u32 newValue);
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 EGE_NAMESPACE_END
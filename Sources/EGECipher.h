@@ -4,5 +4,6 @@
 #include "Core/Crypto/Interface/Cipher/CipherXOR.h"
 #include "Core/Crypto/Interface/Cipher/CipherAES.h"
 #include "Core/Crypto/Interface/Cipher/CipherKey.h"
+#include "Core/Crypto/Interface/Cipher/CipherStream.h"
 
 #endif // EGE_CIPHER_H
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "Core/Database/Interface/SqlQuery.h"
 #include "Core/Database/Interface/SqlResult.h"
+#include "Core/Database/Interface/SqlCursor.h"
 #include "Core/Database/Interface/Database.h"
 #include "Core/Database/Interface/DatabaseSqlite.h"
 
@@ -9,6 +9,8 @@
   #include "Win32/Services/Interface/DeviceServicesWin32.h"
 #elif EGE_PLATFORM_IOS
   #include "iOS/Services/Interface/DeviceServicesIOS.h"
+#elif EGE_PLATFORM_POSIX
+  #include "Posix/Services/Interface/DeviceServicesPosix.h"
 #else
   #error "Implement!"
 #endif // EGE_PLATFORM_WIN32
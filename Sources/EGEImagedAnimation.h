@@ -50,6 +50,7 @@ EGE_NAMESPACE_END
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 #include "Core/Graphics/ImagedAnimation/Interface/ImagedAnimation.h"
+#include "Core/Graphics/ImagedAnimation/Interface/ImagedAnimationGeometry.h"
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 #endif // EGE_IMAGEDANIMATION_H
\ No newline at end of file
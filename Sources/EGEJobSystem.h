@@ -0,0 +1,10 @@
+#ifndef EGE_JOBSYSTEM_H
+#define EGE_JOBSYSTEM_H
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#include "Core/Threading/JobSystem.h"
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#endif // EGE_JOBSYSTEM_H
\ No newline at end of file
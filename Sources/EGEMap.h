@@ -6,6 +6,7 @@
 #if EGE_CONTAINERS_STL
 #include "Core/Containers/Stl/Map.h"
 #include "Core/Containers/Stl/MultiMap.h"
+#include "Core/Containers/Stl/HashMap.h"
 #endif // EGE_CONTAINERS_STL
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,8 @@
+#ifndef EGE_NAME_H
+#define EGE_NAME_H
+
+#include "Core/String/Name.h"
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#endif // EGE_NAME_H
\ No newline at end of file
@@ -8,6 +8,8 @@
   #include "Win32/Services/Interface/PurchaseServicesWin32.h"
 #elif EGE_PLATFORM_IOS
   #include "iOS/Services/Interface/PurchaseServicesIOS.h"
+#elif EGE_PLATFORM_POSIX
+  #include "Posix/Services/Interface/PurchaseServicesPosix.h"
 #else
   #error "Implement!"
 #endif // EGE_PLATFORM_WIN32
@@ -8,6 +8,8 @@
   #include "Win32/Services/Interface/SocialServicesWin32.h"
 #elif EGE_PLATFORM_IOS
   #include "iOS/Services/Interface/SocialServicesIOS.h"
+#elif EGE_PLATFORM_POSIX
+  #include "Posix/Services/Interface/SocialServicesPosix.h"
 #else
   #error "Implement!"
 #endif // EGE_PLATFORM_WIN32
@@ -1,6 +1,6 @@
 #ifndef EGE_TIMELINE_H
 #define EGE_TIMELINE_H
 
-#include "Core/Time/Interface/Timeline.h"
+#include "Core/Time/Interface/TimeLine.h"
 
 #endif // EGE_TIMELINE_H
\ No newline at end of file
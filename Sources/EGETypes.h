@@ -26,6 +26,8 @@ enum EGEResult
 #include "Airplay/TypesAirplay.h"
 #elif EGE_PLATFORM_IOS
 #include "iOS/TypesIOS.h"
+#elif EGE_PLATFORM_POSIX
+#include "Posix/TypesPosix.h"
 #endif // EGE_PLATFORM_WIN32
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 typedef wchar_t Char;
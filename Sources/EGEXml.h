@@ -1,9 +1,12 @@
 #ifndef EGE_XML_H
 #define EGE_XML_H
 
-#include "Core/XML/Interface/XMLAttribute.h"
-#include "Core/XML/Interface/XMLElement.h"
-#include "Core/XML/Interface/XMLDocument.h"
+#include "Core/XML/Interface/XmlAttribute.h"
+#include "Core/XML/Interface/XmlElement.h"
+#include "Core/XML/Interface/XmlDocument.h"
+#include "Core/XML/Interface/XmlCompiledDocument.h"
+#include "Core/XML/Interface/XmlHandle.h"
+#include "Core/XML/Interface/XmlPullParser.h"
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
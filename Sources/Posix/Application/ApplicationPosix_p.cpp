@@ -0,0 +1,58 @@
+#include "Core/Application/Application.h"
+#include "Posix/Application/ApplicationPosix_p.h"
+#include <EGETimer.h>
+#include <EGETime.h>
+#include <EGEMath.h>
+#include <EGEDevice.h>
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(ApplicationPrivate)
+EGE_DEFINE_DELETE_OPERATORS(ApplicationPrivate)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+ApplicationPrivate::ApplicationPrivate(Application* base) : m_d(base)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+ApplicationPrivate::~ApplicationPrivate()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult ApplicationPrivate::run()
+{
+  Time startTime;
+  Time endTime;
+  Time yieldTime;
+
+  // NOTE: there are no windows so no messages to process, just tight loop
+  while (Application::STATE_QUIT != d_func()->state())
+  {
+    // store this loop start time
+    startTime = Timer::GetMicroseconds();
+
+    // send begin of frame signal
+    emit d_func()->frameBegin();
+
+    // update
+    d_func()->update();
+
+    // render
+    d_func()->render();
+
+    // send end of frame signal
+    emit d_func()->frameEnd();
+
+    // stat this loop end time
+    endTime = Timer::GetMicroseconds();
+
+    // give some time for OS
+    yieldTime = d_func()->m_renderInterval - (endTime - startTime);
+    Device::Sleep(static_cast<u32>(Math::Max((s32) 0, static_cast<s32>(yieldTime.miliseconds()))));
+  }
+
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
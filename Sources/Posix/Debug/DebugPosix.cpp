@@ -0,0 +1,28 @@
+#include "Core/Debug/Interface/Debug.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Debug::Assert(const char* assertion, const char* file, int line)
+{
+  EGE_UNUSED(assertion);
+  EGE_UNUSED(file);
+  EGE_UNUSED(line);
+
+#ifdef EGE_FEATURE_DEBUG
+  fprintf(stderr, "Assertion failed: %s, file %s, line %d\n", assertion, file, line);
+  fflush(stderr);
+  abort();
+#endif // EGE_FEATURE_DEBUG
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Debug::Print(const char* text)
+{
+  // NOTE: line is written with single call so output from different threads does not get interleaved
+  fprintf(stdout, "%s\n", text);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
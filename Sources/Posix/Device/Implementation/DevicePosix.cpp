@@ -0,0 +1,87 @@
+#include "Core/Device/Interface/Device.h"
+#include <stdio.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Path to file containing unique machine id. */
+static const char* KMachineIdFilePath = "/etc/machine-id";
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+DeviceOS Device::GetOS()
+{
+  return ELinux;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+DeviceType Device::GetDevice()
+{
+  return EDeviceGeneric;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 Device::SurfaceWidth()
+{
+  // NOTE: headless, no surface available
+  return -1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 Device::SurfaceHeight()
+{
+  // NOTE: headless, no surface available
+  return -1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 Device::AudioOutputFrequency()
+{
+  return -1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Device::Sleep(u32 ms)
+{
+  struct timespec request;
+  request.tv_sec  = ms / 1000;
+  request.tv_nsec = (ms % 1000) * 1000000L;
+
+  // NOTE: sleep is resumed with remaining time if interrupted by signal
+  while ((0 != nanosleep(&request, &request)) && (EINTR == errno))
+  {
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u64 Device::AvailableMemory()
+{
+  const long pages    = sysconf(_SC_AVPHYS_PAGES);
+  const long pageSize = sysconf(_SC_PAGESIZE);
+
+  return ((0 < pages) && (0 < pageSize)) ? static_cast<u64>(pages) * static_cast<u64>(pageSize) : 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u64 Device::TotalMemory()
+{
+  const long pages    = sysconf(_SC_PHYS_PAGES);
+  const long pageSize = sysconf(_SC_PAGESIZE);
+
+  return ((0 < pages) && (0 < pageSize)) ? static_cast<u64>(pages) * static_cast<u64>(pageSize) : 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+String Device::GetUniqueId()
+{
+  String uniqueId;
+
+  // read machine id
+  FILE* file = fopen(KMachineIdFilePath, "r");
+  if (NULL != file)
+  {
+    char buffer[64];
+    if (NULL != fgets(buffer, sizeof (buffer), file))
+    {
+      uniqueId = String(buffer).trimmed();
+    }
+
+    fclose(file);
+  }
+
+  return uniqueId;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
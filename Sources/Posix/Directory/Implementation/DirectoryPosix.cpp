@@ -0,0 +1,31 @@
+#include "EGEDirectory.h"
+#include <unistd.h>
+#include <limits.h>
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+String Directory::FromNativeSeparators(const String& path)
+{
+  // NOTE: native separator is the same as the framework one
+  return path;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+String Directory::Path(DirectoryType directory)
+{
+  EGE_UNUSED(directory);
+
+  // get current directory
+  char path[PATH_MAX];
+  if (NULL == getcwd(path, sizeof (path)))
+  {
+    // error!
+    return String();
+  }
+
+  // convert to framework layout
+  return FromNativeSeparators(String(path));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "Core/Graphics/Graphics.h"
+#include "Posix/Graphics/GraphicsPosix_p.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(GraphicsPrivate)
+EGE_DEFINE_DELETE_OPERATORS(GraphicsPrivate)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+GraphicsPrivate::GraphicsPrivate(Graphics* base) : m_d(base)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+GraphicsPrivate::~GraphicsPrivate()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult GraphicsPrivate::construct()
+{
+  // NOTE: there is no windowing system nor OpenGL support, rendering is always recorded into off-screen render window
+  return d_func()->constructHeadless();
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,38 @@
+#ifndef EGE_POSIX_POINTER_PRIVATE_H
+#define EGE_POSIX_POINTER_PRIVATE_H
+
+#include <EGE.h>
+#include <EGEEvent.h>
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class Pointer;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class PointerPrivate : public IEventListener
+{
+  public:
+
+    PointerPrivate(Pointer* base);
+   ~PointerPrivate();
+
+    EGE_DECLARE_NEW_OPERATORS
+    EGE_DECLARE_DELETE_OPERATORS
+
+    EGE_DECLARE_PUBLIC_IMPLEMENTATION(Pointer)
+
+  public:
+
+    /*! Creates object. */
+    EGEResult construct();
+
+  private:
+
+    /*! @see IEventListener::onEventRecieved. */
+    void onEventRecieved(const Event& event) override;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_POSIX_POINTER_PRIVATE_H
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "Core/Memory/MemoryManager.h"
+#include <stdlib.h>
+#include <string.h>
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void* MemoryManager::DoMalloc(size_t size)
+{
+  return malloc(size);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void* MemoryManager::DoRealloc(void* data, size_t size)
+{
+  return realloc(data, size);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void MemoryManager::DoFree(void* data)
+{
+  if (NULL != data)
+  {
+    free(data);
+  }
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void* MemoryManager::MemCpy(void* dst, const void* src, size_t size)
+{
+  return memcpy(dst, src, size);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void* MemoryManager::MemMove(void* dst, const void* src, size_t size)
+{
+  return memmove(dst, src, size);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+void* MemoryManager::MemSet(void* dst, int c, size_t size)
+{
+  return memset(dst, c, size);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 MemoryManager::MemCmp(const void* ptr1, const void* ptr2, size_t size)
+{
+  return memcmp(ptr1, ptr2, size);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include "Posix/NativeUI/MessageBoxPosix_p.h"
+#include "Core/NativeUI/MessageBox.h"
+#include <stdio.h>
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGE_DEFINE_NEW_OPERATORS(MessageBoxPrivate)
+EGE_DEFINE_DELETE_OPERATORS(MessageBoxPrivate)
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+MessageBoxPrivate::MessageBoxPrivate(MessageBox* base) : m_d(base)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+MessageBoxPrivate::~MessageBoxPrivate()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+EGEResult MessageBoxPrivate::construct()
+{
+  return EGE_SUCCESS;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s32 MessageBoxPrivate::show()
+{
+  // NOTE: headless, message is logged only and treated as dismissed right away
+  fprintf(stderr, "%ls: %ls\n", d_func()->m_title.c_str(), d_func()->m_content.c_str());
+
+  return 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,13 @@
+#include "Posix/Services/Interface/PurchaseServicesPosix.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PurchaseServicesPosix::PurchaseServicesPosix(Application* application) : PurchaseServicesNull(application)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+PurchaseServicesPosix::~PurchaseServicesPosix()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
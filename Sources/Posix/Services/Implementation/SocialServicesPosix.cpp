@@ -0,0 +1,13 @@
+#include "Posix/Services/Interface/SocialServicesPosix.h"
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+SocialServicesPosix::SocialServicesPosix(Application* application) : SocialServicesNull(application)
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+SocialServicesPosix::~SocialServicesPosix()
+{
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
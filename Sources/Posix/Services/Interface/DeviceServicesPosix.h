@@ -0,0 +1,40 @@
+#ifndef EGE_POSIX_SERVICES_DEVICESERVICES_H
+#define EGE_POSIX_SERVICES_DEVICESERVICES_H
+
+/*! POSIX implementation of Device Services.
+ */
+
+#include "EGE.h"
+#include "EGEString.h"
+#include "EGEDatabase.h"
+#include "Core/Services/Interface/DeviceServices.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class DeviceServicesPosix : public DeviceServices
+{
+  public:
+
+    DeviceServicesPosix();
+   ~DeviceServicesPosix();
+
+    /*! @see DeviceServices::openUrl. */
+    bool openUrl(const String& url) override;
+    /*! @see DeviceServices::retrieveConfidentialValue. */
+    EGEResult storeConfidentialValue(const String& name, const String& value) override;
+    EGEResult storeConfidentialValue(const String& name, const PDataBuffer value) override;
+    /*! @see DeviceServices::retrieveConfidentialValue. */
+    EGEResult retrieveConfidentialValue(const String& name, String& value) override;
+    EGEResult retrieveConfidentialValue(const String& name, PDataBuffer& value) override;
+
+  private:
+
+    /*! Confidential database. */
+    DatabaseSqlite m_database;
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_POSIX_SERVICES_DEVICESERVICES_H
\ No newline at end of file
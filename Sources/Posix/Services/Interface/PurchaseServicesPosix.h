@@ -0,0 +1,23 @@
+#ifndef EGE_POSIX_SERVICES_PURCHASESERVICES_H
+#define EGE_POSIX_SERVICES_PURCHASESERVICES_H
+
+/*! POSIX implementation for in-game purchases. 
+ */
+
+#include "Core/Services/Interface/PurchaseServicesNull.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class PurchaseServicesPosix : public PurchaseServicesNull
+{
+  public:
+    
+    PurchaseServicesPosix(Application* application);
+   ~PurchaseServicesPosix();
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_POSIX_SERVICES_PURCHASESERVICES_H
\ No newline at end of file
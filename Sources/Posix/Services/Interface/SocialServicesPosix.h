@@ -0,0 +1,24 @@
+#ifndef EGE_POSIX_SERVICES_SOCIALSERVICES_H
+#define EGE_POSIX_SERVICES_SOCIALSERVICES_H
+
+/*! POSIX implementation of social services. 
+ */
+
+#include "EGE.h"
+#include "Core/Services/Interface/SocialServicesNull.h"
+
+EGE_NAMESPACE_BEGIN
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+class SocialServicesPosix : public SocialServicesNull
+{
+  public:
+    
+    SocialServicesPosix(Application* application);
+   ~SocialServicesPosix();
+};
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
+
+#endif // EGE_POSIX_SERVICES_SOCIALSERVICES_H
\ No newline at end of file
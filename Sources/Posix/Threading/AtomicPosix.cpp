@@ -0,0 +1,34 @@
+#include "EGEAtomic.h"
+
+EGE_NAMESPACE_BEGIN
+
+// NOTE: GCC/Clang builtins are used, all of them but load act as full memory barriers
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 egeAtomicIncrement(volatile u32& value)
+{
+  return __sync_add_and_fetch(&value, 1);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 egeAtomicDecrement(volatile u32& value)
+{
+  return __sync_sub_and_fetch(&value, 1);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 egeAtomicAdd(volatile u32& value, s32 delta)
+{
+  return __sync_add_and_fetch(&value, static_cast<u32>(delta));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 egeAtomicLoad(volatile u32& value)
+{
+  return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool egeAtomicCompareAndSet(volatile u32& value, u32 compareValue, u32 newValue)
+{
+  return __sync_bool_compare_and_swap(&value, compareValue, newValue);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EGE_NAMESPACE_END
\ No newline at end of file
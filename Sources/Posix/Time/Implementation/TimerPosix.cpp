@@ -0,0 +1,35 @@
+#include "Core/Time/Interface/Timer.h"
+#include <time.h>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*! Local function returning monotonic time (in nanoseconds).
+ *  @note Monotonic clock is not affected by system time changes so it never goes backwards.
+ */
+static s64 MonotonicNanoseconds()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return static_cast<s64>(now.tv_sec) * 1000000000LL + static_cast<s64>(now.tv_nsec);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s64 Timer::GetMiliseconds()
+{
+  return MonotonicNanoseconds() / 1000000LL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+s64 Timer::GetMicroseconds()
+{
+  return MonotonicNanoseconds() / 1000LL;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool Timer::IsHighResolution()
+{
+  struct timespec resolution;
+
+  // NOTE: resolution of at least 1us is required
+  return (0 == clock_getres(CLOCK_MONOTONIC, &resolution)) && (0 == resolution.tv_sec) && (1000 >= resolution.tv_nsec);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
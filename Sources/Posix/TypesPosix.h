@@ -0,0 +1,19 @@
+#ifndef EGE_POSIX_TYPES_H
+#define EGE_POSIX_TYPES_H
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+typedef signed int          s32;            // i
+typedef unsigned int        u32;            // ui
+typedef short               s16;            // si
+typedef unsigned short      u16;            // su
+typedef char                s8;             // c
+typedef unsigned char       u8;             // by
+typedef signed int          fp16;           // fp
+typedef signed int          fp8;            // fp
+typedef long long           s64;            // li
+typedef unsigned long long  u64;            // lu
+typedef float               float32;
+typedef double              float64;
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#endif // EGE_POSIX_TYPES_H
\ No newline at end of file
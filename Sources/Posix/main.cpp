@@ -0,0 +1,44 @@
+#include "Core/Application/Application.h"
+#include <EGECommandLine.h>
+#include <EGEDictionary.h>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  EGEResult result = EGE_ERROR;
+
+  // initialize memory manager
+  if (MemoryManager::Initialize())
+  {
+    // process command line
+    CommandLineParser commandLineParser(argc, argv);
+
+    // NOTE: there is no windowing system support so application always runs headless
+    Dictionary params = commandLineParser.dictionary();
+    params[EGE_ENGINE_PARAM_HEADLESS] = "true";
+
+    // create application instance
+    Application* application = Application::CreateInstance();
+    if (NULL != application)
+    {
+      // construct application
+      result = application->construct(params);
+      if (EGE_SUCCESS == result)
+      {
+        // run application
+        result = application->run();
+      }
+    }
+
+    // clean up
+    Application::DestroyInstance(application);
+  }
+
+  // deinitialize memory manager
+  MemoryManager::Deinitialize();
+
+  return (EGE_SUCCESS == result) ? 0 : 1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -6,6 +6,11 @@ EGE_NAMESPACE
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 #define EGE_EXPECT_FLOAT_EQ(expected, actual, epsilon) TestBase::ExpectFloatEqual(expected, actual, epsilon, __FILE__, __LINE__)
+
+// NOTE: secure CRT functions are available with MSVC only
+#ifndef _MSC_VER
+  #define sprintf_s snprintf
+#endif // _MSC_VER
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 class TestBase : public ::testing::Test
 {
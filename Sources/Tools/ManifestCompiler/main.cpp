@@ -0,0 +1,47 @@
+/*! Resource manifest compiler. 
+ *  Compiles each resource definition file given on command line into binary manifest stored next to it. Meant to be run as part of build so manifests
+ *  shipped with application are always up to date with their resource definition files.
+ *  Usage: EGEManifestCompiler <resource definition file> [<resource definition file> ...]
+ */
+
+#include "EGE.h"
+#include "EGEMemory.h"
+#include "Core/Resource/ResourceManager.h"
+#include <stdio.h>
+
+EGE_NAMESPACE
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  if (2 > argc)
+  {
+    // error!
+    fprintf(stderr, "Usage: %s <resource definition file> [<resource definition file> ...]\n", argv[0]);
+    return 1;
+  }
+
+  EGEResult result = EGE_ERROR;
+
+  // initialize memory manager
+  if (MemoryManager::Initialize())
+  {
+    result = EGE_SUCCESS;
+
+    // compile all given files
+    for (int i = 1; (i < argc) && (EGE_SUCCESS == result); ++i)
+    {
+      if (EGE_SUCCESS != (result = ResourceManager::CompileManifest(argv[i])))
+      {
+        // error!
+        fprintf(stderr, "Could not compile manifest for %s\n", argv[i]);
+      }
+    }
+  }
+
+  // deinitialize memory manager
+  MemoryManager::Deinitialize();
+
+  return (EGE_SUCCESS == result) ? 0 : 1;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -29,7 +29,7 @@ class PointerPrivate : public IEventListener
   private:
 
     /*! @see IEventListener::onEventRecieved. */
-    void onEventRecieved(PEvent event) override;
+    void onEventRecieved(const Event& event) override;
 };
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
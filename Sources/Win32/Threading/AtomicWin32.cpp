@@ -1,22 +1,37 @@
 #include "EGEAtomic.h"
 #include <windows.h>
+#include <intrin.h>
 
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void egeAtomicIncrement(volatile u32& value)
+u32 egeAtomicIncrement(volatile u32& value)
 {
-  InterlockedIncrement(&value);
+  return InterlockedIncrement(&value);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void egeAtomicDecrement(volatile u32& value)
+u32 egeAtomicDecrement(volatile u32& value)
 {
-  InterlockedDecrement(&value);
+  return InterlockedDecrement(&value);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void egeAtomicCompareAndSet(volatile u32& value, u32 compareValue, u32 newValue)
+u32 egeAtomicAdd(volatile u32& value, s32 delta)
 {
-  InterlockedCompareExchangeAcquire(&value, newValue, compareValue);
+  // NOTE: InterlockedExchangeAdd returns initial value
+  return static_cast<u32>(InterlockedExchangeAdd(reinterpret_cast<volatile LONG*>(&value), delta) + delta);
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 egeAtomicLoad(volatile u32& value)
+{
+  // NOTE: aligned loads already have acquire semantics on x86/x64, only compiler is to be prevented from reordering accesses around it
+  const u32 result = value;
+  _ReadWriteBarrier();
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool egeAtomicCompareAndSet(volatile u32& value, u32 compareValue, u32 newValue)
+{
+  return compareValue == InterlockedCompareExchangeAcquire(&value, newValue, compareValue);
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -56,7 +56,7 @@ class RenderWindowOGLIOS : public RenderWindow, public IEventListener
   private:
   
     /*! @see IEventListener::onEventRecieved. */
-    void onEventRecieved(PEvent event) override;
+    void onEventRecieved(const Event& event) override;
     /*! Sets new orientation. */
     void setOrientation(DeviceOrientation orientation);
     /*! Resizes render buffers. */
@@ -185,7 +185,7 @@ EGEResult RenderWindowOGLIOS::construct(const Dictionary& params)
 //  }
 
   // register for events
-  if ( ! app()->eventManager()->addListener(this))
+  if ( ! app()->eventManager()->addListener(this, EGE_EVENT_ID_INTERNAL_ORIENTATION_CHANGED))
   {
     // error!
     return EGE_ERROR;
@@ -406,14 +406,14 @@ void RenderWindowOGLIOS::detectCapabilities()
   OGL_CHECK()
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void RenderWindowOGLIOS::onEventRecieved(PEvent event)
+void RenderWindowOGLIOS::onEventRecieved(const Event& event)
 {
   // process
-  switch (event->id())
+  switch (event.id())
   {
     case EGE_EVENT_ID_INTERNAL_ORIENTATION_CHANGED:
       
-      setOrientation(static_cast<DeviceOrientation>(ege_cast<Integer*>(event->data())->value()));
+      setOrientation(static_cast<DeviceOrientation>(event.intValue()));
       break;
       
     default:
@@ -21,7 +21,7 @@ PointerPrivate::~PointerPrivate()
 EGEResult PointerPrivate::construct()
 {
   // subscribe for notifications
-  if ( ! d_func()->app()->eventManager()->addListener(this))
+  if ( ! d_func()->app()->eventManager()->addListener(this, EGE_EVENT_ID_INTERNAL_POINTER_DATA))
   {
     // error!
     return EGE_ERROR;
@@ -30,7 +30,7 @@ EGEResult PointerPrivate::construct()
   return EGE_SUCCESS;
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void PointerPrivate::onEventRecieved(PEvent event)
+void PointerPrivate::onEventRecieved(const Event& event)
 {
   // check if quitting already
   if (d_func()->app()->isQuitting())
@@ -39,12 +39,12 @@ void PointerPrivate::onEventRecieved(PEvent event)
     return;
   }
   
-  switch (event->id())
+  switch (event.id())
   {
     case EGE_EVENT_ID_INTERNAL_POINTER_DATA:
       
       // emit signal
-      emit d_func()->eventSignal(event->data());
+      emit d_func()->eventSignal(event.data());
       break;
   }
 }
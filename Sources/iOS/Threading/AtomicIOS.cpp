@@ -4,19 +4,32 @@
 EGE_NAMESPACE_BEGIN
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void egeAtomicIncrement(volatile u32& value)
+u32 egeAtomicIncrement(volatile u32& value)
 {
-  OSAtomicIncrement32Barrier(reinterpret_cast<volatile int32_t*>(&value));
+  return static_cast<u32>(OSAtomicIncrement32Barrier(reinterpret_cast<volatile int32_t*>(&value)));
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void egeAtomicDecrement(volatile u32& value)
+u32 egeAtomicDecrement(volatile u32& value)
 {
-  OSAtomicDecrement32Barrier(reinterpret_cast<volatile int32_t*>(&value));
+  return static_cast<u32>(OSAtomicDecrement32Barrier(reinterpret_cast<volatile int32_t*>(&value)));
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-void egeAtomicCompareAndSet(volatile u32& value, u32 compareValue, u32 newValue)
+u32 egeAtomicAdd(volatile u32& value, s32 delta)
 {
-  OSAtomicCompareAndSwap32Barrier(compareValue, newValue, reinterpret_cast<volatile int32_t*>(&value));
+  return static_cast<u32>(OSAtomicAdd32Barrier(delta, reinterpret_cast<volatile int32_t*>(&value)));
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+u32 egeAtomicLoad(volatile u32& value)
+{
+  // NOTE: barrier after the load prevents subsequent accesses from being performed before it
+  const u32 result = value;
+  OSMemoryBarrier();
+  return result;
+}
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool egeAtomicCompareAndSet(volatile u32& value, u32 compareValue, u32 newValue)
+{
+  return OSAtomicCompareAndSwap32Barrier(compareValue, newValue, reinterpret_cast<volatile int32_t*>(&value));
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -62,7 +62,7 @@ bool FontsTest::initialize()
     return false;
   }
 
-  app()->eventManager()->addListener(this);
+  app()->eventManager()->addListener(this, EGE_EVENT_ID_CORE_LANGUAGE_CHANGED);
 
   return true;
 }
@@ -73,9 +73,9 @@ void FontsTest::update(const Time& time)
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 /*! IEventListener override. Event reciever. */
-void FontsTest::onEventRecieved(PEvent event)
+void FontsTest::onEventRecieved(const Event& event)
 {
-  if (EGE_EVENT_ID_CORE_LANGUAGE_CHANGED == event->uid())
+  if (EGE_EVENT_ID_CORE_LANGUAGE_CHANGED == event.id())
   {
     updateTexts();
   }
@@ -23,7 +23,7 @@ class FontsTest : public Test, public EGE::IEventListener
   private:
 
     /* IEventListener override. Event reciever. */
-    void onEventRecieved(EGE::PEvent event) override;
+    void onEventRecieved(const EGE::Event& event) override;
     /* Updates texts. */
     void updateTexts();
     /* Test override. Slot called when resource group has been loaded. */
@@ -13,7 +13,7 @@ EGE_NAMESPACE
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 LocalizationTest::LocalizationTest(App* app) : Test(app)
 {
-  app->eventManager()->addListener(this);
+  app->eventManager()->addListener(this, EGE_EVENT_ID_CORE_LANGUAGE_CHANGED);
 
   PResourceFont fontResource = app->resourceManager()->resource(RESOURCE_NAME_FONT, "debug-font");
   if (fontResource)
@@ -113,9 +113,9 @@ void LocalizationTest::pointerEvent(PPointerData data)
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------
 /*! IEventListener override. Event reciever. */
-void LocalizationTest::onEventRecieved(PEvent event)
+void LocalizationTest::onEventRecieved(const Event& event)
 {
-  if (EGE_EVENT_ID_CORE_LANGUAGE_CHANGED == event->uid())
+  if (EGE_EVENT_ID_CORE_LANGUAGE_CHANGED == event.id())
   {
     updateTexts();
   }
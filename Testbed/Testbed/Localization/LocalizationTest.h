@@ -25,7 +25,7 @@ class LocalizationTest : public Test, public EGE::IEventListener
     /* Test override. Pointer event receiver. */
     void pointerEvent(EGE::PPointerData data) override;
     /* IEventListener override. Event reciever. */
-    void onEventRecieved(EGE::PEvent event) override;
+    void onEventRecieved(const EGE::Event& event) override;
     /* Updates texts. */
     void updateTexts();
 };